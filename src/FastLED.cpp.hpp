@@ -10,6 +10,7 @@
 #include "fl/channels/channel_events.h"
 #include "fl/channels/manager.h"
 #include "fl/system/trace.h"
+#include "fl/system/frame_telemetry.h"
 #include "fl/channels/driver.h"  // for IChannelDriver
 #include "fl/channels/detail/wait_spin_budget.h"  // for tiered-wait spin-budget setters (#2818)
 #include "fl/system/delay.h"  // for delayMicroseconds
@@ -286,12 +287,19 @@ static void throttleToMaxRefreshRate(fl::u32 minMicros) FL_NO_EXCEPT {
 
 FL_KEEP_ALIVE void CFastLED::show(fl::u8 scale) {
 	FL_SCOPED_TRACE;
+#if FASTLED_FRAME_TELEMETRY
+	fl::FrameTelemetry::instance().beginFrame(fl::micros());
+#endif
 	onBeginFrame();
-	throttleToMaxRefreshRate(mNMinMicros);
+	{
+		FL_FRAME_STAGE(THROTTLE);
+		throttleToMaxRefreshRate(mNMinMicros);
+	}
 	lastshow = fl::micros();
 
 	// If we have a function for computing power, use it!
 	if(mPPowerFunc) {
+		FL_FRAME_STAGE(POWER);
 		scale = (*mPPowerFunc)(scale, mNPowerData);
 	}
 
@@ -331,6 +339,9 @@ FL_KEEP_ALIVE void CFastLED::show(fl::u8 scale) {
 	countFPS();
 	onEndFrame();
 	onEndShowLeds();
+#if FASTLED_FRAME_TELEMETRY
+	fl::FrameTelemetry::instance().endFrame(fl::micros());
+#endif
 }
 
 void CFastLED::onEndFrame() {
@@ -360,12 +371,19 @@ CLEDController & CFastLED::operator[](int x) {
 }
 
 void CFastLED::showColor(const CRGB & color, fl::u8 scale) {
+#if FASTLED_FRAME_TELEMETRY
+	fl::FrameTelemetry::instance().beginFrame(fl::micros());
+#endif
 	onBeginFrame();
-	throttleToMaxRefreshRate(mNMinMicros);
+	{
+		FL_FRAME_STAGE(THROTTLE);
+		throttleToMaxRefreshRate(mNMinMicros);
+	}
 	lastshow = fl::micros();
 
 	// If we have a function for computing power, use it!
 	if(mPPowerFunc) {
+		FL_FRAME_STAGE(POWER);
 		scale = (*mPPowerFunc)(scale, mNPowerData);
 	}
 
@@ -402,6 +420,9 @@ void CFastLED::showColor(const CRGB & color, fl::u8 scale) {
 	countFPS();
 	onEndFrame();
 	onEndShowLeds();
+#if FASTLED_FRAME_TELEMETRY
+	fl::FrameTelemetry::instance().endFrame(fl::micros());
+#endif
 }
 
 void CFastLED::clear(bool writeData) {
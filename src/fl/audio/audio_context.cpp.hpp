@@ -32,9 +32,99 @@ Context::Context(const Sample& sample)
 
 Context::~Context() FL_NO_EXCEPT = default;
 
+void Context::reserveFFTArena(span<const int> bandCounts) {
+    mArena.clear();
+    mArena.reserve(bandCounts.size());
+    for (int bands : bandCounts) {
+        if (bands <= 0) {
+            continue;
+        }
+        ArenaSlot slot;
+        slot.bins = fl::make_shared<fft::Bins>(bands);
+        mArena.push_back(fl::move(slot));
+    }
+    mArenaFirst = -1;
+}
+
+void Context::releaseFFTArena() {
+    mArena.clear();
+    mArenaFirst = -1;
+}
+
+int Context::arenaFind(const fft::Args& args) {
+    for (fl::size i = 0; i < mArena.size(); i++) {
+        ArenaSlot& slot = mArena[i];
+        if (slot.bound && slot.args == args) {
+            if (slot.frame == mArenaFrame) {
+                mArenaStats.hits++;
+                return static_cast<int>(i);
+            }
+            break;  // Bound to these args but stale: recompute below.
+        }
+    }
+
+    // Prefer the slot already bound to these args, then any slot of the
+    // right size that was idle for the whole previous frame.
+    int pick = -1;
+    for (fl::size i = 0; i < mArena.size(); i++) {
+        ArenaSlot& slot = mArena[i];
+        if (static_cast<int>(slot.bins->bands()) != args.bands) {
+            continue;
+        }
+        if (slot.bound && slot.args == args) {
+            pick = static_cast<int>(i);
+            break;
+        }
+        const bool idle = !slot.bound || slot.frame + 1 < mArenaFrame;
+        if (idle && pick < 0) {
+            pick = static_cast<int>(i);
+        }
+    }
+    if (pick < 0) {
+        mArenaStats.exhausted++;
+        return -1;
+    }
+
+    ArenaSlot& slot = mArena[pick];
+    slot.args = args;
+    slot.bound = true;
+    slot.frame = mArenaFrame;
+    slot.bins->clear();  // Vectors keep capacity — zero allocs
+    mFFT.run(mSample.pcm(), slot.bins.get(), args);
+    mArenaStats.computed++;
+    if (mArenaFirst < 0) {
+        mArenaFirst = pick;
+    }
+    return pick;
+}
+
+const fft::Bins* Context::peekFFT(int bands, float fmin, float fmax, fft::Mode mode, fft::Window window) {
+    fft::Args args(mSample.size(), bands, fmin, fmax, mSampleRate, mode, window);
+    if (!mArena.empty()) {
+        const int slot = arenaFind(args);
+        if (slot >= 0) {
+            return mArena[slot].bins.get();
+        }
+    }
+    // The cache co-owns the result until the next setSample().
+    return cachedFFT(args).get();
+}
+
 shared_ptr<const fft::Bins> Context::getFFT(int bands, float fmin, float fmax, fft::Mode mode, fft::Window window) {
     fft::Args args(mSample.size(), bands, fmin, fmax, mSampleRate, mode, window);
 
+    if (!mArena.empty()) {
+        const int slot = arenaFind(args);
+        if (slot >= 0) {
+            return mArena[slot].bins;
+        }
+    }
+    return cachedFFT(args);
+}
+
+shared_ptr<const fft::Bins> Context::cachedFFT(const fft::Args& args) {
+    const int bands = args.bands;
+
     // O(1) cache lookup using hash map
     fl::size argsHash = hashFFTArgs(args);
     auto it = mFFTCacheMap.find(argsHash);
@@ -70,6 +160,8 @@ shared_ptr<const fft::Bins> Context::getFFT(int bands, float fmin, float fmax, f
         // Remove the oldest entry's hash from hash map
         fl::size oldHash = hashFFTArgs(mFFTCache[0].args);
         mFFTCacheMap.erase(oldHash);
+        // peekFFT() callers may still point at it until setSample().
+        mEvicted.push_back(fl::move(mFFTCache[0].bins));
 
         // Shift all remaining entries and update map indices
         for (size i = 1; i < mFFTCache.size(); i++) {
@@ -108,6 +200,11 @@ shared_ptr<const fft::Bins> Context::getFFT16(fft::Mode mode, fft::Window window
                   fft::Args::DefaultMaxFrequency(), mode, window);
 }
 
+const fft::Bins* Context::peekFFT16(fft::Mode mode, fft::Window window) {
+    return peekFFT(16, fft::Args::DefaultMinFrequency(),
+                   fft::Args::DefaultMaxFrequency(), mode, window);
+}
+
 void Context::setFFTHistoryDepth(int depth) {
     if (mFFTHistoryDepth != depth) {
         mFFTHistory.clear();
@@ -130,9 +227,15 @@ const fft::Bins* Context::getHistoricalFFT(int framesBack) const {
 }
 
 void Context::setSample(const Sample& sample) {
-    // Save current fft::FFT to history (use first cached entry if available)
-    if (!mFFTCache.empty() && mFFTHistoryDepth > 0) {
-        const shared_ptr<fft::Bins>& first = mFFTCache[0].bins;
+    // Save current fft::FFT to history (use the first FFT computed this
+    // frame: an arena slot, else the first cached entry)
+    const fft::Bins* first = nullptr;
+    if (mArenaFirst >= 0) {
+        first = mArena[mArenaFirst].bins.get();
+    } else if (!mFFTCache.empty()) {
+        first = mFFTCache[0].bins.get();
+    }
+    if (mFFTHistoryDepth > 0) {
         if (first) {
             if (static_cast<int>(mFFTHistory.size()) < mFFTHistoryDepth) {
                 mFFTHistory.push_back(*first);
@@ -153,10 +256,18 @@ void Context::setSample(const Sample& sample) {
             mRecyclePool.push_back(fl::move(mFFTCache[i].bins));
         }
     }
+    for (size i = 0; i < mEvicted.size(); i++) {
+        if (mEvicted[i].use_count() == 1) {
+            mRecyclePool.push_back(fl::move(mEvicted[i]));
+        }
+    }
+    mEvicted.clear();
 
     mSample = sample;
     // Clear per-frame fft::FFT cache (new sample = new data)
     mFFTCache.clear();
+    mArenaFrame++;
+    mArenaFirst = -1;
     // Reset silence flag — pipeline must re-populate after NFT update this frame.
     mIsSilent = false;
 }
@@ -165,6 +276,11 @@ void Context::clearCache() {
     mFFTCache.clear();
     mFFTCacheMap.clear();
     mRecyclePool.clear();
+    mEvicted.clear();
+    for (ArenaSlot& slot : mArena) {
+        slot.bound = false;
+    }
+    mArenaFirst = -1;
     mFFTHistory.clear();
     mFFTHistoryDepth = 0;
     mFFTHistoryIndex = 0;
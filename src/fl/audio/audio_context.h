@@ -37,7 +37,19 @@ public:
         fft::Mode mode = fft::Mode::AUTO,
         fft::Window window = fft::Window::BLACKMAN_HARRIS
     ) FL_NO_EXCEPT;
-    bool hasFFT() const FL_NO_EXCEPT { return !mFFTCache.empty(); }
+    bool hasFFT() const FL_NO_EXCEPT { return !mFFTCache.empty() || mArenaFirst >= 0; }
+
+    // Same lookup as getFFT() but returns a plain pointer, valid until the
+    // next setSample() (bins evicted from the heap cache are kept alive
+    // until then). With an arena reserved this touches neither the heap nor
+    // a reference count. The built-in detectors fetch their spectra this way.
+    const fft::Bins* peekFFT(
+        int bands = 16,
+        float fmin = fft::Args::DefaultMinFrequency(),
+        float fmax = fft::Args::DefaultMaxFrequency(),
+        fft::Mode mode = fft::Mode::AUTO,
+        fft::Window window = fft::Window::BLACKMAN_HARRIS
+    ) FL_NO_EXCEPT;
 
     // 3-band energy from 3 linear bins (20-11025 Hz).
     // bass: 20-3688 Hz, mid: 3688-7356 Hz, treb: 7356-11025 Hz.
@@ -47,6 +59,30 @@ public:
     // Detectors that need 16 bins should use this to share a single cached fft::FFT.
     shared_ptr<const fft::Bins> getFFT16(fft::Mode mode = fft::Mode::LOG_REBIN,
                                        fft::Window window = fft::Window::BLACKMAN_HARRIS) FL_NO_EXCEPT;
+    const fft::Bins* peekFFT16(fft::Mode mode = fft::Mode::LOG_REBIN,
+                               fft::Window window = fft::Window::BLACKMAN_HARRIS) FL_NO_EXCEPT;
+
+    // ----- Preallocated fft::FFT arena -----
+    // Reserves one fft::Bins slot per entry of `bandCounts`, allocated here
+    // and never again. A slot binds to the first fft::Args with its band
+    // count and is recomputed in place once per sample, so steady-state
+    // getFFT()/peekFFT() do no heap work. A slot left unused for a whole
+    // frame may rebind to other args. Requests no free slot can serve
+    // count as `exhausted` and fall back to the heap-backed cache.
+    //
+    // Slots are overwritten by the next sample's fft::FFT: bins returned
+    // by getFFT() must not be read across setSample() (detectors re-fetch
+    // each update(), so this holds for the built-in ones).
+    struct FFTArenaStats {
+        u32 computed = 0;   // fft::FFT runs into an arena slot
+        u32 hits = 0;       // repeat requests served from a slot this frame
+        u32 exhausted = 0;  // requests with no free slot (heap fallback)
+    };
+    void reserveFFTArena(span<const int> bandCounts) FL_NO_EXCEPT;
+    void releaseFFTArena() FL_NO_EXCEPT;
+    bool hasFFTArena() const FL_NO_EXCEPT { return !mArena.empty(); }
+    const FFTArenaStats& getFFTArenaStats() const FL_NO_EXCEPT { return mArenaStats; }
+    void resetFFTArenaStats() FL_NO_EXCEPT { mArenaStats = FFTArenaStats(); }
 
     // ----- fft::FFT History (for temporal analysis) -----
     void setFFTHistoryDepth(int depth) FL_NO_EXCEPT;
@@ -80,15 +116,33 @@ private:
         shared_ptr<fft::Bins> bins;
     };
 
+    struct ArenaSlot {
+        fft::Args args;
+        shared_ptr<fft::Bins> bins;
+        u32 frame = 0;       // mArenaFrame of the last computation
+        bool bound = false;  // args is valid
+    };
+
     // Create cache key hash from fft::Args for O(1) lookup
     static fl::size hashFFTArgs(const fft::Args& args) FL_NO_EXCEPT;
 
+    // Returns the arena slot serving `args` (computing it if this frame has
+    // not yet), or -1 when every matching slot is taken.
+    int arenaFind(const fft::Args& args) FL_NO_EXCEPT;
+    // Per-frame heap cache behind getFFT() when the arena has no slot.
+    shared_ptr<const fft::Bins> cachedFFT(const fft::Args& args);
+
     int mSampleRate = 44100;
     Sample mSample;
     fft::FFT mFFT; // fft::FFT engine (has its own kernel cache)
     vector<FFTCacheEntry> mFFTCache; // Strong cache: co-owned with callers
     flat_map<fl::size, int> mFFTCacheMap; // Maps args hash to index in mFFTCache
     vector<shared_ptr<fft::Bins>> mRecyclePool; // Recycled bins for zero-alloc reuse
+    vector<shared_ptr<fft::Bins>> mEvicted; // Evicted this frame; alive for peekFFT()
+    vector<ArenaSlot> mArena;  // Preallocated slots (reserveFFTArena)
+    u32 mArenaFrame = 1;       // Bumped by setSample()
+    int mArenaFirst = -1;      // First slot computed this frame (for history)
+    FFTArenaStats mArenaStats;
     vector<fft::Bins> mFFTHistory;
     int mFFTHistoryDepth = 0;
     int mFFTHistoryIndex = 0;
@@ -1,11 +1,24 @@
 #pragma once
+#include "fl/stl/int.h"
 #include "fl/stl/noexcept.h"
+#include "fl/stl/shared_ptr.h"
+#include "fl/stl/vector.h"
 
 namespace fl {
 namespace audio {
 
 class Context;
 
+// Context inputs a detector reads during update(). Processor's scheduler
+// uses the union over the detectors it runs each frame for its stats; the
+// Context itself stays lazy, so unused inputs are never computed.
+enum DetectorInput : u8 {
+    kDetectorInputPcm = 1 << 0,
+    kDetectorInputRms = 1 << 1,
+    kDetectorInputFFT = 1 << 2,
+    kDetectorInputFFTHistory = 1 << 3,
+};
+
 class Detector {
 public:
     virtual ~Detector() FL_NO_EXCEPT = default;
@@ -17,6 +30,38 @@ public:
     virtual bool needsFFTHistory() const FL_NO_EXCEPT { return false; }
     virtual const char* getName() const FL_NO_EXCEPT = 0;
     virtual void reset() FL_NO_EXCEPT {}
+
+    // ----- Scheduling declarations (read by Processor) -----
+
+    // Bitmask of DetectorInput. Defaults to what needsFFT()/needsFFTHistory()
+    // already say; override when a detector reads less than that.
+    virtual u8 inputs() const FL_NO_EXCEPT {
+        u8 mask = kDetectorInputPcm | kDetectorInputRms;
+        if (needsFFT()) {
+            mask |= kDetectorInputFFT;
+        }
+        if (needsFFTHistory()) {
+            mask |= kDetectorInputFFTHistory;
+        }
+        return mask;
+    }
+
+    // Shared detectors whose state this one reads in update() without
+    // updating them itself. Processor runs these first, and runs them on
+    // every frame this detector runs.
+    virtual void getDependencies(fl::vector<Detector*>& out) const FL_NO_EXCEPT {
+        (void)out;
+    }
+
+    // Run every N audio frames (1 = every frame). Processor can override
+    // this per detector via setDetectorUpdateInterval().
+    virtual u8 defaultUpdateInterval() const FL_NO_EXCEPT { return 1; }
+
+private:
+    friend class Processor;
+    // Index of this detector's Processor schedule slot, so per-frame getters
+    // find it without a scan. -1 while unscheduled.
+    int mScheduleSlot = -1;
 };
 
 } // namespace audio
@@ -21,6 +21,8 @@
 #include "fl/audio/detector/drop.h"
 #include "fl/audio/detector/equalizer.h"
 #include "fl/audio/detector/vibe.h"
+#include "fl/log/log.h"
+#include "fl/stl/cstring.h"
 #include "fl/stl/noexcept.h"
 
 namespace fl {
@@ -31,7 +33,189 @@ Processor::Processor()
 {}
 
 void Processor::registerDetector(shared_ptr<Detector> detector) {
-    mActiveDetectors.push_back(detector);
+    DetectorSlot slot;
+    slot.interval = detector->defaultUpdateInterval();
+    for (const auto& o : mIntervalOverrides) {
+        if (fl::strcmp(o.name.c_str(), detector->getName()) == 0) {
+            slot.interval = o.frames;
+        }
+    }
+    if (slot.interval == 0) {
+        slot.interval = 1;
+    }
+    slot.lastPollFrame = mFrame;
+    slot.detector = detector;
+    detector->mScheduleSlot = static_cast<int>(mSlots.size());
+    mSlots.push_back(slot);
+    mOrderDirty = true;
+}
+
+int Processor::findSlot(const Detector* detector) const {
+    if (!detector) {
+        return -1;
+    }
+    const int slot = detector->mScheduleSlot;
+    if (slot < 0 || static_cast<fl::size>(slot) >= mSlots.size() ||
+        mSlots[slot].detector.get() != detector) {
+        return -1;  // Not scheduled by this processor.
+    }
+    return slot;
+}
+
+void Processor::notePoll(const Detector* detector) {
+    int slot = findSlot(detector);
+    if (slot >= 0) {
+        mSlots[slot].lastPollFrame = mFrame;
+    }
+}
+
+void Processor::rebuildSchedule() {
+    // Resolve declared dependencies to slot indices, then order with a
+    // stable Kahn sort so independent detectors keep registration order.
+    const fl::size n = mSlots.size();
+    vector<Detector*> deps;
+    vector<u16> pending(n, 0);
+    for (fl::size i = 0; i < n; ++i) {
+        DetectorSlot& slot = mSlots[i];
+        slot.deps.clear();
+        deps.clear();
+        slot.detector->getDependencies(deps);
+        for (Detector* dep : deps) {
+            int j = findSlot(dep);
+            if (j >= 0 && static_cast<fl::size>(j) != i) {
+                slot.deps.push_back(static_cast<u16>(j));
+            }
+        }
+        pending[i] = static_cast<u16>(slot.deps.size());
+    }
+
+    // Spread detectors that share an interval across its frames (the 1st,
+    // 2nd, ... detector with interval 4 runs on frames 0, 1, ... mod 4), so
+    // slow analyzers do not all land on the same audio frame.
+    for (fl::size i = 0; i < n; ++i) {
+        u8 earlier = 0;
+        for (fl::size k = 0; k < i; ++k) {
+            if (mSlots[k].interval == mSlots[i].interval) {
+                ++earlier;
+            }
+        }
+        mSlots[i].phase = static_cast<u8>(earlier % mSlots[i].interval);
+    }
+
+    mOrder.clear();
+    vector<bool> placed(n, false);
+    bool progress = true;
+    while (mOrder.size() < n && progress) {
+        progress = false;
+        for (fl::size i = 0; i < n; ++i) {
+            if (placed[i] || pending[i] != 0) {
+                continue;
+            }
+            placed[i] = true;
+            mOrder.push_back(static_cast<u16>(i));
+            progress = true;
+            for (fl::size k = 0; k < n; ++k) {
+                for (u16 d : mSlots[k].deps) {
+                    if (d == i) {
+                        --pending[k];
+                    }
+                }
+            }
+        }
+    }
+    if (mOrder.size() < n) {
+        FL_WARN_F("audio::Processor: detector dependency cycle, running "
+                  "remaining detectors in registration order");
+        for (fl::size i = 0; i < n; ++i) {
+            if (!placed[i]) {
+                mOrder.push_back(static_cast<u16>(i));
+            }
+        }
+    }
+    mOrderDirty = false;
+}
+
+void Processor::runDetectors(const shared_ptr<Context>& context) {
+    if (mOrderDirty) {
+        rebuildSchedule();
+    }
+
+    // Pass 1 (dependents first): decide who runs. A detector runs when
+    // something consumes it (callbacks, or a recent poll) and its interval
+    // is up; anything it depends on is then forced to run this frame too.
+    for (fl::size k = mOrder.size(); k-- > 0;) {
+        DetectorSlot& slot = mSlots[mOrder[k]];
+        if (!slot.due) {
+            const bool wanted = slot.subscribed || mPollTimeoutFrames == 0 ||
+                                (mFrame - slot.lastPollFrame) < mPollTimeoutFrames;
+            if (!wanted) {
+                ++mScheduleStats.skippedIdle;
+                continue;
+            }
+            if ((mFrame + slot.interval - slot.phase) % slot.interval != 0) {
+                ++mScheduleStats.skippedInterval;
+                continue;
+            }
+            slot.due = true;
+        }
+        for (u16 d : slot.deps) {
+            mSlots[d].due = true;
+        }
+    }
+
+    // Pass 2: compute state, dependencies first
+    u8 inputs = 0;
+    for (u16 i : mOrder) {
+        DetectorSlot& slot = mSlots[i];
+        if (slot.due) {
+            slot.detector->update(context);
+            inputs |= slot.detector->inputs();
+            ++mScheduleStats.detectorRuns;
+        }
+    }
+
+    // Pass 3: fire callbacks for the detectors that ran
+    for (u16 i : mOrder) {
+        DetectorSlot& slot = mSlots[i];
+        if (slot.due) {
+            slot.due = false;
+            slot.detector->fireCallbacks();
+        }
+    }
+
+    mScheduleStats.lastInputs = inputs;
+    ++mScheduleStats.frames;
+    ++mFrame;
+}
+
+void Processor::setDetectorUpdateInterval(const char* name, u8 frames) {
+    if (frames == 0) {
+        frames = 1;
+    }
+    for (auto& slot : mSlots) {
+        if (fl::strcmp(slot.detector->getName(), name) == 0) {
+            slot.interval = frames;
+            mOrderDirty = true;  // Reassign phases.
+        }
+    }
+    for (auto& o : mIntervalOverrides) {
+        if (o.name == name) {
+            o.frames = frames;
+            return;
+        }
+    }
+    mIntervalOverrides.push_back(IntervalOverride{fl::string(name), frames});
+}
+
+fl::vector<const char*> Processor::getSchedule() {
+    if (mOrderDirty) {
+        rebuildSchedule();
+    }
+    fl::vector<const char*> names;
+    for (u16 i : mOrder) {
+        names.push_back(mSlots[i].detector->getName());
+    }
+    return names;
 }
 
 Processor::~Processor() FL_NO_EXCEPT = default;
@@ -73,245 +257,233 @@ void Processor::update(const Sample& sample) {
         mContext->setSilent(conditioned.rms() < kSilenceRmsThreshold);
     }
 
-    // Phase 1: Compute state for all active detector
-    for (auto& d : mActiveDetectors) {
-        d->update(mContext);
-    }
-
-    // Phase 2: Fire callbacks for all active detector
-    for (auto& d : mActiveDetectors) {
-        d->fireCallbacks();
-    }
+    // Compute state, then fire callbacks, for the detectors scheduled this frame
+    runDetectors(mContext);
 }
 
 void Processor::updateFromContext(shared_ptr<Context> externalContext) {
     // Use externally-provided context (FFT already cached, signal already conditioned).
     // This avoids recomputing FFT when Reactive has already done it.
-    for (auto& d : mActiveDetectors) {
-        d->update(externalContext);
-    }
-    for (auto& d : mActiveDetectors) {
-        d->fireCallbacks();
-    }
+    runDetectors(externalContext);
 }
 
 void Processor::onBeat(function<void()> callback) {
-    auto detector = getBeatDetector();
+    auto detector = subscribe(getBeatDetector());
     detector->onBeat.add(callback);
 }
 
 void Processor::onBeatPhase(function<void(float)> callback) {
-    auto detector = getBeatDetector();
+    auto detector = subscribe(getBeatDetector());
     detector->onBeatPhase.add(callback);
 }
 
 void Processor::onOnset(function<void(float)> callback) {
-    auto detector = getBeatDetector();
+    auto detector = subscribe(getBeatDetector());
     detector->onOnset.add(callback);
 }
 
 void Processor::onTempoChange(function<void(float, float)> callback) {
-    auto detector = getBeatDetector();
+    auto detector = subscribe(getBeatDetector());
     detector->onTempoChange.add(callback);
 }
 
 void Processor::onTempo(function<void(float)> callback) {
-    auto detector = getTempoAnalyzer();
+    auto detector = subscribe(getTempoAnalyzer());
     detector->onTempo.add(callback);
 }
 
 void Processor::onTempoWithConfidence(function<void(float, float)> callback) {
-    auto detector = getTempoAnalyzer();
+    auto detector = subscribe(getTempoAnalyzer());
     detector->onTempoWithConfidence.add(callback);
 }
 
 void Processor::onTempoStable(function<void()> callback) {
-    auto detector = getTempoAnalyzer();
+    auto detector = subscribe(getTempoAnalyzer());
     detector->onTempoStable.add(callback);
 }
 
 void Processor::onTempoUnstable(function<void()> callback) {
-    auto detector = getTempoAnalyzer();
+    auto detector = subscribe(getTempoAnalyzer());
     detector->onTempoUnstable.add(callback);
 }
 
 void Processor::onBass(function<void(float)> callback) {
-    auto detector = getFrequencyBands();
+    auto detector = subscribe(getFrequencyBands());
     detector->onBassLevel.add(callback);
 }
 
 void Processor::onMid(function<void(float)> callback) {
-    auto detector = getFrequencyBands();
+    auto detector = subscribe(getFrequencyBands());
     detector->onMidLevel.add(callback);
 }
 
 void Processor::onTreble(function<void(float)> callback) {
-    auto detector = getFrequencyBands();
+    auto detector = subscribe(getFrequencyBands());
     detector->onTrebleLevel.add(callback);
 }
 
 void Processor::onFrequencyBands(function<void(float, float, float)> callback) {
-    auto detector = getFrequencyBands();
+    auto detector = subscribe(getFrequencyBands());
     detector->onLevelsUpdate.add(callback);
 }
 
 void Processor::onEqualizer(function<void(const detector::Equalizer&)> callback) {
-    auto detector = getEqualizerDetector();
+    auto detector = subscribe(getEqualizerDetector());
     detector->onEqualizer.add(callback);
 }
 
 void Processor::onEnergy(function<void(float)> callback) {
-    auto detector = getEnergyAnalyzer();
+    auto detector = subscribe(getEnergyAnalyzer());
     detector->onEnergy.add(callback);
 }
 
 void Processor::onNormalizedEnergy(function<void(float)> callback) {
-    auto detector = getEnergyAnalyzer();
+    auto detector = subscribe(getEnergyAnalyzer());
     detector->onNormalizedEnergy.add(callback);
 }
 
 void Processor::onPeak(function<void(float)> callback) {
-    auto detector = getEnergyAnalyzer();
+    auto detector = subscribe(getEnergyAnalyzer());
     detector->onPeak.add(callback);
 }
 
 void Processor::onAverageEnergy(function<void(float)> callback) {
-    auto detector = getEnergyAnalyzer();
+    auto detector = subscribe(getEnergyAnalyzer());
     detector->onAverageEnergy.add(callback);
 }
 
 void Processor::onTransient(function<void()> callback) {
-    auto detector = getTransientDetector();
+    auto detector = subscribe(getTransientDetector());
     detector->onTransient.add(callback);
 }
 
 void Processor::onTransientWithStrength(function<void(float)> callback) {
-    auto detector = getTransientDetector();
+    auto detector = subscribe(getTransientDetector());
     detector->onTransientWithStrength.add(callback);
 }
 
 void Processor::onAttack(function<void(float)> callback) {
-    auto detector = getTransientDetector();
+    auto detector = subscribe(getTransientDetector());
     detector->onAttack.add(callback);
 }
 
 void Processor::onSilence(function<void(u8)> callback) {
-    auto detector = getSilenceDetector();
+    auto detector = subscribe(getSilenceDetector());
     detector->onSilence.add(callback);
 }
 
 void Processor::onSilenceStart(function<void()> callback) {
-    auto detector = getSilenceDetector();
+    auto detector = subscribe(getSilenceDetector());
     detector->onSilenceStart.add(callback);
 }
 
 void Processor::onSilenceEnd(function<void()> callback) {
-    auto detector = getSilenceDetector();
+    auto detector = subscribe(getSilenceDetector());
     detector->onSilenceEnd.add(callback);
 }
 
 void Processor::onSilenceDuration(function<void(u32)> callback) {
-    auto detector = getSilenceDetector();
+    auto detector = subscribe(getSilenceDetector());
     detector->onSilenceDuration.add(callback);
 }
 
 void Processor::onCrescendo(function<void()> callback) {
-    auto detector = getDynamicsAnalyzer();
+    auto detector = subscribe(getDynamicsAnalyzer());
     detector->onCrescendo.add(callback);
 }
 
 void Processor::onDiminuendo(function<void()> callback) {
-    auto detector = getDynamicsAnalyzer();
+    auto detector = subscribe(getDynamicsAnalyzer());
     detector->onDiminuendo.add(callback);
 }
 
 void Processor::onDynamicTrend(function<void(float)> callback) {
-    auto detector = getDynamicsAnalyzer();
+    auto detector = subscribe(getDynamicsAnalyzer());
     detector->onDynamicTrend.add(callback);
 }
 
 void Processor::onCompressionRatio(function<void(float)> callback) {
-    auto detector = getDynamicsAnalyzer();
+    auto detector = subscribe(getDynamicsAnalyzer());
     detector->onCompressionRatio.add(callback);
 }
 
 void Processor::onPitch(function<void(float)> callback) {
-    auto detector = getPitchDetector();
+    auto detector = subscribe(getPitchDetector());
     detector->onPitch.add(callback);
 }
 
 void Processor::onPitchWithConfidence(function<void(float, float)> callback) {
-    auto detector = getPitchDetector();
+    auto detector = subscribe(getPitchDetector());
     detector->onPitchWithConfidence.add(callback);
 }
 
 void Processor::onPitchChange(function<void(float)> callback) {
-    auto detector = getPitchDetector();
+    auto detector = subscribe(getPitchDetector());
     detector->onPitchChange.add(callback);
 }
 
 void Processor::onVoiced(function<void(u8)> callback) {
-    auto detector = getPitchDetector();
+    auto detector = subscribe(getPitchDetector());
     detector->onVoiced.add(callback);
 }
 
 void Processor::onNoteOn(function<void(u8, u8)> callback) {
-    auto detector = getNoteDetector();
+    auto detector = subscribe(getNoteDetector());
     detector->onNoteOn.add(callback);
 }
 
 void Processor::onNoteOff(function<void(u8)> callback) {
-    auto detector = getNoteDetector();
+    auto detector = subscribe(getNoteDetector());
     detector->onNoteOff.add(callback);
 }
 
 void Processor::onNoteChange(function<void(u8, u8)> callback) {
-    auto detector = getNoteDetector();
+    auto detector = subscribe(getNoteDetector());
     detector->onNoteChange.add(callback);
 }
 
 void Processor::onDownbeat(function<void()> callback) {
-    auto detector = getDownbeatDetector();
+    auto detector = subscribe(getDownbeatDetector());
     detector->onDownbeat.add(callback);
 }
 
 void Processor::onMeasureBeat(function<void(u8)> callback) {
-    auto detector = getDownbeatDetector();
+    auto detector = subscribe(getDownbeatDetector());
     detector->onMeasureBeat.add(callback);
 }
 
 void Processor::onMeterChange(function<void(u8)> callback) {
-    auto detector = getDownbeatDetector();
+    auto detector = subscribe(getDownbeatDetector());
     detector->onMeterChange.add(callback);
 }
 
 void Processor::onMeasurePhase(function<void(float)> callback) {
-    auto detector = getDownbeatDetector();
+    auto detector = subscribe(getDownbeatDetector());
     detector->onMeasurePhase.add(callback);
 }
 
 void Processor::onBackbeat(function<void(u8 beatNumber, float confidence, float strength)> callback) {
-    auto detector = getBackbeatDetector();
+    auto detector = subscribe(getBackbeatDetector());
     detector->onBackbeat.add(callback);
 }
 
 void Processor::onVocal(function<void(u8)> callback) {
-    auto detector = getVocalDetector();
+    auto detector = subscribe(getVocalDetector());
     detector->onVocal.add(callback);
 }
 
 void Processor::onVocalStart(function<void()> callback) {
-    auto detector = getVocalDetector();
+    auto detector = subscribe(getVocalDetector());
     detector->onVocalStart.add(callback);
 }
 
 void Processor::onVocalEnd(function<void()> callback) {
-    auto detector = getVocalDetector();
+    auto detector = subscribe(getVocalDetector());
     detector->onVocalEnd.add(callback);
 }
 
 void Processor::onVocalConfidence(function<void(float)> callback) {
-    auto detector = getVocalDetector();
+    auto detector = subscribe(getVocalDetector());
     // This callback fires every frame with the current confidence
     // We need to wrap it since detector::Vocal doesn't have this callback built-in
     detector->onVocal.add([callback, detector](u8) {
@@ -322,132 +494,132 @@ void Processor::onVocalConfidence(function<void(float)> callback) {
 }
 
 void Processor::onPercussion(function<void(detector::PercussionType)> callback) {
-    auto detector = getPercussionDetector();
+    auto detector = subscribe(getPercussionDetector());
     detector->onPercussionHit.add(callback);
 }
 
 void Processor::onKick(function<void()> callback) {
-    auto detector = getPercussionDetector();
+    auto detector = subscribe(getPercussionDetector());
     detector->onKick.add(callback);
 }
 
 void Processor::onSnare(function<void()> callback) {
-    auto detector = getPercussionDetector();
+    auto detector = subscribe(getPercussionDetector());
     detector->onSnare.add(callback);
 }
 
 void Processor::onHiHat(function<void()> callback) {
-    auto detector = getPercussionDetector();
+    auto detector = subscribe(getPercussionDetector());
     detector->onHiHat.add(callback);
 }
 
 void Processor::onTom(function<void()> callback) {
-    auto detector = getPercussionDetector();
+    auto detector = subscribe(getPercussionDetector());
     detector->onTom.add(callback);
 }
 
 void Processor::onChord(function<void(const detector::Chord&)> callback) {
-    auto detector = getChordDetector();
+    auto detector = subscribe(getChordDetector());
     detector->onChord.add(callback);
 }
 
 void Processor::onChordChange(function<void(const detector::Chord&)> callback) {
-    auto detector = getChordDetector();
+    auto detector = subscribe(getChordDetector());
     detector->onChordChange.add(callback);
 }
 
 void Processor::onChordEnd(function<void()> callback) {
-    auto detector = getChordDetector();
+    auto detector = subscribe(getChordDetector());
     detector->onChordEnd.add(callback);
 }
 
 void Processor::onKey(function<void(const detector::Key&)> callback) {
-    auto detector = getKeyDetector();
+    auto detector = subscribe(getKeyDetector());
     detector->onKey.add(callback);
 }
 
 void Processor::onKeyChange(function<void(const detector::Key&)> callback) {
-    auto detector = getKeyDetector();
+    auto detector = subscribe(getKeyDetector());
     detector->onKeyChange.add(callback);
 }
 
 void Processor::onKeyEnd(function<void()> callback) {
-    auto detector = getKeyDetector();
+    auto detector = subscribe(getKeyDetector());
     detector->onKeyEnd.add(callback);
 }
 
 void Processor::onMood(function<void(const detector::Mood&)> callback) {
-    auto detector = getMoodAnalyzer();
+    auto detector = subscribe(getMoodAnalyzer());
     detector->onMood.add(callback);
 }
 
 void Processor::onMoodChange(function<void(const detector::Mood&)> callback) {
-    auto detector = getMoodAnalyzer();
+    auto detector = subscribe(getMoodAnalyzer());
     detector->onMoodChange.add(callback);
 }
 
 void Processor::onValenceArousal(function<void(float, float)> callback) {
-    auto detector = getMoodAnalyzer();
+    auto detector = subscribe(getMoodAnalyzer());
     detector->onValenceArousal.add(callback);
 }
 
 void Processor::onBuildupStart(function<void()> callback) {
-    auto detector = getBuildupDetector();
+    auto detector = subscribe(getBuildupDetector());
     detector->onBuildupStart.add(callback);
 }
 
 void Processor::onBuildupProgress(function<void(float)> callback) {
-    auto detector = getBuildupDetector();
+    auto detector = subscribe(getBuildupDetector());
     detector->onBuildupProgress.add(callback);
 }
 
 void Processor::onBuildupPeak(function<void()> callback) {
-    auto detector = getBuildupDetector();
+    auto detector = subscribe(getBuildupDetector());
     detector->onBuildupPeak.add(callback);
 }
 
 void Processor::onBuildupEnd(function<void()> callback) {
-    auto detector = getBuildupDetector();
+    auto detector = subscribe(getBuildupDetector());
     detector->onBuildupEnd.add(callback);
 }
 
 void Processor::onBuildup(function<void(const detector::Buildup&)> callback) {
-    auto detector = getBuildupDetector();
+    auto detector = subscribe(getBuildupDetector());
     detector->onBuildup.add(callback);
 }
 
 void Processor::onDrop(function<void()> callback) {
-    auto detector = getDropDetector();
+    auto detector = subscribe(getDropDetector());
     detector->onDrop.add(callback);
 }
 
 void Processor::onDropEvent(function<void(const detector::Drop&)> callback) {
-    auto detector = getDropDetector();
+    auto detector = subscribe(getDropDetector());
     detector->onDropEvent.add(callback);
 }
 
 void Processor::onDropImpact(function<void(float)> callback) {
-    auto detector = getDropDetector();
+    auto detector = subscribe(getDropDetector());
     detector->onDropImpact.add(callback);
 }
 
 void Processor::onVibeLevels(function<void(const detector::VibeLevels&)> callback) {
-    auto detector = getVibeDetector();
+    auto detector = subscribe(getVibeDetector());
     detector->onVibeLevels.add(callback);
 }
 
 void Processor::onVibeBassSpike(function<void()> callback) {
-    auto detector = getVibeDetector();
+    auto detector = subscribe(getVibeDetector());
     detector->onBassSpike.add(callback);
 }
 
 void Processor::onVibeMidSpike(function<void()> callback) {
-    auto detector = getVibeDetector();
+    auto detector = subscribe(getVibeDetector());
     detector->onMidSpike.add(callback);
 }
 
 void Processor::onVibeTrebSpike(function<void()> callback) {
-    auto detector = getVibeDetector();
+    auto detector = subscribe(getVibeDetector());
     detector->onTrebSpike.add(callback);
 }
 
@@ -724,8 +896,8 @@ void Processor::setSampleRate(int sampleRate) {
     mContext->setSampleRate(sampleRate);
 
     // Propagate to all active detector that are sample-rate-aware
-    for (auto& d : mActiveDetectors) {
-        d->setSampleRate(sampleRate);
+    for (auto& slot : mSlots) {
+        slot.detector->setSampleRate(sampleRate);
     }
 }
 
@@ -779,10 +951,15 @@ void Processor::reset() {
     mNoiseFloorTracker.reset();
     mContext->clearCache();
 
-    for (auto& d : mActiveDetectors) {
-        d->reset();
+    for (auto& slot : mSlots) {
+        slot.detector->reset();
+        slot.detector->mScheduleSlot = -1;
     }
-    mActiveDetectors.clear();
+    mSlots.clear();
+    mOrder.clear();
+    mOrderDirty = false;
+    mFrame = 0;
+    mScheduleStats = ScheduleStats();
 
     // Null out all typed pointers so re-registration works on next use
     mBeatDetector.reset();
@@ -812,6 +989,7 @@ shared_ptr<detector::Beat> Processor::getBeatDetector() {
         mBeatDetector = make_shared<detector::Beat>();
         registerDetector(mBeatDetector);
     }
+    notePoll(mBeatDetector.get());
     return mBeatDetector;
 }
 
@@ -820,6 +998,7 @@ shared_ptr<detector::FrequencyBands> Processor::getFrequencyBands() {
         mFrequencyBands = make_shared<detector::FrequencyBands>();
         registerDetector(mFrequencyBands);
     }
+    notePoll(mFrequencyBands.get());
     return mFrequencyBands;
 }
 
@@ -828,6 +1007,7 @@ shared_ptr<detector::EnergyAnalyzer> Processor::getEnergyAnalyzer() {
         mEnergyAnalyzer = make_shared<detector::EnergyAnalyzer>();
         registerDetector(mEnergyAnalyzer);
     }
+    notePoll(mEnergyAnalyzer.get());
     return mEnergyAnalyzer;
 }
 
@@ -836,6 +1016,7 @@ shared_ptr<detector::TempoAnalyzer> Processor::getTempoAnalyzer() {
         mTempoAnalyzer = make_shared<detector::TempoAnalyzer>();
         registerDetector(mTempoAnalyzer);
     }
+    notePoll(mTempoAnalyzer.get());
     return mTempoAnalyzer;
 }
 
@@ -844,6 +1025,7 @@ shared_ptr<detector::Transient> Processor::getTransientDetector() {
         mTransientDetector = make_shared<detector::Transient>();
         registerDetector(mTransientDetector);
     }
+    notePoll(mTransientDetector.get());
     return mTransientDetector;
 }
 
@@ -852,6 +1034,7 @@ shared_ptr<detector::Silence> Processor::getSilenceDetector() {
         mSilenceDetector = make_shared<detector::Silence>();
         registerDetector(mSilenceDetector);
     }
+    notePoll(mSilenceDetector.get());
     return mSilenceDetector;
 }
 
@@ -860,6 +1043,7 @@ shared_ptr<detector::DynamicsAnalyzer> Processor::getDynamicsAnalyzer() {
         mDynamicsAnalyzer = make_shared<detector::DynamicsAnalyzer>();
         registerDetector(mDynamicsAnalyzer);
     }
+    notePoll(mDynamicsAnalyzer.get());
     return mDynamicsAnalyzer;
 }
 
@@ -868,6 +1052,7 @@ shared_ptr<detector::Pitch> Processor::getPitchDetector() {
         mPitchDetector = make_shared<detector::Pitch>();
         registerDetector(mPitchDetector);
     }
+    notePoll(mPitchDetector.get());
     return mPitchDetector;
 }
 
@@ -878,6 +1063,7 @@ shared_ptr<detector::Note> Processor::getNoteDetector() {
         mNoteDetector = make_shared<detector::Note>(pitchDetector);
         registerDetector(mNoteDetector);
     }
+    notePoll(mNoteDetector.get());
     return mNoteDetector;
 }
 
@@ -888,6 +1074,7 @@ shared_ptr<detector::Downbeat> Processor::getDownbeatDetector() {
         mDownbeatDetector = make_shared<detector::Downbeat>(beatDetector);
         registerDetector(mDownbeatDetector);
     }
+    notePoll(mDownbeatDetector.get());
     return mDownbeatDetector;
 }
 
@@ -899,6 +1086,7 @@ shared_ptr<detector::Backbeat> Processor::getBackbeatDetector() {
         mBackbeatDetector = make_shared<detector::Backbeat>(beatDetector, downbeatDetector);
         registerDetector(mBackbeatDetector);
     }
+    notePoll(mBackbeatDetector.get());
     return mBackbeatDetector;
 }
 
@@ -907,6 +1095,7 @@ shared_ptr<detector::Vocal> Processor::getVocalDetector() {
         mVocalDetector = make_shared<detector::Vocal>();
         registerDetector(mVocalDetector);
     }
+    notePoll(mVocalDetector.get());
     return mVocalDetector;
 }
 
@@ -915,6 +1104,7 @@ shared_ptr<detector::Percussion> Processor::getPercussionDetector() {
         mPercussionDetector = make_shared<detector::Percussion>();
         registerDetector(mPercussionDetector);
     }
+    notePoll(mPercussionDetector.get());
     return mPercussionDetector;
 }
 
@@ -923,6 +1113,7 @@ shared_ptr<detector::ChordDetector> Processor::getChordDetector() {
         mChordDetector = make_shared<detector::ChordDetector>();
         registerDetector(mChordDetector);
     }
+    notePoll(mChordDetector.get());
     return mChordDetector;
 }
 
@@ -931,6 +1122,7 @@ shared_ptr<detector::KeyDetector> Processor::getKeyDetector() {
         mKeyDetector = make_shared<detector::KeyDetector>();
         registerDetector(mKeyDetector);
     }
+    notePoll(mKeyDetector.get());
     return mKeyDetector;
 }
 
@@ -939,6 +1131,7 @@ shared_ptr<detector::MoodAnalyzer> Processor::getMoodAnalyzer() {
         mMoodAnalyzer = make_shared<detector::MoodAnalyzer>();
         registerDetector(mMoodAnalyzer);
     }
+    notePoll(mMoodAnalyzer.get());
     return mMoodAnalyzer;
 }
 
@@ -947,6 +1140,7 @@ shared_ptr<detector::BuildupDetector> Processor::getBuildupDetector() {
         mBuildupDetector = make_shared<detector::BuildupDetector>();
         registerDetector(mBuildupDetector);
     }
+    notePoll(mBuildupDetector.get());
     return mBuildupDetector;
 }
 
@@ -955,6 +1149,7 @@ shared_ptr<detector::DropDetector> Processor::getDropDetector() {
         mDropDetector = make_shared<detector::DropDetector>();
         registerDetector(mDropDetector);
     }
+    notePoll(mDropDetector.get());
     return mDropDetector;
 }
 
@@ -966,6 +1161,7 @@ shared_ptr<detector::EqualizerDetector> Processor::getEqualizerDetector() {
         }
         registerDetector(mEqualizerDetector);
     }
+    notePoll(mEqualizerDetector.get());
     return mEqualizerDetector;
 }
 
@@ -974,6 +1170,7 @@ shared_ptr<detector::Vibe> Processor::getVibeDetector() {
         mVibeDetector = make_shared<detector::Vibe>();
         registerDetector(mVibeDetector);
     }
+    notePoll(mVibeDetector.get());
     return mVibeDetector;
 }
 
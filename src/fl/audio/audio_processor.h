@@ -12,6 +12,7 @@
 #include "fl/audio/noise_floor_tracker.h"
 #include "fl/stl/shared_ptr.h"
 #include "fl/stl/function.h"  // IWYU pragma: keep
+#include "fl/stl/string.h"
 #include "fl/stl/vector.h"
 #include "fl/task/task.h"
 #include "fl/stl/noexcept.h"
@@ -323,6 +324,38 @@ public:
     const SignalConditioner::Stats& getSignalConditionerStats() const FL_NO_EXCEPT { return mSignalConditioner.getStats(); }
     const NoiseFloorTracker::Stats& getNoiseFloorStats() const FL_NO_EXCEPT { return mNoiseFloorTracker.getStats(); }
 
+    // ----- Detector Scheduling -----
+    // Detectors run in dependency order (Detector::getDependencies()), each
+    // on its own cadence. A detector with no callbacks is kept running by
+    // its polling getters; see setPollTimeoutFrames().
+    struct ScheduleStats {
+        u32 frames = 0;           ///< update()/updateFromContext() calls
+        u32 detectorRuns = 0;     ///< Detector::update() calls
+        u32 skippedIdle = 0;      ///< skipped: no callbacks, not polled recently
+        u32 skippedInterval = 0;  ///< skipped: between update-interval ticks
+        u8 lastInputs = 0;        ///< DetectorInput union of last frame's runs
+    };
+
+    /// Run the detector named `name` (Detector::getName()) every `frames`
+    /// audio frames instead of its defaultUpdateInterval(). Applies now if
+    /// the detector exists, otherwise when it is first created.
+    /// "KeyDetector" and "MoodAnalyzer" default to every 8th frame.
+    /// Callbacks fire only on frames where the detector ran.
+    void setDetectorUpdateInterval(const char* name, u8 frames) FL_NO_EXCEPT;
+
+    /// Idle callback-less detectors that have not been polled through a
+    /// getter for `frames` frames; the next poll returns the last state and
+    /// resumes updates. History-based detectors (beat, tempo) lose
+    /// continuity across an idle gap. 0 (the default) keeps every polled
+    /// detector running.
+    void setPollTimeoutFrames(u32 frames) FL_NO_EXCEPT { mPollTimeoutFrames = frames; }
+
+    const ScheduleStats& getScheduleStats() const FL_NO_EXCEPT { return mScheduleStats; }
+    void resetScheduleStats() FL_NO_EXCEPT { mScheduleStats = ScheduleStats(); }
+
+    /// Detector names in execution order (dependencies first).
+    fl::vector<const char*> getSchedule() FL_NO_EXCEPT;
+
     // ----- State Access -----
     shared_ptr<Context> getContext() const FL_NO_EXCEPT { return mContext; }
     const Sample& getSample() const FL_NO_EXCEPT;
@@ -338,9 +371,42 @@ private:
     NoiseFloorTracker mNoiseFloorTracker;
     shared_ptr<Context> mContext;
 
-    // Active detector registry for two-phase update loop
-    vector<shared_ptr<Detector>> mActiveDetectors;
+    // Active detector registry for the scheduled two-phase update loop
+    struct DetectorSlot {
+        shared_ptr<Detector> detector;
+        vector<u16> deps;        // slot indices this detector reads
+        u8 interval = 1;
+        u8 phase = 0;            // staggers detectors sharing an interval
+        bool subscribed = false; // has at least one callback
+        bool due = false;        // scratch: runs this frame
+        u32 lastPollFrame = 0;
+    };
+    struct IntervalOverride {
+        fl::string name;
+        u8 frames;
+    };
+    vector<DetectorSlot> mSlots;   // registration order
+    vector<u16> mOrder;            // topological order over mSlots
+    bool mOrderDirty = false;
+    u32 mFrame = 0;
+    u32 mPollTimeoutFrames = 0;
+    ScheduleStats mScheduleStats;
+    vector<IntervalOverride> mIntervalOverrides;
+
     void registerDetector(shared_ptr<Detector> detector) FL_NO_EXCEPT;
+    void runDetectors(const shared_ptr<Context>& context) FL_NO_EXCEPT;
+    void rebuildSchedule() FL_NO_EXCEPT;
+    int findSlot(const Detector* detector) const FL_NO_EXCEPT;
+    void notePoll(const Detector* detector) FL_NO_EXCEPT;
+    // Marks the detector as having callbacks; returns it for chaining.
+    template <typename T>
+    shared_ptr<T> subscribe(shared_ptr<T> detector) FL_NO_EXCEPT {
+        int slot = findSlot(detector.get());
+        if (slot >= 0) {
+            mSlots[slot].subscribed = true;
+        }
+        return detector;
+    }
 
     // Lazy detector storage
     shared_ptr<detector::Beat> mBeatDetector;
@@ -77,8 +77,7 @@ void Backbeat::update(shared_ptr<Context> context) {
     // Process beat if detected
     if (beatDetected) {
         // Get fft::FFT for multi-band analysis
-        mRetainedFFT = context->getFFT16();
-        const fft::Bins& fft = *mRetainedFFT;
+        const fft::Bins& fft = *context->peekFFT16();
 
         // Calculate multi-band accent
         MultibandAccent accent = calculateMultibandAccent(fft);
@@ -129,6 +128,15 @@ void Backbeat::fireCallbacks() {
     }
 }
 
+void Backbeat::getDependencies(fl::vector<Detector*>& out) const {
+    if (!mOwnsBeatDetector && mBeatDetector) {
+        out.push_back(mBeatDetector.get());
+    }
+    if (!mOwnsDownbeatDetector && mDownbeatDetector) {
+        out.push_back(mDownbeatDetector.get());
+    }
+}
+
 void Backbeat::reset() {
     mBackbeatDetected = false;
     mLastBackbeatNumber = 0;
@@ -149,8 +157,6 @@ void Backbeat::reset() {
         mBackbeatSpectralProfile[i] = 0.0f;
     }
 
-    mRetainedFFT.reset();
-
     if (mOwnsBeatDetector && mBeatDetector) {
         mBeatDetector->reset();
     }
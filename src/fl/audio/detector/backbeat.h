@@ -67,6 +67,7 @@ public:
     bool needsFFT() const override { return true; }
     bool needsFFTHistory() const override { return false; }
     const char* getName() const override { return "Backbeat"; }
+    void getDependencies(fl::vector<Detector*>& out) const override;
     void reset() override;
 
     // ----- Callbacks (multiple listeners supported) -----
@@ -160,8 +161,6 @@ private:
     static constexpr size SPECTRAL_PROFILE_SIZE = 16;
     float mProfileAlpha;  // EMA smoothing factor for profile updates
 
-    shared_ptr<const fft::Bins> mRetainedFFT;
-
     // ----- Helper Methods -----
     void updateBeatDetector(shared_ptr<Context> context);
     void updateBeatPosition();
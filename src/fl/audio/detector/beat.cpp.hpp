@@ -32,10 +32,9 @@ void Beat::update(shared_ptr<Context> context) {
     // (which include built-in Hamming windowing), while being faster
     // than CQ_OCTAVE. The 16-bin / 30-14080Hz range has N_window=1,
     // which is borderline for CQ_NAIVE but acceptable for beat detection.
-    mRetainedFFT = context->getFFT(16, 30.0f,
-                                   fft::Args::DefaultMaxFrequency(),
-                                   fft::Mode::CQ_NAIVE);
-    const fft::Bins& fft = *mRetainedFFT;
+    const fft::Bins& fft = *context->peekFFT(16, 30.0f,
+                                             fft::Args::DefaultMaxFrequency(),
+                                             fft::Mode::CQ_NAIVE);
     u32 timestamp = context->getTimestamp();
 
     // Calculate spectral flux
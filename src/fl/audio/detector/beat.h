@@ -62,8 +62,6 @@ private:
     MovingAverage<float, 43> mFluxAvg;
     static constexpr size FLUX_HISTORY_SIZE = 43;  // ~1 second at 43fps
 
-    shared_ptr<const fft::Bins> mRetainedFFT;
-
     float calculateSpectralFlux(const fft::Bins& fft);
     void updateAdaptiveThreshold();
     bool detectBeat(u32 timestamp);
@@ -43,8 +43,7 @@ void BuildupDetector::update(shared_ptr<Context> context) {
         return;
     }
 
-    mRetainedFFT = context->getFFT(32);
-    const fft::Bins& fft = *mRetainedFFT;
+    const fft::Bins& fft = *context->peekFFT(32);
     float rms = context->getRMS();
     float treble = getTrebleEnergy(fft);
     u32 timestamp = context->getTimestamp();
@@ -59,8 +59,7 @@ void ChordDetector::initializeTemplateMap() {
 }
 
 void ChordDetector::update(shared_ptr<Context> context) {
-    mRetainedFFT = context->getFFT(32);  // Higher resolution for pitch detection
-    const fft::Bins& fft = *mRetainedFFT;
+    const fft::Bins& fft = *context->peekFFT(32);  // Higher resolution for pitch detection
     u32 timestamp = context->getTimestamp();
 
     // Calculate chroma features
@@ -93,8 +93,6 @@ private:
     // Maps ChordType (as int) to ChordTemplate pointer for fast template lookups
     flat_map<int, const ChordTemplate*> mTemplateMap;
 
-    shared_ptr<const fft::Bins> mRetainedFFT;
-
     // Detection methods
     void initializeTemplateMap();  // Pre-compute template lookups
     void calculateChroma(const fft::Bins& fft);
@@ -51,8 +51,7 @@ void Downbeat::update(shared_ptr<Context> context) {
     // If beat detected, analyze for downbeat
     if (beatDetected) {
         // Get fft::FFT for accent analysis
-        mRetainedFFT = context->getFFT16();
-        const fft::Bins& fft = *mRetainedFFT;
+        const fft::Bins& fft = *context->peekFFT16();
 
         // Calculate current energy (bass-weighted for accent detection)
         float bassEnergy = 0.0f;
@@ -136,6 +135,12 @@ void Downbeat::fireCallbacks() {
     }
 }
 
+void Downbeat::getDependencies(fl::vector<Detector*>& out) const {
+    if (!mOwnsBeatDetector && mBeatDetector) {
+        out.push_back(mBeatDetector.get());
+    }
+}
+
 void Downbeat::reset() {
     mDownbeatDetected = false;
     mCurrentBeat = 1;
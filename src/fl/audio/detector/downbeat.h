@@ -49,6 +49,7 @@ public:
     bool needsFFT() const override { return true; }
     bool needsFFTHistory() const override { return false; }
     const char* getName() const override { return "Downbeat"; }
+    void getDependencies(fl::vector<Detector*>& out) const override;
     void reset() override;
 
     // ----- Callbacks (multiple listeners supported) -----
@@ -138,8 +139,6 @@ private:
     bool mFireMeterChange = false;
     u8 mPendingMeter = 0;
 
-    shared_ptr<const fft::Bins> mRetainedFFT;
-
     // ----- Helper Methods -----
     void updateBeatDetector(shared_ptr<Context> context);
     float calculateBeatAccent(const fft::Bins& fft, float bassEnergy);
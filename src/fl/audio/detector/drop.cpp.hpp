@@ -33,8 +33,7 @@ void DropDetector::update(shared_ptr<Context> context) {
         return;
     }
 
-    mRetainedFFT = context->getFFT(32);
-    const fft::Bins& fft = *mRetainedFFT;
+    const fft::Bins& fft = *context->peekFFT(32);
     float rms = context->getRMS();
     u32 timestamp = context->getTimestamp();
 
@@ -99,8 +99,6 @@ private:
     float mBassThreshold;           // Minimum bass energy ratio
     float mEnergyFluxThreshold;     // Minimum energy increase ratio
 
-    shared_ptr<const fft::Bins> mRetainedFFT;
-
     // Analysis methods
     float getBassEnergy(const fft::Bins& fft) const;
     float getMidEnergy(const fft::Bins& fft) const;
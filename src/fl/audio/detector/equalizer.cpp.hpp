@@ -137,9 +137,9 @@ void EqualizerDetector::update(shared_ptr<Context> context) {
     const float dt = computeAudioDt(pcm.size(), mSampleRate);
 
     // Use Context's cached fft::FFT (shared across detector)
-    mRetainedFFT = context->getFFT(kNumBins, mConfig.minFreq, mConfig.maxFreq);
-    if (!mRetainedFFT) return;
-    const fft::Bins& fftBins = *mRetainedFFT;
+    const fft::Bins* bins = context->peekFFT(kNumBins, mConfig.minFreq, mConfig.maxFreq);
+    if (!bins) return;
+    const fft::Bins& fftBins = *bins;
 
     const auto& raw = fftBins.raw();
     const int numBins = fl::min(static_cast<int>(raw.size()), kNumBins);
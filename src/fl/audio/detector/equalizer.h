@@ -160,9 +160,6 @@ private:
     // Compute log-spaced bin center frequencies from current config
     void computeBinCenters(float* out) const;
 
-    // Cached FFT from Context (shared across detector)
-    shared_ptr<const fft::Bins> mRetainedFFT;
-
     // FFT windowing correction factor (WLED-MM FFT_DOWNSCALE = 0.40)
     static constexpr float kFFTDownscale = 0.40f;
 };
@@ -51,8 +51,7 @@ void FrequencyBands::update(shared_ptr<Context> context) {
     mSampleRate = context->getSampleRate();
 
     // Use shared master fft::FFT via context (downsampled to our config)
-    mRetainedFFT = context->getFFT(kNumBands, kFFTMinFreq, kFFTMaxFreq);
-    const fft::Bins& fftBins = *mRetainedFFT;
+    const fft::Bins& fftBins = *context->peekFFT(kNumBands, kFFTMinFreq, kFFTMaxFreq);
     sFrequencyBandsFFTCount++;  // Diagnostic counter (no private fft::FFT anymore)
 
     span<const i16> pcm = context->getPCM();
@@ -80,9 +80,6 @@ private:
     float mMidNorm = 0.0f;
     float mTrebleNorm = 0.0f;
 
-    // Retained FFT from context (keeps shared_ptr alive during update)
-    shared_ptr<const fft::Bins> mRetainedFFT;
-
     float calculateBandEnergy(const fft::Bins& fft, float minFreq, float maxFreq,
                               float fftMinFreq, float fftMaxFreq);
 };
@@ -117,8 +117,7 @@ void KeyDetector::initializeProfileStats() {
 
 void KeyDetector::update(shared_ptr<Context> context) {
     // Get fft::FFT data
-    mRetainedFFT = context->getFFT(32);  // Use more bins for better pitch resolution
-    const fft::Bins& fft = *mRetainedFFT;
+    const fft::Bins& fft = *context->peekFFT(32);  // Use more bins for better pitch resolution
     u32 timestamp = context->getTimestamp();
 
     // Extract chroma features
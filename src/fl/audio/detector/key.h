@@ -88,6 +88,9 @@ public:
     void fireCallbacks() override;
     bool needsFFT() const override { return true; }
     const char* getName() const override { return "KeyDetector"; }
+    // Slow-moving: runs every 8th audio frame unless overridden with
+    // Processor::setDetectorUpdateInterval().
+    u8 defaultUpdateInterval() const FL_NO_EXCEPT override { return 8; }
     void reset() override;
 
     // Event callbacks (multiple listeners supported)
@@ -131,8 +134,6 @@ private:
     float mMinorProfileMean = 0.0f;
     float mMinorProfileStdDev = 0.0f;
 
-    shared_ptr<const fft::Bins> mRetainedFFT;
-
     // Helper methods
     void initializeProfileStats();  // Pre-compute profile statistics once
     void extractChroma(const fft::Bins& fft, float* chroma);
@@ -28,8 +28,7 @@ MoodAnalyzer::MoodAnalyzer()
 MoodAnalyzer::~MoodAnalyzer() FL_NO_EXCEPT = default;
 
 void MoodAnalyzer::update(shared_ptr<Context> context) {
-    mRetainedFFT = context->getFFT(32);  // Higher resolution for mood analysis
-    const fft::Bins& fft = *mRetainedFFT;
+    const fft::Bins& fft = *context->peekFFT(32);  // Higher resolution for mood analysis
     const fft::Bins* prevFFT = context->getHistoricalFFT(1);
 
     // Extract audio features
@@ -72,6 +72,9 @@ public:
     bool needsFFT() const override { return true; }
     bool needsFFTHistory() const override { return true; }
     const char* getName() const override { return "MoodAnalyzer"; }
+    // Slow-moving: runs every 8th audio frame unless overridden with
+    // Processor::setDetectorUpdateInterval().
+    u8 defaultUpdateInterval() const FL_NO_EXCEPT override { return 8; }
     void reset() override;
 
     // Event callbacks (multiple listeners supported)
@@ -110,8 +113,6 @@ private:
     fl::vector<float> mArousalHistory;
     int mHistoryIndex;
 
-    shared_ptr<const fft::Bins> mRetainedFFT;
-
     // Analysis methods
     float calculateSpectralCentroid(const fft::Bins& fft);
     float calculateSpectralRolloff(const fft::Bins& fft, float threshold = 0.85f);
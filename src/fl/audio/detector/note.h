@@ -39,6 +39,11 @@ public:
     void fireCallbacks() override;
     bool needsFFT() const override { return false; }  // Uses pitch detection
     const char* getName() const override { return "Note"; }
+    void getDependencies(fl::vector<Detector*>& out) const override {
+        if (!mOwnsPitchDetector && mPitchDetector) {
+            out.push_back(mPitchDetector.get());
+        }
+    }
     void reset() override;
 
     // Callbacks (multiple listeners supported)
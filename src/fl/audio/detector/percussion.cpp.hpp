@@ -40,8 +40,7 @@ Percussion::Percussion()
 Percussion::~Percussion() FL_NO_EXCEPT = default;
 
 void Percussion::update(shared_ptr<Context> context) {
-    mRetainedFFT = context->getFFT16(fft::Mode::CQ_NAIVE);
-    const fft::Bins& fft = *mRetainedFFT;
+    const fft::Bins& fft = *context->peekFFT16(fft::Mode::CQ_NAIVE);
     u32 timestamp = context->getTimestamp();
 
     // Step 0: Get zero-crossing factor from raw audio sample
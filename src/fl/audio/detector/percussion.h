@@ -102,8 +102,6 @@ private:
     u32 mLastHiHatTime;
     u32 mLastTomTime;
 
-    shared_ptr<const fft::Bins> mRetainedFFT;
-
     static constexpr u32 KICK_COOLDOWN_MS = 100;
     static constexpr u32 SNARE_COOLDOWN_MS = 80;
     static constexpr u32 HIHAT_COOLDOWN_MS = 50;
@@ -35,8 +35,7 @@ TempoAnalyzer::TempoAnalyzer()
 TempoAnalyzer::~TempoAnalyzer() FL_NO_EXCEPT = default;
 
 void TempoAnalyzer::update(shared_ptr<Context> context) {
-    mRetainedFFT = context->getFFT16();
-    const fft::Bins& fft = *mRetainedFFT;
+    const fft::Bins& fft = *context->peekFFT16();
     u32 timestamp = context->getTimestamp();
 
     // Calculate spectral flux for onset detection
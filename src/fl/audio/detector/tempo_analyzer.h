@@ -90,8 +90,6 @@ private:
     static constexpr u32 MIN_BEAT_INTERVAL_MS = 250;  // Max 240 BPM
     static constexpr u32 MAX_BEAT_INTERVAL_MS = 2000; // Min 30 BPM
 
-    shared_ptr<const fft::Bins> mRetainedFFT;
-
     // Silence gate for confidence. Decays confidence (not BPM) toward 0 with
     // tau ~2s during silence; the BPM estimate itself is preserved so that
     // when audio returns, beat sync resumes from the same tempo. Musical tempo
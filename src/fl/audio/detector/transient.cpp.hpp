@@ -25,8 +25,7 @@ Transient::Transient()
 Transient::~Transient() FL_NO_EXCEPT = default;
 
 void Transient::update(shared_ptr<Context> context) {
-    mRetainedFFT = context->getFFT16();
-    const fft::Bins& fft = *mRetainedFFT;
+    const fft::Bins& fft = *context->peekFFT16();
     u32 timestamp = context->getTimestamp();
 
     // Calculate high-frequency energy (transients have strong high-freq components)
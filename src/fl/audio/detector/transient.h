@@ -65,8 +65,6 @@ private:
     // Adaptive outlier rejection for energy before history
     HampelFilter<float, 7> mEnergyOutlierFilter{2.5f};
 
-    shared_ptr<const fft::Bins> mRetainedFFT;
-
     float calculateHighFreqEnergy(const fft::Bins& fft);
     float calculateEnergyFlux(float currentEnergy);
     bool detectTransient(float flux, u32 timestamp);
@@ -30,10 +30,8 @@ void Vocal::update(shared_ptr<Context> context) {
     // F1/F2/F3 formants (94% bin utilization vs 73% with full-range).
     // Broad FFT: 16 LOG_REBIN bins in 174.6-4698.3 Hz — full spectral
     // coverage for flatness, density, flux, and vocal presence ratio.
-    mRetainedFormantFFT = context->getFFT(64, 200.0f, 3500.0f);
-    mRetainedBroadFFT = context->getFFT(16, 174.6f, 4698.3f);
-    const fft::Bins& formantFft = *mRetainedFormantFFT;
-    const fft::Bins& broadFft = *mRetainedBroadFFT;
+    const fft::Bins& formantFft = *context->peekFFT(64, 200.0f, 3500.0f);
+    const fft::Bins& broadFft = *context->peekFFT(16, 174.6f, 4698.3f);
     mFormantNumBins = static_cast<int>(formantFft.raw().size());
     mBroadNumBins = static_cast<int>(broadFft.raw().size());
 
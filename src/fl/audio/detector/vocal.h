@@ -80,9 +80,6 @@ private:
     int mFormantF1MinBin = 0, mFormantF1MaxBin = 0;
     int mFormantF2MinBin = 0, mFormantF2MaxBin = 0;
 
-    shared_ptr<const fft::Bins> mRetainedFormantFFT;  // 64 bins, 200-3500 Hz
-    shared_ptr<const fft::Bins> mRetainedBroadFFT;    // 16 bins, 174.6-4698.3 Hz
-
     // Formant ratio from high-res narrow FFT (64 bins, 200-3500 Hz)
     void computeFormantRatio(const fft::Bins& formantFft);
     // Broad spectral features from low-res wide FFT (16 bins, 174.6-4698.3 Hz)
@@ -4,6 +4,7 @@
 #include "fl/audio/fft/fft_impl.h"
 #include "fl/stl/unordered_map_lru.h"
 #include "fl/stl/int.h"
+#include "fl/log/log.h"
 #include "fl/stl/shared_ptr.h"  // For shared_ptr
 #include "fl/stl/singleton.h"
 #include "fl/stl/mutex.h"
@@ -256,6 +257,26 @@ void FFT::run(const span<const fl::i16> &sample, Bins *out,
     impl->run(sample, out);
 }
 
+fl::size FFT::runBatch(span<const fl::i16> samples, fl::size hop,
+                       span<Bins> out, const Args &args) {
+    if (hop == 0 || args.samples <= 0) {
+        FL_WARN_F("FFT::runBatch: hop and window size must be non-zero");
+        return 0;
+    }
+    // One cache lookup for the whole batch; the kernel is shared by every
+    // window.
+    fl::shared_ptr<Impl> impl = globalCache().get_or_create(args);
+    return impl->runBatch(samples, hop, out);
+}
+
+fl::size FFT::windowCount(fl::size sampleCount, fl::size windowSize,
+                          fl::size hop) {
+    if (hop == 0 || windowSize == 0 || sampleCount < windowSize) {
+        return 0;
+    }
+    return (sampleCount - windowSize) / hop + 1;
+}
+
 void FFT::clear() { globalCache().clear(); }
 
 fl::size FFT::size() const { return globalCache().size(); }
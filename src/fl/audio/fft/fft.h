@@ -168,6 +168,21 @@ class FFT {
     void run(const span<const i16> &sample, Bins *out,
              const Args &args = Args()) FL_NO_EXCEPT;
 
+    // Batch entry point for catching up after a stall or analysing a long
+    // recording offline. Window i is samples[i * hop, i * hop + args.samples)
+    // and lands in out[i]; every window goes through the same cached kernel
+    // and window table, and each Bins reuses its buffers across calls, so a
+    // steady-state batch does not allocate. Runs
+    // min(out.size(), windowCount(samples.size(), args.samples, hop))
+    // windows and returns that count (0 when hop is 0).
+    fl::size runBatch(span<const i16> samples, fl::size hop,
+                      span<Bins> out, const Args &args = Args()) FL_NO_EXCEPT;
+
+    // Number of full windows of windowSize samples, hop apart, that fit in
+    // sampleCount samples.
+    static fl::size windowCount(fl::size sampleCount, fl::size windowSize,
+                                fl::size hop) FL_NO_EXCEPT;
+
     void clear() FL_NO_EXCEPT;
     fl::size size() const FL_NO_EXCEPT;
 
@@ -1172,6 +1172,22 @@ Impl::Result Impl::run(span<const i16> sample, Bins *out) {
     return Impl::Result(true, "");
 }
 
+fl::size Impl::runBatch(span<const i16> samples, fl::size hop,
+                        span<Bins> out) {
+    if (!mContext) {
+        FL_WARN_F("Impl context is not initialized");
+        return 0;
+    }
+    const fl::size window = mContext->sampleSize();
+    const fl::size count =
+        fl::min(out.size(), FFT::windowCount(samples.size(), window, hop));
+    for (fl::size i = 0; i < count; ++i) {
+        const fl::size start = i * hop;
+        mContext->run(samples.slice(start, start + window), &out[i]);
+    }
+    return count;
+}
+
 } // namespace fft
 } // namespace audio
 } // namespace fl
@@ -38,6 +38,10 @@ class Impl {
     // constructor.
     Result run(const Sample &sample, Bins *out);
     Result run(span<const i16> sample, Bins *out);
+    // Run out.size() windows of sampleSize() samples taken hop samples apart
+    // from `samples`. Stops early at the first window that would read past
+    // the end. Returns the number of windows written.
+    fl::size runBatch(span<const i16> samples, fl::size hop, span<Bins> out);
     // Info on what the frequency the bins represent
     fl::string info() const;
 
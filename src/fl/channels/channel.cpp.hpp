@@ -9,16 +9,20 @@
 #include "fl/channels/driver.h"
 #include "fl/channels/manager.h"
 #include "fl/stl/atomic.h"
+#include "fl/stl/chrono.h"
 #include "fl/log/log.h"
 #include "fl/channels/options.h"
 #include "fl/gfx/pixel_iterator_any.h"
 #include "pixel_controller.h"
 #include "fl/system/trace.h"
+#include "fl/system/frame_telemetry.h"
 
 #include "fl/system/pin.h"
+#include "fl/chipsets/encoders/output_sink.h"
 #include "fl/chipsets/encoders/ucs7604.h"
 #include "fl/chipsets/ucs7604.h"
 #include "fl/math/ease.h"
+#include "fl/stl/hash.h"
 #include "fl/stl/iterator.h"
 #include "fl/system/engine_events.h"
 #include "fl/math/xymap.h"
@@ -274,6 +278,9 @@ Channel::Channel(int pin, const ChipsetTimingConfig& timing, fl::span<CRGB> leds
 }
 
 Channel::~Channel() FL_NO_EXCEPT {
+    if (mDeferredPixels) {
+        ChannelManager::instance().cancelDeferredEncode(this);
+    }
     auto& events = ChannelEvents::instance();
     events.onChannelBeginDestroy(*this);
 }
@@ -295,6 +302,7 @@ void Channel::applyConfig(const ChannelConfig& config) {
     applyWhiteCfg(*this, config.options);
     auto& events = ChannelEvents::instance();
     events.onChannelConfigured(*this, config);
+    mLastEncoded = nullptr;  // RGBW, order or screen map may have changed
 }
 
 int Channel::getClockPin() const {
@@ -307,32 +315,30 @@ int Channel::getClockPin() const {
 
 namespace {
 
+/// @brief Map a UCS7604 clockless encoder to its protocol mode
+inline UCS7604Mode ucs7604ModeFor(ClocklessEncoder encoder) {
+    switch (encoder) {
+        case ClocklessEncoder::CLOCKLESS_ENCODER_UCS7604_8BIT:
+            return UCS7604Mode::UCS7604_MODE_8BIT_800KHZ;
+        case ClocklessEncoder::CLOCKLESS_ENCODER_UCS7604_16BIT_1600:
+            return UCS7604Mode::UCS7604_MODE_16BIT_1600KHZ;
+        case ClocklessEncoder::CLOCKLESS_ENCODER_UCS7604_16BIT:
+        default:
+            // Default should never happen - caller already checked
+            return UCS7604Mode::UCS7604_MODE_16BIT_800KHZ;
+    }
+}
+
 /// @brief Encode UCS7604 pixel data into the channel data buffer
-/// @param data Output byte vector (cleared by caller)
+/// @param data Output sink sized by exactEncodedSize()
 /// @param pixelIterator Pixel iterator with color order and RGBW conversion
 /// @param encoder ClocklessEncoder value identifying the UCS7604 mode
 /// @param settings Channel settings (for gamma override)
 /// @param rgbOrder RGB ordering for current control reordering
-void writeUCS7604(fl::vector_psram<u8>* data, PixelIterator& pixelIterator,
+void writeUCS7604(SpanSink* data, PixelIterator& pixelIterator,
                   ClocklessEncoder encoder, const ChannelOptions& settings,
                   EOrder rgbOrder) {
-    // Map encoder enum to UCS7604Mode
-    UCS7604Mode mode;
-    switch (encoder) {
-        case ClocklessEncoder::CLOCKLESS_ENCODER_UCS7604_8BIT:
-            mode = UCS7604Mode::UCS7604_MODE_8BIT_800KHZ;
-            break;
-        case ClocklessEncoder::CLOCKLESS_ENCODER_UCS7604_16BIT:
-            mode = UCS7604Mode::UCS7604_MODE_16BIT_800KHZ;
-            break;
-        case ClocklessEncoder::CLOCKLESS_ENCODER_UCS7604_16BIT_1600:
-            mode = UCS7604Mode::UCS7604_MODE_16BIT_1600KHZ;
-            break;
-        default:
-            // Should never happen â€” caller already checked
-            mode = UCS7604Mode::UCS7604_MODE_16BIT_800KHZ;
-            break;
-    }
+    const UCS7604Mode mode = ucs7604ModeFor(encoder);
 
     // Get current control from global UCS7604 brightness
     UCS7604CurrentControl current = ucs7604::brightness();
@@ -371,6 +377,216 @@ void writeUCS7604(fl::vector_psram<u8>* data, PixelIterator& pixelIterator,
                   mode, wire_current, is_rgbw, gamma8.get());
 }
 
+/// @brief Exact encoded frame size for the chipset. Every encoder's output
+///        length depends only on the LED count and pixel format, so the
+///        frame can be written into a preallocated span. 0 means the channel
+///        path emits nothing (MY9221, or a chipset family compiled out).
+fl::size exactEncodedSize(const ChipsetVariant& chipset,
+                          PixelIterator& pixelIterator) {
+    const fl::size numLeds = static_cast<fl::size>(pixelIterator.size());
+    if (const ClocklessChipset* clockless = chipset.ptr<ClocklessChipset>()) {
+        switch (clockless->encoder) {
+            case ClocklessEncoder::CLOCKLESS_ENCODER_WS2812: {
+                const u8 bpp = pixelIterator.get_rgbww().active() ? 5
+                             : pixelIterator.get_rgbw().active()  ? 4
+                                                                  : 3;
+                return ws2812EncodedSize(numLeds, bpp);
+            }
+            case ClocklessEncoder::CLOCKLESS_ENCODER_TM1812_RGBWW:
+                return tm1812RGBWWEncodedSize(numLeds);
+#if !defined(FASTLED_DISABLE_UCS7604) || !FASTLED_DISABLE_UCS7604
+            case ClocklessEncoder::CLOCKLESS_ENCODER_UCS7604_8BIT:
+            case ClocklessEncoder::CLOCKLESS_ENCODER_UCS7604_16BIT:
+            case ClocklessEncoder::CLOCKLESS_ENCODER_UCS7604_16BIT_1600:
+                return ucs7604EncodedSize(numLeds, ucs7604ModeFor(clockless->encoder),
+                                          pixelIterator.get_rgbw().active());
+#endif
+            default:
+                return 0;
+        }
+    }
+#if !defined(FASTLED_DISABLE_SPI_CHIPSETS) || !FASTLED_DISABLE_SPI_CHIPSETS
+    if (const SpiChipsetConfig* spi = chipset.ptr<SpiChipsetConfig>()) {
+        switch (spi->timing.chipset) {
+            case SpiChipset::APA102:
+            case SpiChipset::DOTSTAR:
+            case SpiChipset::HD107:
+            case SpiChipset::APA102HD:
+            case SpiChipset::DOTSTARHD:
+            case SpiChipset::HD107HD:
+                return apa102EncodedSize(numLeds);
+            case SpiChipset::SK9822:
+            case SpiChipset::SK9822HD:
+                return sk9822EncodedSize(numLeds);
+            case SpiChipset::WS2801:
+                return ws2801EncodedSize(numLeds);
+            case SpiChipset::WS2803:
+                return ws2803EncodedSize(numLeds);
+            case SpiChipset::P9813:
+                return p9813EncodedSize(numLeds);
+            case SpiChipset::LPD8806:
+                return lpd8806EncodedSize(numLeds);
+            case SpiChipset::LPD6803:
+                return lpd6803EncodedSize(numLeds);
+            case SpiChipset::SM16716:
+                return sm16716EncodedSize(numLeds);
+            case SpiChipset::MY9221:
+                return 0;
+            case SpiChipset::HD108:
+                return hd108EncodedSize(numLeds);
+        }
+    }
+#endif
+    return 0;
+}
+
+/// @brief Encode one frame into `out`, which holds exactEncodedSize() bytes.
+/// Only the SpanSink instantiation of each encoder is emitted, so writing
+/// into driver memory costs no extra flash over the old vector path.
+void encodeChipset(const ChipsetVariant& chipset, const ChannelOptions& settings,
+                   EOrder rgbOrder, PixelIterator& pixelIterator, SpanSink* out) {
+    if (chipset.is<ClocklessChipset>()) {
+        // Clockless chipsets: dispatch based on encoder type
+        const ClocklessChipset* clockless = chipset.ptr<ClocklessChipset>();
+        switch (clockless->encoder) {
+            case ClocklessEncoder::CLOCKLESS_ENCODER_WS2812:
+                pixelIterator.writeWS2812(out);
+                break;
+            case ClocklessEncoder::CLOCKLESS_ENCODER_TM1812_RGBWW:
+                pixelIterator.writeTM1812RGBWW(out);
+                break;
+#if !defined(FASTLED_DISABLE_UCS7604) || !FASTLED_DISABLE_UCS7604
+            // Gated by FASTLED_DISABLE_UCS7604 (#2920). For WS2812-only
+            // sketches the UCS7604 case is dead at runtime, but each
+            // `writeUCS7604(...)` reference is statically reachable,
+            // keeping the encoder bodies linked. Setting
+            // `-DFASTLED_DISABLE_UCS7604=1` drops the case + the
+            // `encodeUCS7604_16bit_RGB` / `encodeUCS7604_16bit_RGBW`
+            // template instantiations (~400-600 B). When the gate is
+            // enabled, calling showPixels() on a UCS7604 channel
+            // silently emits nothing.
+            case ClocklessEncoder::CLOCKLESS_ENCODER_UCS7604_8BIT:
+            case ClocklessEncoder::CLOCKLESS_ENCODER_UCS7604_16BIT:
+            case ClocklessEncoder::CLOCKLESS_ENCODER_UCS7604_16BIT_1600:
+                writeUCS7604(out, pixelIterator, clockless->encoder,
+                             settings, rgbOrder);
+                break;
+#endif  // !FASTLED_DISABLE_UCS7604
+        }
+#if !defined(FASTLED_DISABLE_SPI_CHIPSETS) || !FASTLED_DISABLE_SPI_CHIPSETS
+    } else if (chipset.is<SpiChipsetConfig>()) {
+        // SPI chipsets: dispatch based on chipset type (zero allocation).
+        //
+        // Gated by FASTLED_DISABLE_SPI_CHIPSETS (#2913). For NEOPIXEL-only
+        // sketches on ESP32-S3 the SPI branch is dead at runtime, but the
+        // compiler cannot prove that â€” each pixelIterator.writeXXX(...)
+        // reference below is statically reachable, keeping ~720 B of
+        // encoder bodies (writeAPA102, writeSK9822, writeLPD8806,
+        // writeSM16716) plus the 11-case switch table linked. Setting
+        // `-DFASTLED_DISABLE_SPI_CHIPSETS=1` in build_flags drops the
+        // whole branch and recovers ~1.0-1.2 KB on a NEOPIXEL Blink.
+        //
+        // When the gate is enabled, calling showPixels() on an
+        // SpiChipsetConfig channel silently emits nothing â€” the user
+        // accepts that constraint by setting the flag.
+        const SpiChipsetConfig* spi = chipset.ptr<SpiChipsetConfig>();
+        const SpiEncoder& config = spi->timing;
+
+        // Switch on enum WITHOUT default case - compiler will warn if new enum values are added
+        // TODO: Consolidate these PixelIterator methods with template controllers in src/fl/chipsets/
+        switch (config.chipset) {
+            case SpiChipset::APA102:
+            case SpiChipset::DOTSTAR:
+            case SpiChipset::HD107:
+                pixelIterator.writeAPA102(out, false);
+                break;
+
+            case SpiChipset::APA102HD:
+            case SpiChipset::DOTSTARHD:
+            case SpiChipset::HD107HD:
+                pixelIterator.writeAPA102(out, true);
+                break;
+
+            case SpiChipset::SK9822:
+                pixelIterator.writeSK9822(out, false);
+                break;
+
+            case SpiChipset::SK9822HD:
+                pixelIterator.writeSK9822(out, true);
+                break;
+
+            case SpiChipset::WS2801:
+                pixelIterator.writeWS2801(out);
+                break;
+
+            case SpiChipset::WS2803:
+                pixelIterator.writeWS2803(out);
+                break;
+
+            case SpiChipset::P9813:
+                pixelIterator.writeP9813(out);
+                break;
+
+            case SpiChipset::LPD8806:
+                pixelIterator.writeLPD8806(out);
+                break;
+
+            case SpiChipset::LPD6803:
+                pixelIterator.writeLPD6803(out);
+                break;
+
+            case SpiChipset::SM16716:
+                pixelIterator.writeSM16716(out);
+                break;
+
+            case SpiChipset::MY9221:
+                // MY9221 samples data on every clock edge (DDR). The standard
+                // SPI channel encoder path cannot express that framing; drive
+                // it via addLeds<MY9221, DATA, CLOCK>(...) instead.
+                break;
+
+            case SpiChipset::HD108:
+                pixelIterator.writeHD108(out);
+                break;
+        }
+        // No default case - compiler will error if any enum value is missing
+    }
+#endif  // !FASTLED_DISABLE_SPI_CHIPSETS
+#if defined(FASTLED_DISABLE_UCS7604) && FASTLED_DISABLE_UCS7604
+    (void)settings;
+    (void)rgbOrder;
+#endif
+}
+
+/// @brief Fingerprint of everything the encoders read from a frame: the
+///        source pixels plus the scale and dither state PixelController
+///        applies to them. Used by Channel::setSkipUnchanged().
+u32 frameFingerprint(const PixelController<RGB, 1, 0xFFFFFFFF>& pixels) {
+    const ColorAdjustment& adj = pixels.mColorAdjustment;
+    u8 state[16] = {
+        adj.premixed.r, adj.premixed.g, adj.premixed.b,
+        pixels.d[0], pixels.d[1], pixels.d[2],
+        pixels.e[0], pixels.e[1], pixels.e[2],
+        static_cast<u8>(pixels.mAdvance),
+    };
+#if FASTLED_HD_COLOR_MIXING
+    state[10] = adj.color.r;
+    state[11] = adj.color.g;
+    state[12] = adj.color.b;
+    state[13] = adj.brightness;
+#endif
+    const u32 seed = MurmurHash3_x86_32(state, sizeof(state),
+                                        static_cast<u32>(pixels.mLen));
+    // Span from the first pixel to the end of the last one (a solid fill,
+    // mAdvance == 0, is a single pixel).
+    if (pixels.mLen <= 0) {
+        return seed;
+    }
+    const fl::size bytes =
+        static_cast<fl::size>(pixels.mLen - 1) * static_cast<fl::size>(pixels.mAdvance) + 3;
+    return MurmurHash3_x86_32(pixels.mData, bytes, seed);
+}
+
 } // anonymous namespace
 
 /// @brief Cold fallback for the non-pre-bound driver path. Handles dynamic
@@ -436,8 +652,12 @@ fl::shared_ptr<IChannelDriver> Channel::resolveDynamicDriver() {
 void Channel::showPixels(PixelController<RGB, 1, 0xFFFFFFFF> &pixels) {
     FL_SCOPED_TRACE;
 
+    // Pipelined mode rotates through a ring of buffers instead (see
+    // acquirePipelineBuffer() below, once the driver is resolved).
+    const u8 pipelineDepth = ChannelManager::instance().getPipelineDepth();
+
     // Safety check: don't modify buffer if driver is currently transmitting it
-    if (mChannelData->isInUse()) {
+    if (pipelineDepth <= 1 && mChannelData->isInUse()) {
         FL_WARN_F("Channel '%s': showPixels() called while mChannelData is in use by driver, attempting to wait", mName);
         auto driver = mDriver.lock();
         if (!driver) {
@@ -494,142 +714,196 @@ void Channel::showPixels(PixelController<RGB, 1, 0xFFFFFFFF> &pixels) {
 #endif
     }
 
-    // Build pixel iterator with optional addressing transformation
-    // (#2558) Pass both Rgbw and Rgbww from the channel options; the iterator
-    // carries both, and the encoder dispatch below picks the right path based
-    // on which variant alternative ChannelOptions::mWhiteCfg holds.
-    ReorderingPixelIteratorAny iterator(pixels, mScreenMap.getXYMap(), mRgbOrder,
-                                        mSettings.rgbw(), mSettings.rgbww(),
-                                        mName);
-    PixelIterator& pixelIterator = iterator.get();
+    if (pipelineDepth > 1 && !acquirePipelineBuffer(*driver, pipelineDepth)) {
+        return;
+    }
 
-    // Encode pixels based on chipset type
-    auto& data = mChannelData->getData();
-    data.clear();
-    if (mSettings.isRgbww()) {
-        mChannelData->setPixelFormat(ChannelPixelFormat::RGBWW);
-    } else if (mSettings.isRgbw()) {
-        mChannelData->setPixelFormat(ChannelPixelFormat::RGBW);
+    if (reuseUnchangedFrame(pixels, driver, pipelineDepth)) {
+        return;
+    }
+
+    // Parallel encode: claim the output buffer here, copy the LED bytes (the
+    // controller may point at a temporary, e.g. showColor()'s CRGB) and let
+    // ChannelManager::onEndFrame() encode every deferred channel on its worker
+    // pool before feeding the drivers.
+    ChannelManager& manager = ChannelManager::instance();
+    if (manager.getEncodeWorkers() > 1 && canEncodeOffThread()) {
+        const fl::size bytes = pixels.mLen > 0
+            ? static_cast<fl::size>(pixels.mLen - 1) * static_cast<fl::size>(pixels.mAdvance) + 3
+            : 0;
+        const bool queued = mDeferredPixels.has_value();  // shown twice this frame
+        mDeferredBytes.assign(pixels.mData, pixels.mData + bytes);
+        mDeferredPixels.emplace(pixels);
+        mDeferredPixels->mData = mDeferredBytes.data();
+        mDeferredDriver = driver;
+        mDeferredTarget = beginEncode(*mDeferredPixels, driver.get());
+        mDeferredWritten = 0;
+        if (!queued) {
+            manager.deferEncode(this);
+        }
+        return;
+    }
+
+    encodePixels(pixels, driver.get());
+    rememberFrame(driver.get(), enqueueEncoded(driver));
+}
+
+bool Channel::reuseUnchangedFrame(const PixelController<RGB, 1, 0xFFFFFFFF>& pixels,
+                                  const fl::shared_ptr<IChannelDriver>& driver,
+                                  u8 pipelineDepth) {
+    if (!mSettings.mSkipUnchanged) {
+        return false;
+    }
+    ++mChangeStats.frames;
+    mPendingFingerprint = frameFingerprint(pixels);
+    // Ring buffers rotate and UCS7604 output depends on global state the
+    // fingerprint does not see; neither can reuse a cached frame.
+    if (pipelineDepth > 1 || !canEncodeOffThread()) {
+        mLastEncoded = nullptr;
+        return false;
+    }
+    if (mLastEncoded != mChannelData.get() || mLastDriver != driver.get() ||
+        mLastFingerprint != mPendingFingerprint) {
+        return false;
+    }
+    ++mChangeStats.encodesSkipped;
+    if (isSpi()) {
+        // Clocked chipsets hold the last latched frame: nothing to send.
+        ++mChangeStats.transmitsSkipped;
+        return true;
+    }
+    rememberFrame(driver.get(), enqueueEncoded(driver));
+    return true;
+}
+
+void Channel::rememberFrame(const IChannelDriver* driver, bool enqueued) {
+    if (!mSettings.mSkipUnchanged) {
+        return;
+    }
+    // A lent driver buffer may be recycled, so only our own bytes are reusable.
+    if (enqueued && !mChannelData->hasExternalEncoded()) {
+        mLastEncoded = mChannelData.get();
+        mLastDriver = driver;
+        mLastFingerprint = mPendingFingerprint;
     } else {
-        mChannelData->setPixelFormat(ChannelPixelFormat::RGB);
+        mLastEncoded = nullptr;
     }
+}
 
-    if (mChipset.is<ClocklessChipset>()) {
-        // Clockless chipsets: dispatch based on encoder type
-        const ClocklessChipset* clockless = mChipset.ptr<ClocklessChipset>();
-        switch (clockless->encoder) {
-            case ClocklessEncoder::CLOCKLESS_ENCODER_WS2812:
-                pixelIterator.writeWS2812(&data);
-                break;
-            case ClocklessEncoder::CLOCKLESS_ENCODER_TM1812_RGBWW:
-                pixelIterator.writeTM1812RGBWW(&data);
-                break;
+bool Channel::canEncodeOffThread() const {
 #if !defined(FASTLED_DISABLE_UCS7604) || !FASTLED_DISABLE_UCS7604
-            // Gated by FASTLED_DISABLE_UCS7604 (#2920). For WS2812-only
-            // sketches the UCS7604 case is dead at runtime, but each
-            // `writeUCS7604(...)` reference is statically reachable,
-            // keeping the encoder bodies linked. Setting
-            // `-DFASTLED_DISABLE_UCS7604=1` drops the case + the
-            // `encodeUCS7604_16bit_RGB` / `encodeUCS7604_16bit_RGBW`
-            // template instantiations (~400-600 B). When the gate is
-            // enabled, calling showPixels() on a UCS7604 channel
-            // silently emits nothing.
+    // writeUCS7604() goes through the process-wide Gamma8 cache and UCS7604
+    // brightness globals, which are not safe to touch from worker threads.
+    if (const ClocklessChipset* clockless = mChipset.ptr<ClocklessChipset>()) {
+        switch (clockless->encoder) {
             case ClocklessEncoder::CLOCKLESS_ENCODER_UCS7604_8BIT:
             case ClocklessEncoder::CLOCKLESS_ENCODER_UCS7604_16BIT:
             case ClocklessEncoder::CLOCKLESS_ENCODER_UCS7604_16BIT_1600:
-                writeUCS7604(&data, pixelIterator, clockless->encoder,
-                             mSettings, mRgbOrder);
+                return false;
+            default:
                 break;
-#endif  // !FASTLED_DISABLE_UCS7604
         }
-#if !defined(FASTLED_DISABLE_SPI_CHIPSETS) || !FASTLED_DISABLE_SPI_CHIPSETS
-    } else if (mChipset.is<SpiChipsetConfig>()) {
-        // SPI chipsets: dispatch based on chipset type (zero allocation).
-        //
-        // Gated by FASTLED_DISABLE_SPI_CHIPSETS (#2913). For NEOPIXEL-only
-        // sketches on ESP32-S3 the SPI branch is dead at runtime, but the
-        // compiler cannot prove that â€” each pixelIterator.writeXXX(...)
-        // reference below is statically reachable, keeping ~720 B of
-        // encoder bodies (writeAPA102, writeSK9822, writeLPD8806,
-        // writeSM16716) plus the 11-case switch table linked. Setting
-        // `-DFASTLED_DISABLE_SPI_CHIPSETS=1` in build_flags drops the
-        // whole branch and recovers ~1.0-1.2 KB on a NEOPIXEL Blink.
-        //
-        // When the gate is enabled, calling showPixels() on an
-        // SpiChipsetConfig channel silently emits nothing â€” the user
-        // accepts that constraint by setting the flag.
-        const SpiChipsetConfig* spi = mChipset.ptr<SpiChipsetConfig>();
-        const SpiEncoder& config = spi->timing;
-
-        // Switch on enum WITHOUT default case - compiler will warn if new enum values are added
-        // TODO: Consolidate these PixelIterator methods with template controllers in src/fl/chipsets/
-        switch (config.chipset) {
-            case SpiChipset::APA102:
-            case SpiChipset::DOTSTAR:
-            case SpiChipset::HD107:
-                pixelIterator.writeAPA102(&data, false);
-                break;
-
-            case SpiChipset::APA102HD:
-            case SpiChipset::DOTSTARHD:
-            case SpiChipset::HD107HD:
-                pixelIterator.writeAPA102(&data, true);
-                break;
-
-            case SpiChipset::SK9822:
-                pixelIterator.writeSK9822(&data, false);
-                break;
-
-            case SpiChipset::SK9822HD:
-                pixelIterator.writeSK9822(&data, true);
-                break;
-
-            case SpiChipset::WS2801:
-                pixelIterator.writeWS2801(&data);
-                break;
+    }
+#endif
+    return true;
+}
 
-            case SpiChipset::WS2803:
-                pixelIterator.writeWS2803(&data);
-                break;
+void Channel::encodeDeferred() {
+    if (mDeferredPixels) {
+        mDeferredWritten = encodeInto(*mDeferredPixels, mDeferredTarget);
+    }
+}
 
-            case SpiChipset::P9813:
-                pixelIterator.writeP9813(&data);
-                break;
+void Channel::enqueueDeferred() {
+    if (!mDeferredPixels) {
+        return;
+    }
+    checkEncodedSize(mDeferredWritten, mDeferredTarget.size());
+    mDeferredPixels.reset();
+    mDeferredTarget = fl::span<u8>();
+    fl::shared_ptr<IChannelDriver> driver = fl::move(mDeferredDriver);
+    mDeferredDriver.reset();
+    if (driver) {
+        rememberFrame(driver.get(), enqueueEncoded(driver));
+    }
+}
 
-            case SpiChipset::LPD8806:
-                pixelIterator.writeLPD8806(&data);
-                break;
+void Channel::encodePixels(PixelController<RGB, 1, 0xFFFFFFFF> &pixels,
+                           IChannelDriver *driver) {
+    fl::span<u8> dst = beginEncode(pixels, driver);
+    checkEncodedSize(encodeInto(pixels, dst), dst.size());
+}
 
-            case SpiChipset::LPD6803:
-                pixelIterator.writeLPD6803(&data);
-                break;
+fl::span<u8> Channel::beginEncode(PixelController<RGB, 1, 0xFFFFFFFF> &pixels,
+                                  IChannelDriver *driver) {
+    if (mSettings.isRgbww()) {
+        mChannelData->setPixelFormat(ChannelPixelFormat::RGBWW);
+    } else if (mSettings.isRgbw()) {
+        mChannelData->setPixelFormat(ChannelPixelFormat::RGBW);
+    } else {
+        mChannelData->setPixelFormat(ChannelPixelFormat::RGB);
+    }
 
-            case SpiChipset::SM16716:
-                pixelIterator.writeSM16716(&data);
-                break;
+    // Every frame size is known up front. XYMap addressing keeps the LED
+    // count, so the plain iterator sizes the frame without reordering it.
+    PixelIteratorAny sizing(pixels, mRgbOrder, mSettings.rgbw(), mSettings.rgbww());
+    const fl::size exact = exactEncodedSize(mChipset, sizing.get());
+    fl::span<u8> dst;
+    // onChannelDataEncoded listeners predate driver-owned buffers and read
+    // getData(), which an external encode leaves empty.
+    if (driver && exact > 0 &&
+        ChannelEvents::instance().onChannelDataEncoded.empty()) {
+        dst = driver->acquireEncodeBuffer(*mChannelData, exact);
+    }
+    if (dst.size() >= exact && exact > 0) {
+        dst = dst.slice(0, exact);
+        mChannelData->setExternalEncoded(dst);
+        return dst;
+    }
+    return mChannelData->prepareEncoded(exact);
+}
 
-            case SpiChipset::MY9221:
-                // MY9221 samples data on every clock edge (DDR). The standard
-                // SPI channel encoder path cannot express that framing; drive
-                // it via addLeds<MY9221, DATA, CLOCK>(...) instead.
-                break;
+fl::size Channel::encodeInto(PixelController<RGB, 1, 0xFFFFFFFF> &pixels,
+                             fl::span<u8> dst) {
+#if FASTLED_FRAME_TELEMETRY
+    // May run on an encode worker; enqueueEncoded() reports it from the
+    // show() thread.
+    const u32 encodeStart = fl::micros();
+#endif
+    // Build pixel iterator with optional addressing transformation
+    // (#2558) Pass both Rgbw and Rgbww from the channel options; the iterator
+    // carries both, and the encoder dispatch below picks the right path based
+    // on which variant alternative ChannelOptions::mWhiteCfg holds.
+    ReorderingPixelIteratorAny iterator(pixels, mScreenMap.getXYMap(), mRgbOrder,
+                                        mSettings.rgbw(), mSettings.rgbww(),
+                                        mName);
+    SpanSink sink(dst);
+    encodeChipset(mChipset, mSettings, mRgbOrder, iterator.get(), &sink);
+#if FASTLED_FRAME_TELEMETRY
+    mEncodeUs = fl::micros() - encodeStart;
+#endif
+    return sink.size();
+}
 
-            case SpiChipset::HD108:
-                pixelIterator.writeHD108(&data);
-                break;
-        }
-        // No default case - compiler will error if any enum value is missing
+void Channel::checkEncodedSize(fl::size written, fl::size expected) const {
+    if (written != expected) {
+        FL_WARN_F("Channel '%s': encoder wrote %s bytes, expected %s", mName,
+                  written, expected);
     }
-#endif  // !FASTLED_DISABLE_SPI_CHIPSETS
+}
 
+bool Channel::enqueueEncoded(const fl::shared_ptr<IChannelDriver>& driver) {
+#if FASTLED_FRAME_TELEMETRY
+    // Frames reused by setSkipUnchanged() were not encoded this time.
+    FrameTelemetry::instance().addStage(FrameStage::ENCODE, mEncodeUs);
+    mEncodeUs = 0;
+#endif
     // Fire event after encoding completes
     {
         auto& events = ChannelEvents::instance();
         events.onChannelDataEncoded(*this, *mChannelData);
     }
 
-
-
     // #2517: detect the silent-drop scenario before enqueuing â€” if the
     // resolved driver is registered with ChannelManager but currently
     // disabled (typically by `FastLED.setExclusiveDriver<OtherBus>()`),
@@ -658,7 +932,7 @@ void Channel::showPixels(PixelController<RGB, 1, 0xFFFFFFFF> &pixels) {
         // and the one-shot latch are gated. In release, the empty
         // emitDisabledDriverError + the exclusiveDriverName() call + the
         // 3-arg fl::string chain dead-strip (see #2950).
-        return;
+        return false;
     } else if (status == ChannelManager::DriverStatus::STATUS_ENABLED) {
 #if FASTLED_LOG_RUNTIME_ENABLED
         // Reset the one-shot guard so a future disable re-emits the diagnostic.
@@ -670,9 +944,49 @@ void Channel::showPixels(PixelController<RGB, 1, 0xFFFFFFFF> &pixels) {
     // the driver decide what to do â€” this is the historic behaviour.
 
     // Enqueue for transmission (will be sent when driver->show() is called)
-    driver->enqueue(mChannelData);
+    {
+        FL_FRAME_STAGE(ENQUEUE);
+        driver->enqueue(mChannelData);
+    }
     auto& events = ChannelEvents::instance();
     events.onChannelEnqueued(*this, driver->getName());
+    return true;
+}
+
+FL_NO_INLINE
+bool Channel::acquirePipelineBuffer(IChannelDriver& driver, u8 depth) {
+    if (mDataRing.empty()) {
+        mDataRing.push_back(mChannelData);
+    }
+    while (mDataRing.size() < depth) {
+        mDataRing.push_back(ChannelData::create(mChipset));
+    }
+    // The ring never shrinks; a lower depth just stops visiting the tail.
+    if (mRingHead >= depth) {
+        mRingHead = 0;
+    }
+
+    for (u8 i = 0; i < depth; ++i) {
+        const u8 slot = static_cast<u8>((mRingHead + i) % depth);
+        if (!mDataRing[slot]->isInUse()) {
+            mChannelData = mDataRing[slot];
+            mRingHead = static_cast<u8>((slot + 1) % depth);
+            return true;
+        }
+    }
+
+    // Fence: the driver still owns every buffer, so rendering has run a full
+    // ring ahead of transmission. Block until it catches up.
+    const u32 start = fl::micros();
+    const bool ok = driver.waitForReady();
+    ChannelManager::instance().recordPipelineFence(fl::micros() - start);
+    if (!ok) {
+        FL_ERROR_F("Channel '%s': Timeout occurred while waiting for a free pipeline buffer", mName);
+        return false;
+    }
+    mChannelData = mDataRing[mRingHead];
+    mRingHead = static_cast<u8>((mRingHead + 1) % depth);
+    return true;
 }
 
 void Channel::init() {
@@ -787,6 +1101,7 @@ Rgbw Channel::getRgbw() const {
 
 Channel& Channel::setGamma(float gamma) {
     mSettings.mGamma = gamma;
+    mLastEncoded = nullptr;
     return *this;
 }
 
@@ -794,6 +1109,16 @@ fl::optional<float> Channel::getGamma() const {
     return mSettings.mGamma;
 }
 
+Channel& Channel::setSkipUnchanged(bool enable) {
+    mSettings.mSkipUnchanged = enable;
+    mLastEncoded = nullptr;
+    return *this;
+}
+
+bool Channel::getSkipUnchanged() const {
+    return mSettings.mSkipUnchanged;
+}
+
 fl::string Channel::getEngineName() const {
     // Lock the weak_ptr to get a shared_ptr
     auto driver = mDriver.lock();
@@ -811,12 +1136,14 @@ Channel& Channel::setScreenMap(const fl::XYMap& map, float diameter) {
         screenmap.setDiameter(diameter);
     }
     mScreenMap = screenmap;
+    mLastEncoded = nullptr;
     fl::EngineEvents::onCanvasUiSet(asController(), screenmap);
     return *this;
 }
 
 Channel& Channel::setScreenMap(const fl::ScreenMap& map) {
     mScreenMap = map;
+    mLastEncoded = nullptr;
     fl::EngineEvents::onCanvasUiSet(asController(), map);
     return *this;
 }
@@ -18,8 +18,11 @@
 #include "fl/channels/bus.h"
 #include "fl/channels/ichannel.h"
 #include "fl/channels/options.h"
+#include "fl/stl/optional.h"
 #include "fl/stl/shared_ptr.h"
+#include "fl/stl/span.h"
 #include "fl/stl/string.h"
+#include "fl/stl/vector.h"
 #include "fl/stl/weak_ptr.h"
 #include "fl/stl/stdint.h"
 #include "fl/channels/config.h"
@@ -85,6 +88,41 @@ public:
     /// @return Gamma value if set, nullopt otherwise
     fl::optional<float> getGamma() const;
 
+    /// @brief Skip re-encoding (and, for clocked strips, re-sending) frames
+    ///        whose content is unchanged
+    ///
+    /// Each showPixels() fingerprints the source pixels together with the
+    /// brightness/correction scale and the dither offsets. When the
+    /// fingerprint matches the last frame that reached the driver, the
+    /// previous ChannelData encoding is reused. SPI chipsets latch their
+    /// last frame, so for them the transmit is skipped as well; clockless
+    /// strips are still re-sent from the cached bytes.
+    ///
+    /// Temporal dithering changes the output every frame, so a channel with
+    /// dithering enabled never matches; pair this with DISABLE_DITHER for
+    /// mostly-static content.
+    /// Not applied to UCS7604 (its output depends on global brightness and
+    /// gamma state), in pipelined mode, or when the driver lends its own
+    /// encode buffer.
+    /// @return Reference to this channel for chaining
+    Channel& setSkipUnchanged(bool enable);
+
+    /// @brief True if setSkipUnchanged() / ChannelOptions::mSkipUnchanged is on
+    bool getSkipUnchanged() const;
+
+    /// @brief Counters for setSkipUnchanged()
+    struct ChangeStats {
+        u32 frames = 0;            ///< Frames checked while skipping was enabled
+        u32 encodesSkipped = 0;    ///< Frames that reused the previous encoding
+        u32 transmitsSkipped = 0;  ///< Of those, frames not sent at all (SPI)
+    };
+
+    /// @brief Counters collected since the last reset
+    const ChangeStats& getChangeStats() const { return mChangeStats; }
+
+    /// @brief Zero the change counters
+    void resetChangeStats() { mChangeStats = ChangeStats(); }
+
     /// @brief Get the timing configuration for this channel (clockless only)
     /// @return ChipsetTimingConfig reference
     /// @deprecated Use getChipset() instead
@@ -209,6 +247,64 @@ private:
     /// see #2773 item 2.1. Returns `nullptr` on a hard miss (caller should
     /// silently bail).
     FL_NO_INLINE fl::shared_ptr<IChannelDriver> resolveDynamicDriver();
+
+    /// @brief Pick the next free buffer from the pipelined ChannelData ring.
+    ///
+    /// Only reached when `ChannelManager::isPipelined()`. Grows the ring to
+    /// `depth` on demand, points `mChannelData` at the first slot the driver
+    /// no longer owns, and fences on `driver.waitForReady()` when every slot
+    /// is still in flight. Returns false if the fence timed out.
+    FL_NO_INLINE bool acquirePipelineBuffer(IChannelDriver& driver, u8 depth);
+
+    /// @brief Run the chipset encoder over `pixels` into `mChannelData`.
+    ///
+    /// Equivalent to beginEncode() + encodeInto() + checkEncodedSize().
+    void encodePixels(PixelController<RGB, 1, 0xFFFFFFFF>& pixels,
+                      IChannelDriver* driver);
+
+    /// @brief Set the pixel format, size the frame and claim its buffer.
+    ///
+    /// Fixed-size encoders write through a SpanSink into
+    /// `driver->acquireEncodeBuffer()` when the driver offers one, otherwise
+    /// into an exactly-sized ChannelData buffer. Always runs on the calling
+    /// thread, since drivers hand out buffers from shared pools.
+    fl::span<u8> beginEncode(PixelController<RGB, 1, 0xFFFFFFFF>& pixels,
+                             IChannelDriver* driver);
+
+    /// @brief Encode `pixels` into `dst`; returns the bytes written.
+    /// @note Touches only this channel's state and `dst`, so ChannelManager
+    ///       may call it (via encodeDeferred()) from a worker thread.
+    fl::size encodeInto(PixelController<RGB, 1, 0xFFFFFFFF>& pixels,
+                        fl::span<u8> dst);
+
+    /// @brief Warn if the encoder wrote a different size than beginEncode()
+    ///        reserved.
+    void checkEncodedSize(fl::size written, fl::size expected) const;
+
+    /// @brief Fire the encoded event and hand `mChannelData` to `driver`.
+    /// @return False if the driver is disabled and the frame was dropped
+    bool enqueueEncoded(const fl::shared_ptr<IChannelDriver>& driver);
+
+    /// @brief setSkipUnchanged() fast path. Returns true if this frame was
+    ///        fully handled from the previous encoding.
+    bool reuseUnchangedFrame(const PixelController<RGB, 1, 0xFFFFFFFF>& pixels,
+                             const fl::shared_ptr<IChannelDriver>& driver,
+                             u8 pipelineDepth);
+
+    /// @brief Record that mChannelData (fingerprint mPendingFingerprint)
+    ///        reached `driver`, or forget the cached frame if it did not.
+    void rememberFrame(const IChannelDriver* driver, bool enqueued);
+
+    /// @brief False for encoders that read process-wide mutable state
+    ///        (UCS7604 gamma/brightness) and must stay on the calling thread.
+    bool canEncodeOffThread() const;
+
+    /// @brief Parallel-encode hooks driven by ChannelManager::onEndFrame().
+    /// showPixels() has already run beginEncode(); encodeDeferred() runs on a
+    /// worker and enqueueDeferred() on the caller.
+    void encodeDeferred();
+    void enqueueDeferred();
+    friend class ChannelManager;
 protected:
 
     /// @brief Pre-bind a driver, bypassing `ChannelManager::selectDriverForChannel()`
@@ -276,8 +372,26 @@ private:
                                          // disable re-emits the diagnostic.
     const i32 mId;
     fl::string mName;               // User-specified or auto-generated name
-    ChannelDataPtr mChannelData;
+    ChannelDataPtr mChannelData;     // Buffer being encoded this frame (mDataRing slot when pipelined)
+    fl::vector<ChannelDataPtr> mDataRing;  // Pipelined mode only: buffers rotated across frames
+    u8 mRingHead = 0;                // Next ring slot to try in acquirePipelineBuffer()
+    fl::optional<PixelController<RGB, 1, 0xFFFFFFFF>> mDeferredPixels;  // Parallel encode: frame
+                                     // awaiting ChannelManager's worker pool, reading mDeferredBytes
+    fl::vector<u8> mDeferredBytes;   // Copy of the caller's LED bytes (showColor() passes a temporary)
+    fl::shared_ptr<IChannelDriver> mDeferredDriver;  // Driver resolved for the deferred frame
+    fl::span<u8> mDeferredTarget;    // Buffer claimed by beginEncode() for the deferred frame
+    fl::size mDeferredWritten = 0;   // Bytes encodeDeferred() wrote into mDeferredTarget
     fl::ScreenMap mScreenMap;        // Screen map for JS canvas visualization
+    // setSkipUnchanged() state: fingerprint of the frame last handed to
+    // mLastDriver in mLastEncoded. mLastEncoded is null when there is no
+    // reusable frame (never sent, config changed, or not cacheable).
+    u32 mLastFingerprint = 0;
+    u32 mPendingFingerprint = 0;     // Fingerprint of the frame being encoded
+    const ChannelData* mLastEncoded = nullptr;
+    const IChannelDriver* mLastDriver = nullptr;
+    ChangeStats mChangeStats;
+    u32 mEncodeUs = 0;               // Last encodePixels() time, reported to
+                                     // FrameTelemetry from enqueueEncoded()
 };
 
 /// @brief Get stub channel driver for testing or unsupported platforms
@@ -56,6 +56,8 @@ struct NoOpChannelEvent {
     int add(F&& /*f*/, int /*priority*/ = 0) const FL_NO_EXCEPT { return -1; }
 
     void remove(int /*id*/) const FL_NO_EXCEPT {}
+
+    bool empty() const FL_NO_EXCEPT { return true; }
 };
 }  // namespace detail
 
@@ -105,6 +107,9 @@ struct ChannelEvents {
     /// Fired after pixel data is encoded into byte stream (before enqueuing)
     /// Second parameter is the encoded channel data
     /// @note This event fires after writeWS2812/writeAPA102/etc. encoding completes
+    /// @note Read the bytes through ChannelData::encoded(). While this list
+    ///       has listeners, channels skip driver-provided encode buffers so
+    ///       getData() stays populated for older listeners.
     fl::function_list<void(const IChannel&, const ChannelData&)> onChannelDataEncoded;
 
     /// Fired after channel data is enqueued to a driver
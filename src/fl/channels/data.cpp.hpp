@@ -69,15 +69,18 @@ ChannelData::ChannelData(
 
 void ChannelData::writeWithPadding(fl::span<u8> dst) FL_NO_EXCEPT {
     size_t targetSize = dst.size();
-    size_t currentSize = mEncodedData.size();
+    fl::span<const u8> src = encoded();
+    size_t currentSize = src.size();
 
     // Destination must be at least as large as current data
     if (targetSize < currentSize) {
         return; // or throw? For now, silently fail
     }
 
-    // Create source span from encoded data
-    fl::span<const u8> src(mEncodedData.data(), currentSize);
+    // Encoded in place (driver-provided buffer, no padding): nothing to move.
+    if (src.data() == dst.data() && currentSize == targetSize) {
+        return;
+    }
 
     if (mPaddingGenerator) {
         // Use custom padding generator (writes directly to dst)
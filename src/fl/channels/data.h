@@ -110,8 +110,40 @@ public:
         return channelPixelFormatBytesPerPixel(mPixelFormat);
     }
 
+    /// @brief Encoded bytes, wherever they live
+    ///
+    /// Normally a view of getData(). When the driver supplied the encode
+    /// target via IChannelDriver::acquireEncodeBuffer(), this is that
+    /// region and getData() is empty - drivers that hand out buffers must
+    /// read through encoded().
+    fl::span<const u8> encoded() const FL_NO_EXCEPT {
+        if (mExternal.data()) {
+            return mExternal;
+        }
+        return fl::span<const u8>(mEncodedData.data(), mEncodedData.size());
+    }
+
+    /// @brief True when the encoded bytes live in a driver-provided region
+    bool hasExternalEncoded() const FL_NO_EXCEPT { return mExternal.data() != nullptr; }
+
+    /// @brief Record that this frame was encoded into `region` (driver memory)
+    ///        and drop any internally held bytes.
+    void setExternalEncoded(fl::span<u8> region) FL_NO_EXCEPT {
+        mEncodedData.clear();
+        mExternal = region;
+    }
+
+    /// @brief Size the internal buffer to exactly `bytes` for a span encode
+    ///        and return it. Clears any external region. Capacity is kept
+    ///        across frames, so a steady-state frame does not allocate.
+    fl::span<u8> prepareEncoded(size_t bytes) FL_NO_EXCEPT {
+        mExternal = fl::span<u8>();
+        mEncodedData.resize(bytes);
+        return fl::span<u8>(mEncodedData.data(), mEncodedData.size());
+    }
+
     /// @brief Get the data size in bytes
-    size_t getSize() const FL_NO_EXCEPT { return mEncodedData.size(); }
+    size_t getSize() const FL_NO_EXCEPT { return encoded().size(); }
 
     /// @brief Check if channel data is currently in use by the driver
     /// @return true if driver is transmitting this data, false otherwise
@@ -146,7 +178,7 @@ public:
     /// after writeWithPadding() will be dst.size() (fills entire destination).
     ///
     /// @return Current size of encoded data (minimum required dst size)
-    size_t getMinimumSize() const FL_NO_EXCEPT { return mEncodedData.size(); }
+    size_t getMinimumSize() const FL_NO_EXCEPT { return encoded().size(); }
 
     /// @brief Destructor with debug logging
     ~ChannelData();
@@ -180,6 +212,7 @@ private:
     ChannelPixelFormat mPixelFormat;        ///< Explicit byte layout for encoded data
     PaddingGenerator mPaddingGenerator;     ///< Optional padding generator for block-size alignment
     fl::vector_psram<u8> mEncodedData; ///< Encoded transmission bytes (PSRAM)
+    fl::span<u8> mExternal;            ///< Driver-owned encode target, if any
     volatile bool mInUse = false;           ///< Engine is transmitting this data (prevents creator updates)
 };
 
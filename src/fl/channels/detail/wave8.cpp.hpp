@@ -339,6 +339,43 @@ void wave8_transpose_16x4_bf1_pipe4(const u8 lanes_a[16],
     }
 }
 
+FL_OPTIMIZE_FUNCTION
+fl::size wave8_expand_span_simd(const u8* input, fl::size count,
+                                u8 W0, u8 W1,
+                                Wave8Byte* output) FL_NO_EXCEPT {
+    namespace fsimd = fl::simd;
+    FL_ALIGNAS(16) static const u8 kPulseSelect[16] = {
+        0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,
+        0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01};
+    FL_ALIGNAS(16) u8 m0_bytes[16];
+    FL_ALIGNAS(16) u8 d_bytes[16];
+    for (int i = 0; i < 16; ++i) {
+        m0_bytes[i] = W0;
+        d_bytes[i] = (u8)(W0 ^ W1);
+    }
+    const fsimd::simd_u8x16 sel = fsimd::load_u8_16(kPulseSelect);
+    const fsimd::simd_u8x16 m0 = fsimd::load_u8_16(m0_bytes);
+    const fsimd::simd_u8x16 d = fsimd::load_u8_16(d_bytes);
+
+    // Multiplying by 0x0101..01 splats one byte across a u64 — two of those
+    // form one register holding input[i] in lanes 0-7 and input[i+1] in 8-15.
+    const u64 kSplat = 0x0101010101010101ULL;
+    FL_ALIGNAS(16) u64 splat[2];
+    u8* out = fl::bit_cast_ptr<u8>(output);
+    fl::size i = 0;
+    for (; i + 2 <= count; i += 2) {
+        splat[0] = (u64)input[i] * kSplat;
+        splat[1] = (u64)input[i + 1] * kSplat;
+        const fsimd::simd_u8x16 v =
+            fsimd::load_u8_16(fl::bit_cast_ptr<const u8>(splat));
+        const fsimd::simd_u8x16 mask =
+            fsimd::cmpeq_u8_16(fsimd::and_u8_16(v, sel), sel);
+        fsimd::store_u8_16(out + i * sizeof(Wave8Byte),
+                           fsimd::xor_u8_16(m0, fsimd::and_u8_16(mask, d)));
+    }
+    return i;
+}
+
 } // namespace detail
 
 FL_IRAM FL_OPTIMIZE_FUNCTION
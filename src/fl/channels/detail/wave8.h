@@ -12,8 +12,21 @@
 // IWYU pragma: private
 
 #include "fl/channels/wave8.h"
+#include "fl/math/simd.h"
 #include "fl/stl/compiler_control.h"
 
+/// 1 when the fl::simd backend lowers wave8_expand_span_simd() to real vector
+/// instructions (SSE2 and up). Elsewhere the same kernel compiles against the
+/// scalar simd emulation, which is slower than the byte LUT, so the public
+/// wave8ExpandSpan() keeps the byte loop.
+#ifndef FL_WAVE8_EXPAND_SIMD
+#if defined(FASTLED_X86_HAS_SSE2) && FASTLED_X86_HAS_SSE2
+#define FL_WAVE8_EXPAND_SIMD 1
+#else
+#define FL_WAVE8_EXPAND_SIMD 0
+#endif
+#endif
+
 namespace fl {
 
 namespace detail {
@@ -123,6 +136,16 @@ void wave8_transpose_16x4_bf1_pipe4(const u8 lanes_a[16],
                                     u8 output_c[16 * sizeof(Wave8Byte)],
                                     u8 output_d[16 * sizeof(Wave8Byte)]) FL_NO_EXCEPT;
 
+/// @brief Bulk single-lane expansion on fl::simd u8x16 registers.
+///        Two input bytes per register: each byte is splatted across 8 lanes,
+///        masked against {0x80 .. 0x01} and compared to build a per-pulse
+///        select mask, then `W0 ^ (mask & (W0 ^ W1))` yields the symbols.
+///        Same W0/W1 contract as the BF1 kernels. Returns the number of input
+///        bytes consumed (always even); the caller finishes the odd tail.
+fl::size wave8_expand_span_simd(const u8* input, fl::size count,
+                                u8 W0, u8 W1,
+                                Wave8Byte* output) FL_NO_EXCEPT;
+
 } // namespace detail
 
 /// @brief Public single-lane wave8 encoder. Thin wrapper around
@@ -197,6 +197,32 @@ public:
     /// @note Clever implementations may begin transmission early to save memory.
     virtual void enqueue(ChannelDataPtr channelData) FL_NO_EXCEPT = 0;
 
+    /// @brief Optional zero-copy encode target for the next frame of `data`
+    ///
+    /// Channels know the exact encoded size before encoding (see
+    /// fl/chipsets/encoders/output_sink.h). A driver that keeps its own
+    /// DMA-capable staging memory can return a region of at least `bytes`
+    /// bytes here; the channel then encodes straight into it, marks
+    /// `data` with ChannelData::setExternalEncoded(), and the driver reads
+    /// ChannelData::encoded() in enqueue() instead of copying getData().
+    ///
+    /// The region must stay valid and untouched until the driver is done
+    /// transmitting that frame. Return an empty span (the default) to let
+    /// the channel encode into its own buffer. The RMT5 driver hands out
+    /// internal-DRAM pool buffers this way.
+    ///
+    /// Not consulted while ChannelEvents::onChannelDataEncoded has
+    /// listeners, so existing listeners keep seeing the bytes in
+    /// ChannelData::getData(). New listeners should read
+    /// ChannelData::encoded(), which works either way.
+    /// @note Always called from the show() thread, even when encoding
+    ///       itself runs on ChannelManager encode workers.
+    virtual fl::span<u8> acquireEncodeBuffer(const ChannelData& data, fl::size bytes) FL_NO_EXCEPT {
+        (void)data;
+        (void)bytes;
+        return fl::span<u8>();
+    }
+
     /// @brief Trigger transmission of enqueued data
     /// @note May block depending on current driver state (poll() returns BUSY/DRAINING)
     /// @note Typical behavior: Wait for hardware to be READY, then transmit all enqueued data
@@ -2,6 +2,8 @@
 /// @brief Implementation of unified channel bus manager
 
 #include "fl/channels/manager.h"
+#include "fl/channels/channel.h"
+#include "fl/task/parallel_for.h"
 #include "fl/channels/detail/wait_spin_budget.h"
 #include "fl/stl/singleton.h"
 #include "fl/log/log.h"
@@ -10,6 +12,7 @@
 #include "fl/stl/algorithm.h"
 #include "fl/stl/move.h"
 #include "fl/system/trace.h"
+#include "fl/system/frame_telemetry.h"
 #include "fl/task/executor.h"
 #include "fl/net/network_detector.h"
 #include "platforms/init_channel_driver.h"
@@ -567,24 +570,113 @@ bool ChannelManager::waitForReadyOrDraining(u32 timeoutMs) {
 
 
 void ChannelManager::onBeginFrame() {
+    mFrameStartUs = fl::micros();
+    if (isPipelined()) {
+        // Pipelined: only let drivers retire finished buffers. Channels pick
+        // a free ring slot in showPixels() and fence there if none is left.
+        poll();
+        return;
+    }
+    FL_FRAME_STAGE(WAIT);
     waitForReady();  // Wait for all drivers to become READY before clearing previous frame state.
 }
 
 void ChannelManager::onEndFrame() {
+    flushDeferredEncodes();
+
     // Call show() on all drivers to trigger transmission
     // Channels have enqueued data directly to drivers during showPixels()
     // Now we trigger transmission by calling show() on each driver
-    for (auto& entry : mDrivers) {
-        if (entry.enabled) {
-            entry.driver->show();
+    {
+        // Driver show() blocks on hardware that transmits synchronously, so
+        // it counts as waiting on the bus together with the drain below.
+        FL_FRAME_STAGE(WAIT);
+        for (auto& entry : mDrivers) {
+            if (entry.enabled) {
+                entry.driver->show();
+            }
+        }
+        if (!isPipelined()) {
+            waitForReadyOrDraining();
         }
     }
-    waitForReadyOrDraining();
+
+    const u32 elapsed = fl::micros() - mFrameStartUs;
+    mPipelineStats.frames++;
+    mPipelineStats.lastFrameUs = elapsed;
+    if (elapsed > mPipelineStats.maxFrameUs) {
+        mPipelineStats.maxFrameUs = elapsed;
+    }
+}
+
+void ChannelManager::setPipelineDepth(u8 depth) {
+    if (depth < 1) {
+        depth = 1;
+    }
+    if (depth == mPipelineDepth) {
+        return;
+    }
+    // Drain in-flight frames so no channel switches ring size while the
+    // driver still owns one of its buffers.
+    waitForReady();
+    mPipelineDepth = depth;
+    resetPipelineStats();
+}
+
+void ChannelManager::setEncodeWorkers(u8 workers) {
+    if (!fl::task::parallelForSupported() || workers < 1) {
+        workers = 1;
+    }
+    if (workers > fl::task::kMaxParallelWorkers) {
+        workers = fl::task::kMaxParallelWorkers;
+    }
+    // Anything deferred under the old setting still has to go out.
+    flushDeferredEncodes();
+    mEncodeWorkers = workers;
+}
+
+void ChannelManager::deferEncode(Channel* channel) {
+    mDeferredEncodes.push_back(channel);
+}
+
+void ChannelManager::cancelDeferredEncode(Channel* channel) {
+    for (fl::size i = 0; i < mDeferredEncodes.size(); ++i) {
+        if (mDeferredEncodes[i] == channel) {
+            mDeferredEncodes.erase(mDeferredEncodes.begin() + i);
+            return;
+        }
+    }
+}
+
+void ChannelManager::flushDeferredEncodes() {
+    if (mDeferredEncodes.empty()) {
+        return;
+    }
+    FL_SCOPED_TRACE;
+    fl::vector<Channel*>& pending = mDeferredEncodes;
+    // Output buffers were claimed serially in Channel::showPixels(); the
+    // workers only run encoders.
+    fl::task::parallelFor(pending.size(), mEncodeWorkers,
+                          [&pending](fl::size i) { pending[i]->encodeDeferred(); });
+    // Events and driver enqueues stay on the calling thread, in draw order.
+    for (Channel* channel : pending) {
+        channel->enqueueDeferred();
+    }
+    pending.clear();
+}
+
+void ChannelManager::recordPipelineFence(u32 waitUs) {
+    mPipelineStats.fenceWaits++;
+    mPipelineStats.fenceWaitUs += waitUs;
+#if FASTLED_FRAME_TELEMETRY
+    FrameTelemetry::instance().addStage(FrameStage::WAIT, waitUs);
+#endif
 }
 
 void ChannelManager::reset() {
     // Allow all channel drivers to clean up
     waitForReady();
+    resetPipelineStats();
     FL_DBG_F("ChannelManager: reset() - all drivers ready");
 }
 
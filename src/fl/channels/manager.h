@@ -35,6 +35,8 @@
 
 namespace fl {
 
+class Channel;
+
 /// @brief Driver state information for channel manager
 struct DriverInfo {
     fl::string name;  ///< Driver name (empty for unnamed drivers)
@@ -247,6 +249,62 @@ public:
     /// @note Call this between test cases or when reinitializing the LED system
     void reset() FL_NO_EXCEPT;
 
+    /// @brief Per-frame counters for the pipelined show() mode
+    struct PipelineStats {
+        u32 frames = 0;         ///< Frames shown since the last reset
+        u32 lastFrameUs = 0;    ///< show() blocking time of the most recent frame
+        u32 maxFrameUs = 0;     ///< Worst show() blocking time seen
+        u32 fenceWaits = 0;     ///< Times a channel found every ring buffer still in flight
+        u32 fenceWaitUs = 0;    ///< Total time spent blocked on those fences
+    };
+
+    /// @brief Set how many ChannelData buffers each channel rotates through
+    /// @param depth 1 = legacy (each frame waits for the previous one to
+    ///        finish transmitting), 2+ = pipelined (frame N+1 is encoded into
+    ///        a free buffer while the driver still transmits frame N)
+    /// @note In pipelined mode onBeginFrame() only polls drivers instead of
+    ///       blocking until READY, and onEndFrame() returns right after
+    ///       show(). Channels block only when their whole ring is in flight.
+    void setPipelineDepth(u8 depth) FL_NO_EXCEPT;
+
+    /// @brief Current ring depth (1 = not pipelined)
+    u8 getPipelineDepth() const FL_NO_EXCEPT { return mPipelineDepth; }
+
+    /// @brief True when frame pipelining is enabled (depth > 1)
+    bool isPipelined() const FL_NO_EXCEPT { return mPipelineDepth > 1; }
+
+    /// @brief Latency and fence counters collected since the last reset
+    const PipelineStats& getPipelineStats() const FL_NO_EXCEPT { return mPipelineStats; }
+
+    /// @brief Zero the pipeline counters
+    void resetPipelineStats() FL_NO_EXCEPT { mPipelineStats = PipelineStats(); }
+
+    /// @brief Encode channels in parallel on a worker pool (host/stub builds)
+    /// @param workers Threads to fan encoding across, including the caller.
+    ///        0 or 1 = encode serially inside each Channel::showPixels()
+    ///        (default). Clamped to 1 where `fl::thread` is not a real thread
+    ///        (see FASTLED_PARALLEL_FOR).
+    /// @note When enabled, Channel::showPixels() only snapshots its pixels.
+    ///       onEndFrame() encodes every deferred channel across the pool,
+    ///       then enqueues them to their drivers in draw-list order before
+    ///       calling show().
+    void setEncodeWorkers(u8 workers) FL_NO_EXCEPT;
+
+    /// @brief Current encode worker count (1 = serial)
+    u8 getEncodeWorkers() const FL_NO_EXCEPT { return mEncodeWorkers; }
+
+    /// @brief Queue a channel whose encoder will run in onEndFrame()
+    /// @note Called by Channel::showPixels(); not intended for user code
+    void deferEncode(Channel* channel) FL_NO_EXCEPT;
+
+    /// @brief Drop a queued channel (used when it is destroyed mid-frame)
+    void cancelDeferredEncode(Channel* channel) FL_NO_EXCEPT;
+
+    /// @brief Record a channel blocking on a full buffer ring
+    /// @param waitUs Time spent waiting for the driver to release a buffer
+    /// @note Called by Channel::showPixels(); not intended for user code
+    void recordPipelineFence(u32 waitUs) FL_NO_EXCEPT;
+
 private:
     enum class AddDriverSlowReason : u8 {
         NULL_DRIVER,
@@ -316,6 +374,25 @@ private:
     /// @brief Platform wait primitive owned by the manager.
     platforms::ChannelPollSignal mPollNeededSignal;
 
+    /// @brief ChannelData ring depth per channel (1 = legacy single buffer)
+    u8 mPipelineDepth = 1;
+
+    /// @brief micros() at onBeginFrame(), used for per-frame latency
+    u32 mFrameStartUs = 0;
+
+    /// @brief Counters exposed via getPipelineStats()
+    PipelineStats mPipelineStats;
+
+    /// @brief Encode deferred channels in parallel: run each one's encoder on
+    ///        the worker pool, then enqueue them on the calling thread.
+    void flushDeferredEncodes() FL_NO_EXCEPT;
+
+    /// @brief Threads used by the parallel encode stage (1 = serial)
+    u8 mEncodeWorkers = 1;
+
+    /// @brief Channels that deferred encoding to onEndFrame() this frame
+    fl::vector<Channel*> mDeferredEncodes;
+
     // Non-copyable, non-movable
     ChannelManager(const ChannelManager&) FL_NO_EXCEPT = delete;
     ChannelManager& operator=(const ChannelManager&) FL_NO_EXCEPT = delete;
@@ -51,6 +51,8 @@ struct ChannelOptions {
     Bus mBus = Bus::AUTO;              // Typed driver selection
     fl::u8 mBusWhich = 0;              // Instance selector for portable buses
     fl::optional<float> mGamma;        // Gamma correction (nullopt = use default 2.8)
+    bool mSkipUnchanged = false;       // Reuse the last encoding when nothing changed
+                                       // (see Channel::setSkipUnchanged())
 
     /// @return The active Rgbw if mWhiteCfg holds one, else RgbwInvalid::value().
     /// Backward-compat shim for code paths that pre-date the variant migration.
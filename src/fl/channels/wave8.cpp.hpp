@@ -156,6 +156,34 @@ void wave8Transpose_16x2_pipe2(const u8 (&FL_RESTRICT_PARAM lanes_a)[16],
                                        output_a, output_b);
 }
 
+fl::size wave8ExpandSpan_scalar(fl::span<const u8> input,
+                                const Wave8ByteExpansionLut &lut,
+                                fl::span<Wave8Byte> output) {
+    const fl::size count = fl::min(input.size(), output.size());
+    for (fl::size i = 0; i < count; ++i) {
+        detail::wave8_expand_byte(input[i], lut, &output[i]);
+    }
+    return count;
+}
+
+FL_OPTIMIZE_FUNCTION
+fl::size wave8ExpandSpan(fl::span<const u8> input,
+                         const Wave8ByteExpansionLut &lut,
+                         fl::span<Wave8Byte> output) {
+    const fl::size count = fl::min(input.size(), output.size());
+    fl::size done = 0;
+#if FL_WAVE8_EXPAND_SIMD
+    const u8 W0 = lut.lut[0x00].symbols[0].data;
+    const u8 W1 = lut.lut[0xFF].symbols[0].data;
+    done = detail::wave8_expand_span_simd(input.data(), count, W0, W1,
+                                          output.data());
+#endif
+    for (; done < count; ++done) {
+        detail::wave8_expand_byte(input[done], lut, &output[done]);
+    }
+    return count;
+}
+
 FL_OPTIMIZE_FUNCTION FL_IRAM
 void wave8Transpose_16_bf1(const u8 (&FL_RESTRICT_PARAM lanes)[16],
                            const Wave8ByteExpansionLut &lut,
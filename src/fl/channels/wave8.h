@@ -6,6 +6,7 @@
 
 #include "fl/stl/align.h"
 #include "fl/stl/compiler_control.h"
+#include "fl/stl/span.h"
 #include "fl/stl/stdint.h"
 
 namespace fl {
@@ -90,6 +91,24 @@ void wave8(u8 lane,
            const Wave8BitExpansionLut &lut,
            u8 (&FL_RESTRICT_PARAM output)[sizeof(Wave8Byte)]);
 
+/// @brief Expand a whole buffer: output[i] = wave8 symbols of input[i].
+///
+/// Bulk counterpart of wave8_expand_byte() for single-lane encoders that
+/// expand a full pixel buffer per frame. On SSE2 hosts the body runs on
+/// fl::simd u8x16 registers (see detail::wave8_expand_span_simd); elsewhere
+/// it is the byte loop. Like the BF1 kernels it reads the bit-0/bit-1
+/// waveforms from lut[0x00]/lut[0xFF], which holds for every LUT built by
+/// buildWave8ByteExpansionLUT().
+/// @return Number of bytes expanded: min(input.size(), output.size()).
+fl::size wave8ExpandSpan(fl::span<const u8> input,
+                         const Wave8ByteExpansionLut &lut,
+                         fl::span<Wave8Byte> output);
+
+/// @brief Scalar reference for wave8ExpandSpan(): one byte-LUT copy per byte.
+fl::size wave8ExpandSpan_scalar(fl::span<const u8> input,
+                                const Wave8ByteExpansionLut &lut,
+                                fl::span<Wave8Byte> output);
+
 // Public transposition functions (implementations in wave8.cpp)
 void wave8Transpose_2(
     const u8 (&FL_RESTRICT_PARAM lanes)[2],
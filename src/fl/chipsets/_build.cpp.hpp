@@ -2,4 +2,8 @@
 /// @brief Unity build header for fl/chipsets/ directory
 /// Includes all implementation files in alphabetical order
 
+// begin current directory includes
 #include "fl/chipsets/ucs7604.cpp.hpp"
+
+// begin sub directory includes
+#include "fl/chipsets/encoders/_build.cpp.hpp"
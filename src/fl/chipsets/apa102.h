@@ -189,20 +189,16 @@ private:
 		#endif
 		const CRGB colors_scale(scale_r, scale_g, scale_b);
 
-		// RGB reorder indices (compile-time constant from RGB_ORDER template param)
-		const fl::u8 b0_index = (static_cast<int>(RGB_ORDER) >> 6) & 0x3;
-		const fl::u8 b1_index = (static_cast<int>(RGB_ORDER) >> 3) & 0x3;
-		const fl::u8 b2_index = static_cast<int>(RGB_ORDER) & 0x3;
-
 		mSPI.select();
 		startBoundary();
 
-		// Process pixels in batches of 8 using stack-allocated buffers
+		// Gamma, 5-bit brightness and LED-frame bytes are produced in one
+		// fused pass per batch of 8; only the raw pixels are staged.
 		fl::u16 remaining = n;
 		while (remaining > 0) {
 			const fl::u16 batch = (remaining < kBatchSize) ? remaining : kBatchSize;
 			CRGB input_buf[kBatchSize];
-			fl::CRGBA5 gamma_buf[kBatchSize];
+			fl::u8 frame_buf[kBatchSize * 4];
 
 			// Copy raw pixel bytes into CRGB input buffer
 			for (fl::u16 i = 0; i < batch; ++i) {
@@ -211,14 +207,13 @@ private:
 				pixels.advanceData();
 			}
 
-			fl::five_bit_hd_gamma_bitshift(
+			fl::five_bit_hd_gamma_apa102_frames(
 				fl::span<const CRGB>(input_buf, batch), colors_scale, global_brightness,
-				fl::span<fl::CRGBA5>(gamma_buf, batch));
+				RGB_ORDER, fl::span<fl::u8>(frame_buf, batch * 4));
 
 			for (fl::u16 i = 0; i < batch; ++i) {
-				const CRGB& rgb = gamma_buf[i].color;
-				writeLed(gamma_buf[i].brightness_5bit,
-				         rgb.raw[b0_index], rgb.raw[b1_index], rgb.raw[b2_index]);
+				const fl::u8* f = frame_buf + i * 4;
+				writeLed(f[0] & 0x1F, f[1], f[2], f[3]);
 			}
 
 			remaining -= batch;
@@ -0,0 +1,5 @@
+/// @file _build.hpp
+/// @brief Unity build header for fl/chipsets/encoders/ directory
+/// Includes all implementation files in alphabetical order
+
+#include "fl/chipsets/encoders/prepare_frame.cpp.hpp"
@@ -32,6 +32,14 @@ namespace fl {
 // For APA102HD usage, the chipset controller uses ScaledPixelIteratorRGB + ScaledPixelIteratorBrightness
 // with the existing encodeAPA102_HD() function that accepts separate RGB and brightness iterators.
 
+/// @brief Exact encoded size of an APA102 frame
+/// @param num_leds Number of LEDs
+/// @return Start frame (4) + 4 bytes per LED + end frame ((num_leds / 32) + 1 DWords).
+///         The same for every encodeAPA102* variant, including zero LEDs.
+inline size_t apa102EncodedSize(size_t num_leds) FL_NO_EXCEPT {
+    return 4 + num_leds * 4 + ((num_leds / 32) + 1) * 4;
+}
+
 /// @brief Encode pixel data in APA102 format with global brightness
 /// @tparam InputIterator Iterator yielding fl::array<u8, 3> (3 bytes in wire order)
 /// @tparam OutputIterator Output iterator accepting uint8_t
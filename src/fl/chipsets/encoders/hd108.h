@@ -25,6 +25,13 @@
 
 namespace fl {
 
+/// @brief Exact encoded size of an HD108 frame
+/// @param num_leds Number of LEDs
+/// @return Start frame (8) + 8 bytes per LED + end frame ((num_leds / 2) + 4)
+inline size_t hd108EncodedSize(size_t num_leds) FL_NO_EXCEPT {
+    return 8 + num_leds * 8 + num_leds / 2 + 4;
+}
+
 /// @brief Encode pixel data in HD108 format with global brightness
 /// @tparam InputIterator Iterator yielding fl::array<u8, 3> (3 bytes in wire order)
 /// @tparam OutputIterator Output iterator accepting uint8_t
@@ -24,6 +24,13 @@
 
 namespace fl {
 
+/// @brief Exact encoded size of an LPD6803 frame
+/// @param num_leds Number of LEDs
+/// @return Start boundary (4) + 2 bytes per LED + (num_leds / 32) end DWords
+inline size_t lpd6803EncodedSize(size_t num_leds) FL_NO_EXCEPT {
+    return 4 + num_leds * 2 + (num_leds / 32) * 4;
+}
+
 /// @brief Encode pixel data in LPD6803 format
 /// @tparam InputIterator Iterator yielding fl::array<u8, 3> (3 bytes in wire order)
 /// @tparam OutputIterator Output iterator accepting uint8_t
@@ -22,6 +22,13 @@
 
 namespace fl {
 
+/// @brief Exact encoded size of an LPD8806 frame
+/// @param num_leds Number of LEDs
+/// @return 3 bytes per LED + ((num_leds * 3 + 63) / 64) latch bytes
+inline size_t lpd8806EncodedSize(size_t num_leds) FL_NO_EXCEPT {
+    return num_leds * 3 + (num_leds * 3 + 63) / 64;
+}
+
 /// @brief Encode pixel data in LPD8806 format
 /// @tparam InputIterator Iterator yielding fl::array<u8, 3> (3 bytes in wire order)
 /// @tparam OutputIterator Output iterator accepting uint8_t
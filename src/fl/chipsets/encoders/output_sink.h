@@ -7,6 +7,12 @@
 /// that allow encoder free functions to work with both buffer-based
 /// (PixelIterator) and hardware-based (template controllers) architectures.
 
+#include "fl/stl/assert.h"
+#include "fl/stl/compiler_control.h"
+#include "fl/stl/int.h"
+#include "fl/stl/noexcept.h"
+#include "fl/stl/span.h"
+
 namespace fl {
 
 /// @brief OutputSink Concept
@@ -46,4 +52,54 @@ namespace fl {
 /// @note fl::back_inserter is defined in fl/stl/iterator.h
 /// @note Pixel iterator adapters are in fl/chipsets/encoders/pixel_iterator_adapters.h
 
+/// @brief Fixed-size byte sink for encoding straight into a preallocated region
+///
+/// Every encoder has an exact output size known before it runs
+/// (ws2812EncodedSize(), apa102EncodedSize(), lpd8806EncodedSize(), ...).
+/// Size the destination once - a driver DMA buffer or a ChannelData
+/// buffer - and hand the encoder
+/// `fl::back_inserter(sink)`. push_back() is then a pointer store behind a
+/// single bounds compare: no reallocation, no second copy into the driver.
+///
+/// Overrunning the span is a bug in the size calculation: it asserts in
+/// debug builds, and in release the excess bytes are dropped (size() stops
+/// growing) rather than written past the end.
+///
+/// @example
+/// ```cpp
+/// fl::span<u8> dma = driver->acquireEncodeBuffer(data, apa102EncodedSize(n));
+/// fl::SpanSink sink(dma);
+/// encodeAPA102(first, last, fl::back_inserter(sink), 31);
+/// // sink.size() == apa102EncodedSize(n)
+/// ```
+class SpanSink {
+  public:
+    using value_type = u8;
+
+    explicit SpanSink(fl::span<u8> dst) FL_NO_EXCEPT
+        : mBegin(dst.data()), mCur(dst.data()), mEnd(dst.data() + dst.size()) {}
+
+    FASTLED_FORCE_INLINE void push_back(u8 byte) FL_NO_EXCEPT {
+        if (mCur == mEnd) {
+            FL_ASSERT(false, "SpanSink overrun: encoded size was underestimated");
+            return;
+        }
+        *mCur++ = byte;
+    }
+
+    /// @brief Bytes written so far
+    fl::size size() const FL_NO_EXCEPT { return static_cast<fl::size>(mCur - mBegin); }
+
+    /// @brief Bytes left before the end of the destination
+    fl::size remaining() const FL_NO_EXCEPT { return static_cast<fl::size>(mEnd - mCur); }
+
+    /// @brief The written prefix of the destination
+    fl::span<u8> written() const FL_NO_EXCEPT { return fl::span<u8>(mBegin, size()); }
+
+  private:
+    u8 *mBegin;
+    u8 *mCur;
+    u8 *mEnd;
+};
+
 } // namespace fl
@@ -22,6 +22,13 @@
 
 namespace fl {
 
+/// @brief Exact encoded size of a P9813 frame
+/// @param num_leds Number of LEDs
+/// @return Start boundary (4) + 4 bytes per LED + end boundary (4)
+inline size_t p9813EncodedSize(size_t num_leds) FL_NO_EXCEPT {
+    return 8 + num_leds * 4;
+}
+
 /// @brief Encode pixel data in P9813 format
 /// @tparam InputIterator Iterator yielding fl::array<u8, 3> (3 bytes in wire order)
 /// @tparam OutputIterator Output iterator accepting uint8_t
@@ -7,6 +7,9 @@
 #include "fl/stl/string.h"
 #include "fl/stl/iterator.h"
 #include "fl/stl/compiler_control.h"
+#include "fl/stl/singleton.h"
+#include "fl/stl/static_assert.h"
+#include "fl/stl/vector.h"
 #include "fl/gfx/rgbw.h"
 #include "fl/gfx/rgbww.h"
 #include "crgb.h"
@@ -27,6 +30,7 @@
 // This provides the full definitions of ScaledPixelIterator* classes
 // and makeScaledPixelRange* helper functions
 #include "fl/chipsets/encoders/pixel_iterator_adapters.h"
+#include "fl/chipsets/encoders/prepare_frame.h"
 #include "fl/stl/noexcept.h"
 
 namespace fl {
@@ -66,6 +70,12 @@ struct PixelControllerVtable {
   // NOTE: loadAndScale_APA102_HD() removed - use fl::loadAndScale_APA102_HD<RGB_ORDER>() from apa102.h encoder
   // NOTE: loadAndScale_WS2816_HD() removed - use fl::loadAndScale_WS2816_HD<RGB_ORDER>() from ws2816.h encoder
 
+  static void prepareFrame(void* pixel_controller, fl::vector<u8>* out) FL_NO_EXCEPT {
+    PixelControllerT* pc = static_cast<PixelControllerT*>(pixel_controller);
+    out->resize(static_cast<fl::size>(pc->mLenRemaining) * 3);
+    pc->prepareFrame(out->data());
+  }
+
   static void stepDithering(void* pixel_controller) FL_NO_EXCEPT {
     PixelControllerT* pc = static_cast<PixelControllerT*>(pixel_controller);
     pc->stepDithering();
@@ -104,6 +114,7 @@ typedef void (*loadAndScaleRGBWWFunction)(void* pixel_controller, Rgbww rgbww, u
 typedef void (*loadAndScaleRGBFunction)(void* pixel_controller, u8* r_out, u8* g_out, u8* b_out);
 // NOTE: loadAndScale_APA102_HDFunction removed - use fl::loadAndScale_APA102_HD<RGB_ORDER>() from apa102.h encoder
 // NOTE: loadAndScale_WS2816_HDFunction removed - use fl::loadAndScale_WS2816_HD<RGB_ORDER>() from ws2816.h encoder
+typedef void (*prepareFrameFunction)(void* pixel_controller, fl::vector<u8>* out);
 typedef void (*stepDitheringFunction)(void* pixel_controller);
 typedef void (*advanceDataFunction)(void* pixel_controller);
 typedef int (*sizeFunction)(void* pixel_controller);
@@ -155,6 +166,7 @@ class PixelIterator {
       mLoadAndScaleRGB = &Vtable::loadAndScaleRGB;
       // NOTE: mLoadAndScale_APA102_HD removed - use fl::loadAndScale_APA102_HD<RGB_ORDER>() from apa102.h encoder
       // NOTE: mLoadAndScale_WS2816_HD removed - use fl::loadAndScale_WS2816_HD<RGB_ORDER>() from ws2816.h encoder
+      mPrepareFrame = &Vtable::prepareFrame;
       mStepDithering = &Vtable::stepDithering;
       mAdvanceData = &Vtable::advanceData;
       mSize = &Vtable::size;
@@ -178,6 +190,25 @@ class PixelIterator {
     }
     // NOTE: loadAndScale_APA102_HD() removed - use fl::loadAndScale_APA102_HD<RGB_ORDER>() from apa102.h encoder
     // NOTE: loadAndScale_WS2816_HD() removed - use fl::loadAndScale_WS2816_HD<RGB_ORDER>() from ws2816.h encoder
+    /// @brief Scales, dithers and reorders every remaining pixel in one bulk
+    ///        pass (see fl::prepareFrameRGB()) into a thread-local staging
+    ///        buffer, so encoders read wire-order bytes linearly instead of
+    ///        calling through the vtable per pixel.
+    /// @return Pixel range valid until the next prepareRGB() on this thread.
+    ///         The iterator itself is not advanced.
+    fl::pair<const array<u8, 3>*, const array<u8, 3>*> prepareRGB() FL_NO_EXCEPT;
+
+#if FL_PREPARE_FRAME_SIMD
+    using ScaledRGBRange = fl::pair<const array<u8, 3>*, const array<u8, 3>*>;
+#else
+    using ScaledRGBRange =
+        pair<detail::ScaledPixelIteratorRGB, detail::ScaledPixelIteratorRGB>;
+#endif
+    /// @brief Wire-order RGB source for the plain-RGB write paths: the
+    ///        staged frame from prepareRGB() where FL_PREPARE_FRAME_SIMD is
+    ///        set, else the per-pixel iterator (no staging buffer).
+    ScaledRGBRange scaledRGB() FL_NO_EXCEPT;
+
     void stepDithering() FL_NO_EXCEPT { mStepDithering(mPixelController); }
     void advanceData() FL_NO_EXCEPT { mAdvanceData(mPixelController); }
     int size() FL_NO_EXCEPT { return mSize(mPixelController); }
@@ -211,7 +242,7 @@ class PixelIterator {
             auto range = makeScaledPixelRangeRGBW(this);
             encodeWS2812_RGBW(range.first, range.second, back_ins);
         } else {
-            auto range = makeScaledPixelRangeRGB(this);
+            auto range = scaledRGB();
             encodeWS2812_RGB(range.first, range.second, back_ins);
         }
     }
@@ -245,12 +276,12 @@ class PixelIterator {
 
         #if FASTLED_USE_GLOBAL_BRIGHTNESS == 1
         // Global brightness mode: extract from first pixel
-        auto pixel_range = makeScaledPixelRangeRGB(this);
+        auto pixel_range = scaledRGB();
         encodeAPA102_AutoBrightness(pixel_range.first, pixel_range.second,
                                               back_ins);
         #else
         // Full brightness mode
-        auto pixel_range = makeScaledPixelRangeRGB(this);
+        auto pixel_range = scaledRGB();
         encodeAPA102(pixel_range.first, pixel_range.second,
                                back_ins, 31);
         #endif
@@ -277,12 +308,12 @@ class PixelIterator {
 
         #if FASTLED_USE_GLOBAL_BRIGHTNESS == 1
         // Global brightness mode: extract from first pixel
-        auto pixel_range = makeScaledPixelRangeRGB(this);
+        auto pixel_range = scaledRGB();
         encodeSK9822_AutoBrightness(pixel_range.first, pixel_range.second,
                                               back_ins);
         #else
         // Full brightness mode
-        auto pixel_range = makeScaledPixelRangeRGB(this);
+        auto pixel_range = scaledRGB();
         encodeSK9822(pixel_range.first, pixel_range.second,
                                back_ins, 31);
         #endif
@@ -298,7 +329,7 @@ class PixelIterator {
     template <typename CONTAINER_UIN8_T>
     void writeWS2801(CONTAINER_UIN8_T* out) FL_NO_EXCEPT {
         auto back_ins = fl::back_inserter(*out);
-        auto pixel_range = makeScaledPixelRangeRGB(this);
+        auto pixel_range = scaledRGB();
         encodeWS2801(pixel_range.first, pixel_range.second, back_ins);
     }
 
@@ -309,7 +340,7 @@ class PixelIterator {
     template <typename CONTAINER_UIN8_T>
     void writeWS2803(CONTAINER_UIN8_T* out) FL_NO_EXCEPT {
         auto back_ins = fl::back_inserter(*out);
-        auto pixel_range = makeScaledPixelRangeRGB(this);
+        auto pixel_range = scaledRGB();
         encodeWS2803(pixel_range.first, pixel_range.second, back_ins);
     }
 
@@ -319,7 +350,7 @@ class PixelIterator {
     template <typename CONTAINER_UIN8_T>
     void writeP9813(CONTAINER_UIN8_T* out) FL_NO_EXCEPT {
         auto back_ins = fl::back_inserter(*out);
-        auto pixel_range = makeScaledPixelRangeRGB(this);
+        auto pixel_range = scaledRGB();
         encodeP9813(pixel_range.first, pixel_range.second, back_ins);
     }
 
@@ -329,7 +360,7 @@ class PixelIterator {
     template <typename CONTAINER_UIN8_T>
     void writeLPD8806(CONTAINER_UIN8_T* out) FL_NO_EXCEPT {
         auto back_ins = fl::back_inserter(*out);
-        auto pixel_range = makeScaledPixelRangeRGB(this);
+        auto pixel_range = scaledRGB();
         encodeLPD8806(pixel_range.first, pixel_range.second, back_ins);
     }
 
@@ -339,7 +370,7 @@ class PixelIterator {
     template <typename CONTAINER_UIN8_T>
     void writeLPD6803(CONTAINER_UIN8_T* out) FL_NO_EXCEPT {
         auto back_ins = fl::back_inserter(*out);
-        auto pixel_range = makeScaledPixelRangeRGB(this);
+        auto pixel_range = scaledRGB();
         encodeLPD6803(pixel_range.first, pixel_range.second, back_ins);
     }
 
@@ -349,7 +380,7 @@ class PixelIterator {
     template <typename CONTAINER_UIN8_T>
     void writeSM16716(CONTAINER_UIN8_T* out) FL_NO_EXCEPT {
         auto back_ins = fl::back_inserter(*out);
-        auto pixel_range = makeScaledPixelRangeRGB(this);
+        auto pixel_range = scaledRGB();
         encodeSM16716(pixel_range.first, pixel_range.second, back_ins);
     }
 
@@ -368,7 +399,7 @@ class PixelIterator {
                                  brightness_range.first, back_ins);
         #else
         // Standard mode: global brightness (255 = full)
-        auto pixel_range = makeScaledPixelRangeRGB(this);
+        auto pixel_range = scaledRGB();
         encodeHD108(pixel_range.first, pixel_range.second,
                               back_ins, 255);
         #endif
@@ -384,6 +415,7 @@ class PixelIterator {
     loadAndScaleRGBFunction mLoadAndScaleRGB = nullptr;
     // NOTE: mLoadAndScale_APA102_HD removed - use fl::loadAndScale_APA102_HD<RGB_ORDER>() from apa102.h encoder
     // NOTE: mLoadAndScale_WS2816_HD removed - use fl::loadAndScale_WS2816_HD<RGB_ORDER>() from ws2816.h encoder
+    prepareFrameFunction mPrepareFrame = nullptr;
     stepDitheringFunction mStepDithering = nullptr;
     advanceDataFunction mAdvanceData = nullptr;
     sizeFunction mSize = nullptr;
@@ -395,6 +427,31 @@ class PixelIterator {
 };
 
 
+namespace detail {
+/// Per-thread staging buffer behind PixelIterator::prepareRGB(). Thread-local
+/// so parallel channel encodes never share it.
+struct PreparedFrameBuffer {
+    fl::vector<u8> bytes;
+};
+} // namespace detail
+
+inline fl::pair<const array<u8, 3>*, const array<u8, 3>*> PixelIterator::prepareRGB() FL_NO_EXCEPT {
+    FL_STATIC_ASSERT(sizeof(array<u8, 3>) == 3, "array<u8, 3> must be tightly packed");
+    fl::vector<u8>& staging =
+        SingletonThreadLocal<detail::PreparedFrameBuffer>::instance().bytes;
+    mPrepareFrame(mPixelController, &staging);
+    const array<u8, 3>* first = reinterpret_cast<const array<u8, 3>*>(staging.data());  // ok reinterpret cast
+    return fl::make_pair(first, first + staging.size() / 3);
+}
+
+inline PixelIterator::ScaledRGBRange PixelIterator::scaledRGB() FL_NO_EXCEPT {
+#if FL_PREPARE_FRAME_SIMD
+    return prepareRGB();
+#else
+    return makeScaledPixelRangeRGB(this);
+#endif
+}
+
 // ===========================================================================
 // Implementation of adapter advance() methods
 // ===========================================================================
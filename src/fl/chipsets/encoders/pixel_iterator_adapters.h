@@ -444,8 +444,8 @@ makeScaledPixelRangeRGB16(PixelIterator* pixels) FL_NO_EXCEPT {
 // NOTE: For APA102 HD mode, the chipset-specific gamma correction (five_bit_hd_gamma_bitshift)
 // needs to be applied. Since this is chipset-specific and not a general iterator adapter concern,
 // the APA102 controller applies it inline in the showPixelsGammaBitShift() method.
-// The controller uses getRawPixelData() to get raw RGB, applies gamma with loadRGBScaleAndBrightness(),
-// then uses loadAndScaleRGB() to get wire-ordered output.
+// The controller uses getRawPixelData() to get raw RGB and loadRGBScaleAndBrightness() for the
+// uniform scale, then five_bit_hd_gamma_apa102_frames() emits wire-ordered LED frames directly.
 
 } // namespace fl
 
@@ -0,0 +1,113 @@
+// ok no header - implementation for fl/chipsets/encoders/prepare_frame.h.
+
+#include "fl/chipsets/encoders/prepare_frame.h"
+
+#include "fl/math/math8.h"
+#include "fl/math/scale8.h"
+#include "fl/math/simd.h"
+#include "fl/stl/compiler_control.h"
+
+FL_OPTIMIZATION_LEVEL_O3_BEGIN
+
+namespace fl {
+
+namespace {
+
+// 16 pixels = 48 bytes = 3 vectors. Scale repeats every 3 bytes and dither
+// every 6 (two pixels), so one 48-byte pattern covers every block.
+constexpr fl::size kBlockPixels = 16;
+constexpr fl::size kBlockBytes = kBlockPixels * 3;
+
+FASTLED_FORCE_INLINE u8 prepareByte(u8 b, u8 dither, u8 scale) FL_NO_EXCEPT {
+    return fl::scale8(b ? fl::qadd8(b, dither) : 0, scale);
+}
+
+FASTLED_FORCE_INLINE simd::simd_u8x16 prepareVec(simd::simd_u8x16 b,
+                                                 simd::simd_u8x16 dither,
+                                                 simd::simd_u8x16 scale) FL_NO_EXCEPT {
+    const simd::simd_u8x16 zero = simd::cmpeq_u8_16(b, simd::xor_u8_16(b, b));
+    const simd::simd_u8x16 dithered = simd::andnot_u8_16(zero, simd::add_sat_u8_16(b, dither));
+
+    simd::simd_u16x8 lo = simd::widen_lo_u8_to_u16(dithered);
+    simd::simd_u16x8 hi = simd::widen_hi_u8_to_u16(dithered);
+    simd::simd_u16x8 lo_p = simd::mullo_u16_8(lo, simd::widen_lo_u8_to_u16(scale));
+    simd::simd_u16x8 hi_p = simd::mullo_u16_8(hi, simd::widen_hi_u8_to_u16(scale));
+#if (FASTLED_SCALE8_FIXED == 1)
+    // scale8() multiplies by (scale + 1): add the value once more.
+    lo_p = simd::add_u16_8(lo_p, lo);
+    hi_p = simd::add_u16_8(hi_p, hi);
+#endif
+    return simd::narrow_u16_to_u8(simd::srli_u16_8(lo_p, 8), simd::srli_u16_8(hi_p, 8));
+}
+
+} // namespace
+
+void prepareFrameRGB(const u8 *src, fl::size count, int stride,
+                     const FramePrep &prep, u8 *out) FL_NO_EXCEPT {
+    const u8 o0 = prep.order[0];
+    const u8 o1 = prep.order[1];
+    const u8 o2 = prep.order[2];
+    u8 dEven[3];
+    u8 dOdd[3];
+    for (int k = 0; k < 3; ++k) {
+        dEven[k] = prep.dither[k];
+        dOdd[k] = static_cast<u8>(prep.ditherMax[k] - prep.dither[k]);
+    }
+
+    if (stride != 3) {
+        // Solid fills and padded layouts: plain per-pixel loop.
+        const u8 *p = src;
+        for (fl::size i = 0; i < count; ++i, p += stride, out += 3) {
+            const u8 *d = (i & 1) ? dOdd : dEven;
+            out[0] = prepareByte(p[o0], d[0], prep.scale[0]);
+            out[1] = prepareByte(p[o1], d[1], prep.scale[1]);
+            out[2] = prepareByte(p[o2], d[2], prep.scale[2]);
+        }
+        return;
+    }
+
+    // Reorder into wire order first; everything after is per wire slot.
+    for (fl::size i = 0; i < count; ++i) {
+        const u8 *p = src + i * 3;
+        u8 *w = out + i * 3;
+        w[0] = p[o0];
+        w[1] = p[o1];
+        w[2] = p[o2];
+    }
+
+    u8 scalePattern[kBlockBytes];
+    u8 ditherPattern[kBlockBytes];
+    for (fl::size j = 0; j < kBlockBytes; ++j) {
+        const fl::size k = j % 3;
+        scalePattern[j] = prep.scale[k];
+        ditherPattern[j] = ((j / 3) & 1) ? dOdd[k] : dEven[k];
+    }
+    simd::simd_u8x16 scaleVec[3];
+    simd::simd_u8x16 ditherVec[3];
+    for (int v = 0; v < 3; ++v) {
+        scaleVec[v] = simd::load_u8_16(scalePattern + v * 16);
+        ditherVec[v] = simd::load_u8_16(ditherPattern + v * 16);
+    }
+
+    const fl::size blocks = count / kBlockPixels;
+    for (fl::size blk = 0; blk < blocks; ++blk) {
+        u8 *w = out + blk * kBlockBytes;
+        for (int v = 0; v < 3; ++v) {
+            simd::store_u8_16(w + v * 16,
+                              prepareVec(simd::load_u8_16(w + v * 16), ditherVec[v], scaleVec[v]));
+        }
+    }
+
+    // Blocks hold an even pixel count, so the tail keeps the same parity.
+    for (fl::size i = blocks * kBlockPixels; i < count; ++i) {
+        u8 *w = out + i * 3;
+        const u8 *d = (i & 1) ? dOdd : dEven;
+        w[0] = prepareByte(w[0], d[0], prep.scale[0]);
+        w[1] = prepareByte(w[1], d[1], prep.scale[1]);
+        w[2] = prepareByte(w[2], d[2], prep.scale[2]);
+    }
+}
+
+} // namespace fl
+
+FL_OPTIMIZATION_LEVEL_O3_END
@@ -0,0 +1,56 @@
+#pragma once
+
+/// @file fl/chipsets/encoders/prepare_frame.h
+/// @brief Whole-frame scale/dither/reorder into a wire-order staging buffer
+///
+/// PixelController applies color adjustment, temporal dithering and RGB
+/// reordering one byte at a time while an encoder pulls pixels through
+/// PixelIterator. prepareFrameRGB() runs the same transform over a whole
+/// strip in one pass, 16 pixels per iteration with fl::simd, and leaves a
+/// contiguous wire-order buffer that encoders read linearly (see
+/// PixelIterator::prepareRGB()).
+///
+/// The output is byte-identical to PixelController::loadAndScale<SLOT>()
+/// followed by stepDithering() for each pixel:
+///
+///   b       = src[order[k]]
+///   wire[k] = scale8(b ? qadd8(b, dither_k) : 0, scale[k])
+///
+/// where dither_k is dither[k] on even pixels and ditherMax[k] - dither[k]
+/// on odd pixels.
+
+#include "fl/math/simd.h"
+#include "fl/stl/int.h"
+#include "fl/stl/noexcept.h"
+
+/// 1 when the fl::simd backend lowers prepareFrameRGB()'s block loop to real
+/// vector instructions (SSE2 and up). Elsewhere the same loop compiles
+/// against the scalar simd emulation and buys nothing over the per-pixel
+/// iterator, so PixelIterator's write paths do not stage frames at all.
+#ifndef FL_PREPARE_FRAME_SIMD
+#if defined(FASTLED_X86_HAS_SSE2) && FASTLED_X86_HAS_SSE2
+#define FL_PREPARE_FRAME_SIMD 1
+#else
+#define FL_PREPARE_FRAME_SIMD 0
+#endif
+#endif
+
+namespace fl {
+
+/// @brief Per-channel parameters of the PixelController transform, in wire
+///        order (slot 0 is the first byte on the wire).
+struct FramePrep {
+    u8 order[3];      ///< Source byte index for each wire slot (RGB_BYTE0..2)
+    u8 scale[3];      ///< Premixed color correction * brightness
+    u8 dither[3];     ///< Dither offset of the first pixel
+    u8 ditherMax[3];  ///< Toggle range: the next pixel uses ditherMax - dither
+};
+
+/// @brief Transforms `count` pixels into `out` (count * 3 bytes, wire order).
+/// @param src First pixel; each pixel is 3 source-order bytes.
+/// @param stride Bytes between pixels (3 for a CRGB array, 0 for a solid fill).
+///        The SIMD path needs stride 3; anything else runs the scalar loop.
+void prepareFrameRGB(const u8 *src, fl::size count, int stride,
+                     const FramePrep &prep, u8 *out) FL_NO_EXCEPT;
+
+} // namespace fl
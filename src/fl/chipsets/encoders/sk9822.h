@@ -25,6 +25,13 @@
 
 namespace fl {
 
+/// @brief Exact encoded size of an SK9822 frame
+/// @param num_leds Number of LEDs
+/// @return Same framing as APA102: 4 + 4 * num_leds + ((num_leds / 32) + 1) * 4
+inline size_t sk9822EncodedSize(size_t num_leds) FL_NO_EXCEPT {
+    return 4 + num_leds * 4 + ((num_leds / 32) + 1) * 4;
+}
+
 /// @brief Encode pixel data in SK9822 format with global brightness
 /// @tparam InputIterator Iterator yielding fl::array<u8, 3> (3 bytes in wire order)
 /// @tparam OutputIterator Output iterator accepting uint8_t
@@ -20,6 +20,13 @@
 
 namespace fl {
 
+/// @brief Exact encoded size of an SM16716 frame
+/// @param num_leds Number of LEDs
+/// @return 3 bytes per LED + 7-byte header
+inline size_t sm16716EncodedSize(size_t num_leds) FL_NO_EXCEPT {
+    return num_leds * 3 + 7;
+}
+
 /// @brief Encode pixel data in SM16716 format
 /// @tparam InputIterator Iterator yielding fl::array<u8, 3> (3 bytes in wire order)
 /// @tparam OutputIterator Output iterator accepting uint8_t
@@ -10,6 +10,13 @@
 
 namespace fl {
 
+/// @brief Exact encoded size of a TM1812 RGBCCT frame
+/// @param num_leds Number of logical 5-channel pixels
+/// @return 12 bytes per IC, one IC per pair of pixels (odd count rounds up)
+inline size_t tm1812RGBWWEncodedSize(size_t num_leds) FL_NO_EXCEPT {
+    return ((num_leds + 1) / 2) * 12;
+}
+
 /// @brief Pack 5-channel RGBCCT pixels into TM1812 12-channel frames.
 ///
 /// The TM1812 consumes four RGB groups (12 bytes / 96 bits) per IC. RGBCCT
@@ -194,6 +194,21 @@ void encodeUCS7604_16bit_RGBW(InputIterator first, InputIterator last, OutputIte
     }
 }
 
+/// @brief Bytes per LED for a UCS7604 mode
+inline size_t ucs7604BytesPerLed(UCS7604Mode mode, bool is_rgbw) FL_NO_EXCEPT {
+    if (mode == UCS7604Mode::UCS7604_MODE_8BIT_800KHZ) {
+        return is_rgbw ? 4 : 3;
+    }
+    return is_rgbw ? 8 : 6;
+}
+
+/// @brief Exact encoded size of a UCS7604 frame
+/// @return Preamble (15) + padding (0-2) + LED data; always divisible by 3
+inline size_t ucs7604EncodedSize(size_t num_leds, UCS7604Mode mode, bool is_rgbw) FL_NO_EXCEPT {
+    const size_t unpadded = 15 + num_leds * ucs7604BytesPerLed(mode, is_rgbw);
+    return unpadded + (3 - (unpadded % 3)) % 3;
+}
+
 /// @brief Encode complete UCS7604 frame (preamble + padding + pixel data)
 /// @tparam OutputIterator Output iterator accepting uint8_t
 /// @param pixel_iter PixelIterator with pixel data and scaling/gamma/dithering
@@ -211,18 +226,10 @@ void encodeUCS7604(PixelIterator& pixel_iter, size_t num_leds, OutputIterator ou
                    const Gamma8* gamma = nullptr) {
     constexpr size_t PREAMBLE_LEN = 15;
 
-    // Calculate bytes per LED based on mode and RGB/RGBW
-    size_t bytes_per_led;
-    if (mode == UCS7604Mode::UCS7604_MODE_8BIT_800KHZ) {
-        bytes_per_led = is_rgbw ? 4 : 3;
-    } else {
-        bytes_per_led = is_rgbw ? 8 : 6;
-    }
-
-    // Calculate total data size and padding
-    size_t led_data_size = num_leds * bytes_per_led;
-    size_t total_data_size = PREAMBLE_LEN + led_data_size;
-    size_t padding = (3 - (total_data_size % 3)) % 3;
+    // Padding is whatever rounds the frame up to a multiple of 3
+    const size_t led_data_size = num_leds * ucs7604BytesPerLed(mode, is_rgbw);
+    const size_t padding =
+        ucs7604EncodedSize(num_leds, mode, is_rgbw) - PREAMBLE_LEN - led_data_size;
 
     // Build preamble (15 bytes) with current control
     buildUCS7604Preamble(out, mode, current.r, current.g, current.b, current.w);
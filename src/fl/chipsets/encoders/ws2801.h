@@ -22,6 +22,13 @@
 
 namespace fl {
 
+/// @brief Exact encoded size of a WS2801 frame
+/// @param num_leds Number of LEDs
+/// @return 3 bytes per LED (no frame overhead)
+inline size_t ws2801EncodedSize(size_t num_leds) FL_NO_EXCEPT {
+    return num_leds * 3;
+}
+
 /// @brief Encode pixel data in WS2801/WS2803 format
 ///
 /// Writes RGB pixel data in WS2801 protocol format.
@@ -1,5 +1,6 @@
 #pragma once
 #include "fl/stl/noexcept.h"
+#include "fl/stl/stdint.h"
 
 /// @file chipsets/encoders/ws2803.h
 /// @brief WS2803 SPI chipset encoder (WS2801 alias)
@@ -20,6 +21,11 @@ namespace fl {
 template <typename InputIterator, typename OutputIterator>
 void encodeWS2801(InputIterator first, InputIterator last, OutputIterator out) FL_NO_EXCEPT;
 
+/// @brief Exact encoded size of a WS2803 frame (same as WS2801)
+inline size_t ws2803EncodedSize(size_t num_leds) FL_NO_EXCEPT {
+    return num_leds * 3;
+}
+
 /// @brief Encode pixel data in WS2803 format (alias for WS2801)
 /// @tparam InputIterator Iterator yielding fl::array<u8, 3> (3 bytes in wire order)
 /// @tparam OutputIterator Output iterator accepting uint8_t
@@ -24,6 +24,14 @@
 
 namespace fl {
 
+/// @brief Exact encoded size of a WS2812 frame
+/// @param num_leds Number of LEDs
+/// @param bytes_per_pixel 3 (RGB), 4 (RGBW) or 5 (RGBWW)
+/// @return Bytes written by encodeWS2812_RGB/_RGBW/_RGBWW (no frame overhead)
+inline size_t ws2812EncodedSize(size_t num_leds, u8 bytes_per_pixel) FL_NO_EXCEPT {
+    return num_leds * bytes_per_pixel;
+}
+
 /// @brief Encode 3-byte pixel data in WS2812 format
 /// @tparam InputIterator Iterator yielding fl::array<u8, 3> (3 bytes in wire order)
 /// @tparam OutputIterator Output iterator accepting uint8_t (e.g., fl::back_inserter)
@@ -1,5 +1,6 @@
 /// @file _build.cpp.hpp
 /// @brief Unity build header for fl/fled/detail/ directory
 
+#include "fl/fled/detail/delta_rle.cpp.hpp"
 #include "fl/fled/detail/parser.cpp.hpp"
 #include "fl/fled/detail/pixel_format.cpp.hpp"
@@ -0,0 +1,219 @@
+// ok no header - implementation for fl/fled/detail/delta_rle.h.
+
+#include "fl/fled/detail/delta_rle.h"
+
+#include "fl/stl/cstring.h"
+
+namespace fl {
+namespace fled {
+
+namespace {
+
+constexpr fl::size kMaxLiteral = 128;
+constexpr fl::size kMaxRun = 129;
+constexpr fl::size kMinRun = 3;  // Shorter repeats stay inside literals.
+
+// Appends PackBits tokens for `src` to `out`.
+void packBits(fl::span<const fl::u8> src, fl::vector<fl::u8> *out) FL_NO_EXCEPT {
+    const fl::size n = src.size();
+    fl::size i = 0;
+    fl::size litStart = 0;
+    auto flushLiteral = [&](fl::size end) {
+        while (litStart < end) {
+            fl::size len = end - litStart;
+            if (len > kMaxLiteral) {
+                len = kMaxLiteral;
+            }
+            out->push_back(static_cast<fl::u8>(len - 1));
+            for (fl::size k = 0; k < len; ++k) {
+                out->push_back(src[litStart + k]);
+            }
+            litStart += len;
+        }
+    };
+    while (i < n) {
+        fl::size run = 1;
+        while (i + run < n && run < kMaxRun && src[i + run] == src[i]) {
+            ++run;
+        }
+        if (run >= kMinRun) {
+            flushLiteral(i);
+            out->push_back(static_cast<fl::u8>(run + 0x7e));
+            out->push_back(src[i]);
+            i += run;
+            litStart = i;
+        } else {
+            i += run;
+        }
+    }
+    flushLiteral(n);
+}
+
+void appendRecord(DeltaRleKind kind, fl::span<const fl::u8> src,
+                  fl::vector<fl::u8> *out) FL_NO_EXCEPT {
+    const fl::size headerAt = out->size();
+    out->push_back(static_cast<fl::u8>(kind));
+    for (int i = 0; i < 4; ++i) {
+        out->push_back(0);
+    }
+    packBits(src, out);
+    const fl::u32 len = static_cast<fl::u32>(out->size() - headerAt -
+                                             kDeltaRleRecordHeaderBytes);
+    (*out)[headerAt + 1] = static_cast<fl::u8>(len);
+    (*out)[headerAt + 2] = static_cast<fl::u8>(len >> 8);
+    (*out)[headerAt + 3] = static_cast<fl::u8>(len >> 16);
+    (*out)[headerAt + 4] = static_cast<fl::u8>(len >> 24);
+}
+
+} // namespace
+
+bool readDeltaRleRecordHeader(const fl::u8 *header, DeltaRleKind *outKind,
+                              fl::u32 *outLength) FL_NO_EXCEPT {
+    if (header[0] > static_cast<fl::u8>(DeltaRleKind::Delta)) {
+        return false;
+    }
+    *outKind = static_cast<DeltaRleKind>(header[0]);
+    *outLength = static_cast<fl::u32>(header[1])
+        | (static_cast<fl::u32>(header[2]) << 8)
+        | (static_cast<fl::u32>(header[3]) << 16)
+        | (static_cast<fl::u32>(header[4]) << 24);
+    return true;
+}
+
+// ---- DeltaRleDecoder ----
+
+void DeltaRleDecoder::begin(DeltaRleKind kind, fl::span<fl::u8> ref,
+                            fl::span<fl::u8> dst) FL_NO_EXCEPT {
+    mRef = ref;
+    mDst = dst;
+    mPos = 0;
+    mPending = 0;
+    mState = kHeader;
+    mDelta = kind == DeltaRleKind::Delta;
+}
+
+void DeltaRleDecoder::emit(fl::u8 value) FL_NO_EXCEPT {
+    const fl::u8 v = mDelta ? static_cast<fl::u8>(mRef[mPos] ^ value) : value;
+    mRef[mPos] = v;
+    mDst[mPos] = v;
+    ++mPos;
+}
+
+void DeltaRleDecoder::emitRun(fl::u8 value, fl::size count) FL_NO_EXCEPT {
+    if (!mDelta) {
+        fl::memset(mRef.data() + mPos, value, count);
+        if (mDst.data() != mRef.data()) {
+            fl::memset(mDst.data() + mPos, value, count);
+        }
+    } else if (value == 0) {
+        // Unchanged span - the common case for slowly-changing content.
+        if (mDst.data() != mRef.data()) {
+            fl::memcpy(mDst.data() + mPos, mRef.data() + mPos, count);
+        }
+    } else {
+        for (fl::size k = 0; k < count; ++k) {
+            const fl::u8 v = static_cast<fl::u8>(mRef[mPos + k] ^ value);
+            mRef[mPos + k] = v;
+            mDst[mPos + k] = v;
+        }
+    }
+    mPos += count;
+}
+
+bool DeltaRleDecoder::feed(fl::span<const fl::u8> chunk) FL_NO_EXCEPT {
+    const fl::size frameBytes = mRef.size();
+    for (fl::size i = 0; i < chunk.size(); ++i) {
+        const fl::u8 b = chunk[i];
+        switch (mState) {
+        case kHeader:
+            if (b < 0x80) {
+                mPending = static_cast<fl::size>(b) + 1;
+                mState = kLiteral;
+            } else {
+                mPending = static_cast<fl::size>(b) - 0x7e;
+                mState = kRunValue;
+            }
+            if (mPos + mPending > frameBytes) {
+                return false;
+            }
+            break;
+        case kLiteral:
+            emit(b);
+            if (--mPending == 0) {
+                mState = kHeader;
+            }
+            break;
+        case kRunValue:
+            emitRun(b, mPending);
+            mPending = 0;
+            mState = kHeader;
+            break;
+        }
+    }
+    return true;
+}
+
+// ---- DeltaRleEncoder ----
+
+DeltaRleEncoder::DeltaRleEncoder(fl::size frameBytes,
+                                 fl::u16 keyframeInterval) FL_NO_EXCEPT
+    : mFrameBytes(frameBytes),
+      mKeyframeInterval(keyframeInterval) {}
+
+bool DeltaRleEncoder::addFrame(fl::span<const fl::u8> frame,
+                               fl::vector<fl::u8> *out) FL_NO_EXCEPT {
+    if (!out || frame.size() != mFrameBytes) {
+        return false;
+    }
+    const bool key = mFrameIndex == 0 || mKeyframeInterval <= 1 ||
+                     (mFrameIndex % mKeyframeInterval) == 0;
+    if (key) {
+        appendRecord(DeltaRleKind::Keyframe, frame, out);
+        mPrev.assign(frame.begin(), frame.end());
+    } else {
+        mXor.resize(mFrameBytes);
+        for (fl::size i = 0; i < mFrameBytes; ++i) {
+            mXor[i] = static_cast<fl::u8>(frame[i] ^ mPrev[i]);
+            mPrev[i] = frame[i];
+        }
+        appendRecord(DeltaRleKind::Delta, mXor, out);
+    }
+    ++mFrameIndex;
+    return true;
+}
+
+fl::vector<fl::u8> encodeDeltaRlePayload(fl::span<const fl::u8> raw,
+                                         fl::size frameBytes,
+                                         fl::u16 keyframeInterval) FL_NO_EXCEPT {
+    fl::vector<fl::u8> out;
+    if (frameBytes == 0) {
+        return out;
+    }
+    DeltaRleEncoder encoder(frameBytes, keyframeInterval);
+    for (fl::size at = 0; at + frameBytes <= raw.size(); at += frameBytes) {
+        encoder.addFrame(raw.slice(at, at + frameBytes), &out);
+    }
+    return out;
+}
+
+fl::size countDeltaRleFrames(fl::span<const fl::u8> payload) FL_NO_EXCEPT {
+    fl::size frames = 0;
+    fl::size at = 0;
+    while (at + kDeltaRleRecordHeaderBytes <= payload.size()) {
+        DeltaRleKind kind;
+        fl::u32 len = 0;
+        if (!readDeltaRleRecordHeader(payload.data() + at, &kind, &len)) {
+            break;
+        }
+        const fl::size next = at + kDeltaRleRecordHeaderBytes + len;
+        if (next > payload.size()) {
+            break;
+        }
+        ++frames;
+        at = next;
+    }
+    return frames;
+}
+
+} // namespace fled
+} // namespace fl
@@ -0,0 +1,96 @@
+#pragma once
+
+// XOR-delta + run-length payload coding for the .fled pixel format
+// PixelFormat::Rgb8DeltaRle (0x80). See FLED_FORMAT.md "Delta/RLE Payload".
+//
+// The payload is a sequence of frame records:
+//
+//   u8   kind     0 = keyframe (RLE of the raw rgb8 frame)
+//                 1 = delta    (RLE of frame XOR previous frame)
+//   u32  length   little-endian count of RLE bytes that follow
+//   u8[] rle      PackBits tokens: h < 0x80 -> (h + 1) literal bytes follow,
+//                 h >= 0x80 -> the next byte repeats (h - 0x7e) times.
+//
+// Keyframes every N frames keep random access cheap: a seek decodes the
+// nearest keyframe at or before the target and then the deltas after it.
+
+#include "fl/stl/int.h"
+#include "fl/stl/noexcept.h"
+#include "fl/stl/span.h"
+#include "fl/stl/vector.h"
+
+namespace fl {
+namespace fled {
+
+enum class DeltaRleKind : fl::u8 {
+    Keyframe = 0,
+    Delta = 1,
+};
+
+constexpr fl::size kDeltaRleRecordHeaderBytes = 5;
+
+// Parses a record header. Returns false if the kind byte is unknown.
+bool readDeltaRleRecordHeader(const fl::u8 *header, DeltaRleKind *outKind,
+                              fl::u32 *outLength) FL_NO_EXCEPT;
+
+// Streaming record decoder. Encoded bytes can arrive in chunks of any size
+// (file reads, or one span from a mapped payload); nothing is buffered.
+// Decoded pixels are written straight into `dst` while `ref` (the previous
+// frame, needed for deltas) is kept current. `dst` may alias `ref`.
+class DeltaRleDecoder {
+  public:
+    void begin(DeltaRleKind kind, fl::span<fl::u8> ref,
+               fl::span<fl::u8> dst) FL_NO_EXCEPT;
+
+    // Consumes encoded bytes. Returns false on malformed input (a token
+    // that runs past the end of the frame).
+    bool feed(fl::span<const fl::u8> chunk) FL_NO_EXCEPT;
+
+    // True once every frame byte has been produced and no token is pending.
+    bool finished() const FL_NO_EXCEPT {
+        return mState == kHeader && mPos == mRef.size();
+    }
+
+  private:
+    enum State : fl::u8 { kHeader, kLiteral, kRunValue };
+
+    void emit(fl::u8 value) FL_NO_EXCEPT;
+    void emitRun(fl::u8 value, fl::size count) FL_NO_EXCEPT;
+
+    fl::span<fl::u8> mRef;
+    fl::span<fl::u8> mDst;
+    fl::size mPos = 0;
+    fl::size mPending = 0;
+    State mState = kHeader;
+    bool mDelta = false;
+};
+
+// Encodes frames one at a time into records appended to `out`.
+class DeltaRleEncoder {
+  public:
+    // `keyframeInterval` of 0 or 1 makes every frame a keyframe.
+    DeltaRleEncoder(fl::size frameBytes, fl::u16 keyframeInterval = 30) FL_NO_EXCEPT;
+
+    // `frame` must be frameBytes long; returns false otherwise.
+    bool addFrame(fl::span<const fl::u8> frame, fl::vector<fl::u8> *out) FL_NO_EXCEPT;
+
+  private:
+    fl::size mFrameBytes;
+    fl::u16 mKeyframeInterval;
+    fl::u32 mFrameIndex = 0;
+    fl::vector<fl::u8> mPrev;
+    fl::vector<fl::u8> mXor;
+};
+
+// Encodes a raw rgb8 payload (frames of `frameBytes`) in one go. A trailing
+// partial frame is dropped.
+fl::vector<fl::u8> encodeDeltaRlePayload(fl::span<const fl::u8> raw,
+                                         fl::size frameBytes,
+                                         fl::u16 keyframeInterval = 30) FL_NO_EXCEPT;
+
+// Number of complete records in an encoded payload. Stops at the first
+// truncated or malformed record header.
+fl::size countDeltaRleFrames(fl::span<const fl::u8> payload) FL_NO_EXCEPT;
+
+} // namespace fled
+} // namespace fl
@@ -16,10 +16,15 @@ enum class PixelFormat : fl::u8 {
     Rgba8    = 0x02,  // 4 bpp - R, G, B, A
     Rgbw8    = 0x03,  // 4 bpp - R, G, B, W
     Rgb565Le = 0x04,  // 2 bpp - little-endian RGB565
+    // FastLED-local, provisional: XOR-delta + RLE frame records that decode
+    // to rgb8. Variable size per frame, so bytesPerLed() reports 0; see
+    // fl/fled/detail/delta_rle.h.
+    Rgb8DeltaRle = 0x80,
 };
 
 // Returns the bytes-per-LED for a v1 pixel-format byte.
-// Returns 0 for unknown / reserved formats (0x05 - 0xff) - callers should
+// Returns 0 for unknown / reserved formats (0x05 - 0xff) and for
+// variable-size encodings such as Rgb8DeltaRle - callers should
 // treat 0 as "consumer does not support this pixel_format" and reject
 // before reading frame bytes per FLED_FORMAT.md.
 fl::u8 bytesPerLed(fl::u8 pixelFormat) FL_NO_EXCEPT;
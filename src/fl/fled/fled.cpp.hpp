@@ -1,6 +1,7 @@
 #include "fl/fled/fled.h"
 
 #include "fl/channels/config.h"
+#include "fl/fled/detail/delta_rle.h"
 #include "fl/fled/detail/fled_impl.hpp"
 #include "fl/fled/detail/parser.h"
 #include "fl/fled/detail/pixel_format.h"
@@ -96,6 +97,14 @@ fl::size Fled::payloadBytes() const FL_NO_EXCEPT {
 
 fl::size Fled::frameCount(fl::size ledCount) const FL_NO_EXCEPT {
     if (!mImpl || ledCount == 0) return 0;
+    if (mImpl->pixelFormatByte() ==
+        static_cast<fl::u8>(fl::fled::PixelFormat::Rgb8DeltaRle)) {
+        // Variable-size records: one per frame.
+        fl::size len = 0;
+        fl::shared_ptr<const fl::u8> payload = blob("frame_payload", &len);
+        return fl::fled::countDeltaRleFrames(
+            fl::span<const fl::u8>(payload.get(), len));
+    }
     const fl::u8 bpp = fl::fled::bytesPerLed(mImpl->pixelFormatByte());
     if (bpp == 0) return 0;
     const fl::size perFrame = ledCount * static_cast<fl::size>(bpp);
@@ -72,6 +72,7 @@ class Fled {
     //   frame_count = payload_bytes / (led_count * bytes_per_led)
     // The caller supplies led_count (typically from screenMap()->getLength()).
     // Returns 0 if led_count is 0, bytes-per-LED is 0, or the bundle is null.
+    // For Rgb8DeltaRle payloads the count is the number of frame records.
     fl::size frameCount(fl::size ledCount) const FL_NO_EXCEPT;
 
     // Reads video.fps from the JSON envelope, falling back to defaultFps
@@ -6,6 +6,7 @@
 #include "fl/fx/2d/animartrix_detail/perlin_i16_optimized.cpp.hpp"
 #include "fl/fx/2d/animartrix_detail/perlin_q16.cpp.hpp"
 #include "fl/fx/2d/animartrix_detail/perlin_s8x8.cpp.hpp"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.cpp.hpp"
 // perlin_s16x16_simd.cpp.hpp moved to fl/math/noise/ (built via fl/math/_build.cpp.hpp)
 
 // begin sub directory includes
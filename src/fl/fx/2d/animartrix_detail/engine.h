@@ -31,8 +31,9 @@ struct Engine {
     modulators move;
     rgb pixel;
 
-    fl::vector<fl::vector<float>> polar_theta;
-    fl::vector<fl::vector<float>> distance;
+    // Flat SoA polar tables, indexed [x][y] (see PolarTable).
+    PolarTable polar_theta;
+    PolarTable distance;
 
     unsigned long a = 0;
     unsigned long b = 0;
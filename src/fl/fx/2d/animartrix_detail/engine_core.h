@@ -22,14 +22,31 @@ FL_OPTIMIZATION_LEVEL_O3_BEGIN
 
 namespace fl {
 
+// Flat per-pixel table (structure-of-arrays layout, x-major: x * num_y + y).
+// table[x][y] keeps the indexing the viz modules were written against while
+// the storage stays one contiguous block that batch kernels can stream.
+struct PolarTable {
+    fl::vector<float> values;
+    int stride = 0;  // num_y
+
+    float *operator[](int x) { return values.data() + x * stride; }
+    const float *operator[](int x) const { return values.data() + x * stride; }
+    float *data() { return values.data(); }
+    const float *data() const { return values.data(); }
+    fl::size size() const { return values.size(); }
+};
+
 // Polar coordinate pre-computation
 // Builds polar_theta[x][y] and distance[x][y] lookup tables
 inline void render_polar_lookup_table(float cx, float cy,
-                                      fl::vector<fl::vector<float>> &polar_theta,
-                                      fl::vector<fl::vector<float>> &distance,
+                                      PolarTable &polar_theta,
+                                      PolarTable &distance,
                                       int num_x, int num_y) {
-    polar_theta.resize(num_x, fl::vector<float>(num_y, 0.0f));
-    distance.resize(num_x, fl::vector<float>(num_y, 0.0f));
+    const fl::size count = static_cast<fl::size>(num_x) * num_y;
+    polar_theta.values.assign(count, 0.0f);
+    distance.values.assign(count, 0.0f);
+    polar_theta.stride = num_y;
+    distance.stride = num_y;
 
     for (int xx = 0; xx < num_x; xx++) {
         for (int yy = 0; yy < num_y; yy++) {
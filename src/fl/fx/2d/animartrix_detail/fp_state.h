@@ -23,6 +23,16 @@ struct FL_ALIGNAS(16) FPVizState {
     fl::vector<fl::u16> pixel_idx;         // pre-mapped xyMap(x,y) LED index
     int count = 0;
 
+    // Per-frame scratch for render_values_fp() layers (same x-major order).
+    // Only the first `layers` show buffers passed to ensureCache() are sized.
+    static constexpr int kMaxLayers = 9;
+    fl::vector<fl::i32> angle_buf;
+    fl::vector<fl::i32> dist_buf;
+    fl::vector<fl::i32> z_buf;
+    fl::vector<fl::i32> offset_x_buf;
+    fl::vector<fl::i32> offset_y_buf;
+    fl::vector<fl::i32> show_buf[kMaxLayers];
+
     // Perlin fade LUT (257 entries, Q8.24 format).
     FL_ALIGNAS(16) fl::i32 fade_lut[257];
     bool fade_lut_initialized = false;
@@ -31,7 +41,7 @@ struct FL_ALIGNAS(16) FPVizState {
 
     // Rebuild per-pixel cache when grid changes.
     // Called once per frame; rebuilds only if pixel count changed.
-    void ensureCache(Engine *e) {
+    void ensureCache(Engine *e, int layers = 3) {
         const int num_x = e->num_x;
         const int num_y = e->num_y;
         const int total_pixels = num_x * num_y;
@@ -42,6 +52,14 @@ struct FL_ALIGNAS(16) FPVizState {
             distance_raw.resize(padded, 0);
             sqrt_distance_raw.resize(padded, 0);
             pixel_idx.resize(padded, 0);
+            angle_buf.resize(padded, 0);
+            dist_buf.resize(padded, 0);
+            z_buf.resize(padded, 0);
+            offset_x_buf.resize(padded, 0);
+            offset_y_buf.resize(padded, 0);
+            for (auto &show : show_buf) {
+                show.clear();
+            }
 
             int idx = 0;
             for (int x = 0; x < num_x; x++) {
@@ -55,6 +73,12 @@ struct FL_ALIGNAS(16) FPVizState {
             }
             count = total_pixels;
         }
+        const fl::size padded = angle_buf.size();
+        for (int i = 0; i < layers && i < kMaxLayers; i++) {
+            if (show_buf[i].size() != padded) {
+                show_buf[i].resize(padded, 0);
+            }
+        }
 
         if (!fade_lut_initialized) {
             perlin_s16x16::init_fade_lut(fade_lut);
@@ -172,15 +172,10 @@ FASTLED_FORCE_INLINE void rgb_sanity_check_fp(fl::i32 &r, fl::i32 &g, fl::i32 &b
     if (b > 255) b = 255;
 }
 
-// Hybrid helper: takes float render_parameters (same struct the float path uses),
-// converts to FP on-the-fly, and calls render_value_fp().
-// This enables a trivial conversion pattern: replace e->render_value(e->animation)
-// with render_value_fp_from_float(e->animation, fade_lut, perm).
-// The FP speedup comes from sincos32 + pnoise2d_raw replacing sinf/cosf + float pnoise.
-FASTLED_FORCE_INLINE fl::i32 render_value_fp_from_float(
-        const render_parameters &anim,
-        const fl::i32 *fade_lut,
-        const fl::u8 *perm) {
+// Converts float render_parameters (the struct the float path uses) to the
+// s16x16 form. Also gives render_values_fp() its uniform layer parameters.
+FASTLED_FORCE_INLINE render_parameters_fp to_render_parameters_fp(
+        const render_parameters &anim) {
     using FP = fl::s16x16;
     render_parameters_fp p;
     p.angle_raw = FP(anim.angle).raw();
@@ -196,7 +191,19 @@ FASTLED_FORCE_INLINE fl::i32 render_value_fp_from_float(
     p.center_y_raw = FP(anim.center_y).raw();
     p.low_limit_raw = FP(anim.low_limit).raw();
     p.high_limit_raw = FP(anim.high_limit).raw();
-    return render_value_fp(p, fade_lut, perm);
+    return p;
+}
+
+// Hybrid helper: takes float render_parameters (same struct the float path uses),
+// converts to FP on-the-fly, and calls render_value_fp().
+// This enables a trivial conversion pattern: replace e->render_value(e->animation)
+// with render_value_fp_from_float(e->animation, fade_lut, perm).
+// The FP speedup comes from sincos32 + pnoise2d_raw replacing sinf/cosf + float pnoise.
+FASTLED_FORCE_INLINE fl::i32 render_value_fp_from_float(
+        const render_parameters &anim,
+        const fl::i32 *fade_lut,
+        const fl::u8 *perm) {
+    return render_value_fp(to_render_parameters_fp(anim), fade_lut, perm);
 }
 
 }  // namespace fl
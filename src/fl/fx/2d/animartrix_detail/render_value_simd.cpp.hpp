@@ -0,0 +1,49 @@
+// ok no header - implementation for fl/fx/2d/animartrix_detail/render_value_simd.h.
+
+#include "fl/stl/compiler_control.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
+
+FL_OPTIMIZATION_LEVEL_O3_BEGIN
+
+namespace fl {
+
+namespace {
+
+FASTLED_FORCE_INLINE simd::simd_u32x4 load_render_input(const fl::i32 *src, int i,
+                                              simd::simd_u32x4 uniform) {
+    return src ? simd::load_u32_4(reinterpret_cast<const fl::u32 *>(src + i))  // ok reinterpret cast
+               : uniform;
+}
+
+}  // namespace
+
+void render_values_fp(const render_parameters_fp &p, const render_inputs_fp &in,
+                      int count, const fl::i32 *fade_lut, const fl::u8 *perm,
+                      fl::i32 *out) {
+    const auto angle_uniform = simd::set1_u32_4(static_cast<fl::u32>(p.angle_raw));
+    const auto dist_uniform = simd::set1_u32_4(static_cast<fl::u32>(p.dist_raw));
+    const auto z_uniform = simd::set1_u32_4(static_cast<fl::u32>(p.z_raw));
+    const auto offset_x_uniform = simd::set1_u32_4(static_cast<fl::u32>(p.offset_x_raw));
+    const auto offset_y_uniform = simd::set1_u32_4(static_cast<fl::u32>(p.offset_y_raw));
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        auto v = render_value_fp_simd4(
+            load_render_input(in.angle, i, angle_uniform), load_render_input(in.dist, i, dist_uniform),
+            load_render_input(in.z, i, z_uniform), load_render_input(in.offset_x, i, offset_x_uniform),
+            load_render_input(in.offset_y, i, offset_y_uniform), p, fade_lut, perm);
+        simd::store_u32_4(reinterpret_cast<fl::u32 *>(out + i), v);  // ok reinterpret cast
+    }
+    render_parameters_fp lane = p;
+    for (; i < count; i++) {
+        if (in.angle) lane.angle_raw = in.angle[i];
+        if (in.dist) lane.dist_raw = in.dist[i];
+        if (in.z) lane.z_raw = in.z[i];
+        if (in.offset_x) lane.offset_x_raw = in.offset_x[i];
+        if (in.offset_y) lane.offset_y_raw = in.offset_y[i];
+        out[i] = render_value_fp(lane, fade_lut, perm);
+    }
+}
+
+}  // namespace fl
+
+FL_OPTIMIZATION_LEVEL_O3_END
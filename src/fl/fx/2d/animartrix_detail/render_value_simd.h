@@ -0,0 +1,138 @@
+#pragma once
+
+// Batched fixed-point render_value: the shared per-pixel kernel for
+// structure-of-arrays Animartrix visualizers.
+//
+// render_value_fp() evaluates one pixel. Here the per-pixel inputs (angle,
+// dist, z and optionally offset_x / offset_y) come from flat s16x16 arrays
+// and everything else in render_parameters_fp is uniform for the whole layer,
+// so four pixels go through polar->cartesian, Perlin and the [0, 255] mapping
+// per iteration:
+//
+//   sincos32_simd  -> 4 angles at once
+//   mulhi*_4       -> coordinate scaling in SIMD registers
+//   perlin_s16x16_simd::pnoise2d_raw_simd4_vec when z is 0 on every lane,
+//   scalar pnoise3d_raw per lane otherwise
+//
+// Results match render_value_fp() to within 1 per channel: the cos/sin * dist
+// product is taken as mulhi32 << 1 (as in Chasing_Spirals_Q31_SIMD) instead
+// of a 64-bit >> 31, which can differ in the last bit of the noise coordinate.
+
+#include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/math/noise/perlin_s16x16_simd.h"
+#include "fl/math/simd.h"
+#include "fl/math/sin32.h"
+#include "fl/stl/int.h"
+
+namespace fl {
+
+// Evaluates render_value for 4 pixels. p.angle_raw, p.dist_raw, p.z_raw,
+// p.offset_x_raw and p.offset_y_raw are ignored; the lanes of the *_vec
+// arguments are used instead.
+FASTLED_FORCE_INLINE simd::simd_u32x4 render_value_fp_simd4(
+        simd::simd_u32x4 angle_vec, simd::simd_u32x4 dist_vec,
+        simd::simd_u32x4 z_vec, simd::simd_u32x4 offset_x_vec,
+        simd::simd_u32x4 offset_y_vec, const render_parameters_fp &p,
+        const fl::i32 *fade_lut, const fl::u8 *perm) {
+    using FP = fl::s16x16;
+    constexpr fl::i32 FP_ONE = static_cast<fl::i32>(1) << FP::FRAC_BITS;
+    constexpr fl::i32 RAD_TO_A24 = 2670177;
+
+    // Angle: s16x16 radians -> A24, then 4-wide sin/cos.
+    auto angles = simd::mulhi_su32_4(
+        angle_vec, simd::set1_u32_4(static_cast<fl::u32>(RAD_TO_A24)));
+    SinCos32_simd sc = sincos32_simd(angles);
+
+    // (Q31 * s16x16) >> 31 == mulhi32 << 1
+    auto cos_dist = simd::sll_u32_4(simd::mulhi32_i32_4(sc.cos_vals, dist_vec), 1);
+    auto sin_dist = simd::sll_u32_4(simd::mulhi32_i32_4(sc.sin_vals, dist_vec), 1);
+
+    auto pre_x = simd::sub_i32_4(
+        simd::add_i32_4(offset_x_vec, simd::set1_u32_4(static_cast<fl::u32>(p.center_x_raw))),
+        cos_dist);
+    auto pre_y = simd::sub_i32_4(
+        simd::add_i32_4(offset_y_vec, simd::set1_u32_4(static_cast<fl::u32>(p.center_y_raw))),
+        sin_dist);
+    auto nx = simd::mulhi_i32_4(pre_x, simd::set1_u32_4(static_cast<fl::u32>(p.scale_x_raw)));
+    auto ny = simd::mulhi_i32_4(pre_y, simd::set1_u32_4(static_cast<fl::u32>(p.scale_y_raw)));
+    auto nz = simd::mulhi_i32_4(
+        simd::add_i32_4(z_vec, simd::set1_u32_4(static_cast<fl::u32>(p.offset_z_raw))),
+        simd::set1_u32_4(static_cast<fl::u32>(p.scale_z_raw)));
+
+    // Perlin: 2D when z == 0 (same rule as render_value_fp), per lane.
+    simd::simd_u32x4 raw;
+    const fl::u32 z0 = simd::extract_u32_4(nz, 0);
+    const fl::u32 z1 = simd::extract_u32_4(nz, 1);
+    const fl::u32 z2 = simd::extract_u32_4(nz, 2);
+    const fl::u32 z3 = simd::extract_u32_4(nz, 3);
+    if ((z0 | z1 | z2 | z3) == 0) {
+        raw = perlin_s16x16_simd::pnoise2d_raw_simd4_vec(nx, ny, fade_lut, perm);
+    } else {
+        auto lane = [&](int i, fl::u32 z) -> fl::u32 {
+            const fl::i32 x = static_cast<fl::i32>(simd::extract_u32_4(nx, i));
+            const fl::i32 y = static_cast<fl::i32>(simd::extract_u32_4(ny, i));
+            if (z == 0) {
+                return static_cast<fl::u32>(perlin_s16x16::pnoise2d_raw(x, y, fade_lut, perm));
+            }
+            return static_cast<fl::u32>(perlin_s16x16::pnoise3d_raw(
+                x, y, static_cast<fl::i32>(z), fade_lut, perm));
+        };
+        raw = simd::set_u32_4(lane(0, z0), lane(1, z1), lane(2, z2), lane(3, z3));
+    }
+
+    // Clamp to [low_limit, high_limit] and map to [0, 255].
+    auto low = simd::set1_u32_4(static_cast<fl::u32>(p.low_limit_raw));
+    auto high = simd::set1_u32_4(static_cast<fl::u32>(p.high_limit_raw));
+    auto shifted = simd::sub_i32_4(simd::min_i32_4(simd::max_i32_4(raw, low), high), low);
+    const fl::i32 range = p.high_limit_raw - p.low_limit_raw;
+
+    simd::simd_u32x4 result;
+    if (range == FP_ONE || range == 2 * FP_ONE) {
+        // shifted * 255 fits in 32 bits for both fast ranges.
+        auto x255 = simd::sub_i32_4(simd::sll_u32_4(shifted, 8), shifted);
+        result = simd::sra_i32_4(x255, range == FP_ONE ? FP::FRAC_BITS : FP::FRAC_BITS + 1);
+    } else {
+        auto lane = [&](int i) -> fl::u32 {
+            const fl::i64 s = static_cast<fl::i32>(simd::extract_u32_4(shifted, i));
+            return static_cast<fl::u32>(static_cast<fl::i32>((s * 255) / range));
+        };
+        result = simd::set_u32_4(lane(0), lane(1), lane(2), lane(3));
+    }
+    auto zero = simd::set1_u32_4(0u);
+    auto max255 = simd::set1_u32_4(255u);
+    return simd::min_i32_4(simd::max_i32_4(result, zero), max255);
+}
+
+// Per-pixel inputs of one render_values_fp() layer, as flat s16x16 arrays in
+// FPVizState order. A null array means the matching field of
+// render_parameters_fp is used for every pixel.
+struct render_inputs_fp {
+    const fl::i32 *angle = nullptr;
+    const fl::i32 *dist = nullptr;
+    const fl::i32 *z = nullptr;
+    const fl::i32 *offset_x = nullptr;  // feedback layers (offset from a show)
+    const fl::i32 *offset_y = nullptr;
+};
+
+// Runs one noise layer over `count` pixels and writes [0, 255] values to
+// `out`. Arrays need no padding; a tail of count % 4 pixels falls back to
+// render_value_fp().
+void render_values_fp(const render_parameters_fp &p, const render_inputs_fp &in,
+                      int count, const fl::i32 *fade_lut, const fl::u8 *perm,
+                      fl::i32 *out);
+
+// Shorthand for the common angle / dist / z layer. `angle` and `z` may be
+// null, in which case p.angle_raw / p.z_raw is used for every pixel.
+inline void render_values_fp(const render_parameters_fp &p,
+                             const fl::i32 *angle, const fl::i32 *dist,
+                             const fl::i32 *z, int count,
+                             const fl::i32 *fade_lut, const fl::u8 *perm,
+                             fl::i32 *out) {
+    render_inputs_fp in;
+    in.angle = angle;
+    in.dist = dist;
+    in.z = z;
+    render_values_fp(p, in, count, fade_lut, perm, out);
+}
+
+}  // namespace fl
@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/big_caleido.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -92,7 +93,7 @@ void Big_Caleido::draw(Context &ctx) {
 void Big_Caleido_FP::draw(Context &ctx) {
     auto *e = ctx.mEngine.get();
     e->get_ready();
-    mState.ensureCache(e);
+    mState.ensureCache(e, 5);
     const fl::i32 *fade_lut = fl::assume_aligned<16>(mState.fade_lut);
     const fl::u8 *perm = PERLIN_NOISE;
 
@@ -106,57 +107,58 @@ void Big_Caleido_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
-    for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = 5 * e->polar_theta[x][y] +
-                                 5 * e->move.noise_angle[0] +
-                                 e->animation.dist * 0.1;
-            e->animation.z = 5;
-            e->animation.scale_x = 0.05;
-            e->animation.scale_y = 0.05;
-            e->animation.offset_z = 50 * e->move.linear[0];
-            e->animation.offset_x = 50 * e->move.noise_angle[0];
-            e->animation.offset_y = 50 * e->move.noise_angle[1];
-            float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.angle = 6 * e->polar_theta[x][y] +
-                                 5 * e->move.noise_angle[1] +
-                                 e->animation.dist * 0.15;
-            e->animation.z = 5;
-            e->animation.scale_x = 0.05;
-            e->animation.scale_y = 0.05;
-            e->animation.offset_z = 50 * e->move.linear[1];
-            e->animation.offset_x = 50 * e->move.noise_angle[1];
-            e->animation.offset_y = 50 * e->move.noise_angle[2];
-            float show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.angle = 5;
-            e->animation.z = 5;
-            e->animation.scale_x = 0.10;
-            e->animation.scale_y = 0.10;
-            e->animation.offset_z = 10 * e->move.linear[2];
-            e->animation.offset_x = 10 * e->move.noise_angle[2];
-            e->animation.offset_y = 10 * e->move.noise_angle[3];
-            float show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    const int n = mState.count;
+    const fl::i32 *dist = mState.distance_raw.data();
+
+    // Layers 1-2: angle = k * theta + 5 * noise_angle[layer] + dist * m
+    const float theta_mul[2] = {5, 6};
+    const double dist_mul[2] = {0.1, 0.15};
+    e->animation.z = 5;
+    e->animation.scale_x = 0.05;
+    e->animation.scale_y = 0.05;
+    for (int layer = 0; layer < 2; layer++) {
+        e->animation.offset_z = 50 * e->move.linear[layer];
+        e->animation.offset_x = 50 * e->move.noise_angle[layer];
+        e->animation.offset_y = 50 * e->move.noise_angle[layer + 1];
+        int idx = 0;
+        for (int x = 0; x < e->num_x; x++) {
+            for (int y = 0; y < e->num_y; y++, idx++) {
+                mState.angle_buf[idx] = fl::s16x16(
+                    theta_mul[layer] * e->polar_theta[x][y] +
+                    5 * e->move.noise_angle[layer] +
+                    e->distance[x][y] * dist_mul[layer]).raw();
+            }
+        }
+        render_values_fp(to_render_parameters_fp(e->animation),
+                         mState.angle_buf.data(), dist, nullptr, n, fade_lut,
+                         perm, mState.show_buf[layer].data());
+    }
 
-            e->animation.angle = 15;
-            e->animation.z = 15;
-            e->animation.scale_x = 0.10;
-            e->animation.scale_y = 0.10;
-            e->animation.offset_z = 10 * e->move.linear[3];
-            e->animation.offset_x = 10 * e->move.noise_angle[3];
-            e->animation.offset_y = 10 * e->move.noise_angle[4];
-            float show4 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    // Layers 3-5: uniform angle and z, only the distance varies.
+    const float angle[3] = {5, 15, 2};
+    const float z[3] = {5, 15, 15};
+    const float scale[3] = {0.10f, 0.10f, 0.15f};
+    for (int layer = 2; layer < 5; layer++) {
+        e->animation.angle = angle[layer - 2];
+        e->animation.z = z[layer - 2];
+        e->animation.scale_x = scale[layer - 2];
+        e->animation.scale_y = scale[layer - 2];
+        e->animation.offset_z = 10 * e->move.linear[layer];
+        e->animation.offset_x = 10 * e->move.noise_angle[layer];
+        e->animation.offset_y = 10 * e->move.noise_angle[layer + 1];
+        render_values_fp(to_render_parameters_fp(e->animation), nullptr, dist,
+                         nullptr, n, fade_lut, perm,
+                         mState.show_buf[layer].data());
+    }
 
-            e->animation.angle = 2;
-            e->animation.z = 15;
-            e->animation.scale_x = 0.15;
-            e->animation.scale_y = 0.15;
-            e->animation.offset_z = 10 * e->move.linear[4];
-            e->animation.offset_x = 10 * e->move.noise_angle[4];
-            e->animation.offset_y = 10 * e->move.noise_angle[5];
-            float show5 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    int idx = 0;
+    for (int x = 0; x < e->num_x; x++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            float show1 = mState.show_buf[0][idx];
+            float show2 = mState.show_buf[1][idx];
+            float show3 = mState.show_buf[2][idx];
+            float show4 = mState.show_buf[3][idx];
+            float show5 = mState.show_buf[4][idx];
 
             e->pixel.red = show1 - show4;
             e->pixel.green = show2 - show5;
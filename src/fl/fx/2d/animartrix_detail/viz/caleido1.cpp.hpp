@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/caleido1.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -79,7 +80,7 @@ void Caleido1::draw(Context &ctx) {
 void Caleido1_FP::draw(Context &ctx) {
     auto *e = ctx.mEngine.get();
     e->get_ready();
-    mState.ensureCache(e);
+    mState.ensureCache(e, 4);
     const fl::i32 *fade_lut = fl::assume_aligned<16>(mState.fade_lut);
     const fl::u8 *perm = PERLIN_NOISE;
 
@@ -97,40 +98,46 @@ void Caleido1_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
-    for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = e->distance[x][y] * (2 + e->move.directional[0]) / 3;
-            e->animation.angle = 3 * e->polar_theta[x][y] +
-                                 3 * e->move.noise_angle[0] + e->move.radial[4];
-            e->animation.scale_x = 0.1;
-            e->animation.scale_y = 0.1;
-            e->animation.scale_z = 0.1;
-            e->animation.offset_y = 2 * e->move.linear[0];
-            e->animation.offset_x = 0;
-            e->animation.offset_z = 0;
-            e->animation.z = e->move.linear[0];
-            float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.dist = e->distance[x][y] * (2 + e->move.directional[1]) / 3;
-            e->animation.angle = 4 * e->polar_theta[x][y] +
-                                 3 * e->move.noise_angle[1] + e->move.radial[4];
-            e->animation.offset_x = 2 * e->move.linear[1];
-            e->animation.z = e->move.linear[1];
-            float show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.dist = e->distance[x][y] * (2 + e->move.directional[2]) / 3;
-            e->animation.angle = 5 * e->polar_theta[x][y] +
-                                 3 * e->move.noise_angle[2] + e->move.radial[4];
-            e->animation.offset_y = 2 * e->move.linear[2];
-            e->animation.z = e->move.linear[2];
-            float show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    // dist = distance * (2 + directional[k]) / 3,
+    // angle = m * theta + 3 * noise_angle[k] + radial[4]; the layers
+    // alternate between moving offset_y and offset_x.
+    const int n = mState.count;
+    const float theta_mul[4] = {3, 4, 5, 4};
+    e->animation.scale_x = 0.1;
+    e->animation.scale_y = 0.1;
+    e->animation.scale_z = 0.1;
+    e->animation.offset_x = 0;
+    e->animation.offset_z = 0;
+    for (int layer = 0; layer < 4; layer++) {
+        if (layer % 2 == 0) {
+            e->animation.offset_y = 2 * e->move.linear[layer];
+        } else {
+            e->animation.offset_x = 2 * e->move.linear[layer];
+        }
+        e->animation.z = e->move.linear[layer];
+        int idx = 0;
+        for (int x = 0; x < e->num_x; x++) {
+            for (int y = 0; y < e->num_y; y++, idx++) {
+                mState.dist_buf[idx] = fl::s16x16(
+                    e->distance[x][y] * (2 + e->move.directional[layer]) / 3).raw();
+                mState.angle_buf[idx] = fl::s16x16(
+                    theta_mul[layer] * e->polar_theta[x][y] +
+                    3 * e->move.noise_angle[layer] + e->move.radial[4]).raw();
+            }
+        }
+        render_values_fp(to_render_parameters_fp(e->animation),
+                         mState.angle_buf.data(), mState.dist_buf.data(),
+                         nullptr, n, fade_lut, perm,
+                         mState.show_buf[layer].data());
+    }
 
-            e->animation.dist = e->distance[x][y] * (2 + e->move.directional[3]) / 3;
-            e->animation.angle = 4 * e->polar_theta[x][y] +
-                                 3 * e->move.noise_angle[3] + e->move.radial[4];
-            e->animation.offset_x = 2 * e->move.linear[3];
-            e->animation.z = e->move.linear[3];
-            float show4 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    int idx = 0;
+    for (int x = 0; x < e->num_x; x++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            float show1 = mState.show_buf[0][idx];
+            float show2 = mState.show_buf[1][idx];
+            float show3 = mState.show_buf[2][idx];
+            float show4 = mState.show_buf[3][idx];
 
             e->pixel.red = show1;
             e->pixel.green = show3 * e->distance[x][y] / 10;
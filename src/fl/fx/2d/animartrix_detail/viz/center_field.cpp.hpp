@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/center_field.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -81,7 +82,7 @@ void Center_Field_FP::draw(Context &ctx) {
     e->calculate_oscillators(e->timings);
 
     // Build/update per-pixel geometry cache
-    mState.ensureCache(e);
+    mState.ensureCache(e, 2);
 
     const int total_pixels = mState.count;
     const fl::i32 *fade_lut = fl::assume_aligned<16>(mState.fade_lut);
@@ -123,28 +124,24 @@ void Center_Field_FP::draw(Context &ctx) {
     p.low_limit_raw = 0;
     p.high_limit_raw = FP_ONE;
 
+    // Pass 1: dist = 5 * sqrt(distance), pass 2: dist = 4 * sqrt(distance)
+    const fl::i32 dist_mul_raw[2] = {five_raw, four_raw};
+    for (int pass = 0; pass < 2; pass++) {
+        for (int i = 0; i < total_pixels; i++) {
+            mState.dist_buf[i] = static_cast<fl::i32>(
+                (static_cast<fl::i64>(dist_mul_raw[pass]) * mState.sqrt_distance_raw[i]) >> FP::FRAC_BITS);
+        }
+        render_values_fp(p, mState.polar_theta_raw.data(), mState.dist_buf.data(),
+                         nullptr, total_pixels, fade_lut, perm,
+                         mState.show_buf[pass].data());
+    }
+
     fl::span<CRGB> leds = e->mCtx->leds;
 
     for (int i = 0; i < total_pixels; i++) {
-        const fl::i32 theta_raw = mState.polar_theta_raw[i];
-        const fl::i32 sqrt_dist_raw = mState.sqrt_distance_raw[i];
-
-        // Pass 1: dist = 5 * sqrt(distance)
-        fl::i32 dist1_raw = static_cast<fl::i32>(
-            (static_cast<fl::i64>(five_raw) * sqrt_dist_raw) >> FP::FRAC_BITS);
-        p.angle_raw = theta_raw;
-        p.dist_raw = dist1_raw;
-        fl::i32 show1 = render_value_fp(p, fade_lut, perm);
-
-        // Pass 2: dist = 4 * sqrt(distance)
-        fl::i32 dist2_raw = static_cast<fl::i32>(
-            (static_cast<fl::i64>(four_raw) * sqrt_dist_raw) >> FP::FRAC_BITS);
-        p.dist_raw = dist2_raw;
-        fl::i32 show2 = render_value_fp(p, fade_lut, perm);
-
         // pixel.red = show1, pixel.green = show2, pixel.blue = 0
-        fl::i32 r = show1;
-        fl::i32 g = show2;
+        fl::i32 r = mState.show_buf[0][i];
+        fl::i32 g = mState.show_buf[1][i];
         fl::i32 b = 0;
         rgb_sanity_check_fp(r, g, b);
 
@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/complex_kaleido.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -98,7 +99,7 @@ void Complex_Kaleido::draw(Context &ctx) {
 void Complex_Kaleido_FP::draw(Context &ctx) {
     auto *e = ctx.mEngine.get();
     e->get_ready();
-    mState.ensureCache(e);
+    mState.ensureCache(e, 4);
     const fl::i32 *fade_lut = fl::assume_aligned<16>(mState.fade_lut);
     const fl::u8 *perm = PERLIN_NOISE;
 
@@ -112,56 +113,43 @@ void Complex_Kaleido_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
-    for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = 5 * e->polar_theta[x][y] + 10 * e->move.radial[0] +
-                                 e->animation.dist / 2;
-            e->animation.z = 5;
-            e->animation.scale_x = 0.07;
-            e->animation.scale_y = 0.07;
-            e->animation.offset_z = 0;
-            e->animation.offset_x = -30 * e->move.linear[0];
-            e->animation.offset_y = 0;
-            e->animation.low_limit = 0;
-            e->show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = -5 * e->polar_theta[x][y] + 12 * e->move.radial[1] +
-                                 e->animation.dist / 2;
-            e->animation.z = 500;
-            e->animation.scale_x = 0.07;
-            e->animation.scale_y = 0.07;
-            e->animation.offset_z = 0;
-            e->animation.offset_x = -30 * e->move.linear[1];
-            e->animation.offset_y = 0;
-            e->animation.low_limit = 0;
-            e->show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = -5 * e->polar_theta[x][y] + 12 * e->move.radial[2] +
-                                 e->animation.dist / 2;
-            e->animation.z = 500;
-            e->animation.scale_x = 0.05;
-            e->animation.scale_y = 0.05;
-            e->animation.offset_z = 0;
-            e->animation.offset_x = -40 * e->move.linear[2];
-            e->animation.offset_y = 0;
-            e->animation.low_limit = 0;
-            e->show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    // angle = k * theta + m * radial[layer] + dist / 2
+    const int n = mState.count;
+    const float theta_mul[4] = {5, -5, -5, 5};
+    const float radial_mul[4] = {10, 12, 12, 12};
+    const float z[4] = {5, 500, 500, 500};
+    const float scale[4] = {0.07f, 0.07f, 0.05f, 0.09f};
+    const float offset_x_mul[4] = {-30, -30, -40, -35};
+    e->animation.offset_z = 0;
+    e->animation.offset_y = 0;
+    e->animation.low_limit = 0;
+    for (int layer = 0; layer < 4; layer++) {
+        e->animation.z = z[layer];
+        e->animation.scale_x = scale[layer];
+        e->animation.scale_y = scale[layer];
+        e->animation.offset_x = offset_x_mul[layer] * e->move.linear[layer];
+        int idx = 0;
+        for (int x = 0; x < e->num_x; x++) {
+            for (int y = 0; y < e->num_y; y++, idx++) {
+                mState.angle_buf[idx] = fl::s16x16(
+                    theta_mul[layer] * e->polar_theta[x][y] +
+                    radial_mul[layer] * e->move.radial[layer] +
+                    e->distance[x][y] / 2).raw();
+            }
+        }
+        render_values_fp(to_render_parameters_fp(e->animation),
+                         mState.angle_buf.data(), mState.distance_raw.data(),
+                         nullptr, n, fade_lut, perm,
+                         mState.show_buf[layer].data());
+    }
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = 5 * e->polar_theta[x][y] + 12 * e->move.radial[3] +
-                                 e->animation.dist / 2;
-            e->animation.z = 500;
-            e->animation.scale_x = 0.09;
-            e->animation.scale_y = 0.09;
-            e->animation.offset_z = 0;
-            e->animation.offset_x = -35 * e->move.linear[3];
-            e->animation.offset_y = 0;
-            e->animation.low_limit = 0;
-            e->show4 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    int idx = 0;
+    for (int x = 0; x < e->num_x; x++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->show1 = mState.show_buf[0][idx];
+            e->show2 = mState.show_buf[1][idx];
+            e->show3 = mState.show_buf[2][idx];
+            e->show4 = mState.show_buf[3][idx];
 
             e->show5 = e->screen(e->show4, e->show3);
             e->show6 = e->colordodge(e->show2, e->show3);
@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/complex_kaleido_3.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -126,7 +127,7 @@ void Complex_Kaleido_3::draw(Context &ctx) {
 void Complex_Kaleido_3_FP::draw(Context &ctx) {
     auto *e = ctx.mEngine.get();
     e->get_ready();
-    mState.ensureCache(e);
+    mState.ensureCache(e, 4);
     const fl::i32 *fade_lut = fl::assume_aligned<16>(mState.fade_lut);
     const fl::u8 *perm = PERLIN_NOISE;
 
@@ -145,78 +146,64 @@ void Complex_Kaleido_3_FP::draw(Context &ctx) {
 
     float q = 2;
 
+    // angle = k * theta + radial term + dist / ((directional[d] + 3) * 2) +
+    // noise_angle[layer] * q
+    const int n = mState.count;
+    auto render_layer = [&](int layer, float theta_mul, float radial_term, int d) {
+        int idx = 0;
+        for (int x = 0; x < e->num_x; x++) {
+            for (int y = 0; y < e->num_y; y++, idx++) {
+                mState.angle_buf[idx] = fl::s16x16(
+                    theta_mul * e->polar_theta[x][y] + radial_term +
+                    e->distance[x][y] / (((e->move.directional[d] + 3) * 2)) +
+                    e->move.noise_angle[layer] * q).raw();
+            }
+        }
+        render_values_fp(to_render_parameters_fp(e->animation),
+                         mState.angle_buf.data(), mState.distance_raw.data(),
+                         nullptr, n, fade_lut, perm,
+                         mState.show_buf[layer].data());
+    };
+    e->animation.offset_y = 0;
+    e->animation.low_limit = 0;
+
+    e->animation.z = 5;
+    e->animation.scale_x = 0.08 * size * (e->move.directional[0] + 1.5);
+    e->animation.scale_y = 0.07 * size;
+    e->animation.offset_z = -10 * e->move.linear[0];
+    e->animation.offset_x = -30 * e->move.linear[0];
+    render_layer(0, 5, 10 * e->move.radial[0], 0);
+
+    e->animation.z = 500;
+    e->animation.scale_x = 0.07 * size * (e->move.directional[1] + 1.1);
+    e->animation.scale_y = 0.07 * size * (e->move.directional[2] + 1.3);
+    e->animation.offset_z = -12 * e->move.linear[1];
+    e->animation.offset_x = -(e->num_x - 1) * e->move.linear[1];
+    render_layer(1, -5, 10 * e->move.radial[1], 1);
+
+    e->animation.scale_x = 0.05 * size * (e->move.directional[3] + 1.5);
+    e->animation.scale_y = 0.05 * size * (e->move.directional[4] + 1.5);
+    e->animation.offset_z = -12 * e->move.linear[3];
+    e->animation.offset_x = -40 * e->move.linear[3];
+    render_layer(2, -5, 12 * e->move.radial[2], 3);
+
+    e->animation.scale_x = 0.09 * size * (e->move.directional[5] + 1.5);
+    e->animation.scale_y = 0.09 * size * (e->move.directional[6] + 1.5);
+    e->animation.offset_z = 0;
+    e->animation.offset_x = -35 * e->move.linear[3];
+    render_layer(3, 5, 12 * e->move.radial[3], 5);
+
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle =
-                5 * e->polar_theta[x][y] + 10 * e->move.radial[0] +
-                e->animation.dist / (((e->move.directional[0] + 3) * 2)) +
-                e->move.noise_angle[0] * q;
-            e->animation.z = 5;
-            e->animation.scale_x = 0.08 * size * (e->move.directional[0] + 1.5);
-            e->animation.scale_y = 0.07 * size;
-            e->animation.offset_z = -10 * e->move.linear[0];
-            e->animation.offset_x = -30 * e->move.linear[0];
-            e->animation.offset_y = 0;
-            e->animation.low_limit = 0;
-            e->show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle =
-                -5 * e->polar_theta[x][y] + 10 * e->move.radial[1] +
-                e->animation.dist / (((e->move.directional[1] + 3) * 2)) +
-                e->move.noise_angle[1] * q;
-            e->animation.z = 500;
-            e->animation.scale_x = 0.07 * size * (e->move.directional[1] + 1.1);
-            e->animation.scale_y = 0.07 * size * (e->move.directional[2] + 1.3);
-            ;
-            e->animation.offset_z = -12 * e->move.linear[1];
-            ;
-            e->animation.offset_x = -(e->num_x - 1) * e->move.linear[1];
-            e->animation.offset_y = 0;
-            e->animation.low_limit = 0;
-            e->show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle =
-                -5 * e->polar_theta[x][y] + 12 * e->move.radial[2] +
-                e->animation.dist / (((e->move.directional[3] + 3) * 2)) +
-                e->move.noise_angle[2] * q;
-            e->animation.z = 500;
-            e->animation.scale_x = 0.05 * size * (e->move.directional[3] + 1.5);
-            ;
-            e->animation.scale_y = 0.05 * size * (e->move.directional[4] + 1.5);
-            ;
-            e->animation.offset_z = -12 * e->move.linear[3];
-            e->animation.offset_x = -40 * e->move.linear[3];
-            e->animation.offset_y = 0;
-            e->animation.low_limit = 0;
-            e->show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle =
-                5 * e->polar_theta[x][y] + 12 * e->move.radial[3] +
-                e->animation.dist / (((e->move.directional[5] + 3) * 2)) +
-                e->move.noise_angle[3] * q;
-            e->animation.z = 500;
-            e->animation.scale_x = 0.09 * size * (e->move.directional[5] + 1.5);
-            ;
-            ;
-            e->animation.scale_y = 0.09 * size * (e->move.directional[6] + 1.5);
-            ;
-            ;
-            e->animation.offset_z = 0;
-            e->animation.offset_x = -35 * e->move.linear[3];
-            e->animation.offset_y = 0;
-            e->animation.low_limit = 0;
-            e->show4 = render_value_fp_from_float(e->animation, fade_lut, perm);
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->show1 = mState.show_buf[0][idx];
+            e->show2 = mState.show_buf[1][idx];
+            e->show3 = mState.show_buf[2][idx];
+            e->show4 = mState.show_buf[3][idx];
 
             e->show5 = e->screen(e->show4, e->show3) - e->show2;
             e->show6 = e->colordodge(e->show4, e->show1);
 
-            e->show7 = e->multiply(e->show1, e->show2);
-
             float linear1 = y / 32.f;
 
             float radius = e->radial_filter_radius;
@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/complex_kaleido_4.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -117,7 +118,7 @@ void Complex_Kaleido_4::draw(Context &ctx) {
 void Complex_Kaleido_4_FP::draw(Context &ctx) {
     auto *e = ctx.mEngine.get();
     e->get_ready();
-    mState.ensureCache(e);
+    mState.ensureCache(e, 3);
     const fl::i32 *fade_lut = fl::assume_aligned<16>(mState.fade_lut);
     const fl::u8 *perm = PERLIN_NOISE;
 
@@ -133,68 +134,55 @@ void Complex_Kaleido_4_FP::draw(Context &ctx) {
     e->calculate_oscillators(e->timings);
 
     float size = 0.6;
+    float s = 1 + e->move.directional[6] * 0.3;
+
+    const int n = mState.count;
+    e->animation.offset_x = 0;
+    e->animation.offset_y = 0;
+    e->animation.low_limit = 0;
+
+    // Layers 1-2: dist = distance * s,
+    // angle = 5 * theta + radial[k] -/+ dist / (3 + directional[k] * 0.5)
+    for (int layer = 0; layer < 2; layer++) {
+        e->animation.z = layer == 0 ? 5 : 50;
+        e->animation.scale_x = 0.08 * size + (e->move.directional[layer] * 0.01);
+        e->animation.scale_y = 0.07 * size + (e->move.directional[layer + 1] * 0.01);
+        e->animation.offset_z = -10 * e->move.linear[layer];
+        int idx = 0;
+        for (int x = 0; x < e->num_x; x++) {
+            for (int y = 0; y < e->num_y; y++, idx++) {
+                float dist = e->distance[x][y] * s;
+                double spiral = dist / (3 + e->move.directional[layer] * 0.5);
+                mState.dist_buf[idx] = fl::s16x16(dist).raw();
+                mState.angle_buf[idx] = fl::s16x16(
+                    5 * e->polar_theta[x][y] + 1 * e->move.radial[layer] +
+                    (layer == 0 ? -spiral : spiral)).raw();
+            }
+        }
+        render_values_fp(to_render_parameters_fp(e->animation),
+                         mState.angle_buf.data(), mState.dist_buf.data(),
+                         nullptr, n, fade_lut, perm,
+                         mState.show_buf[layer].data());
+    }
 
-    float q = 1;
-
+    // Layer 3: fixed angle, scrolling in y.
+    e->animation.angle = 1;
+    e->animation.z = 500;
+    e->animation.scale_x = 0.2 * size;
+    e->animation.scale_y = 0.2 * size;
+    e->animation.offset_z = 0;
+    e->animation.offset_y = +7 * e->move.linear[3] + e->move.noise_angle[3];
+    render_values_fp(to_render_parameters_fp(e->animation), nullptr,
+                     mState.distance_raw.data(), nullptr, n, fade_lut, perm,
+                     mState.show_buf[2].data());
+    // The reference's fourth layer never reaches a channel, so it is skipped.
+
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-
-            float s = 1 + e->move.directional[6] * 0.3;
-
-            e->animation.dist = e->distance[x][y] * s;
-            e->animation.angle =
-                5 * e->polar_theta[x][y] + 1 * e->move.radial[0] -
-                e->animation.dist / (3 + e->move.directional[0] * 0.5);
-            e->animation.z = 5;
-            e->animation.scale_x = 0.08 * size + (e->move.directional[0] * 0.01);
-            e->animation.scale_y = 0.07 * size + (e->move.directional[1] * 0.01);
-            e->animation.offset_z = -10 * e->move.linear[0];
-            e->animation.offset_x = 0;
-            e->animation.offset_y = 0;
-            e->animation.low_limit = 0;
-            e->show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.dist = e->distance[x][y] * s;
-            e->animation.angle =
-                5 * e->polar_theta[x][y] + 1 * e->move.radial[1] +
-                e->animation.dist / (3 + e->move.directional[1] * 0.5);
-            e->animation.z = 50;
-            e->animation.scale_x = 0.08 * size + (e->move.directional[1] * 0.01);
-            e->animation.scale_y = 0.07 * size + (e->move.directional[2] * 0.01);
-            e->animation.offset_z = -10 * e->move.linear[1];
-            e->animation.offset_x = 0;
-            e->animation.offset_y = 0;
-            e->animation.low_limit = 0;
-            e->show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = 1;
-            e->animation.z = 500;
-            e->animation.scale_x = 0.2 * size;
-            e->animation.scale_y = 0.2 * size;
-            e->animation.offset_z = 0;
-            e->animation.offset_y = +7 * e->move.linear[3] + e->move.noise_angle[3];
-            e->animation.offset_x = 0;
-            e->animation.low_limit = 0;
-            e->show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle =
-                5 * e->polar_theta[x][y] + 12 * e->move.radial[3] +
-                e->animation.dist / (((e->move.directional[5] + 3) * 2)) +
-                e->move.noise_angle[3] * q;
-            e->animation.z = 500;
-            e->animation.scale_x = 0.09 * size * (e->move.directional[5] + 1.5);
-            ;
-            ;
-            e->animation.scale_y = 0.09 * size * (e->move.directional[6] + 1.5);
-            ;
-            ;
-            e->animation.offset_z = 0;
-            e->animation.offset_x = -35 * e->move.linear[3];
-            e->animation.offset_y = 0;
-            e->animation.low_limit = 0;
-            e->show4 = render_value_fp_from_float(e->animation, fade_lut, perm);
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->show1 = mState.show_buf[0][idx];
+            e->show2 = mState.show_buf[1][idx];
+            e->show3 = mState.show_buf[2][idx];
 
             float radius = e->radial_filter_radius;
             float radial = (radius - e->distance[x][y]) / e->distance[x][y];
@@ -212,7 +200,6 @@ void Complex_Kaleido_4_FP::draw(Context &ctx) {
             e->pixel.green = 0.5 * (e->show6);
 
             e->pixel = e->rgb_sanity_check(e->pixel);
-
             e->setPixelColorInternal(x, y, e->pixel);
         }
     }
@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/complex_kaleido_5.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -67,7 +68,7 @@ void Complex_Kaleido_5_FP::draw(Context &ctx) {
 
     auto *e = ctx.mEngine.get();
     e->get_ready();
-    mState.ensureCache(e);
+    mState.ensureCache(e, 1);
     const fl::i32 *fade_lut = fl::assume_aligned<16>(mState.fade_lut);
     const fl::u8 *perm = PERLIN_NOISE;
 
@@ -110,34 +111,32 @@ void Complex_Kaleido_5_FP::draw(Context &ctx) {
     p.low_limit_raw = FP(-0.5f).raw();
     p.high_limit_raw = FP_ONE;
 
-    fl::span<CRGB> leds = e->mCtx->leds;
-
     for (int i = 0; i < total_pixels; i++) {
-        const fl::i32 dist_raw = mState.distance_raw[i];
-
         // dist = distance * s
-        p.dist_raw = static_cast<fl::i32>(
-            (static_cast<fl::i64>(dist_raw) * s_raw) >> FP::FRAC_BITS);
-
+        const fl::i32 dist_raw = static_cast<fl::i32>(
+            (static_cast<fl::i64>(mState.distance_raw[i]) * s_raw) >> FP::FRAC_BITS);
         // angle = 10*radial[6] + 50*directional[5]*polar_theta - dist/3
         fl::i32 theta_term = static_cast<fl::i32>(
             (static_cast<fl::i64>(theta_scale_raw) * mState.polar_theta_raw[i]) >> FP::FRAC_BITS);
         fl::i32 dist_third = static_cast<fl::i32>(
-            (static_cast<fl::i64>(p.dist_raw) * one_third_raw) >> FP::FRAC_BITS);
-        p.angle_raw = angle_base_raw + theta_term - dist_third;
-
-        fl::i32 show1 = render_value_fp(p, fade_lut, perm);
+            (static_cast<fl::i64>(dist_raw) * one_third_raw) >> FP::FRAC_BITS);
+        mState.dist_buf[i] = dist_raw;
+        mState.angle_buf[i] = angle_base_raw + theta_term - dist_third;
+    }
+    render_values_fp(p, mState.angle_buf.data(), mState.dist_buf.data(), nullptr,
+                     total_pixels, fade_lut, perm, mState.show_buf[0].data());
 
+    fl::span<CRGB> leds = e->mCtx->leds;
+    for (int i = 0; i < total_pixels; i++) {
+        fl::i32 show1 = mState.show_buf[0][i];
         // Radial filter (float post-processing — not in critical Perlin path)
         // distance_raw is s16x16; convert back to float for division
-        float dist_f = FP::from_raw(dist_raw).to_float();
+        float dist_f = FP::from_raw(mState.distance_raw[i]).to_float();
         float radial = (dist_f > 0.0f) ? (radius - dist_f) / dist_f : 0.0f;
-
         fl::i32 r = static_cast<fl::i32>(show1 * radial);
         fl::i32 g = 0;
         fl::i32 b = 0;
         rgb_sanity_check_fp(r, g, b);
-
         leds[mState.pixel_idx[i]] = CRGB(
             static_cast<fl::u8>(r),
             static_cast<fl::u8>(g),
@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/complex_kaleido_6.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -67,7 +68,7 @@ void Complex_Kaleido_6::draw(Context &ctx) {
 void Complex_Kaleido_6_FP::draw(Context &ctx) {
     auto *e = ctx.mEngine.get();
     e->get_ready();
-    mState.ensureCache(e);
+    mState.ensureCache(e, 2);
     const fl::i32 *fade_lut = fl::assume_aligned<16>(mState.fade_lut);
     const fl::u8 *perm = PERLIN_NOISE;
 
@@ -82,37 +83,40 @@ void Complex_Kaleido_6_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
-    for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = 16 * e->polar_theta[x][y] + 16 * e->move.radial[0];
-            e->animation.z = 5;
-            e->animation.scale_x = 0.06;
-            e->animation.scale_y = 0.06;
-            e->animation.offset_z = -10 * e->move.linear[0];
-            e->animation.offset_y = 10 * e->move.noise_angle[0];
-            e->animation.offset_x = 10 * e->move.noise_angle[4];
-            e->animation.low_limit = 0;
-            e->show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = 16 * e->polar_theta[x][y] + 16 * e->move.radial[1];
-            e->animation.z = 500;
-            e->animation.scale_x = 0.06;
-            e->animation.scale_y = 0.06;
-            e->animation.offset_z = -10 * e->move.linear[1];
-            e->animation.offset_y = 10 * e->move.noise_angle[1];
-            e->animation.offset_x = 10 * e->move.noise_angle[3];
-            e->animation.low_limit = 0;
-            e->show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    // angle = 16 * theta + 16 * radial[layer]
+    const int n = mState.count;
+    const float z[2] = {5, 500};
+    const int offset_x_noise[2] = {4, 3};
+    e->animation.scale_x = 0.06;
+    e->animation.scale_y = 0.06;
+    e->animation.low_limit = 0;
+    for (int layer = 0; layer < 2; layer++) {
+        e->animation.z = z[layer];
+        e->animation.offset_z = -10 * e->move.linear[layer];
+        e->animation.offset_y = 10 * e->move.noise_angle[layer];
+        e->animation.offset_x = 10 * e->move.noise_angle[offset_x_noise[layer]];
+        const float radial = 16 * e->move.radial[layer];
+        int idx = 0;
+        for (int x = 0; x < e->num_x; x++) {
+            for (int y = 0; y < e->num_y; y++, idx++) {
+                mState.angle_buf[idx] =
+                    fl::s16x16(16 * e->polar_theta[x][y] + radial).raw();
+            }
+        }
+        render_values_fp(to_render_parameters_fp(e->animation),
+                         mState.angle_buf.data(), mState.distance_raw.data(),
+                         nullptr, n, fade_lut, perm,
+                         mState.show_buf[layer].data());
+    }
 
-            e->pixel.red = e->show1;
+    int idx = 0;
+    for (int x = 0; x < e->num_x; x++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->pixel.red = mState.show_buf[0][idx];
             e->pixel.green = 0;
-            e->pixel.blue = e->show2;
+            e->pixel.blue = mState.show_buf[1][idx];
 
             e->pixel = e->rgb_sanity_check(e->pixel);
-
             e->setPixelColorInternal(x, y, e->pixel);
         }
     }
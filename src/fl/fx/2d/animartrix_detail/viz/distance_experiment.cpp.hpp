@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/distance_experiment.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -65,7 +66,7 @@ void Distance_Experiment::draw(Context &ctx) {
 void Distance_Experiment_FP::draw(Context &ctx) {
     auto *e = ctx.mEngine.get();
     e->get_ready();
-    mState.ensureCache(e);
+    mState.ensureCache(e, 2);
     const fl::i32 *fade_lut = fl::assume_aligned<16>(mState.fade_lut);
     const fl::u8 *perm = PERLIN_NOISE;
 
@@ -80,29 +81,38 @@ void Distance_Experiment_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
-    for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = fl::powf(e->distance[x][y], 0.5f);
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[0];
-            e->animation.scale_x = 0.07;
-            e->animation.scale_y = 0.07;
-            e->animation.scale_z = 0.1;
-            e->animation.offset_y = e->move.linear[0];
-            e->animation.offset_x = 0;
-            e->animation.offset_z = 0;
-            e->animation.z = 0;
-            float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    // dist = distance^0.5 / distance^0.6, angle = theta + a per-layer angle
+    const int n = mState.count;
+    const float exponent[2] = {0.5f, 0.6f};
+    const float angle_add[2] = {e->move.radial[0], e->move.noise_angle[2]};
+    e->animation.scale_x = 0.07;
+    e->animation.scale_y = 0.07;
+    e->animation.scale_z = 0.1;
+    e->animation.offset_x = 0;
+    e->animation.offset_z = 0;
+    e->animation.z = 0;
+    for (int layer = 0; layer < 2; layer++) {
+        e->animation.offset_y = e->move.linear[layer];
+        int idx = 0;
+        for (int x = 0; x < e->num_x; x++) {
+            for (int y = 0; y < e->num_y; y++, idx++) {
+                mState.dist_buf[idx] =
+                    fl::s16x16(fl::powf(e->distance[x][y], exponent[layer])).raw();
+                mState.angle_buf[idx] =
+                    fl::s16x16(e->polar_theta[x][y] + angle_add[layer]).raw();
+            }
+        }
+        render_values_fp(to_render_parameters_fp(e->animation),
+                         mState.angle_buf.data(), mState.dist_buf.data(),
+                         nullptr, n, fade_lut, perm,
+                         mState.show_buf[layer].data());
+    }
 
-            e->animation.dist = fl::powf(e->distance[x][y], 0.6f);
-            e->animation.angle = e->polar_theta[x][y] + e->move.noise_angle[2];
-            e->animation.scale_x = 0.07;
-            e->animation.scale_y = 0.07;
-            e->animation.scale_z = 0.1;
-            e->animation.offset_y = e->move.linear[1];
-            e->animation.offset_x = 0;
-            e->animation.offset_z = 0;
-            e->animation.z = 0;
-            float show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    int idx = 0;
+    for (int x = 0; x < e->num_x; x++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            float show1 = mState.show_buf[0][idx];
+            float show2 = mState.show_buf[1][idx];
 
             e->pixel.red = show1 + show2;
             e->pixel.green = show2;
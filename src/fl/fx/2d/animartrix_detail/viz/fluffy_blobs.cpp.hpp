@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/fluffy_blobs.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -117,7 +118,7 @@ void Fluffy_Blobs::draw(Context &ctx) {
 
 void Fluffy_Blobs_FP::draw(Context &ctx) {
     auto *e = ctx.mEngine.get();
-    mState.ensureCache(e);
+    mState.ensureCache(e, 4);
     const fl::i32 *fade_lut = fl::assume_aligned<16>(mState.fade_lut);
     const fl::u8 *perm = PERLIN_NOISE;
 
@@ -138,83 +139,53 @@ void Fluffy_Blobs_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
-    for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y] + (radial_speed * e->move.radial[0]);
-            e->animation.z = 5;
-            e->animation.scale_x = size;
-            e->animation.scale_y = size;
-            e->animation.offset_z = 0;
-            e->animation.offset_x = 0;
-            e->animation.offset_y = linear_speed * e->move.linear[0];
-            e->animation.low_limit = 0;
-            e->animation.high_limit = 1;
-            e->show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.angle = e->polar_theta[x][y] + (radial_speed * e->move.radial[1]);
-            e->animation.offset_y = linear_speed * e->move.linear[1];
-            e->animation.offset_z = 200;
-            e->animation.scale_x = size * 1.1;
-            e->animation.scale_y = size * 1.1;
-            e->show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.angle = e->polar_theta[x][y] + (radial_speed * e->move.radial[2]);
-            e->animation.offset_y = linear_speed * e->move.linear[2];
-            e->animation.offset_z = 400;
-            e->animation.scale_x = size * 1.2;
-            e->animation.scale_y = size * 1.2;
-            e->show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.angle = e->polar_theta[x][y] + (radial_speed * e->move.radial[3]);
-            e->animation.offset_y = linear_speed * e->move.linear[3];
-            e->animation.offset_z = 600;
-            e->animation.scale_x = size;
-            e->animation.scale_y = size;
-            e->show4 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.angle = e->polar_theta[x][y] + (radial_speed * e->move.radial[4]);
-            e->animation.offset_y = linear_speed * e->move.linear[4];
-            e->animation.offset_z = 800;
-            e->animation.scale_x = size * 1.1;
-            e->animation.scale_y = size * 1.1;
-            e->show5 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.angle = e->polar_theta[x][y] + (radial_speed * e->move.radial[5]);
-            e->animation.offset_y = linear_speed * e->move.linear[5];
-            e->animation.offset_z = 1800;
-            e->animation.scale_x = size * 1.2;
-            e->animation.scale_y = size * 1.2;
-            e->show6 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.angle = e->polar_theta[x][y] + (radial_speed * e->move.radial[6]);
-            e->animation.offset_y = linear_speed * e->move.linear[6];
-            e->animation.offset_z = 2800;
-            e->animation.scale_x = size;
-            e->animation.scale_y = size;
-            e->show7 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.angle = e->polar_theta[x][y] + (radial_speed * e->move.radial[7]);
-            e->animation.offset_y = linear_speed * e->move.linear[7];
-            e->animation.offset_z = 3800;
-            e->animation.scale_x = size * 1.1;
-            e->animation.scale_y = size * 1.1;
-            e->show8 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    // Nine layers in three groups of three; each group only appears as a
+    // sum, so layers render into show_buf[3] and accumulate into
+    // show_buf[group].
+    const int n = mState.count;
+    const float offset_z[9] = {0, 200, 400, 600, 800, 1800, 2800, 3800, 4800};
+    const double scale_mul[3] = {1, 1.1, 1.2};
+    e->animation.z = 5;
+    e->animation.offset_x = 0;
+    e->animation.low_limit = 0;
+    e->animation.high_limit = 1;
+    fl::i32 *layer_out = mState.show_buf[3].data();
+    for (int layer = 0; layer < 9; layer++) {
+        e->animation.offset_y = linear_speed * e->move.linear[layer];
+        e->animation.offset_z = offset_z[layer];
+        e->animation.scale_x = size * scale_mul[layer % 3];
+        e->animation.scale_y = size * scale_mul[layer % 3];
+        int idx = 0;
+        for (int x = 0; x < e->num_x; x++) {
+            for (int y = 0; y < e->num_y; y++, idx++) {
+                mState.angle_buf[idx] = fl::s16x16(
+                    e->polar_theta[x][y] + (radial_speed * e->move.radial[layer])).raw();
+            }
+        }
+        fl::i32 *sum = mState.show_buf[layer / 3].data();
+        render_values_fp(to_render_parameters_fp(e->animation),
+                         mState.angle_buf.data(), mState.distance_raw.data(),
+                         nullptr, n, fade_lut, perm,
+                         layer % 3 == 0 ? sum : layer_out);
+        if (layer % 3 != 0) {
+            for (int i = 0; i < n; i++) {
+                sum[i] += layer_out[i];
+            }
+        }
+    }
 
-            e->animation.angle = e->polar_theta[x][y] + (radial_speed * e->move.radial[8]);
-            e->animation.offset_y = linear_speed * e->move.linear[8];
-            e->animation.offset_z = 4800;
-            e->animation.scale_x = size * 1.2;
-            e->animation.scale_y = size * 1.2;
-            e->show9 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    int idx = 0;
+    for (int x = 0; x < e->num_x; x++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            float sum1 = mState.show_buf[0][idx];  // show1 + show2 + show3
+            float sum2 = mState.show_buf[1][idx];  // show4 + show5 + show6
+            float sum3 = mState.show_buf[2][idx];  // show7 + show8 + show9
 
-            e->pixel.red = 0.8 * (e->show1 + e->show2 + e->show3) + (e->show4 + e->show5 + e->show6);
-            e->pixel.green = 0.8 * (e->show4 + e->show5 + e->show6);
-            e->pixel.blue = 0.3 * (e->show7 + e->show8 + e->show9);
+            e->pixel.red = 0.8 * sum1 + sum2;
+            e->pixel.green = 0.8 * sum2;
+            e->pixel.blue = 0.3 * sum3;
 
             e->pixel = e->rgb_sanity_check(e->pixel);
-
             e->setPixelColorInternal(x, y, e->pixel);
         }
     }
@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/hot_blob.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -65,47 +66,62 @@ void Hot_Blob::draw(Context &ctx) {
 void Hot_Blob_FP::draw(Context &ctx) {
     auto *e = ctx.mEngine.get();
     e->get_ready();
-    mState.ensureCache(e);
+    mState.ensureCache(e, 4);
     const fl::i32 *fade_lut = fl::assume_aligned<16>(mState.fade_lut);
     const fl::u8 *perm = PERLIN_NOISE;
     e->run_default_oscillators(0.001);
 
+    const int n = mState.count;
+    const fl::i32 *theta = mState.polar_theta_raw.data();
+    const fl::i32 *dist = mState.distance_raw.data();
+    fl::i32 *show1 = mState.show_buf[0].data();
+    fl::i32 *show2 = mState.show_buf[1].data();
+    fl::i32 *show3 = mState.show_buf[2].data();
+    fl::i32 *show4 = mState.show_buf[3].data();
+
+    e->animation.scale_x = 0.07 + e->move.directional[0] * 0.002;
+    e->animation.scale_y = 0.07;
+    e->animation.offset_y = -e->move.linear[0];
+    e->animation.offset_x = 0;
+    e->animation.offset_z = 0;
+    e->animation.z = 0;
+    e->animation.low_limit = -1;
+    render_values_fp(to_render_parameters_fp(e->animation), theta, dist,
+                     nullptr, n, fade_lut, perm, show1);
+
+    e->animation.offset_y = -e->move.linear[1];
+    render_values_fp(to_render_parameters_fp(e->animation), theta, dist,
+                     nullptr, n, fade_lut, perm, show3);
+
+    // Layers 3-4 are displaced by the first two.
+    for (int i = 0; i < n; i++) {
+        float s1 = show1[i];
+        float s3 = show3[i];
+        mState.offset_x_buf[i] = fl::s16x16(s3 / 20).raw();
+        mState.offset_y_buf[i] = fl::s16x16(-e->move.linear[0] / 2 + s1 / 70).raw();
+    }
+    render_inputs_fp in;
+    in.angle = theta;
+    in.dist = dist;
+    in.offset_x = mState.offset_x_buf.data();
+    in.offset_y = mState.offset_y_buf.data();
+    e->animation.low_limit = 0;
+    render_values_fp(to_render_parameters_fp(e->animation), in, n, fade_lut,
+                     perm, show2);
+    e->animation.z = 100;
+    render_values_fp(to_render_parameters_fp(e->animation), in, n, fade_lut,
+                     perm, show4);
+
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y];
-
-            e->animation.scale_x = 0.07 + e->move.directional[0] * 0.002;
-            e->animation.scale_y = 0.07;
-
-            e->animation.offset_y = -e->move.linear[0];
-            e->animation.offset_x = 0;
-            e->animation.offset_z = 0;
-
-            e->animation.z = 0;
-            e->animation.low_limit = -1;
-            float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.offset_y = -e->move.linear[1];
-            float show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.offset_x = show3 / 20;
-            e->animation.offset_y = -e->move.linear[0] / 2 + show1 / 70;
-            e->animation.low_limit = 0;
-            float show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.offset_x = show3 / 20;
-            e->animation.offset_y = -e->move.linear[0] / 2 + show1 / 70;
-            e->animation.z = 100;
-            float show4 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
+        for (int y = 0; y < e->num_y; y++, idx++) {
             float radius = e->radial_filter_radius;
-            float radial = (radius - e->animation.dist) / e->animation.dist;
+            float radial = (radius - e->distance[x][y]) / e->distance[x][y];
 
             float linear = (y + 1) / (e->num_y - 1.f);
 
-            e->pixel.red = radial * show2;
-            e->pixel.green = linear * radial * 0.3 * (show2 - show4);
+            e->pixel.red = radial * show2[idx];
+            e->pixel.green = linear * radial * 0.3 * (show2[idx] - show4[idx]);
             e->pixel.blue = 0;
 
             e->pixel = e->rgb_sanity_check(e->pixel);
@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/lava1.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -73,7 +74,7 @@ void Lava1::draw(Context &ctx) {
 void Lava1_FP::draw(Context &ctx) {
     auto *e = ctx.mEngine.get();
     e->get_ready();
-    mState.ensureCache(e);
+    mState.ensureCache(e, 3);
     const fl::i32 *fade_lut = fl::assume_aligned<16>(mState.fade_lut);
     const fl::u8 *perm = PERLIN_NOISE;
 
@@ -91,32 +92,47 @@ void Lava1_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    // Each layer is displaced by the previous one (offset += show / 100).
+    const int n = mState.count;
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = e->distance[x][y] * 0.8;
-            e->animation.angle = e->polar_theta[x][y];
-            e->animation.scale_x = 0.15;
-            e->animation.scale_y = 0.12;
-            e->animation.scale_z = 0.01;
-            e->animation.offset_y = -e->move.linear[0];
-            e->animation.offset_x = 0;
-            e->animation.offset_z = 0;
-            e->animation.z = 30;
-            float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.offset_y = -e->move.linear[1];
-            e->animation.scale_x = 0.15;
-            e->animation.scale_y = 0.12;
-            e->animation.offset_x = show1 / 100;
-            e->animation.offset_y += show1 / 100;
-            float show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            mState.dist_buf[idx] = fl::s16x16(e->distance[x][y] * 0.8).raw();
+        }
+    }
+    e->animation.scale_x = 0.15;
+    e->animation.scale_y = 0.12;
+    e->animation.scale_z = 0.01;
+    e->animation.offset_y = -e->move.linear[0];
+    e->animation.offset_x = 0;
+    e->animation.offset_z = 0;
+    e->animation.z = 30;
+    render_values_fp(to_render_parameters_fp(e->animation),
+                     mState.polar_theta_raw.data(), mState.dist_buf.data(),
+                     nullptr, n, fade_lut, perm, mState.show_buf[0].data());
+
+    render_inputs_fp in;
+    in.angle = mState.polar_theta_raw.data();
+    in.dist = mState.dist_buf.data();
+    in.offset_x = mState.offset_x_buf.data();
+    in.offset_y = mState.offset_y_buf.data();
+    for (int layer = 1; layer < 3; layer++) {
+        const fl::i32 *prev = mState.show_buf[layer - 1].data();
+        for (int i = 0; i < n; i++) {
+            float show = prev[i];
+            mState.offset_x_buf[i] = fl::s16x16(show / 100).raw();
+            mState.offset_y_buf[i] =
+                fl::s16x16(-e->move.linear[layer] + show / 100).raw();
+        }
+        render_values_fp(to_render_parameters_fp(e->animation), in, n,
+                         fade_lut, perm, mState.show_buf[layer].data());
+    }
 
-            e->animation.offset_y = -e->move.linear[2];
-            e->animation.scale_x = 0.15;
-            e->animation.scale_y = 0.12;
-            e->animation.offset_x = show2 / 100;
-            e->animation.offset_y += show2 / 100;
-            float show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    idx = 0;
+    for (int x = 0; x < e->num_x; x++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            float show2 = mState.show_buf[1][idx];
+            float show3 = mState.show_buf[2][idx];
 
             float linear = (y) / (e->num_y - 1.f);
 
@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/module_experiment1.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -54,7 +55,7 @@ void Module_Experiment1::draw(Context &ctx) {
 void Module_Experiment1_FP::draw(Context &ctx) {
     auto *e = ctx.mEngine.get();
     e->get_ready();
-    mState.ensureCache(e);
+    mState.ensureCache(e, 1);
     const fl::i32 *fade_lut = fl::assume_aligned<16>(mState.fade_lut);
     const fl::u8 *perm = PERLIN_NOISE;
 
@@ -66,24 +67,34 @@ void Module_Experiment1_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const int n = mState.count;
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-
-            e->animation.dist = e->distance[x][y] + 20 * e->move.directional[0];
-            e->animation.angle = e->move.noise_angle[0] + e->move.noise_angle[1] +
-                                 e->polar_theta[x][y];
-            e->animation.z = 5;
-            e->animation.scale_x = 0.1;
-            e->animation.scale_y = 0.1;
-            e->animation.offset_z = -10;
-            e->animation.offset_y = 20 * e->move.linear[2];
-            e->animation.offset_x = 10;
-            e->animation.low_limit = 0;
-            e->show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            mState.dist_buf[idx] = fl::s16x16(
+                e->distance[x][y] + 20 * e->move.directional[0]).raw();
+            mState.angle_buf[idx] = fl::s16x16(
+                e->move.noise_angle[0] + e->move.noise_angle[1] +
+                e->polar_theta[x][y]).raw();
+        }
+    }
+    e->animation.z = 5;
+    e->animation.scale_x = 0.1;
+    e->animation.scale_y = 0.1;
+    e->animation.offset_z = -10;
+    e->animation.offset_y = 20 * e->move.linear[2];
+    e->animation.offset_x = 10;
+    e->animation.low_limit = 0;
+    render_values_fp(to_render_parameters_fp(e->animation),
+                     mState.angle_buf.data(), mState.dist_buf.data(), nullptr,
+                     n, fade_lut, perm, mState.show_buf[0].data());
+
+    idx = 0;
+    for (int x = 0; x < e->num_x; x++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
             e->pixel.red = 0;
             e->pixel.green = 0;
-            e->pixel.blue = e->show1;
+            e->pixel.blue = mState.show_buf[0][idx];
 
             e->pixel = e->rgb_sanity_check(e->pixel);
 
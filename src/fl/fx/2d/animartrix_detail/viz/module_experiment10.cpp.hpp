@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/module_experiment10.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -112,7 +113,7 @@ void Module_Experiment10_FP::draw(Context &ctx) {
 
     auto *e = ctx.mEngine.get();
     e->get_ready();
-    mState.ensureCache(e);
+    mState.ensureCache(e, 3);
     const fl::i32 *fade_lut = fl::assume_aligned<16>(mState.fade_lut);
     const fl::u8 *perm = PERLIN_NOISE;
 
@@ -147,14 +148,13 @@ void Module_Experiment10_FP::draw(Context &ctx) {
     const fl::i32 scale_xy_raw = FP(0.1f * 0.4f).raw(); // 0.1 * s
 
     // Per-frame angle offsets for each pass
-    const fl::i32 angle_offset1_raw = FP(e->move.noise_angle[0] + e->move.noise_angle[6]).raw();
-    const fl::i32 angle_offset2_raw = FP(e->move.noise_angle[1] + e->move.noise_angle[6]).raw();
-    const fl::i32 angle_offset3_raw = FP(e->move.noise_angle[2] + e->move.noise_angle[6]).raw();
+    const fl::i32 angle_offset_raw[3] = {
+        FP(e->move.noise_angle[0] + e->move.noise_angle[6]).raw(),
+        FP(e->move.noise_angle[1] + e->move.noise_angle[6]).raw(),
+        FP(e->move.noise_angle[2] + e->move.noise_angle[6]).raw()};
 
     // Per-frame sinf arguments
-    const float radial3 = e->move.radial[3];
-    const float radial4 = e->move.radial[4];
-    const float radial5 = e->move.radial[5];
+    const float radial[3] = {e->move.radial[3], e->move.radial[4], e->move.radial[5]};
 
     // Per-frame time hue offset
     const fl::u8 a = e->getTime() / 100;
@@ -171,52 +171,35 @@ void Module_Experiment10_FP::draw(Context &ctx) {
     p.high_limit_raw = FP_ONE;
 
     // Pass-specific per-frame constants
-    const fl::i32 oz1_raw = FP(10.0f * e->move.linear[0]).raw();
-    const fl::i32 oy1_raw = FP(-5.0f * r_factor * e->move.linear[0]).raw();
-    const fl::i32 ox1_raw = FP(10.0f).raw();
-
-    const fl::i32 oz2_raw = FP(0.1f * e->move.linear[1]).raw();
-    const fl::i32 oy2_raw = FP(-5.0f * r_factor * e->move.linear[1]).raw();
-    const fl::i32 ox2_raw = FP(100.0f).raw();
-
-    const fl::i32 oz3_raw = FP(0.1f * e->move.linear[2]).raw();
-    const fl::i32 oy3_raw = FP(-5.0f * r_factor * e->move.linear[2]).raw();
-    const fl::i32 ox3_raw = FP(1000.0f).raw();
+    const fl::i32 oz_raw[3] = {FP(10.0f * e->move.linear[0]).raw(),
+                               FP(0.1f * e->move.linear[1]).raw(),
+                               FP(0.1f * e->move.linear[2]).raw()};
+    const fl::i32 ox_raw[3] = {FP(10.0f).raw(), FP(100.0f).raw(), FP(1000.0f).raw()};
+
+    // Pass k: dist = a + distance + a*sin(w*distance - radial[3 + k])
+    const float amp[3] = {3.0f, 4.0f, 5.0f};
+    const float ripple[3] = {0.25f, 0.24f, 0.23f};
+    for (int pass = 0; pass < 3; pass++) {
+        for (int i = 0; i < total_pixels; i++) {
+            // Convert distance to float once for the sinf call
+            const float dist_f = FP::from_raw(mState.distance_raw[i]).to_float();
+            mState.dist_buf[i] = FP(amp[pass] + dist_f +
+                                    amp[pass] * fl::sinf(ripple[pass] * dist_f - radial[pass])).raw();
+            mState.angle_buf[i] = mState.polar_theta_raw[i] + angle_offset_raw[pass];
+        }
+        p.offset_z_raw = oz_raw[pass];
+        p.offset_y_raw = FP(-5.0f * r_factor * e->move.linear[pass]).raw();
+        p.offset_x_raw = ox_raw[pass];
+        render_values_fp(p, mState.angle_buf.data(), mState.dist_buf.data(), nullptr,
+                         total_pixels, fade_lut, perm, mState.show_buf[pass].data());
+    }
 
     fl::span<CRGB> leds = e->mCtx->leds;
 
     for (int i = 0; i < total_pixels; i++) {
-        const fl::i32 theta_raw = mState.polar_theta_raw[i];
-        const fl::i32 dist_raw_i = mState.distance_raw[i];
-        // Convert distance to float once for the sinf calls
-        const float dist_f = FP::from_raw(dist_raw_i).to_float();
-
-        // Pass 1: dist = 3 + distance + 3*sin(0.25*distance - radial[3])
-        fl::i32 dist1_raw = FP(3.0f + dist_f + 3.0f * fl::sinf(0.25f * dist_f - radial3)).raw();
-        p.angle_raw = theta_raw + angle_offset1_raw;
-        p.dist_raw = dist1_raw;
-        p.offset_z_raw = oz1_raw;
-        p.offset_y_raw = oy1_raw;
-        p.offset_x_raw = ox1_raw;
-        fl::i32 show1 = render_value_fp(p, fade_lut, perm);
-
-        // Pass 2: dist = 4 + distance + 4*sin(0.24*distance - radial[4])
-        fl::i32 dist2_raw = FP(4.0f + dist_f + 4.0f * fl::sinf(0.24f * dist_f - radial4)).raw();
-        p.angle_raw = theta_raw + angle_offset2_raw;
-        p.dist_raw = dist2_raw;
-        p.offset_z_raw = oz2_raw;
-        p.offset_y_raw = oy2_raw;
-        p.offset_x_raw = ox2_raw;
-        fl::i32 show2 = render_value_fp(p, fade_lut, perm);
-
-        // Pass 3: dist = 5 + distance + 5*sin(0.23*distance - radial[5])
-        fl::i32 dist3_raw = FP(5.0f + dist_f + 5.0f * fl::sinf(0.23f * dist_f - radial5)).raw();
-        p.angle_raw = theta_raw + angle_offset3_raw;
-        p.dist_raw = dist3_raw;
-        p.offset_z_raw = oz3_raw;
-        p.offset_y_raw = oy3_raw;
-        p.offset_x_raw = ox3_raw;
-        fl::i32 show3 = render_value_fp(p, fade_lut, perm);
+        const fl::i32 show1 = mState.show_buf[0][i];
+        const fl::i32 show2 = mState.show_buf[1][i];
+        const fl::i32 show3 = mState.show_buf[2][i];
 
         // Color: CHSV with hue = (a + show1 + show2) + show3
         CRGB c = CRGB(CHSV(static_cast<fl::u8>((a + show1 + show2) + show3), 255, 255));
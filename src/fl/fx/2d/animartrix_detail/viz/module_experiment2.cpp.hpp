@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/module_experiment2.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -57,7 +58,7 @@ void Module_Experiment2_FP::draw(Context &ctx) {
 
     auto *e = ctx.mEngine.get();
     e->get_ready();
-    mState.ensureCache(e);
+    mState.ensureCache(e, 1);
     const fl::i32 *fade_lut = fl::assume_aligned<16>(mState.fade_lut);
     const fl::u8 *perm = PERLIN_NOISE;
 
@@ -98,14 +99,18 @@ void Module_Experiment2_FP::draw(Context &ctx) {
     p.low_limit_raw = 0;
     p.high_limit_raw = FP_ONE;
 
-    fl::span<CRGB> leds = e->mCtx->leds;
-
     for (int i = 0; i < total_pixels; i++) {
         // Per-pixel: dist and angle
-        p.dist_raw = mState.distance_raw[i] - dist_offset_raw;
-        p.angle_raw = angle_offset_raw + mState.polar_theta_raw[i];
+        mState.dist_buf[i] = mState.distance_raw[i] - dist_offset_raw;
+        mState.angle_buf[i] = angle_offset_raw + mState.polar_theta_raw[i];
+    }
+    render_values_fp(p, mState.angle_buf.data(), mState.dist_buf.data(), nullptr,
+                     total_pixels, fade_lut, perm, mState.show_buf[0].data());
 
-        fl::i32 show1 = render_value_fp(p, fade_lut, perm);
+    fl::span<CRGB> leds = e->mCtx->leds;
+
+    for (int i = 0; i < total_pixels; i++) {
+        fl::i32 show1 = mState.show_buf[0][i];
 
         fl::i32 r = show1;
         fl::i32 g = show1 - 80;
@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/module_experiment4.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -78,7 +79,7 @@ void Module_Experiment4::draw(Context &ctx) {
 void Module_Experiment4_FP::draw(Context &ctx) {
     auto *e = ctx.mEngine.get();
     e->get_ready();
-    mState.ensureCache(e);
+    mState.ensureCache(e, 3);
     const fl::i32 *fade_lut = fl::assume_aligned<16>(mState.fade_lut);
     const fl::u8 *perm = PERLIN_NOISE;
 
@@ -91,43 +92,40 @@ void Module_Experiment4_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
-    for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-
-            float s = 0.8;
-
-            e->animation.dist = (e->distance[x][y] * e->distance[x][y]) * 0.7;
-            e->animation.angle = e->polar_theta[x][y];
-            e->animation.z = 5;
-            e->animation.scale_x = 0.004 * s;
-            e->animation.scale_y = 0.003 * s;
-            e->animation.offset_z = 0.1 * e->move.linear[2];
-            e->animation.offset_y = -20 * e->move.linear[2];
-            e->animation.offset_x = 10;
-            e->animation.low_limit = 0;
-            e->show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.dist = (e->distance[x][y] * e->distance[x][y]) * 0.8;
-            e->animation.angle = e->polar_theta[x][y];
-            e->animation.z = 50;
-            e->animation.scale_x = 0.004 * s;
-            e->animation.scale_y = 0.003 * s;
-            e->animation.offset_z = 0.1 * e->move.linear[3];
-            e->animation.offset_y = -20 * e->move.linear[3];
-            e->animation.offset_x = 100;
-            e->animation.low_limit = 0;
-            e->show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    float s = 0.8;
+
+    // dist = distance^2 * k, angle = theta
+    const int n = mState.count;
+    const double dist_mul[3] = {0.7, 0.8, 0.9};
+    const float z[3] = {5, 50, 5000};
+    const float offset_x[3] = {10, 100, 1000};
+    e->animation.scale_x = 0.004 * s;
+    e->animation.scale_y = 0.003 * s;
+    e->animation.low_limit = 0;
+    for (int layer = 0; layer < 3; layer++) {
+        e->animation.z = z[layer];
+        e->animation.offset_z = 0.1 * e->move.linear[layer + 2];
+        e->animation.offset_y = -20 * e->move.linear[layer + 2];
+        e->animation.offset_x = offset_x[layer];
+        int idx = 0;
+        for (int x = 0; x < e->num_x; x++) {
+            for (int y = 0; y < e->num_y; y++, idx++) {
+                mState.dist_buf[idx] = fl::s16x16(
+                    (e->distance[x][y] * e->distance[x][y]) * dist_mul[layer]).raw();
+            }
+        }
+        render_values_fp(to_render_parameters_fp(e->animation),
+                         mState.polar_theta_raw.data(), mState.dist_buf.data(),
+                         nullptr, n, fade_lut, perm,
+                         mState.show_buf[layer].data());
+    }
 
-            e->animation.dist = (e->distance[x][y] * e->distance[x][y]) * 0.9;
-            e->animation.angle = e->polar_theta[x][y];
-            e->animation.z = 5000;
-            e->animation.scale_x = 0.004 * s;
-            e->animation.scale_y = 0.003 * s;
-            e->animation.offset_z = 0.1 * e->move.linear[4];
-            e->animation.offset_y = -20 * e->move.linear[4];
-            e->animation.offset_x = 1000;
-            e->animation.low_limit = 0;
-            e->show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    int idx = 0;
+    for (int x = 0; x < e->num_x; x++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->show1 = mState.show_buf[0][idx];
+            e->show2 = mState.show_buf[1][idx];
+            e->show3 = mState.show_buf[2][idx];
 
             e->pixel.red = e->show1 - e->show2 - e->show3;
             e->pixel.blue = e->show2 - e->show1 - e->show3;
@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/module_experiment6.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -72,7 +73,7 @@ void Module_Experiment6::draw(Context &ctx) {
 void Module_Experiment6_FP::draw(Context &ctx) {
     auto *e = ctx.mEngine.get();
     e->get_ready();
-    mState.ensureCache(e);
+    mState.ensureCache(e, 2);
     const fl::i32 *fade_lut = fl::assume_aligned<16>(mState.fade_lut);
     const fl::u8 *perm = PERLIN_NOISE;
 
@@ -88,34 +89,40 @@ void Module_Experiment6_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
-    for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-
-            float s = 0.8;
-
-            e->animation.dist = e->distance[x][y] +
-                                 fl::sinf(0.25 * e->distance[x][y] - e->move.radial[3]);
-            e->animation.angle = e->polar_theta[x][y];
-            e->animation.z = 5;
-            e->animation.scale_x = 0.1 * s;
-            e->animation.scale_y = 0.1 * s;
-            e->animation.offset_z = 0.1 * e->move.linear[0];
-            e->animation.offset_y = -20 * e->move.linear[0];
-            e->animation.offset_x = 10;
-            e->animation.low_limit = 0;
-            e->show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    float s = 0.8;
+
+    // dist = distance + sin(k * distance - radial[3 + layer]), angle = theta
+    const int n = mState.count;
+    const double ripple[2] = {0.25, 0.24};
+    const float z[2] = {5, 10};
+    e->animation.scale_x = 0.1 * s;
+    e->animation.scale_y = 0.1 * s;
+    e->animation.offset_x = 10;
+    e->animation.low_limit = 0;
+    for (int layer = 0; layer < 2; layer++) {
+        e->animation.z = z[layer];
+        e->animation.offset_z = 0.1 * e->move.linear[layer];
+        e->animation.offset_y = -20 * e->move.linear[layer];
+        int idx = 0;
+        for (int x = 0; x < e->num_x; x++) {
+            for (int y = 0; y < e->num_y; y++, idx++) {
+                mState.dist_buf[idx] = fl::s16x16(
+                    e->distance[x][y] +
+                    fl::sinf(ripple[layer] * e->distance[x][y] -
+                             e->move.radial[3 + layer])).raw();
+            }
+        }
+        render_values_fp(to_render_parameters_fp(e->animation),
+                         mState.polar_theta_raw.data(), mState.dist_buf.data(),
+                         nullptr, n, fade_lut, perm,
+                         mState.show_buf[layer].data());
+    }
 
-            e->animation.dist = e->distance[x][y] +
-                                 fl::sinf(0.24 * e->distance[x][y] - e->move.radial[4]);
-            e->animation.angle = e->polar_theta[x][y];
-            e->animation.z = 10;
-            e->animation.scale_x = 0.1 * s;
-            e->animation.scale_y = 0.1 * s;
-            e->animation.offset_z = 0.1 * e->move.linear[1];
-            e->animation.offset_y = -20 * e->move.linear[1];
-            e->animation.offset_x = 10;
-            e->animation.low_limit = 0;
-            e->show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    int idx = 0;
+    for (int x = 0; x < e->num_x; x++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->show1 = mState.show_buf[0][idx];
+            e->show2 = mState.show_buf[1][idx];
 
             e->pixel.red = (e->show1 + e->show2);
             e->pixel.green = ((e->show1 + e->show2) * 0.6) - 30;
@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/module_experiment8.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -106,7 +107,7 @@ void Module_Experiment8::draw(Context &ctx) {
 void Module_Experiment8_FP::draw(Context &ctx) {
     auto *e = ctx.mEngine.get();
     e->get_ready();
-    mState.ensureCache(e);
+    mState.ensureCache(e, 3);
     const fl::i32 *fade_lut = fl::assume_aligned<16>(mState.fade_lut);
     const fl::u8 *perm = PERLIN_NOISE;
 
@@ -132,53 +133,48 @@ void Module_Experiment8_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
-    for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-
-            float s = 0.4;
-            float r = 1.5;
-
-            e->animation.dist =
-                3 + e->distance[x][y] +
-                3 * fl::sinf(0.25 * e->distance[x][y] - e->move.radial[3]);
-            e->animation.angle = e->polar_theta[x][y] + e->move.noise_angle[0] +
-                                 e->move.noise_angle[6];
-            e->animation.z = 5;
-            e->animation.scale_x = 0.1 * s;
-            e->animation.scale_y = 0.1 * s;
-            e->animation.offset_z = 10 * e->move.linear[0];
-            e->animation.offset_y = -5 * r * e->move.linear[0];
-            e->animation.offset_x = 10;
-            e->animation.low_limit = 0;
-            e->show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.dist =
-                4 + e->distance[x][y] +
-                4 * fl::sinf(0.24 * e->distance[x][y] - e->move.radial[4]);
-            e->animation.angle = e->polar_theta[x][y] + e->move.noise_angle[1] +
-                                 e->move.noise_angle[6];
-            e->animation.z = 5;
-            e->animation.scale_x = 0.1 * s;
-            e->animation.scale_y = 0.1 * s;
-            e->animation.offset_z = 0.1 * e->move.linear[1];
-            e->animation.offset_y = -5 * r * e->move.linear[1];
-            e->animation.offset_x = 100;
-            e->animation.low_limit = 0;
-            e->show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    float s = 0.4;
+    float r = 1.5;
+
+    // dist = a + distance + a * sin(k * distance - radial[3 + layer]),
+    // angle = theta + noise_angle[layer] + noise_angle[6]
+    const int n = mState.count;
+    const float amp[3] = {3, 4, 5};
+    const double ripple[3] = {0.25, 0.24, 0.23};
+    const float offset_x[3] = {10, 100, 1000};
+    e->animation.z = 5;
+    e->animation.scale_x = 0.1 * s;
+    e->animation.scale_y = 0.1 * s;
+    e->animation.low_limit = 0;
+    for (int layer = 0; layer < 3; layer++) {
+        e->animation.offset_z = layer == 0 ? 10 * e->move.linear[0]
+                                           : 0.1 * e->move.linear[layer];
+        e->animation.offset_y = -5 * r * e->move.linear[layer];
+        e->animation.offset_x = offset_x[layer];
+        int idx = 0;
+        for (int x = 0; x < e->num_x; x++) {
+            for (int y = 0; y < e->num_y; y++, idx++) {
+                mState.dist_buf[idx] = fl::s16x16(
+                    amp[layer] + e->distance[x][y] +
+                    amp[layer] * fl::sinf(ripple[layer] * e->distance[x][y] -
+                                          e->move.radial[3 + layer])).raw();
+                mState.angle_buf[idx] = fl::s16x16(
+                    e->polar_theta[x][y] + e->move.noise_angle[layer] +
+                    e->move.noise_angle[6]).raw();
+            }
+        }
+        render_values_fp(to_render_parameters_fp(e->animation),
+                         mState.angle_buf.data(), mState.dist_buf.data(),
+                         nullptr, n, fade_lut, perm,
+                         mState.show_buf[layer].data());
+    }
 
-            e->animation.dist =
-                5 + e->distance[x][y] +
-                5 * fl::sinf(0.23 * e->distance[x][y] - e->move.radial[5]);
-            e->animation.angle = e->polar_theta[x][y] + e->move.noise_angle[2] +
-                                 e->move.noise_angle[6];
-            e->animation.z = 5;
-            e->animation.scale_x = 0.1 * s;
-            e->animation.scale_y = 0.1 * s;
-            e->animation.offset_z = 0.1 * e->move.linear[2];
-            e->animation.offset_y = -5 * r * e->move.linear[2];
-            e->animation.offset_x = 1000;
-            e->animation.low_limit = 0;
-            e->show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    int idx = 0;
+    for (int x = 0; x < e->num_x; x++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->show1 = mState.show_buf[0][idx];
+            e->show2 = mState.show_buf[1][idx];
+            e->show3 = mState.show_buf[2][idx];
 
             e->show4 = e->colordodge(e->show1, e->show2);
 
@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/module_experiment9.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -60,7 +61,7 @@ void Module_Experiment9::draw(Context &ctx) {
 void Module_Experiment9_FP::draw(Context &ctx) {
     auto *e = ctx.mEngine.get();
     e->get_ready();
-    mState.ensureCache(e);
+    mState.ensureCache(e, 1);
     const fl::i32 *fade_lut = fl::assume_aligned<16>(mState.fade_lut);
     const fl::u8 *perm = PERLIN_NOISE;
 
@@ -78,22 +79,31 @@ void Module_Experiment9_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    // angle = theta + radial[1]
+    const int n = mState.count;
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[1];
-            e->animation.z = 5;
-            e->animation.scale_x = 0.001;
-            e->animation.scale_y = 0.1;
-            e->animation.scale_z = 0.1;
-            e->animation.offset_y = -10 * e->move.linear[0];
-            e->animation.offset_x = 20;
-            e->animation.offset_z = 10;
-            e->animation.low_limit = 0;
-            e->show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->pixel.red = 10 * e->show1;
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            mState.angle_buf[idx] =
+                fl::s16x16(e->polar_theta[x][y] + e->move.radial[1]).raw();
+        }
+    }
+    e->animation.z = 5;
+    e->animation.scale_x = 0.001;
+    e->animation.scale_y = 0.1;
+    e->animation.scale_z = 0.1;
+    e->animation.offset_y = -10 * e->move.linear[0];
+    e->animation.offset_x = 20;
+    e->animation.offset_z = 10;
+    e->animation.low_limit = 0;
+    render_values_fp(to_render_parameters_fp(e->animation),
+                     mState.angle_buf.data(), mState.distance_raw.data(),
+                     nullptr, n, fade_lut, perm, mState.show_buf[0].data());
+
+    idx = 0;
+    for (int x = 0; x < e->num_x; x++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->pixel.red = 10 * mState.show_buf[0][idx];
             e->pixel.green = 0;
             e->pixel.blue = 0;
 
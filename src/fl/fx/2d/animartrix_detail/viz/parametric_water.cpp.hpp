@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/parametric_water.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -106,7 +107,7 @@ void Parametric_Water::draw(Context &ctx) {
 void Parametric_Water_FP::draw(Context &ctx) {
     auto *e = ctx.mEngine.get();
     e->get_ready();
-    mState.ensureCache(e);
+    mState.ensureCache(e, 4);
     const fl::i32 *fade_lut = fl::assume_aligned<16>(mState.fade_lut);
     const fl::u8 *perm = PERLIN_NOISE;
 
@@ -121,63 +122,43 @@ void Parametric_Water_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
-    for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-
-            float s = 4;
-            float f = 10 + 2 * e->move.directional[0];
-
-            e->animation.dist = (f + e->move.directional[0]) *
-                                 fl::sinf(-e->move.radial[5] + e->move.radial[0] +
-                                      (e->distance[x][y] / (s)));
-            e->animation.angle = 1 * e->polar_theta[x][y];
-            e->animation.z = 5;
-            e->animation.scale_x = 0.1;
-            e->animation.scale_y = 0.1;
-            e->animation.offset_z = -10;
-            e->animation.offset_y = 20 * e->move.linear[0];
-            e->animation.offset_x = 10;
-            e->animation.low_limit = 0;
-            e->show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.dist = (f + e->move.directional[1]) *
-                                 fl::sinf(-e->move.radial[5] + e->move.radial[1] +
-                                      (e->distance[x][y] / (s)));
-            e->animation.angle = 1 * e->polar_theta[x][y];
-            e->animation.z = 500;
-            e->animation.scale_x = 0.1;
-            e->animation.scale_y = 0.1;
-            e->animation.offset_z = -10;
-            e->animation.offset_y = 20 * e->move.linear[1];
-            e->animation.offset_x = 10;
-            e->animation.low_limit = 0;
-            e->show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.dist = (f + e->move.directional[2]) *
-                                 fl::sinf(-e->move.radial[5] + e->move.radial[2] +
-                                      (e->distance[x][y] / (s)));
-            e->animation.angle = 1 * e->polar_theta[x][y];
-            e->animation.z = 5000;
-            e->animation.scale_x = 0.1;
-            e->animation.scale_y = 0.1;
-            e->animation.offset_z = -10;
-            e->animation.offset_y = 20 * e->move.linear[2];
-            e->animation.offset_x = 10;
-            e->animation.low_limit = 0;
-            e->show4 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    float s = 4;
+    float f = 10 + 2 * e->move.directional[0];
+
+    // dist = (f + directional[k]) * sin(radial[k] - radial[5] + distance / s),
+    // angle = theta
+    const int n = mState.count;
+    const float z[4] = {5, 500, 5000, 2000};
+    e->animation.scale_x = 0.1;
+    e->animation.scale_y = 0.1;
+    e->animation.offset_z = -10;
+    e->animation.offset_x = 10;
+    e->animation.low_limit = 0;
+    for (int layer = 0; layer < 4; layer++) {
+        e->animation.z = z[layer];
+        e->animation.offset_y = 20 * e->move.linear[layer];
+        int idx = 0;
+        for (int x = 0; x < e->num_x; x++) {
+            for (int y = 0; y < e->num_y; y++, idx++) {
+                mState.dist_buf[idx] = fl::s16x16(
+                    (f + e->move.directional[layer]) *
+                    fl::sinf(-e->move.radial[5] + e->move.radial[layer] +
+                             (e->distance[x][y] / (s)))).raw();
+            }
+        }
+        render_values_fp(to_render_parameters_fp(e->animation),
+                         mState.polar_theta_raw.data(), mState.dist_buf.data(),
+                         nullptr, n, fade_lut, perm,
+                         mState.show_buf[layer].data());
+    }
 
-            e->animation.dist = (f + e->move.directional[3]) *
-                                 fl::sinf(-e->move.radial[5] + e->move.radial[3] +
-                                      (e->distance[x][y] / (s)));
-            e->animation.angle = 1 * e->polar_theta[x][y];
-            e->animation.z = 2000;
-            e->animation.scale_x = 0.1;
-            e->animation.scale_y = 0.1;
-            e->animation.offset_z = -10;
-            e->animation.offset_y = 20 * e->move.linear[3];
-            e->animation.offset_x = 10;
-            e->animation.low_limit = 0;
-            e->show5 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    int idx = 0;
+    for (int x = 0; x < e->num_x; x++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->show2 = mState.show_buf[0][idx];
+            e->show3 = mState.show_buf[1][idx];
+            e->show4 = mState.show_buf[2][idx];
+            e->show5 = mState.show_buf[3][idx];
 
             e->show6 = e->screen(e->show4, e->show5);
             e->show7 = e->screen(e->show2, e->show3);
@@ -185,6 +166,7 @@ void Parametric_Water_FP::draw(Context &ctx) {
             float radius = 40;
             float radial = (radius - e->distance[x][y]) / radius;
 
+            // red follows the previous pixel's blue, as in the float version.
             e->pixel.red = e->pixel.blue - 40;
             e->pixel.green = 0;
             e->pixel.blue = (0.3 * e->show6 + 0.7 * e->show7) * radial;
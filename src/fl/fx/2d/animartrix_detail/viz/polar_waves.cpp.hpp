@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/polar_waves.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -75,29 +76,33 @@ void Polar_Waves_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
-    for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = (e->distance[x][y]);
-            e->animation.angle =
-                e->polar_theta[x][y] - e->animation.dist * 0.1 + e->move.radial[0];
-            e->animation.z = (e->animation.dist * 1.5) - 10 * e->move.linear[0];
-            e->animation.scale_x = 0.15;
-            e->animation.scale_y = 0.15;
-            e->animation.offset_x = e->move.linear[0];
-
-            float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
-            e->animation.angle =
-                e->polar_theta[x][y] - e->animation.dist * 0.1 + e->move.radial[1];
-            e->animation.z = (e->animation.dist * 1.5) - 10 * e->move.linear[1];
-            e->animation.offset_x = e->move.linear[1];
-
-            float show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
-            e->animation.angle =
-                e->polar_theta[x][y] - e->animation.dist * 0.1 + e->move.radial[2];
-            e->animation.z = (e->animation.dist * 1.5) - 10 * e->move.linear[2];
-            e->animation.offset_x = e->move.linear[2];
+    // angle = theta - dist * 0.1 + radial[k], z = dist * 1.5 - 10 * linear[k]
+    const int n = mState.count;
+    const fl::s16x16 k_angle(0.1f);
+    const fl::s16x16 k_z(1.5f);
+    e->animation.scale_x = 0.15;
+    e->animation.scale_y = 0.15;
+    for (int layer = 0; layer < 3; layer++) {
+        e->animation.offset_x = e->move.linear[layer];
+        const fl::i32 radial_raw = fl::s16x16(e->move.radial[layer]).raw();
+        const fl::i32 lin_raw = fl::s16x16(10 * e->move.linear[layer]).raw();
+        for (int i = 0; i < n; i++) {
+            const fl::s16x16 d = fl::s16x16::from_raw(mState.distance_raw[i]);
+            mState.angle_buf[i] = mState.polar_theta_raw[i] - (d * k_angle).raw() + radial_raw;
+            mState.z_buf[i] = (d * k_z).raw() - lin_raw;
+        }
+        render_values_fp(to_render_parameters_fp(e->animation),
+                         mState.angle_buf.data(), mState.distance_raw.data(),
+                         mState.z_buf.data(), n, fade_lut, perm,
+                         mState.show_buf[layer].data());
+    }
 
-            float show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    int idx = 0;
+    for (int x = 0; x < e->num_x; x++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            float show1 = mState.show_buf[0][idx];
+            float show2 = mState.show_buf[1][idx];
+            float show3 = mState.show_buf[2][idx];
 
             float radius = e->radial_filter_radius;
             float radial = (radius - e->distance[x][y]) / e->distance[x][y];
@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/rgb_blobs.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -81,29 +82,34 @@ void RGB_Blobs_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
-    for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[0] +
-                                 e->move.noise_angle[0] + e->move.noise_angle[3];
-            e->animation.z = (fl::sqrtf(e->animation.dist));
-            e->animation.scale_x = 0.1;
-            e->animation.scale_y = 0.1;
-            e->animation.offset_z = 10;
-            e->animation.offset_x = 10 * e->move.linear[0];
-            float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[1] +
-                                 e->move.noise_angle[1] + e->move.noise_angle[4];
-            e->animation.offset_x = 11 * e->move.linear[1];
-            e->animation.offset_z = 100;
-            float show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    // angle = theta + radial[k] + noise_angle[k] + noise_angle[k + 3],
+    // z = sqrt(dist) (precomputed in the state cache).
+    const int n = mState.count;
+    const float offset_x_mul[3] = {10, 11, 12};
+    const float offset_z[3] = {10, 100, 300};
+    e->animation.scale_x = 0.1;
+    e->animation.scale_y = 0.1;
+    for (int layer = 0; layer < 3; layer++) {
+        e->animation.offset_z = offset_z[layer];
+        e->animation.offset_x = offset_x_mul[layer] * e->move.linear[layer];
+        const fl::i32 angle_add = fl::s16x16(e->move.radial[layer] +
+                                             e->move.noise_angle[layer] +
+                                             e->move.noise_angle[layer + 3]).raw();
+        for (int i = 0; i < n; i++) {
+            mState.angle_buf[i] = mState.polar_theta_raw[i] + angle_add;
+        }
+        render_values_fp(to_render_parameters_fp(e->animation),
+                         mState.angle_buf.data(), mState.distance_raw.data(),
+                         mState.sqrt_distance_raw.data(), n, fade_lut, perm,
+                         mState.show_buf[layer].data());
+    }
 
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[2] +
-                                 e->move.noise_angle[2] + e->move.noise_angle[5];
-            e->animation.offset_x = 12 * e->move.linear[2];
-            e->animation.offset_z = 300;
-            float show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    int idx = 0;
+    for (int x = 0; x < e->num_x; x++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            float show1 = mState.show_buf[0][idx];
+            float show2 = mState.show_buf[1][idx];
+            float show3 = mState.show_buf[2][idx];
 
             float radius = e->radial_filter_radius;
             float radial = (radius - e->distance[x][y]) / e->distance[x][y];
@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/rgb_blobs5.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -70,7 +71,7 @@ void RGB_Blobs5::draw(Context &ctx) {
 void RGB_Blobs5_FP::draw(Context &ctx) {
     auto *e = ctx.mEngine.get();
     e->get_ready();
-    mState.ensureCache(e);
+    mState.ensureCache(e, 3);
     const fl::i32 *fade_lut = fl::assume_aligned<16>(mState.fade_lut);
     const fl::u8 *perm = PERLIN_NOISE;
 
@@ -84,37 +85,52 @@ void RGB_Blobs5_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    // dist = distance + noise_angle[4], z = 3 + sqrt(dist),
+    // angle = theta + radial[k] + noise_angle[k] + noise_angle[k + 3] +
+    // noise_angle[k + 1]
+    const int n = mState.count;
+    const float offset_x_mul[3] = {50, 50, 50};
+    const float offset_z[3] = {10, 100, 300};
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = e->distance[x][y] + e->move.noise_angle[4];
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[0] +
-                                 e->move.noise_angle[0] + e->move.noise_angle[3] +
-                                 e->move.noise_angle[1];
-            e->animation.z = 3 + fl::sqrtf(e->animation.dist);
-            e->animation.scale_x = 0.05;
-            e->animation.scale_y = 0.05;
-            e->animation.offset_z = 10;
-            e->animation.offset_x = 50 * e->move.linear[0];
-            float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[1] +
-                                 e->move.noise_angle[1] + e->move.noise_angle[4] +
-                                 e->move.noise_angle[2];
-            e->animation.offset_x = 50 * e->move.linear[1];
-            e->animation.offset_z = 100;
-            float show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            float dist = e->distance[x][y] + e->move.noise_angle[4];
+            mState.dist_buf[idx] = fl::s16x16(dist).raw();
+            mState.z_buf[idx] = fl::s16x16(3 + fl::sqrtf(dist)).raw();
+        }
+    }
+    e->animation.scale_x = 0.05;
+    e->animation.scale_y = 0.05;
+    for (int layer = 0; layer < 3; layer++) {
+        e->animation.offset_z = offset_z[layer];
+        e->animation.offset_x = offset_x_mul[layer] * e->move.linear[layer];
+        idx = 0;
+        for (int x = 0; x < e->num_x; x++) {
+            for (int y = 0; y < e->num_y; y++, idx++) {
+                mState.angle_buf[idx] = fl::s16x16(
+                    e->polar_theta[x][y] + e->move.radial[layer] +
+                    e->move.noise_angle[layer] + e->move.noise_angle[layer + 3] +
+                    e->move.noise_angle[layer + 1]).raw();
+            }
+        }
+        render_values_fp(to_render_parameters_fp(e->animation),
+                         mState.angle_buf.data(), mState.dist_buf.data(),
+                         mState.z_buf.data(), n, fade_lut, perm,
+                         mState.show_buf[layer].data());
+    }
 
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[2] +
-                                 e->move.noise_angle[2] + e->move.noise_angle[5] +
-                                 e->move.noise_angle[3];
-            e->animation.offset_x = 50 * e->move.linear[2];
-            e->animation.offset_z = 300;
-            float show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    idx = 0;
+    for (int x = 0; x < e->num_x; x++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            float show1 = mState.show_buf[0][idx];
+            float show2 = mState.show_buf[1][idx];
+            float show3 = mState.show_buf[2][idx];
 
             float radius = 23;
             float radial = (radius - e->distance[x][y]) / e->distance[x][y];
 
-            e->pixel.red = radial * (show1 + show3) * 0.5 * e->animation.dist / 5;
+            float dist = e->distance[x][y] + e->move.noise_angle[4];
+            e->pixel.red = radial * (show1 + show3) * 0.5 * dist / 5;
             e->pixel.green = radial * (show2 + show1) * 0.5 * y / 15;
             e->pixel.blue = radial * (show3 + show2) * 0.5 * x / 15;
 
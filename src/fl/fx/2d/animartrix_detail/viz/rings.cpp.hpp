@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/rings.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -77,26 +78,27 @@ void Rings_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
-    for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.angle = 5;
-            e->animation.scale_x = 0.2;
-            e->animation.scale_y = 0.2;
-            e->animation.scale_z = 1;
-            e->animation.dist = e->distance[x][y];
-            e->animation.offset_y = -e->move.linear[0];
-            e->animation.offset_x = 0;
-            float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.angle = 10;
-            e->animation.dist = e->distance[x][y];
-            e->animation.offset_y = -e->move.linear[1];
-            float show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    // Three layers over the flat polar tables; the angle is uniform per layer.
+    const int n = mState.count;
+    const float angles[3] = {5, 10, 12};
+    e->animation.scale_x = 0.2;
+    e->animation.scale_y = 0.2;
+    e->animation.scale_z = 1;
+    e->animation.offset_x = 0;
+    for (int layer = 0; layer < 3; layer++) {
+        e->animation.angle = angles[layer];
+        e->animation.offset_y = -e->move.linear[layer];
+        render_parameters_fp p = to_render_parameters_fp(e->animation);
+        render_values_fp(p, nullptr, mState.distance_raw.data(), nullptr, n,
+                         fade_lut, perm, mState.show_buf[layer].data());
+    }
 
-            e->animation.angle = 12;
-            e->animation.dist = e->distance[x][y];
-            e->animation.offset_y = -e->move.linear[2];
-            float show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    int idx = 0;
+    for (int x = 0; x < e->num_x; x++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            float show1 = mState.show_buf[0][idx];
+            float show2 = mState.show_buf[1][idx];
+            float show3 = mState.show_buf[2][idx];
 
             e->pixel.red = show1;
             e->pixel.green = show2 / 4;
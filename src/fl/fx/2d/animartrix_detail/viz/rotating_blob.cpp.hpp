@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/rotating_blob.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -74,7 +75,7 @@ void Rotating_Blob::draw(Context &ctx) {
 void Rotating_Blob_FP::draw(Context &ctx) {
     auto *e = ctx.mEngine.get();
     e->get_ready();
-    mState.ensureCache(e);
+    mState.ensureCache(e, 4);
     const fl::i32 *fade_lut = fl::assume_aligned<16>(mState.fade_lut);
     const fl::u8 *perm = PERLIN_NOISE;
 
@@ -90,37 +91,53 @@ void Rotating_Blob_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    const int n = mState.count;
+    e->animation.scale_x = 0.05;
+    e->animation.scale_y = 0.05;
+    e->animation.offset_x = 0;
+    e->animation.offset_y = 0;
+    e->animation.offset_z = 100;
+    e->animation.z = e->move.linear[0];
+    e->animation.low_limit = -1;
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.scale_x = 0.05;
-            e->animation.scale_y = 0.05;
-            e->animation.offset_x = 0;
-            e->animation.offset_y = 0;
-            e->animation.offset_z = 100;
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[0];
-            e->animation.dist = e->distance[x][y];
-            e->animation.z = e->move.linear[0];
-            e->animation.low_limit = -1;
-            float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.angle =
-                e->polar_theta[x][y] - e->move.radial[1] + show1 / 512.0;
-            e->animation.dist = e->distance[x][y] * show1 / 255.0;
-            e->animation.low_limit = 0;
-            e->animation.z = e->move.linear[1];
-            float show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.angle =
-                e->polar_theta[x][y] - e->move.radial[2] + show1 / 512.0;
-            e->animation.dist = e->distance[x][y] * show1 / 220.0;
-            e->animation.z = e->move.linear[2];
-            float show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            mState.angle_buf[idx] =
+                fl::s16x16(e->polar_theta[x][y] + e->move.radial[0]).raw();
+        }
+    }
+    render_values_fp(to_render_parameters_fp(e->animation),
+                     mState.angle_buf.data(), mState.distance_raw.data(),
+                     nullptr, n, fade_lut, perm, mState.show_buf[0].data());
+
+    // Layers 2-4 twist and scale the first one:
+    // angle = theta - radial[k] + show1 / 512, dist = distance * show1 / d
+    const double dist_div[3] = {255.0, 220.0, 200.0};
+    e->animation.low_limit = 0;
+    for (int layer = 1; layer < 4; layer++) {
+        e->animation.z = e->move.linear[layer];
+        idx = 0;
+        for (int x = 0; x < e->num_x; x++) {
+            for (int y = 0; y < e->num_y; y++, idx++) {
+                float show1 = mState.show_buf[0][idx];
+                mState.angle_buf[idx] = fl::s16x16(
+                    e->polar_theta[x][y] - e->move.radial[layer] + show1 / 512.0).raw();
+                mState.dist_buf[idx] = fl::s16x16(
+                    e->distance[x][y] * show1 / dist_div[layer - 1]).raw();
+            }
+        }
+        render_values_fp(to_render_parameters_fp(e->animation),
+                         mState.angle_buf.data(), mState.dist_buf.data(),
+                         nullptr, n, fade_lut, perm,
+                         mState.show_buf[layer].data());
+    }
 
-            e->animation.angle =
-                e->polar_theta[x][y] - e->move.radial[3] + show1 / 512.0;
-            e->animation.dist = e->distance[x][y] * show1 / 200.0;
-            e->animation.z = e->move.linear[3];
-            float show4 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    idx = 0;
+    for (int x = 0; x < e->num_x; x++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            float show2 = mState.show_buf[1][idx];
+            float show3 = mState.show_buf[2][idx];
+            float show4 = mState.show_buf[3][idx];
 
             e->pixel.red = (show2 + show4) / 2;
             e->pixel.green = show3 / 6;
@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/scaledemo1.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -69,7 +70,7 @@ void Scaledemo1_FP::draw(Context &ctx) {
 
     auto *e = ctx.mEngine.get();
     e->get_ready();
-    mState.ensureCache(e);
+    mState.ensureCache(e, 2);
     const fl::i32 *fade_lut = fl::assume_aligned<16>(mState.fade_lut);
     const fl::u8 *perm = PERLIN_NOISE;
 
@@ -123,30 +124,34 @@ void Scaledemo1_FP::draw(Context &ctx) {
     p.low_limit_raw = 0;
     p.high_limit_raw = FP_ONE;
 
-    fl::span<CRGB> leds = e->mCtx->leds;
-
     for (int i = 0; i < total_pixels; i++) {
-        const fl::i32 raw_dist = mState.distance_raw[i];
-
-        // Check distance cutoff early
-        if (raw_dist > dist_cutoff_raw) {
-            leds[mState.pixel_idx[i]] = CRGB(0, 0, 0);
-            continue;
-        }
-
         // dist = 0.24 * distance
-        p.dist_raw = static_cast<fl::i32>(
-            (static_cast<fl::i64>(dist_scale_raw) * raw_dist) >> FP::FRAC_BITS);
+        mState.dist_buf[i] = static_cast<fl::i32>(
+            (static_cast<fl::i64>(dist_scale_raw) * mState.distance_raw[i]) >> FP::FRAC_BITS);
 
         // angle = 3 * polar_theta + radial[2]
-        p.angle_raw = static_cast<fl::i32>(
+        mState.angle_buf[i] = static_cast<fl::i32>(
             (static_cast<fl::i64>(three_raw) * mState.polar_theta_raw[i]) >> FP::FRAC_BITS) + radial2_raw;
+    }
+    render_values_fp(p, mState.angle_buf.data(), mState.dist_buf.data(), nullptr,
+                     total_pixels, fade_lut, perm, mState.show_buf[0].data());
 
-        fl::i32 show1 = render_value_fp(p, fade_lut, perm);
+    // Pass 2: same params but angle = 3
+    p.angle_raw = angle2_raw;
+    render_values_fp(p, nullptr, mState.dist_buf.data(), nullptr, total_pixels,
+                     fade_lut, perm, mState.show_buf[1].data());
+
+    fl::span<CRGB> leds = e->mCtx->leds;
+
+    for (int i = 0; i < total_pixels; i++) {
+        // Distance cutoff
+        if (mState.distance_raw[i] > dist_cutoff_raw) {
+            leds[mState.pixel_idx[i]] = CRGB(0, 0, 0);
+            continue;
+        }
 
-        // Pass 2: same params but angle = 3
-        p.angle_raw = angle2_raw;
-        fl::i32 show2 = render_value_fp(p, fade_lut, perm);
+        fl::i32 show1 = mState.show_buf[0][i];
+        fl::i32 show2 = mState.show_buf[1][i];
 
         // dist = 1, so color = show1, (show1-show2)*0.3, (show2-show1)
         fl::i32 r = show1;
@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/slow_fade.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -64,7 +65,7 @@ void Slow_Fade::draw(Context &ctx) {
 void Slow_Fade_FP::draw(Context &ctx) {
     auto *e = ctx.mEngine.get();
     e->get_ready();
-    mState.ensureCache(e);
+    mState.ensureCache(e, 3);
     const fl::i32 *fade_lut = fl::assume_aligned<16>(mState.fade_lut);
     const fl::u8 *perm = PERLIN_NOISE;
 
@@ -72,32 +73,45 @@ void Slow_Fade_FP::draw(Context &ctx) {
     e->timings.master_speed = 0.00005;
     e->calculate_oscillators(e->timings);
 
-    for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist =
-                fl::sqrtf(e->distance[x][y]) * 0.7 * (e->move.directional[0] + 1.5);
-            e->animation.angle =
-                e->polar_theta[x][y] - e->move.radial[0] + e->distance[x][y] / 5;
-
-            e->animation.scale_x = 0.11;
-            e->animation.scale_y = 0.11;
-
-            e->animation.offset_y = -50 * e->move.linear[0];
-            e->animation.offset_x = 0;
-            e->animation.offset_z = 0;
-
-            e->animation.z = e->move.linear[0];
-            e->animation.low_limit = -0.1;
-            e->animation.high_limit = 1;
-            float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.dist = e->animation.dist * 1.1;
-            e->animation.angle += e->move.noise_angle[0] / 10;
-            float show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    // Each layer stretches the previous one's dist by 1.1 and turns its
+    // angle by noise_angle[k] / 10.
+    const int n = mState.count;
+    e->animation.scale_x = 0.11;
+    e->animation.scale_y = 0.11;
+    e->animation.offset_y = -50 * e->move.linear[0];
+    e->animation.offset_x = 0;
+    e->animation.offset_z = 0;
+    e->animation.z = e->move.linear[0];
+    e->animation.low_limit = -0.1;
+    e->animation.high_limit = 1;
+    const render_parameters_fp p = to_render_parameters_fp(e->animation);
+    for (int layer = 0; layer < 3; layer++) {
+        int idx = 0;
+        for (int x = 0; x < e->num_x; x++) {
+            for (int y = 0; y < e->num_y; y++, idx++) {
+                float dist =
+                    fl::sqrtf(e->distance[x][y]) * 0.7 * (e->move.directional[0] + 1.5);
+                float angle =
+                    e->polar_theta[x][y] - e->move.radial[0] + e->distance[x][y] / 5;
+                for (int k = 0; k < layer; k++) {
+                    dist = dist * 1.1;
+                    angle += e->move.noise_angle[k] / 10;
+                }
+                mState.dist_buf[idx] = fl::s16x16(dist).raw();
+                mState.angle_buf[idx] = fl::s16x16(angle).raw();
+            }
+        }
+        render_values_fp(p, mState.angle_buf.data(), mState.dist_buf.data(),
+                         nullptr, n, fade_lut, perm,
+                         mState.show_buf[layer].data());
+    }
 
-            e->animation.dist = e->animation.dist * 1.1;
-            e->animation.angle += e->move.noise_angle[1] / 10;
-            float show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    int idx = 0;
+    for (int x = 0; x < e->num_x; x++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            float show1 = mState.show_buf[0][idx];
+            float show2 = mState.show_buf[1][idx];
+            float show3 = mState.show_buf[2][idx];
 
             float radius = e->radial_filter_radius;
             float radial = (radius - e->distance[x][y]) / e->distance[x][y];
@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/spiral_matrix1.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -97,7 +98,7 @@ void SpiralMatrix1::draw(Context &ctx) {
 void SpiralMatrix1_FP::draw(Context &ctx) {
     auto *e = ctx.mEngine.get();
     e->get_ready();
-    mState.ensureCache(e);
+    mState.ensureCache(e, 5);
     const fl::i32 *fade_lut = fl::assume_aligned<16>(mState.fade_lut);
     const fl::u8 *perm = PERLIN_NOISE;
 
@@ -111,58 +112,49 @@ void SpiralMatrix1_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
-    for (int x = 0; x < e->num_x / 2; x++) {
-        for (int y = 0; y < e->num_y / 2; y++) {
-
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y] + 5 * e->move.noise_angle[0];
-            e->animation.z = 5;
-            e->animation.scale_x = 0.1;
-            e->animation.scale_y = 0.1;
-            e->animation.offset_z = 50 * e->move.linear[0];
-            e->animation.offset_x = 150 * e->move.directional[0];
-            e->animation.offset_y = 150 * e->move.directional[1];
-            float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y] + 4 * e->move.noise_angle[1];
-            e->animation.z = 15;
-            e->animation.scale_x = 0.15;
-            e->animation.scale_y = 0.15;
-            e->animation.offset_z = 50 * e->move.linear[1];
-            e->animation.offset_x = 150 * e->move.directional[1];
-            e->animation.offset_y = 150 * e->move.directional[2];
-            float show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y] + 5 * e->move.noise_angle[2];
-            e->animation.z = 25;
-            e->animation.scale_x = 0.1;
-            e->animation.scale_y = 0.1;
-            e->animation.offset_z = 50 * e->move.linear[2];
-            e->animation.offset_x = 150 * e->move.directional[2];
-            e->animation.offset_y = 150 * e->move.directional[3];
-            float show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y] + 5 * e->move.noise_angle[3];
-            e->animation.z = 35;
-            e->animation.scale_x = 0.15;
-            e->animation.scale_y = 0.15;
-            e->animation.offset_z = 50 * e->move.linear[3];
-            e->animation.offset_x = 150 * e->move.directional[3];
-            e->animation.offset_y = 150 * e->move.directional[4];
-            float show4 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    // Only the top-left quadrant is rendered (and mirrored), so the layer
+    // inputs are packed for that quadrant alone.
+    const int half_x = e->num_x / 2;
+    const int half_y = e->num_y / 2;
+    const int n = half_x * half_y;
+    const float angle_mul[5] = {5, 4, 5, 5, 5};
+    const float z[5] = {5, 15, 25, 35, 45};
+    const float scale[5] = {0.1f, 0.15f, 0.1f, 0.15f, 0.2f};
+    int idx = 0;
+    for (int x = 0; x < half_x; x++) {
+        for (int y = 0; y < half_y; y++, idx++) {
+            mState.dist_buf[idx] = fl::s16x16(e->distance[x][y]).raw();
+        }
+    }
+    for (int layer = 0; layer < 5; layer++) {
+        e->animation.z = z[layer];
+        e->animation.scale_x = scale[layer];
+        e->animation.scale_y = scale[layer];
+        e->animation.offset_z = 50 * e->move.linear[layer];
+        e->animation.offset_x = 150 * e->move.directional[layer];
+        e->animation.offset_y = 150 * e->move.directional[layer + 1];
+        idx = 0;
+        for (int x = 0; x < half_x; x++) {
+            for (int y = 0; y < half_y; y++, idx++) {
+                mState.angle_buf[idx] = fl::s16x16(
+                    e->polar_theta[x][y] +
+                    angle_mul[layer] * e->move.noise_angle[layer]).raw();
+            }
+        }
+        render_values_fp(to_render_parameters_fp(e->animation),
+                         mState.angle_buf.data(), mState.dist_buf.data(),
+                         nullptr, n, fade_lut, perm,
+                         mState.show_buf[layer].data());
+    }
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y] + 5 * e->move.noise_angle[4];
-            e->animation.z = 45;
-            e->animation.scale_x = 0.2;
-            e->animation.scale_y = 0.2;
-            e->animation.offset_z = 50 * e->move.linear[4];
-            e->animation.offset_x = 150 * e->move.directional[4];
-            e->animation.offset_y = 150 * e->move.directional[5];
-            float show5 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    idx = 0;
+    for (int x = 0; x < half_x; x++) {
+        for (int y = 0; y < half_y; y++, idx++) {
+            float show1 = mState.show_buf[0][idx];
+            float show2 = mState.show_buf[1][idx];
+            float show3 = mState.show_buf[2][idx];
+            float show4 = mState.show_buf[3][idx];
+            float show5 = mState.show_buf[4][idx];
 
             e->pixel.red = show1 + show2;
             e->pixel.green = show3 + show4;
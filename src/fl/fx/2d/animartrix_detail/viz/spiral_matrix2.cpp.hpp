@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/spiral_matrix2.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -74,7 +75,7 @@ void SpiralMatrix2::draw(Context &ctx) {
 void SpiralMatrix2_FP::draw(Context &ctx) {
     auto *e = ctx.mEngine.get();
     e->get_ready();
-    mState.ensureCache(e);
+    mState.ensureCache(e, 3);
     const fl::i32 *fade_lut = fl::assume_aligned<16>(mState.fade_lut);
     const fl::u8 *perm = PERLIN_NOISE;
 
@@ -88,42 +89,38 @@ void SpiralMatrix2_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
-    for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-
-            e->animation.dist = e->distance[x][y] * (e->move.directional[0]);
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[0];
-            e->animation.z = 5;
-            e->animation.scale_x = 0.09;
-            e->animation.scale_y = 0.09;
-            e->animation.offset_z = 5 * e->move.linear[0];
-            e->animation.offset_x = 0;
-            e->animation.offset_y = 0;
-            float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.dist = e->distance[x][y] * e->move.directional[1];
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[1];
-            e->animation.z = 50;
-            e->animation.scale_x = 0.07;
-            e->animation.scale_y = 0.07;
-            e->animation.offset_z = 5 * e->move.linear[1];
-            e->animation.offset_x = 0;
-            e->animation.offset_y = 0;
-            float show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.dist = e->distance[x][y] * e->move.directional[2];
-            e->animation.angle = e->polar_theta[x][y] + e->move.radial[2];
-            e->animation.z = 500;
-            e->animation.scale_x = 0.05;
-            e->animation.scale_y = 0.05;
-            e->animation.offset_z = 5 * e->move.linear[2];
-            e->animation.offset_x = 0;
-            e->animation.offset_y = 0;
-            float show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    // dist = distance * directional[k], angle = theta + radial[k]
+    const int n = mState.count;
+    const float z[3] = {5, 50, 500};
+    const float scale[3] = {0.09f, 0.07f, 0.05f};
+    e->animation.offset_x = 0;
+    e->animation.offset_y = 0;
+    for (int layer = 0; layer < 3; layer++) {
+        e->animation.z = z[layer];
+        e->animation.scale_x = scale[layer];
+        e->animation.scale_y = scale[layer];
+        e->animation.offset_z = 5 * e->move.linear[layer];
+        int idx = 0;
+        for (int x = 0; x < e->num_x; x++) {
+            for (int y = 0; y < e->num_y; y++, idx++) {
+                mState.dist_buf[idx] = fl::s16x16(
+                    e->distance[x][y] * e->move.directional[layer]).raw();
+                mState.angle_buf[idx] = fl::s16x16(
+                    e->polar_theta[x][y] + e->move.radial[layer]).raw();
+            }
+        }
+        render_values_fp(to_render_parameters_fp(e->animation),
+                         mState.angle_buf.data(), mState.dist_buf.data(),
+                         nullptr, n, fade_lut, perm,
+                         mState.show_buf[layer].data());
+    }
 
-            e->pixel.red = show1;
-            e->pixel.green = show2;
-            e->pixel.blue = show3;
+    int idx = 0;
+    for (int x = 0; x < e->num_x; x++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->pixel.red = mState.show_buf[0][idx];
+            e->pixel.green = mState.show_buf[1][idx];
+            e->pixel.blue = mState.show_buf[2][idx];
 
             e->pixel = e->rgb_sanity_check(e->pixel);
 
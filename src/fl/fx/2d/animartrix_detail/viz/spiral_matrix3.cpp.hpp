@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/spiral_matrix3.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -106,7 +107,7 @@ void SpiralMatrix3::draw(Context &ctx) {
 void SpiralMatrix3_FP::draw(Context &ctx) {
     auto *e = ctx.mEngine.get();
     e->get_ready();
-    mState.ensureCache(e);
+    mState.ensureCache(e, 5);
     const fl::i32 *fade_lut = fl::assume_aligned<16>(mState.fade_lut);
     const fl::u8 *perm = PERLIN_NOISE;
 
@@ -120,74 +121,53 @@ void SpiralMatrix3_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
-    for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y];
-            e->animation.z = 5;
-            e->animation.scale_x = 0.09;
-            e->animation.scale_y = 0.09;
-            e->animation.offset_z = 0;
-            e->animation.offset_x = 0;
-            e->animation.offset_y = -20 * e->move.linear[0];
-            ;
-            e->animation.low_limit = -1;
-            e->animation.high_limit = 1;
-            e->show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y];
-            e->animation.z = 500;
-            e->animation.scale_x = 0.09;
-            e->animation.scale_y = 0.09;
-            e->animation.offset_z = 0;
-            e->animation.offset_x = 0;
-            e->animation.offset_y = -20 * e->move.linear[0];
-            ;
-            e->animation.low_limit = -1;
-            e->animation.high_limit = 1;
-            e->show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y];
-            e->animation.z = 50;
-            e->animation.scale_x = 0.09;
-            e->animation.scale_y = 0.09;
-            e->animation.offset_z = 0;
-            e->animation.offset_x = 500 + e->show1 / 20;
-            e->animation.offset_y = -4 * e->move.linear[0] + e->show2 / 20;
-            e->animation.low_limit = 0;
-            e->animation.high_limit = 1;
-            e->show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y];
-            e->animation.z = 50;
-            e->animation.scale_x = 0.09;
-            e->animation.scale_y = 0.09;
-            e->animation.offset_z = 0;
-            e->animation.offset_x = 500 + e->show1 / 18;
-            e->animation.offset_y = -4 * e->move.linear[0] + e->show2 / 18;
-            e->animation.low_limit = 0;
-            e->animation.high_limit = 1;
-            e->show4 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y];
-            e->animation.z = 50;
-            e->animation.scale_x = 0.09;
-            e->animation.scale_y = 0.09;
-            e->animation.offset_z = 0;
-            e->animation.offset_x = 500 + e->show1 / 19;
-            e->animation.offset_y = -4 * e->move.linear[0] + e->show2 / 19;
-            e->animation.low_limit = 0.3;
-            e->animation.high_limit = 1;
-            e->show5 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    const int n = mState.count;
+    const fl::i32 *theta = mState.polar_theta_raw.data();
+    const fl::i32 *dist = mState.distance_raw.data();
+    e->animation.scale_x = 0.09;
+    e->animation.scale_y = 0.09;
+    e->animation.offset_z = 0;
+    e->animation.high_limit = 1;
+
+    // Layers 1-2 (z = 5, 500) only displace the other three.
+    e->animation.offset_x = 0;
+    e->animation.offset_y = -20 * e->move.linear[0];
+    e->animation.low_limit = -1;
+    e->animation.z = 5;
+    render_values_fp(to_render_parameters_fp(e->animation), theta, dist,
+                     nullptr, n, fade_lut, perm, mState.show_buf[0].data());
+    e->animation.z = 500;
+    render_values_fp(to_render_parameters_fp(e->animation), theta, dist,
+                     nullptr, n, fade_lut, perm, mState.show_buf[1].data());
+
+    // Layers 3-5: offset = (500, -4 * linear[0]) + (show1, show2) / d
+    const int div[3] = {20, 18, 19};
+    const float low_limit[3] = {0, 0, 0.3f};
+    render_inputs_fp in;
+    in.angle = theta;
+    in.dist = dist;
+    in.offset_x = mState.offset_x_buf.data();
+    in.offset_y = mState.offset_y_buf.data();
+    e->animation.z = 50;
+    for (int layer = 2; layer < 5; layer++) {
+        for (int i = 0; i < n; i++) {
+            float show1 = mState.show_buf[0][i];
+            float show2 = mState.show_buf[1][i];
+            mState.offset_x_buf[i] = fl::s16x16(500 + show1 / div[layer - 2]).raw();
+            mState.offset_y_buf[i] = fl::s16x16(
+                -4 * e->move.linear[0] + show2 / div[layer - 2]).raw();
+        }
+        e->animation.low_limit = low_limit[layer - 2];
+        render_values_fp(to_render_parameters_fp(e->animation), in, n,
+                         fade_lut, perm, mState.show_buf[layer].data());
+    }
 
-            e->pixel.red = e->show4;
-            e->pixel.green = e->show3;
-            e->pixel.blue = e->show5;
+    int idx = 0;
+    for (int x = 0; x < e->num_x; x++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->pixel.red = mState.show_buf[3][idx];
+            e->pixel.green = mState.show_buf[2][idx];
+            e->pixel.blue = mState.show_buf[4][idx];
 
             e->pixel = e->rgb_sanity_check(e->pixel);
 
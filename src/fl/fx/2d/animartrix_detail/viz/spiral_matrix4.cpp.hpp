@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/spiral_matrix4.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -72,7 +73,7 @@ void SpiralMatrix4_FP::draw(Context &ctx) {
 
     auto *e = ctx.mEngine.get();
     e->get_ready();
-    mState.ensureCache(e);
+    mState.ensureCache(e, 2);
     const fl::i32 *fade_lut = fl::assume_aligned<16>(mState.fade_lut);
     const fl::u8 *perm = PERLIN_NOISE;
 
@@ -113,23 +114,23 @@ void SpiralMatrix4_FP::draw(Context &ctx) {
     const fl::i32 oy1_raw = FP(-20.0f * e->move.linear[0]).raw();
     const fl::i32 oy2_raw = FP(-40.0f * e->move.linear[0]).raw();
 
+    // Pass 1: z=5, offset_y=-20*linear[0]
+    p.z_raw = z1_raw;
+    p.offset_y_raw = oy1_raw;
+    render_values_fp(p, mState.polar_theta_raw.data(), mState.distance_raw.data(),
+                     nullptr, total_pixels, fade_lut, perm, mState.show_buf[0].data());
+
+    // Pass 2: z=500, offset_y=-40*linear[0]
+    p.z_raw = z2_raw;
+    p.offset_y_raw = oy2_raw;
+    render_values_fp(p, mState.polar_theta_raw.data(), mState.distance_raw.data(),
+                     nullptr, total_pixels, fade_lut, perm, mState.show_buf[1].data());
+
     fl::span<CRGB> leds = e->mCtx->leds;
 
     for (int i = 0; i < total_pixels; i++) {
-        const fl::i32 theta_raw = mState.polar_theta_raw[i];
-        const fl::i32 dist_raw = mState.distance_raw[i];
-
-        // Pass 1: z=5, offset_y=-20*linear[0]
-        p.angle_raw = theta_raw;
-        p.dist_raw = dist_raw;
-        p.z_raw = z1_raw;
-        p.offset_y_raw = oy1_raw;
-        fl::i32 show1 = render_value_fp(p, fade_lut, perm);
-
-        // Pass 2: z=500, offset_y=-40*linear[0]
-        p.z_raw = z2_raw;
-        p.offset_y_raw = oy2_raw;
-        fl::i32 show2 = render_value_fp(p, fade_lut, perm);
+        fl::i32 show1 = mState.show_buf[0][i];
+        fl::i32 show2 = mState.show_buf[1][i];
 
         fl::i32 r = add_fp(show2, show1);
         fl::i32 g = 0;
@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/spiral_matrix8.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -82,7 +83,7 @@ void SpiralMatrix8::draw(Context &ctx) {
 void SpiralMatrix8_FP::draw(Context &ctx) {
     auto *e = ctx.mEngine.get();
     e->get_ready();
-    mState.ensureCache(e);
+    mState.ensureCache(e, 4);
     const fl::i32 *fade_lut = fl::assume_aligned<16>(mState.fade_lut);
     const fl::u8 *perm = PERLIN_NOISE;
 
@@ -96,43 +97,45 @@ void SpiralMatrix8_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
+    // Fixed angles: every layer only varies with the distance.
+    const int n = mState.count;
+    const fl::i32 *dist = mState.distance_raw.data();
+    e->animation.scale_x = 0.15;
+    e->animation.scale_y = 0.15;
+    e->animation.offset_z = 0;
+    e->animation.low_limit = 0;
+
+    e->animation.angle = 2;
+    e->animation.z = 5;
+    e->animation.offset_y = 50 * e->move.linear[0];
+    e->animation.offset_x = 0;
+    render_values_fp(to_render_parameters_fp(e->animation), nullptr, dist,
+                     nullptr, n, fade_lut, perm, mState.show_buf[0].data());
+
+    e->animation.z = 150;
+    e->animation.offset_x = -50 * e->move.linear[0];
+    render_values_fp(to_render_parameters_fp(e->animation), nullptr, dist,
+                     nullptr, n, fade_lut, perm, mState.show_buf[1].data());
+
+    e->animation.angle = 1;
+    e->animation.z = 550;
+    e->animation.offset_x = 0;
+    e->animation.offset_y = -50 * e->move.linear[1];
+    render_values_fp(to_render_parameters_fp(e->animation), nullptr, dist,
+                     nullptr, n, fade_lut, perm, mState.show_buf[2].data());
+
+    e->animation.z = 1250;
+    e->animation.offset_y = 50 * e->move.linear[1];
+    render_values_fp(to_render_parameters_fp(e->animation), nullptr, dist,
+                     nullptr, n, fade_lut, perm, mState.show_buf[3].data());
+
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = 2;
-            e->animation.z = 5;
-            e->animation.scale_x = 0.15;
-            e->animation.scale_y = 0.15;
-            e->animation.offset_z = 0;
-            e->animation.offset_y = 50 * e->move.linear[0];
-            e->animation.offset_x = 0;
-            e->animation.low_limit = 0;
-            float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = 2;
-            e->animation.z = 150;
-            e->animation.offset_x = -50 * e->move.linear[0];
-            float show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = 1;
-            e->animation.z = 550;
-            e->animation.scale_x = 0.15;
-            e->animation.scale_y = 0.15;
-            e->animation.offset_x = 0;
-            e->animation.offset_y = -50 * e->move.linear[1];
-            float show4 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = 1;
-            e->animation.z = 1250;
-            e->animation.scale_x = 0.15;
-            e->animation.scale_y = 0.15;
-            e->animation.offset_x = 0;
-            e->animation.offset_y = 50 * e->move.linear[1];
-            float show5 = render_value_fp_from_float(e->animation, fade_lut, perm);
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            float show1 = mState.show_buf[0][idx];
+            float show2 = mState.show_buf[1][idx];
+            float show4 = mState.show_buf[2][idx];
+            float show5 = mState.show_buf[3][idx];
 
             e->show3 = e->add(show1, show2);
             e->show6 = e->screen(show4, show5);
@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/spiral_matrix9.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -95,7 +96,7 @@ void SpiralMatrix9::draw(Context &ctx) {
 void SpiralMatrix9_FP::draw(Context &ctx) {
     auto *e = ctx.mEngine.get();
     e->get_ready();
-    mState.ensureCache(e);
+    mState.ensureCache(e, 4);
     const fl::i32 *fade_lut = fl::assume_aligned<16>(mState.fade_lut);
     const fl::u8 *perm = PERLIN_NOISE;
 
@@ -109,53 +110,46 @@ void SpiralMatrix9_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
-    for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y];
-            e->animation.z = 5;
-            e->animation.scale_x = 0.09;
-            e->animation.scale_y = 0.09;
-            e->animation.offset_y = -30 * e->move.linear[0];
-            e->animation.offset_z = 0;
-            e->animation.offset_x = 0;
-            e->animation.low_limit = -1;
-            e->show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y];
-            e->animation.z = 50;
-            e->animation.scale_x = 0.09;
-            e->animation.scale_y = 0.09;
-            e->animation.offset_y = -30 * e->move.linear[1];
-            e->animation.offset_z = 0;
-            e->animation.offset_x = 0;
-            e->animation.low_limit = -1;
-            e->show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    const int n = mState.count;
+    const fl::i32 *dist = mState.distance_raw.data();
+    e->animation.scale_x = 0.09;
+    e->animation.scale_y = 0.09;
+    e->animation.offset_z = 0;
+    e->animation.offset_x = 0;
+
+    // Layers 1-2: plain polar noise at z = 5 and 50.
+    e->animation.low_limit = -1;
+    for (int layer = 0; layer < 2; layer++) {
+        e->animation.z = layer == 0 ? 5 : 50;
+        e->animation.offset_y = -30 * e->move.linear[layer];
+        render_values_fp(to_render_parameters_fp(e->animation),
+                         mState.polar_theta_raw.data(), dist, nullptr, n,
+                         fade_lut, perm, mState.show_buf[layer].data());
+    }
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y] + 2 + (e->show1 / 255) * PI;
-            e->animation.z = 5;
-            e->animation.scale_x = 0.09;
-            e->animation.scale_y = 0.09;
-            e->animation.offset_y = -10 * e->move.linear[0];
-            e->animation.offset_z = 0;
-            e->animation.offset_x = 0;
-            e->animation.low_limit = 0;
-            e->show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    // Layers 3-4: angle = theta + 2 + (show / 255) * PI of layer 1 / 2.
+    e->animation.z = 5;
+    e->animation.low_limit = 0;
+    for (int layer = 2; layer < 4; layer++) {
+        e->animation.offset_y = (layer == 2 ? -10 : -20) * e->move.linear[0];
+        int idx = 0;
+        for (int x = 0; x < e->num_x; x++) {
+            for (int y = 0; y < e->num_y; y++, idx++) {
+                float show = mState.show_buf[layer - 2][idx];
+                mState.angle_buf[idx] = fl::s16x16(
+                    e->polar_theta[x][y] + 2 + (show / 255) * PI).raw();
+            }
+        }
+        render_values_fp(to_render_parameters_fp(e->animation),
+                         mState.angle_buf.data(), dist, nullptr, n, fade_lut,
+                         perm, mState.show_buf[layer].data());
+    }
 
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = e->polar_theta[x][y] + 2 + (e->show2 / 255) * PI;
-            ;
-            e->animation.z = 5;
-            e->animation.scale_x = 0.09;
-            e->animation.scale_y = 0.09;
-            e->animation.offset_y = -20 * e->move.linear[0];
-            e->animation.offset_z = 0;
-            e->animation.offset_x = 0;
-            e->animation.low_limit = 0;
-            e->show4 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    int idx = 0;
+    for (int x = 0; x < e->num_x; x++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->show3 = mState.show_buf[2][idx];
+            e->show4 = mState.show_buf[3][idx];
 
             e->show5 = e->screen(e->show4, e->show3);
             e->show6 = e->colordodge(e->show5, e->show3);
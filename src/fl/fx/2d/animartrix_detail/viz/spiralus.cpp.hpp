@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/spiralus.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -105,34 +106,48 @@ void Spiralus_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
-    for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle = 2 * e->polar_theta[x][y] + e->move.noise_angle[5] +
-                                 e->move.directional[3] * e->move.noise_angle[6] *
-                                     e->animation.dist / 10;
-            e->animation.scale_x = 0.08;
-            e->animation.scale_y = 0.08;
-            e->animation.scale_z = 0.02;
-            e->animation.offset_y = -e->move.linear[0];
-            e->animation.offset_x = 0;
-            e->animation.offset_z = 0;
-            e->animation.z = e->move.linear[1];
-            float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.angle = 2 * e->polar_theta[x][y] + e->move.noise_angle[7] +
-                                 e->move.directional[5] * e->move.noise_angle[8] *
-                                     e->animation.dist / 10;
-            e->animation.offset_y = -e->move.linear[1];
-            e->animation.z = e->move.linear[2];
-            float show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    const int n = mState.count;
+    const fl::i32 *dist = mState.distance_raw.data();
+    e->animation.scale_x = 0.08;
+    e->animation.scale_y = 0.08;
+    e->animation.scale_z = 0.02;
+    e->animation.offset_x = 0;
+    e->animation.offset_z = 0;
+
+    // angle = k * theta + na[a] + dir[d] * na[b] * dist / 10 per layer.
+    const int angle_mul[] = {2, 2, 2};
+    const int noise_a[] = {5, 7, 6};
+    const int noise_b[] = {6, 8, 7};
+    const int dir[] = {3, 5, 6};
+    const float offset_y[] = {-e->move.linear[0], -e->move.linear[1],
+                              e->move.linear[2]};
+    const float z[] = {e->move.linear[1], e->move.linear[2],
+                       e->move.linear[0]};
+    for (int layer = 0; layer < 3; layer++) {
+        int idx = 0;
+        for (int x = 0; x < e->num_x; x++) {
+            for (int y = 0; y < e->num_y; y++, idx++) {
+                float d = e->distance[x][y];
+                mState.angle_buf[idx] = fl::s16x16(
+                    angle_mul[layer] * e->polar_theta[x][y] +
+                    e->move.noise_angle[noise_a[layer]] +
+                    e->move.directional[dir[layer]] *
+                        e->move.noise_angle[noise_b[layer]] * d / 10).raw();
+            }
+        }
+        e->animation.offset_y = offset_y[layer];
+        e->animation.z = z[layer];
+        render_values_fp(to_render_parameters_fp(e->animation),
+                         mState.angle_buf.data(), dist, nullptr, n, fade_lut,
+                         perm, mState.show_buf[layer].data());
+    }
 
-            e->animation.angle = 2 * e->polar_theta[x][y] + e->move.noise_angle[6] +
-                                 e->move.directional[6] * e->move.noise_angle[7] *
-                                     e->animation.dist / 10;
-            e->animation.offset_y = e->move.linear[2];
-            e->animation.z = e->move.linear[0];
-            float show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    int idx = 0;
+    for (int x = 0; x < e->num_x; x++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            float show1 = mState.show_buf[0][idx];
+            float show2 = mState.show_buf[1][idx];
+            float show3 = mState.show_buf[2][idx];
 
             float f = 1;
 
@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/water.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -113,61 +114,42 @@ void Water_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
-    for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-
-            e->animation.dist =
-                e->distance[x][y] +
-                4 * fl::sinf(e->move.directional[5] * PI + (float)x / 2) +
-                4 * fl::cosf(e->move.directional[6] * PI + float(y) / 2);
-            e->animation.angle = 1 * e->polar_theta[x][y];
-            e->animation.z = 5;
-            e->animation.scale_x = 0.06;
-            e->animation.scale_y = 0.06;
-            e->animation.offset_z = -10 * e->move.linear[0];
-            e->animation.offset_y = 10;
-            e->animation.offset_x = 10;
-            e->animation.low_limit = 0;
-            e->show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.dist = (10 + e->move.directional[0]) *
-                                 fl::sinf(-e->move.radial[5] + e->move.radial[0] +
-                                      (e->distance[x][y] / (3)));
-            e->animation.angle = 1 * e->polar_theta[x][y];
-            e->animation.z = 5;
-            e->animation.scale_x = 0.1;
-            e->animation.scale_y = 0.1;
-            e->animation.offset_z = -10;
-            e->animation.offset_y = 20 * e->move.linear[0];
-            e->animation.offset_x = 10;
-            e->animation.low_limit = 0;
-            e->show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.dist = (10 + e->move.directional[1]) *
-                                 fl::sinf(-e->move.radial[5] + e->move.radial[1] +
-                                      (e->distance[x][y] / (3)));
-            e->animation.angle = 1 * e->polar_theta[x][y];
+    const int n = mState.count;
+
+    // The first layer (show1) never reaches the pixel, so it is not rendered.
+    // Layers 2-4 ripple the distance by a radial sine per layer.
+    e->animation.z = 5;
+    e->animation.scale_x = 0.1;
+    e->animation.scale_y = 0.1;
+    e->animation.offset_z = -10;
+    e->animation.offset_x = 10;
+    e->animation.low_limit = 0;
+    for (int layer = 0; layer < 3; layer++) {
+        int idx = 0;
+        for (int x = 0; x < e->num_x; x++) {
+            for (int y = 0; y < e->num_y; y++, idx++) {
+                float d = (10 + e->move.directional[layer]) *
+                          fl::sinf(-e->move.radial[5] + e->move.radial[layer] +
+                                   (e->distance[x][y] / (3)));
+                mState.dist_buf[idx] = fl::s16x16(d).raw();
+            }
+        }
+        if (layer > 0) {
             e->animation.z = 500;
-            e->animation.scale_x = 0.1;
-            e->animation.scale_y = 0.1;
-            e->animation.offset_z = -10;
-            e->animation.offset_y = 20 * e->move.linear[1];
-            e->animation.offset_x = 10;
-            e->animation.low_limit = 0;
-            e->show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
+        }
+        e->animation.offset_y = 20 * e->move.linear[layer];
+        render_values_fp(to_render_parameters_fp(e->animation),
+                         mState.polar_theta_raw.data(), mState.dist_buf.data(),
+                         nullptr, n, fade_lut, perm,
+                         mState.show_buf[layer].data());
+    }
 
-            e->animation.dist = (10 + e->move.directional[2]) *
-                                 fl::sinf(-e->move.radial[5] + e->move.radial[2] +
-                                      (e->distance[x][y] / (3)));
-            e->animation.angle = 1 * e->polar_theta[x][y];
-            e->animation.z = 500;
-            e->animation.scale_x = 0.1;
-            e->animation.scale_y = 0.1;
-            e->animation.offset_z = -10;
-            e->animation.offset_y = 20 * e->move.linear[2];
-            e->animation.offset_x = 10;
-            e->animation.low_limit = 0;
-            e->show4 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    int idx = 0;
+    for (int x = 0; x < e->num_x; x++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            e->show2 = mState.show_buf[0][idx];
+            e->show3 = mState.show_buf[1][idx];
+            e->show4 = mState.show_buf[2][idx];
 
             e->pixel.blue = (0.7 * e->show2 + 0.6 * e->show3 + 0.5 * e->show4);
             e->pixel.red = e->pixel.blue - 40;
@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/waves.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -73,22 +74,29 @@ void Waves_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
-    for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.angle = e->polar_theta[x][y];
-            e->animation.scale_x = 0.1;
-            e->animation.scale_y = 0.1;
-            e->animation.scale_z = 0.1;
-            e->animation.dist = e->distance[x][y];
-            e->animation.offset_y = 0;
-            e->animation.offset_x = 0;
-            e->animation.z = 2 * e->distance[x][y] - e->move.linear[0];
-            float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    const int n = mState.count;
+    e->animation.scale_x = 0.1;
+    e->animation.scale_y = 0.1;
+    e->animation.scale_z = 0.1;
+    e->animation.offset_y = 0;
+    e->animation.offset_x = 0;
+    const render_parameters_fp p = to_render_parameters_fp(e->animation);
+    for (int layer = 0; layer < 2; layer++) {
+        // z = 2 * dist - linear
+        const fl::i32 lin_raw = fl::s16x16(e->move.linear[layer]).raw();
+        for (int i = 0; i < n; i++) {
+            mState.z_buf[i] = 2 * mState.distance_raw[i] - lin_raw;
+        }
+        render_values_fp(p, mState.polar_theta_raw.data(), mState.distance_raw.data(),
+                         mState.z_buf.data(), n, fade_lut, perm,
+                         mState.show_buf[layer].data());
+    }
 
-            e->animation.angle = e->polar_theta[x][y];
-            e->animation.dist = e->distance[x][y];
-            e->animation.z = 2 * e->distance[x][y] - e->move.linear[1];
-            float show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    int idx = 0;
+    for (int x = 0; x < e->num_x; x++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            float show1 = mState.show_buf[0][idx];
+            float show2 = mState.show_buf[1][idx];
 
             e->pixel.red = show1;
             e->pixel.green = 0;
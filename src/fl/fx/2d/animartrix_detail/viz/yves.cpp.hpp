@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/yves.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -92,7 +93,7 @@ void Yves::draw(Context &ctx) {
 void Yves_FP::draw(Context &ctx) {
     auto *e = ctx.mEngine.get();
     e->get_ready();
-    mState.ensureCache(e);
+    mState.ensureCache(e, 4);
     const fl::i32 *fade_lut = fl::assume_aligned<16>(mState.fade_lut);
     const fl::u8 *perm = PERLIN_NOISE;
 
@@ -116,47 +117,70 @@ void Yves_FP::draw(Context &ctx) {
 
     e->calculate_oscillators(e->timings);
 
-    for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle =
-                e->polar_theta[x][y] + 2 * PI + e->move.noise_angle[5];
-            e->animation.scale_x = 0.08;
-            e->animation.scale_y = 0.08;
-            e->animation.scale_z = 0.08;
-            e->animation.offset_y = -e->move.linear[0];
-            e->animation.offset_x = 0;
-            e->animation.offset_z = 0;
-            e->animation.z = 0;
-            float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.dist = e->distance[x][y];
-            e->animation.angle =
-                e->polar_theta[x][y] + 2 * PI + e->move.noise_angle[6];
-            ;
-            e->animation.scale_x = 0.08;
-            e->animation.scale_y = 0.08;
-            e->animation.scale_z = 0.08;
-            e->animation.offset_y = -e->move.linear[1];
-            e->animation.offset_x = 0;
-            e->animation.offset_z = 0;
-            e->animation.z = 0;
-            float show2 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.angle = e->polar_theta[x][y] + show1 / 100 +
-                                 e->move.noise_angle[3] + e->move.noise_angle[4];
-            e->animation.dist = e->distance[x][y] + show2 / 50;
-            e->animation.offset_y = -e->move.linear[2];
-
-            e->animation.offset_y += show1 / 100;
-            e->animation.offset_x += show2 / 100;
-
-            float show3 = render_value_fp_from_float(e->animation, fade_lut, perm);
-
-            e->animation.offset_y = 0;
-            e->animation.offset_x = 0;
+    const int n = mState.count;
+    const fl::i32 *dist = mState.distance_raw.data();
+    e->animation.scale_x = 0.08;
+    e->animation.scale_y = 0.08;
+    e->animation.scale_z = 0.08;
+    e->animation.offset_x = 0;
+    e->animation.offset_z = 0;
+    e->animation.z = 0;
+
+    // Layers 1-2: theta + 2 * PI + noise_angle[5 + layer].
+    for (int layer = 0; layer < 2; layer++) {
+        int idx = 0;
+        for (int x = 0; x < e->num_x; x++) {
+            for (int y = 0; y < e->num_y; y++, idx++) {
+                mState.angle_buf[idx] = fl::s16x16(
+                    e->polar_theta[x][y] + 2 * PI +
+                    e->move.noise_angle[5 + layer]).raw();
+            }
+        }
+        e->animation.offset_y = -e->move.linear[layer];
+        render_values_fp(to_render_parameters_fp(e->animation),
+                         mState.angle_buf.data(), dist, nullptr, n, fade_lut,
+                         perm, mState.show_buf[layer].data());
+    }
 
-            float show4 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    // Layers 3-4 share an angle and distance warped by layers 1-2; layer 3
+    // also shifts its offsets by them.
+    int idx = 0;
+    for (int x = 0; x < e->num_x; x++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            float show1 = mState.show_buf[0][idx];
+            float show2 = mState.show_buf[1][idx];
+            mState.angle_buf[idx] = fl::s16x16(
+                e->polar_theta[x][y] + show1 / 100 + e->move.noise_angle[3] +
+                e->move.noise_angle[4]).raw();
+            float d = e->distance[x][y] + show2 / 50;
+            mState.dist_buf[idx] = fl::s16x16(d).raw();
+            float offset_y = -e->move.linear[2];
+            offset_y += show1 / 100;
+            float offset_x = 0;
+            offset_x += show2 / 100;
+            mState.offset_x_buf[idx] = fl::s16x16(offset_x).raw();
+            mState.offset_y_buf[idx] = fl::s16x16(offset_y).raw();
+        }
+    }
+    render_inputs_fp in;
+    in.angle = mState.angle_buf.data();
+    in.dist = mState.dist_buf.data();
+    in.offset_x = mState.offset_x_buf.data();
+    in.offset_y = mState.offset_y_buf.data();
+    render_values_fp(to_render_parameters_fp(e->animation), in, n, fade_lut,
+                     perm, mState.show_buf[2].data());
+
+    e->animation.offset_y = 0;
+    e->animation.offset_x = 0;
+    render_values_fp(to_render_parameters_fp(e->animation),
+                     mState.angle_buf.data(), mState.dist_buf.data(), nullptr,
+                     n, fade_lut, perm, mState.show_buf[3].data());
+
+    idx = 0;
+    for (int x = 0; x < e->num_x; x++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            float show3 = mState.show_buf[2][idx];
+            float show4 = mState.show_buf[3][idx];
 
             e->pixel.red = show3;
             e->pixel.green = show3 * show4 / 255;
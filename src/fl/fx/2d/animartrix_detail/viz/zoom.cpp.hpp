@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/zoom.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -60,21 +61,29 @@ void Zoom_FP::draw(Context &ctx) {
     e->timings.master_speed = 0.003;
     e->calculate_oscillators(e->timings);
 
-    for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = (e->distance[x][y] * e->distance[x][y]) / 2;
-            e->animation.angle = e->polar_theta[x][y];
-
-            e->animation.scale_x = 0.005;
-            e->animation.scale_y = 0.005;
-
-            e->animation.offset_y = -10 * e->move.linear[0];
-            e->animation.offset_x = 0;
-            e->animation.offset_z = 0;
+    // dist = distance^2 / 2, taken from the flat float table.
+    const int n = mState.count;
+    const float *distance = e->distance.data();
+    for (int i = 0; i < n; i++) {
+        mState.dist_buf[i] = fl::s16x16((distance[i] * distance[i]) / 2).raw();
+    }
 
-            e->animation.z = 0;
-            e->animation.low_limit = 0;
-            float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    e->animation.scale_x = 0.005;
+    e->animation.scale_y = 0.005;
+    e->animation.offset_y = -10 * e->move.linear[0];
+    e->animation.offset_x = 0;
+    e->animation.offset_z = 0;
+    e->animation.z = 0;
+    e->animation.low_limit = 0;
+    // z == 0: every iteration stays on the 4-wide 2D Perlin path.
+    render_values_fp(to_render_parameters_fp(e->animation),
+                     mState.polar_theta_raw.data(), mState.dist_buf.data(),
+                     nullptr, n, fade_lut, perm, mState.show_buf[0].data());
+
+    int idx = 0;
+    for (int x = 0; x < e->num_x; x++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            float show1 = mState.show_buf[0][idx];
 
             float linear = 1;
 
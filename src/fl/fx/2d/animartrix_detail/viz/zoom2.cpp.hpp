@@ -1,6 +1,7 @@
 #include "fl/stl/compiler_control.h"
 #include "fl/fx/2d/animartrix_detail/viz/zoom2.h"
 #include "fl/fx/2d/animartrix_detail/render_value_fp.h"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
 #include "fl/fx/2d/animartrix_detail/perlin_float.h"
 
 FL_FAST_MATH_BEGIN
@@ -50,7 +51,7 @@ void Zoom2::draw(Context &ctx) {
 void Zoom2_FP::draw(Context &ctx) {
     auto *e = ctx.mEngine.get();
     e->get_ready();
-    mState.ensureCache(e);
+    mState.ensureCache(e, 1);
     const fl::i32 *fade_lut = fl::assume_aligned<16>(mState.fade_lut);
     const fl::u8 *perm = PERLIN_NOISE;
 
@@ -58,21 +59,30 @@ void Zoom2_FP::draw(Context &ctx) {
     e->timings.master_speed = 0.003;
     e->calculate_oscillators(e->timings);
 
+    const int n = mState.count;
+    int idx = 0;
     for (int x = 0; x < e->num_x; x++) {
-        for (int y = 0; y < e->num_y; y++) {
-            e->animation.dist = (e->distance[x][y] * e->distance[x][y]) / 2;
-            e->animation.angle = e->polar_theta[x][y];
-
-            e->animation.scale_x = 0.005;
-            e->animation.scale_y = 0.005;
-
-            e->animation.offset_y = -10 * e->move.linear[0];
-            e->animation.offset_x = 0;
-            e->animation.offset_z = 0.1 * e->move.linear[0];
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            float d = (e->distance[x][y] * e->distance[x][y]) / 2;
+            mState.dist_buf[idx] = fl::s16x16(d).raw();
+        }
+    }
 
-            e->animation.z = 0;
-            e->animation.low_limit = 0;
-            float show1 = render_value_fp_from_float(e->animation, fade_lut, perm);
+    e->animation.scale_x = 0.005;
+    e->animation.scale_y = 0.005;
+    e->animation.offset_y = -10 * e->move.linear[0];
+    e->animation.offset_x = 0;
+    e->animation.offset_z = 0.1 * e->move.linear[0];
+    e->animation.z = 0;
+    e->animation.low_limit = 0;
+    render_values_fp(to_render_parameters_fp(e->animation),
+                     mState.polar_theta_raw.data(), mState.dist_buf.data(),
+                     nullptr, n, fade_lut, perm, mState.show_buf[0].data());
+
+    idx = 0;
+    for (int x = 0; x < e->num_x; x++) {
+        for (int y = 0; y < e->num_y; y++, idx++) {
+            float show1 = mState.show_buf[0][idx];
 
             e->pixel.red = show1;
             e->pixel.green = 0;
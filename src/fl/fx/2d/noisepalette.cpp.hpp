@@ -106,11 +106,29 @@ void NoisePalette::setPalettePreset(int paletteIndex) {
     }
 }
 
-void NoisePalette::mapNoiseToLEDsUsingPalette(fl::span<CRGB> leds) {
+u8 &NoisePalette::paletteHue() {
     static u8 ihue = 0; // okay static in header
+    return ihue;
+}
+
+void NoisePalette::refreshPaletteLut() {
+    // currentPalette is assigned from many places; recompile on any change.
+    if (!mLutValid || mLutPalette != currentPalette) {
+        mPaletteLut.compile(currentPalette);
+        mLutPalette = currentPalette;
+        mLutValid = true;
+    }
+}
+
+void NoisePalette::mapNoiseToLEDsUsingPalette(fl::span<CRGB> leds) {
+    refreshPaletteLut();
+    mapNoiseRows(leds, 0, height, paletteHue());
+    paletteHue() += 1;
+}
 
+void NoisePalette::mapNoiseRows(fl::span<CRGB> leds, u16 y0, u16 y1, u8 ihue) {
     for (u16 i = 0; i < width; i++) {
-        for (u16 j = 0; j < height; j++) {
+        for (u16 j = y0; j < y1; j++) {
             // We use the value at the (i,j) coordinate in the noise
             // array for our brightness, and the flipped value from (j,i)
             // for our pixel's index into the color palette.
@@ -131,15 +149,18 @@ void NoisePalette::mapNoiseToLEDsUsingPalette(fl::span<CRGB> leds) {
                 bri = dim8_raw(bri * 2);
             }
 
-            CRGB color = ColorFromPalette(currentPalette, index, bri);
-            leds[XY(i, j)] = color;
+            // Same as ColorFromPalette(currentPalette, index, bri).
+            leds[XY(i, j)] = mPaletteLut.lookup(index, bri);
         }
     }
-
-    ihue += 1;
 }
 
 void NoisePalette::fillnoise8() {
+    fillNoiseRows(0, height);
+    advanceNoise();
+}
+
+void NoisePalette::fillNoiseRows(u16 y0, u16 y1) {
     // If we're running at a low "speed", some 8-bit artifacts become
     // visible from frame-to-frame.  In order to reduce this, we can do some
     // fast data-smoothing. The amount of data smoothing we're doing depends
@@ -149,31 +170,40 @@ void NoisePalette::fillnoise8() {
         dataSmoothing = 200 - (speed * 4);
     }
 
-    for (u16 i = 0; i < width; i++) {
-        int ioffset = scale * i;
-        for (u16 j = 0; j < height; j++) {
-            int joffset = scale * j;
-
-            u8 data = inoise8(mX + ioffset, mY + joffset, mZ);
-
-            // The range of the inoise8 function is roughly 16-238.
-            // These two operations expand those values out to roughly
-            // 0..255 You can comment them out if you want the raw noise
-            // data.
-            data = qsub8(data, 16);
-            data = qadd8(data, scale8(data, 39));
-
-            if (dataSmoothing) {
-                u8 olddata = noise[i * height + j];
-                u8 newdata = scale8(olddata, dataSmoothing) +
-                                  scale8(data, 256 - dataSmoothing);
-                data = newdata;
+    // Noise is evaluated a row (fixed y) at a time through inoise8_row(),
+    // which shares the y/z work and lattice hashes across the row.
+    constexpr u16 kChunk = 32;
+    u8 row[kChunk];
+    for (u16 j = y0; j < y1; j++) {
+        const u16 y = mY + scale * j;
+        for (u16 i0 = 0; i0 < width; i0 += kChunk) {
+            const u16 n = (width - i0) < kChunk ? (width - i0) : kChunk;
+            inoise8_row(row, n, mX + scale * i0, static_cast<i16>(scale), y, mZ);
+            for (u16 c = 0; c < n; c++) {
+                const u16 i = i0 + c;
+                u8 data = row[c];
+
+                // The range of the inoise8 function is roughly 16-238.
+                // These two operations expand those values out to roughly
+                // 0..255 You can comment them out if you want the raw noise
+                // data.
+                data = qsub8(data, 16);
+                data = qadd8(data, scale8(data, 39));
+
+                if (dataSmoothing) {
+                    u8 olddata = noise[i * height + j];
+                    u8 newdata = scale8(olddata, dataSmoothing) +
+                                      scale8(data, 256 - dataSmoothing);
+                    data = newdata;
+                }
+
+                noise[i * height + j] = data;
             }
-
-            noise[i * height + j] = data;
         }
     }
+}
 
+void NoisePalette::advanceNoise() {
     mZ += speed;
 
     // apply slow drift to X and Y, just for visual variation.
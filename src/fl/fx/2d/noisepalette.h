@@ -10,6 +10,7 @@
 #include "fl/stl/shared_ptr.h"  // For shared_ptr
 #include "fl/math/xymap.h"
 #include "fl/fx/fx2d.h"
+#include "fl/gfx/palette_lut.h"
 #include "fl/math/random8.h"
 
 namespace fl {
@@ -29,10 +30,10 @@ class NoisePalette : public Fx2d {
 
     // No need for a destructor, scoped_ptr will handle memory deallocation
 
-    void draw(DrawContext context) override {
-        fillnoise8();
-        mapNoiseToLEDsUsingPalette(context.leds);
-    }
+    void draw(DrawContext context) override { drawTiled(context); }
+
+    // Each band fills its own noise rows, then (second pass) maps them.
+    bool isPixelIndependent() const override { return true; }
 
     string fxName() const override { return "NoisePalette"; }
     void mapNoiseToLEDsUsingPalette(fl::span<CRGB> leds);
@@ -61,11 +62,40 @@ class NoisePalette : public Fx2d {
     u16 scale = 0;
     fl::vector_psram<u8> noise;
     CRGBPalette16 currentPalette;
+    PaletteLUT mPaletteLut;        // currentPalette at full brightness
+    CRGBPalette16 mLutPalette;     // palette mPaletteLut was compiled from
+    bool mLutValid = false;
     bool colorLoop = 0;
     int currentPaletteIndex = 0;
     float mFps = 60.f;
 
     void fillnoise8();
+    void fillNoiseRows(u16 y0, u16 y1);
+    void advanceNoise();
+    void mapNoiseRows(fl::span<CRGB> leds, u16 y0, u16 y1, u8 hue);
+    void refreshPaletteLut();
+    static u8 &paletteHue();
+
+    // Pass 0 fills noise, pass 1 maps it: the map reads the transposed
+    // cell noise[j * width + i], which another band may own.
+    u8 tilePasses() const override { return 2; }
+    void beginTiles(DrawContext &context) override {
+        FASTLED_UNUSED(context);
+        refreshPaletteLut();
+    }
+    void drawTile(const DrawContext &context, u8 pass, u16 y0,
+                  u16 y1) override {
+        if (pass == 0) {
+            fillNoiseRows(y0, y1);
+        } else {
+            mapNoiseRows(context.leds, y0, y1, paletteHue());
+        }
+    }
+    void endTiles(DrawContext &context) override {
+        FASTLED_UNUSED(context);
+        advanceNoise();
+        paletteHue() += 1;
+    }
 
     u16 XY(u8 x, u8 y) const { return mXyMap.mapToIndex(x, y); }
 
@@ -3,3 +3,4 @@
 /// Includes all implementation files in alphabetical order
 
 #include "fl/fx/detail/fx_layer.cpp.hpp"
+#include "fl/fx/detail/tile_render.cpp.hpp"
@@ -6,6 +6,7 @@
 namespace fl {
 
 class AudioBatch; // forward declaration — pointer only, no include needed
+class TileRenderer;
 
 struct DrawContext {
     fl::u32 now;
@@ -13,6 +14,9 @@ struct DrawContext {
     u16 frame_time = 0;
     float speed = 1.0f;
     const AudioBatch *audio = nullptr; ///< Non-owning. Null when no audio.
+    /// Non-owning. Set by FxEngine::setTileWorkers(); null renders
+    /// Fx2d::drawTiled() bands on the calling thread.
+    TileRenderer *tiles = nullptr;
     DrawContext(fl::u32 now, fl::span<CRGB> leds, u16 frame_time = 0,
                 float speed = 1.0f, const AudioBatch *audio = nullptr)
         : now(now), leds(leds), frame_time(frame_time), speed(speed),
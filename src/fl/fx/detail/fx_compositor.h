@@ -8,6 +8,7 @@
 #include "fl/stl/shared_ptr.h"  // For shared_ptr
 #include "fl/stl/vector.h"  // IWYU pragma: keep
 #include "fl/fx/detail/fx_layer.h"
+#include "fl/fx/detail/tile_render.h"
 #include "fl/fx/fx.h"  // IWYU pragma: keep
 
 #ifndef FASTLED_FX_ENGINE_MAX_FX
@@ -42,8 +43,11 @@ class FxCompositor {
         mTransition.end();
     }
 
+    // `tiles` is empty (no tiling) or holds one renderer per layer, so a
+    // transition's two effects keep separate band stats.
     void draw(fl::u32 now, fl::u32 warpedTime, fl::span<CRGB> finalBuffer,
-              float speed = 1.0f, const AudioBatch *audio = nullptr);
+              float speed = 1.0f, const AudioBatch *audio = nullptr,
+              fl::span<TileRenderer> tiles = fl::span<TileRenderer>());
 
   private:
     void swapLayers() {
@@ -59,18 +63,20 @@ class FxCompositor {
 
 inline void FxCompositor::draw(fl::u32 now, fl::u32 warpedTime,
                                fl::span<CRGB> finalBuffer,
-                               float speed, const AudioBatch *audio) {
+                               float speed, const AudioBatch *audio,
+                               fl::span<TileRenderer> tiles) {
     if (!mLayers[0]->getFx()) {
         return;
     }
-    mLayers[0]->draw(warpedTime, speed, audio);
+    const bool tiled = tiles.size() >= 2;
+    mLayers[0]->draw(warpedTime, speed, audio, tiled ? &tiles[0] : nullptr);
     u8 progress = mTransition.getProgress(now);
     if (!progress) {
         fl::span<CRGB> surface0 = mLayers[0]->getSurface();
         fl::memcpy(finalBuffer.data(), surface0.data(), sizeof(CRGB) * mNumLeds);
         return;
     }
-    mLayers[1]->draw(warpedTime, speed, audio);
+    mLayers[1]->draw(warpedTime, speed, audio, tiled ? &tiles[1] : nullptr);
     fl::span<CRGB> surface0 = mLayers[0]->getSurface();
     fl::span<CRGB> surface1 = mLayers[1]->getSurface();
 
@@ -16,7 +16,8 @@ void FxLayer::setFx(fl::shared_ptr<Fx> newFx) {
     }
 }
 
-void FxLayer::draw(fl::u32 now, float speed, const AudioBatch *audio) {
+void FxLayer::draw(fl::u32 now, float speed, const AudioBatch *audio,
+                   TileRenderer *tiles) {
     // assert(fx);
     if (!frame) {
         frame = fl::make_shared<Frame>(fx->getNumLeds());
@@ -32,6 +33,7 @@ void FxLayer::draw(fl::u32 now, float speed, const AudioBatch *audio) {
     u16 frame_time = static_cast<u16>(now - mLastNow);
     mLastNow = now;
     Fx::DrawContext context(now, frame->rgb(), frame_time, speed, audio);
+    context.tiles = tiles;
     fx->draw(context);
 }
 
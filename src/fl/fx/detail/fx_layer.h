@@ -9,13 +9,15 @@ namespace fl {
 class Frame;
 class Fx;
 class AudioBatch;
+class TileRenderer;
 
 FASTLED_SHARED_PTR(FxLayer);
 class FxLayer {
   public:
     void setFx(fl::shared_ptr<Fx> newFx);
 
-    void draw(fl::u32 now, float speed = 1.0f, const AudioBatch *audio = nullptr);
+    void draw(fl::u32 now, float speed = 1.0f, const AudioBatch *audio = nullptr,
+              TileRenderer *tiles = nullptr);
 
     void pause(fl::u32 now);
 
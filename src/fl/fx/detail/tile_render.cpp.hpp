@@ -0,0 +1,68 @@
+#include "fl/fx/detail/tile_render.h"
+
+#include "fl/stl/chrono.h"
+#include "fl/task/parallel_for.h"
+
+namespace fl {
+
+float TileStats::imbalance() const FL_NO_EXCEPT {
+    if (tiles.empty()) {
+        return 0.0f;
+    }
+    fl::u32 slowest = 0;
+    fl::u64 sum = 0;
+    for (const TileTiming &t : tiles) {
+        sum += t.micros;
+        if (t.micros > slowest) {
+            slowest = t.micros;
+        }
+    }
+    if (sum == 0) {
+        return 1.0f;
+    }
+    const float mean = static_cast<float>(sum) / static_cast<float>(tiles.size());
+    return static_cast<float>(slowest) / mean;
+}
+
+void TileRenderer::beginFrame() FL_NO_EXCEPT {
+    mFrameStart = fl::micros();
+    mStats.tiles.clear();
+    mStats.totalMicros = 0;
+    mStats.workers = mWorkers ? mWorkers : 1;
+}
+
+void TileRenderer::endFrame() FL_NO_EXCEPT {
+    mStats.totalMicros = fl::micros() - mFrameStart;
+}
+
+void TileRenderer::run(u16 height, u8 passes,
+                       const fl::function<void(u8, u16, u16)> &band) FL_NO_EXCEPT {
+    if (height == 0 || passes == 0) {
+        return;
+    }
+    const u8 workers = mWorkers ? mWorkers : 1;
+    fl::size bands = static_cast<fl::size>(workers) * mBandsPerWorker;
+    if (bands > height) {
+        bands = height;
+    }
+    const fl::size first = mStats.tiles.size();
+    mStats.tiles.resize(first + bands * passes);
+
+    for (u8 pass = 0; pass < passes; ++pass) {
+        TileTiming *slots = mStats.tiles.data() + first + pass * bands;
+        // Each job owns its slot, so workers never share a write.
+        fl::task::parallelFor(bands, workers, [&](fl::size b) {
+            const u16 y0 = static_cast<u16>(b * height / bands);
+            const u16 y1 = static_cast<u16>((b + 1) * height / bands);
+            const fl::u32 t0 = fl::micros();
+            band(pass, y0, y1);
+            TileTiming &slot = slots[b];
+            slot.y0 = y0;
+            slot.y1 = y1;
+            slot.pass = pass;
+            slot.micros = fl::micros() - t0;
+        });
+    }
+}
+
+} // namespace fl
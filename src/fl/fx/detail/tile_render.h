@@ -0,0 +1,71 @@
+#pragma once
+
+/// @file fl/fx/detail/tile_render.h
+/// @brief Row-band (tile) parallel rendering for pixel-independent Fx2d effects.
+///
+/// `FxEngine::setTileWorkers(N)` hands a TileRenderer to every DrawContext.
+/// Effects that declare `Fx2d::isPixelIndependent()` split their frame into
+/// row bands through `Fx2d::drawTiled()`, and the bands are claimed by up to N
+/// workers via `fl::task::parallelFor()`. Where `fl::thread` is a
+/// synchronous fake (MCUs) the bands simply run in order on the caller, so
+/// the output is identical either way.
+
+#include "fl/stl/function.h"
+#include "fl/stl/noexcept.h"
+#include "fl/stl/stdint.h"
+#include "fl/stl/vector.h"
+
+namespace fl {
+
+/// @brief Wall time of one band of one pass.
+struct TileTiming {
+    u16 y0 = 0;        ///< First row (inclusive)
+    u16 y1 = 0;        ///< Last row (exclusive)
+    u8 pass = 0;
+    fl::u32 micros = 0;
+};
+
+/// @brief Timings from the most recent tiled frame.
+struct TileStats {
+    fl::vector<TileTiming> tiles;  ///< Pass-major, band order within a pass
+    fl::u32 totalMicros = 0;       ///< Whole frame, including serial work
+    u8 workers = 0;
+
+    /// @brief Slowest band over the mean band time (1.0 = perfectly even).
+    /// Returns 0 when no tiles were recorded.
+    float imbalance() const FL_NO_EXCEPT;
+};
+
+class TileRenderer {
+  public:
+    /// @param workers Threads to use, including the caller. 0 and 1 both
+    ///        render bands serially (still split and timed).
+    void setWorkers(u8 workers) FL_NO_EXCEPT { mWorkers = workers; }
+    u8 workers() const FL_NO_EXCEPT { return mWorkers; }
+
+    /// @brief Bands per worker. More than one lets fast workers pick up the
+    ///        slack when some rows are costlier than others. Default 2.
+    void setBandsPerWorker(u8 bands) FL_NO_EXCEPT {
+        mBandsPerWorker = bands ? bands : 1;
+    }
+
+    /// @brief Runs `band(pass, y0, y1)` over [0, height) for each pass, with
+    ///        a join between passes, and records per-band timings.
+    void run(u16 height, u8 passes,
+             const fl::function<void(u8, u16, u16)> &band) FL_NO_EXCEPT;
+
+    /// @brief Marks the start/end of a frame so totalMicros covers the
+    ///        effect's serial setup as well as the bands.
+    void beginFrame() FL_NO_EXCEPT;
+    void endFrame() FL_NO_EXCEPT;
+
+    const TileStats &stats() const FL_NO_EXCEPT { return mStats; }
+
+  private:
+    u8 mWorkers = 1;
+    u8 mBandsPerWorker = 2;
+    fl::u32 mFrameStart = 0;
+    TileStats mStats;
+};
+
+} // namespace fl
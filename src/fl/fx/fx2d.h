@@ -5,6 +5,7 @@
 #include "fl/stl/shared_ptr.h"         // For FASTLED_SHARED_PTR macros
 #include "fl/math/xymap.h"
 #include "fl/fx/fx.h"
+#include "fl/fx/detail/tile_render.h"
 
 namespace fl {
 
@@ -26,7 +27,54 @@ class Fx2d : public Fx {
     XYMap &getXYMap() { return mXyMap; }
     const XYMap &getXYMap() const { return mXyMap; }
 
+    // True when every output pixel depends only on its own (x, y) and on
+    // state set up once per frame, so row bands can render concurrently.
+    // Such effects implement drawTile() and call drawTiled() from draw().
+    virtual bool isPixelIndependent() const { return false; }
+
   protected:
+    // Number of band passes per frame. Bands of one pass all finish before
+    // the next pass starts, for effects whose second stage reads rows the
+    // first stage wrote elsewhere.
+    virtual u8 tilePasses() const { return 1; }
+    // Serial per-frame work before/after the bands (time, shared state).
+    virtual void beginTiles(DrawContext &context) { FASTLED_UNUSED(context); }
+    virtual void endTiles(DrawContext &context) { FASTLED_UNUSED(context); }
+    // Renders rows [y0, y1) of `pass`. Called concurrently for disjoint
+    // bands when context.tiles has workers; must not touch other rows' output.
+    virtual void drawTile(const DrawContext &context, u8 pass, u16 y0, u16 y1) {
+        FASTLED_UNUSED(context);
+        FASTLED_UNUSED(pass);
+        FASTLED_UNUSED(y0);
+        FASTLED_UNUSED(y1);
+    }
+
+    // Runs beginTiles(), every pass of drawTile() over the full height, then
+    // endTiles(). Bands go to context.tiles when set, else run in order.
+    void drawTiled(DrawContext &context) {
+        TileRenderer *tiles = context.tiles;
+        if (tiles) {
+            tiles->beginFrame();
+        }
+        beginTiles(context);
+        const u16 height = getHeight();
+        const u8 passes = tilePasses();
+        if (tiles) {
+            const DrawContext &ctx = context;
+            tiles->run(height, passes, [this, &ctx](u8 pass, u16 y0, u16 y1) {
+                drawTile(ctx, pass, y0, y1);
+            });
+        } else {
+            for (u8 pass = 0; pass < passes; ++pass) {
+                drawTile(context, pass, 0, height);
+            }
+        }
+        endTiles(context);
+        if (tiles) {
+            tiles->endFrame();
+        }
+    }
+
     XYMap mXyMap;
 };
 
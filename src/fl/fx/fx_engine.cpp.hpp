@@ -23,6 +23,14 @@ void FxEngine::setAudio(fl::shared_ptr<fl::audio::Processor> proc) {
     mAudioProcessor = fl::move(proc);
 }
 
+void FxEngine::setTileWorkers(u8 workers, u8 bandsPerWorker) {
+    mTileWorkers = workers;
+    for (TileRenderer &tiles : mTiles) {
+        tiles.setWorkers(workers);
+        tiles.setBandsPerWorker(bandsPerWorker);
+    }
+}
+
 int FxEngine::addFx(FxPtr effect) {
     float fps = 0;
     if (mInterpolate && effect->hasFixedFrameRate(&fps)) {
@@ -142,7 +150,11 @@ bool FxEngine::draw(fl::u32 now, fl::span<CRGB> finalBuffer) {
     }
     if (!mEffects.empty()) {
         float speed = mTimeFunction.scale();
-        mCompositor.draw(now, warpedTime, finalBuffer, speed, audioPtr);
+        fl::span<TileRenderer> tiles;
+        if (mTileWorkers) {
+            tiles = fl::span<TileRenderer>(mTiles, 2);
+        }
+        mCompositor.draw(now, warpedTime, finalBuffer, speed, audioPtr, tiles);
     }
     return true;
 }
@@ -5,6 +5,7 @@
 #include "fl/stl/vector.h"
 #include "fl/audio/audio_frame.h"  // AudioFrame (stored in vectors)
 #include "fl/fx/detail/fx_compositor.h"
+#include "fl/fx/detail/tile_render.h"
 #include "fl/fx/fx.h"
 #include "fl/fx/time.h"
 #include "fl/fx/video.h"
@@ -129,6 +130,29 @@ class FxEngine {
     void setSpeed(float scale) { mTimeFunction.setSpeed(scale); }
     float getSpeed() const { return mTimeFunction.scale(); }
 
+    /**
+     * @brief Enables tile-parallel rendering for pixel-independent Fx2d
+     * effects (Fx2d::isPixelIndependent()).
+     *
+     * Such effects split each frame into row bands that up to `workers`
+     * threads render concurrently (the calling thread included). Pass 0 to
+     * turn tiling off. On targets without real threads the bands run in
+     * order on the caller, with the same output.
+     */
+    void setTileWorkers(u8 workers, u8 bandsPerWorker = 2);
+    u8 getTileWorkers() const { return mTileWorkers; }
+
+    /**
+     * @brief Per-band timings from the last frame an effect rendered through
+     * Fx2d::drawTiled(), to spot imbalance between bands. Empty until a
+     * tiled frame has been drawn; not updated while tiling is off.
+     * @param layer 0 for the current effect, 1 for the incoming effect while
+     *        a transition runs.
+     */
+    const TileStats &getTileStats(u8 layer = 0) const {
+        return mTiles[layer ? 1 : 0].stats();
+    }
+
   private:
     int mCounter = 0;
     TimeWarp mTimeFunction;   // FxEngine controls the clock, to allow
@@ -149,6 +173,11 @@ class FxEngine {
 
     // Optional auto-polled audio source (set via setAudio()).
     fl::shared_ptr<fl::audio::Processor> mAudioProcessor;
+
+    // Row-band renderers, one per compositor layer, handed to effects when
+    // setTileWorkers() > 0.
+    TileRenderer mTiles[2];
+    u8 mTileWorkers = 0;
 };
 
 } // namespace fl
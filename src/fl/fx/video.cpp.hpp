@@ -105,6 +105,13 @@ void Video::setTimeScale(float timeScale) {
     mImpl->setTimeScale(timeScale);
 }
 
+void Video::setReadAhead(fl::u32 frames) {
+    if (!mImpl) {
+        return;
+    }
+    mImpl->setReadAhead(frames);
+}
+
 float Video::timeScale() const {
     if (!mImpl) {
         return 1.0f;
@@ -81,6 +81,10 @@ class Video : public Fx1d { // Fx1d because video can be irregular.
     void resume(fl::u32 now) override;
     void setFade(fl::u32 fadeInTime, fl::u32 fadeOutTime);
     i32 durationMicros() const; // -1 if this is a stream.
+    // Decode up to `frames` frames ahead of the playhead, one per draw, so
+    // SD/stream reads don't stall the draw that crosses a frame boundary.
+    // Needs frameHistoryCount > 2 to have room. 0 (default) = off.
+    void setReadAhead(fl::u32 frames);
 
     // make compatible with if statements
     operator bool() const { return mImpl.get(); }
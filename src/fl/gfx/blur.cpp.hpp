@@ -14,6 +14,7 @@
 #include "fl/math/scale8.h"
 #include "fl/stl/int.h"
 #include "fl/stl/span.h"
+#include "fl/stl/cstring.h"
 #include "fl/gfx/crgb.h"
 #include "fl/gfx/crgb16.h"
 #include "fl/stl/singleton.h"
@@ -24,6 +25,18 @@
 #include "fl/math/simd.h"
 #endif
 
+/// 1 when the fl::simd backend lowers the blurRows/blurColumns u16x8
+/// stencil to real vector instructions (SSE2 and up). Elsewhere the u16x8
+/// multiplies are scalar emulation and the line-buffer copies cost more
+/// than they save, so the in-place carryover loop is used instead.
+#ifndef FL_BLUR_STENCIL_SIMD
+#if defined(FASTLED_X86_HAS_SSE2) && FASTLED_X86_HAS_SSE2
+#define FL_BLUR_STENCIL_SIMD 1
+#else
+#define FL_BLUR_STENCIL_SIMD 0
+#endif
+#endif
+
 // Force O3 even in debug builds so blur benchmarks don't hit watchdog timeouts.
 FL_OPTIMIZATION_LEVEL_O3_BEGIN
 
@@ -53,6 +66,184 @@ fl::u16 xy_legacy_wrapper(fl::u16 x, fl::u16 y, fl::u16 width,
 
 namespace gfx {
 
+// ── blurRows / blurColumns kernels ──────────────────────────────────────
+//
+// The carryover loop in blur1d() only ever reads pixels it has not written
+// yet, and saturating adds of non-negative terms commute, so every output
+// is a plain 3-tap stencil of the original line:
+//
+//   out[i] = min(255, nscale8(p[i], keep) + nscale8(p[i-1], seep)
+//                                         + nscale8(p[i+1], seep))
+//
+// with zeros past either end. That lets both passes run on whole rows of
+// bytes (R, G and B are independent) with SIMD, bit-exact with the loop,
+// where FL_BLUR_STENCIL_SIMD is set.
+// Columns are walked row-major with a rolling window of line buffers
+// instead of striding down each column.
+namespace blur_detail {
+
+// Multiplier matching nscale8(): (v * mul) >> 8.
+FL_ALWAYS_INLINE u16 nscale8_mul(u8 scale) {
+#if (FASTLED_SCALE8_FIXED == 1)
+    return static_cast<u16>(scale) + 1;
+#else
+    return scale;
+#endif
+}
+
+// In-place carryover blur of `count` pixels spaced `stride` apart.
+static void blur_line_carry(CRGB *p, int count, int stride, u8 keep, u8 seep) {
+    CRGB carryover = CRGB::Black;
+    for (int i = 0; i < count; ++i) {
+        CRGB cur = p[i * stride];
+        CRGB part = cur;
+        part.nscale8(seep);
+        cur.nscale8(keep);
+        cur += carryover;
+        if (i)
+            p[(i - 1) * stride] += part;
+        p[i * stride] = cur;
+        carryover = part;
+    }
+}
+
+#if FL_BLUR_STENCIL_SIMD
+// out = sat(cur * keep + prev * seep + next * seep), per byte.
+static void blur3_bytes(const u8 * FL_RESTRICT_PARAM prev,
+                        const u8 * FL_RESTRICT_PARAM cur,
+                        const u8 * FL_RESTRICT_PARAM next,
+                        u8 * FL_RESTRICT_PARAM out, int nbytes,
+                        u16 keepMul, u16 seepMul) {
+    int i = 0;
+    namespace fsimd = fl::simd; // ok bare using
+    const auto vk = fsimd::set1_u16_8(keepMul);
+    const auto vs = fsimd::set1_u16_8(seepMul);
+    for (; i + 15 < nbytes; i += 16) {
+        auto vp = fsimd::load_u8_16(prev + i);
+        auto vc = fsimd::load_u8_16(cur + i);
+        auto vn = fsimd::load_u8_16(next + i);
+        auto lo = fsimd::add_u16_8(
+            fsimd::srli_u16_8(fsimd::mullo_u16_8(fsimd::widen_lo_u8_to_u16(vc), vk), 8),
+            fsimd::add_u16_8(
+                fsimd::srli_u16_8(fsimd::mullo_u16_8(fsimd::widen_lo_u8_to_u16(vp), vs), 8),
+                fsimd::srli_u16_8(fsimd::mullo_u16_8(fsimd::widen_lo_u8_to_u16(vn), vs), 8)));
+        auto hi = fsimd::add_u16_8(
+            fsimd::srli_u16_8(fsimd::mullo_u16_8(fsimd::widen_hi_u8_to_u16(vc), vk), 8),
+            fsimd::add_u16_8(
+                fsimd::srli_u16_8(fsimd::mullo_u16_8(fsimd::widen_hi_u8_to_u16(vp), vs), 8),
+                fsimd::srli_u16_8(fsimd::mullo_u16_8(fsimd::widen_hi_u8_to_u16(vn), vs), 8)));
+        // Saturating pack is the final qadd8 clamp.
+        fsimd::store_u8_16(out + i, fsimd::narrow_u16_to_u8(lo, hi));
+    }
+    for (; i < nbytes; ++i) {
+        u16 v = static_cast<u16>((cur[i] * keepMul) >> 8) +
+                static_cast<u16>((prev[i] * seepMul) >> 8) +
+                static_cast<u16>((next[i] * seepMul) >> 8);
+        out[i] = v > 255 ? 255 : static_cast<u8>(v);
+    }
+}
+
+struct BlurLineBuffer {
+    fl::vector<u8> bytes;
+};
+
+// Thread-local scratch for the row/column line buffers.
+static u8 *get_linebuf(int minSize) {
+    fl::vector<u8> &buf = SingletonThreadLocal<BlurLineBuffer>::instance().bytes;
+    if (static_cast<int>(buf.size()) < minSize) {
+        buf.resize(minSize);
+    }
+    return buf.data();
+}
+
+// Copy pixels in reverse order (serpentine odd rows).
+static void copy_reversed(const CRGB *src, CRGB *dst, int w) {
+    for (int x = 0; x < w; ++x) {
+        dst[x] = src[w - 1 - x];
+    }
+}
+#endif
+
+// Horizontal pass over `h` contiguous rows of `w` pixels.
+static void blur_rows_contiguous(CRGB *pixels, int w, int h, u8 keep, u8 seep) {
+    if (w <= 0 || h <= 0) {
+        return;
+    }
+#if FL_BLUR_STENCIL_SIMD
+    // One row copy padded with a zero pixel on each side, so the stencil
+    // needs no edge cases.
+    const int n = w * 3;
+    u8 *line = get_linebuf(n + 6);
+    fl::memset(line, 0, 3);
+    fl::memset(line + 3 + n, 0, 3);
+    const u16 keepMul = nscale8_mul(keep);
+    const u16 seepMul = nscale8_mul(seep);
+    for (int row = 0; row < h; ++row) {
+        u8 *rowBytes = reinterpret_cast<u8 *>(pixels + row * w);
+        fl::memcpy(line + 3, rowBytes, n);
+        blur3_bytes(line, line + 3, line + 6, rowBytes, n, keepMul, seepMul);
+    }
+#else
+    for (int row = 0; row < h; ++row) {
+        blur_line_carry(pixels + row * w, w, 1, keep, seep);
+    }
+#endif
+}
+
+#if FL_BLUR_STENCIL_SIMD
+// Vertical pass, row-major: a rolling window of prev/cur/next copies of
+// the original rows feeds blur3_bytes(), so each output row is written
+// once and the image is read sequentially. Serpentine odd rows are
+// un-reversed on load and re-reversed on store.
+static void blur_columns_linebuf(CRGB *pixels, int w, int h, bool serpentine,
+                                 u8 keep, u8 seep) {
+    if (w <= 0 || h <= 0) {
+        return;
+    }
+    const int n = w * 3;
+    u8 *buf = get_linebuf(n * 4);
+    u8 *prev = buf;
+    u8 *cur = buf + n;
+    u8 *next = buf + n * 2;
+    u8 *out = buf + n * 3;
+    const u16 keepMul = nscale8_mul(keep);
+    const u16 seepMul = nscale8_mul(seep);
+
+    auto loadRow = [&](int row, u8 *dst) {
+        CRGB *src = pixels + row * w;
+        if (serpentine && (row & 1)) {
+            copy_reversed(src, reinterpret_cast<CRGB *>(dst), w);
+        } else {
+            fl::memcpy(dst, src, n);
+        }
+    };
+
+    fl::memset(prev, 0, n);
+    loadRow(0, cur);
+    for (int row = 0; row < h; ++row) {
+        if (row + 1 < h) {
+            loadRow(row + 1, next);
+        } else {
+            fl::memset(next, 0, n);
+        }
+        CRGB *dst = pixels + row * w;
+        if (serpentine && (row & 1)) {
+            blur3_bytes(prev, cur, next, out, n, keepMul, seepMul);
+            copy_reversed(reinterpret_cast<const CRGB *>(out), dst, w);
+        } else {
+            blur3_bytes(prev, cur, next, reinterpret_cast<u8 *>(dst), n,
+                        keepMul, seepMul);
+        }
+        u8 *recycled = prev;
+        prev = cur;
+        cur = next;
+        next = recycled;
+    }
+}
+#endif
+
+} // namespace blur_detail
+
 // blur1d: one-dimensional blur filter. Spreads light to 2 line neighbors.
 // blur2d: two-dimensional blur filter. Spreads light to 8 XY neighbors.
 //
@@ -67,21 +258,10 @@ namespace gfx {
 //         eventually all the way to black; this is by design so that
 //         it can be used to (slowly) clear the LEDs to black.
 void blur1d(fl::span<CRGB> leds, fract8 blur_amount) {
-    const fl::u16 numLeds = static_cast<fl::u16>(leds.size());
     fl::u8 keep = 255 - blur_amount;
     fl::u8 seep = blur_amount >> 1;
-    CRGB carryover = CRGB::Black;
-    for (fl::u16 i = 0; i < numLeds; ++i) {
-        CRGB cur = leds[i];
-        CRGB part = cur;
-        part.nscale8(seep);
-        cur.nscale8(keep);
-        cur += carryover;
-        if (i)
-            leds[i - 1] += part;
-        leds[i] = cur;
-        carryover = part;
-    }
+    blur_detail::blur_line_carry(leds.data(), static_cast<fl::u16>(leds.size()),
+                                 1, keep, seep);
 }
 
 void blur2d(fl::span<CRGB> leds, fl::u8 width, fl::u8 height,
@@ -132,25 +312,13 @@ void blur2d(CRGB *leds, fl::u8 width, fl::u8 height, fract8 blur_amount) {
 
 void blurRows(fl::span<CRGB> leds, fl::u8 width, fl::u8 height,
               fract8 blur_amount, const XYMap &xyMap) {
-    CRGB *pixels = leds.data();
     fl::u8 keep = 255 - blur_amount;
     fl::u8 seep = blur_amount >> 1;
-    if (xyMap.isRectangularGrid()) {
-        for (fl::u8 row = 0; row < height; ++row) {
-            CRGB carryover = CRGB::Black;
-            CRGB *rowBase = pixels + row * width;
-            for (fl::u8 col = 0; col < width; ++col) {
-                CRGB cur = rowBase[col];
-                CRGB part = cur;
-                part.nscale8(seep);
-                cur.nscale8(keep);
-                cur += carryover;
-                if (col)
-                    rowBase[col - 1] += part;
-                rowBase[col] = cur;
-                carryover = part;
-            }
-        }
+    if (xyMap.isSerpentineOrLineByLine()) {
+        // The row kernel is symmetric, so reversed serpentine rows can be
+        // blurred in memory order.
+        CRGB *pixels = leds.data() + xyMap.getOffset();
+        blur_detail::blur_rows_contiguous(pixels, width, height, keep, seep);
         return;
     }
     for (fl::u8 row = 0; row < height; ++row) {
@@ -171,26 +339,24 @@ void blurRows(fl::span<CRGB> leds, fl::u8 width, fl::u8 height,
 
 void blurColumns(fl::span<CRGB> leds, fl::u8 width, fl::u8 height,
                  fract8 blur_amount, const XYMap &xyMap) {
-    CRGB *pixels = leds.data();
     fl::u8 keep = 255 - blur_amount;
     fl::u8 seep = blur_amount >> 1;
+#if FL_BLUR_STENCIL_SIMD
+    if (xyMap.isSerpentineOrLineByLine()) {
+        CRGB *pixels = leds.data() + xyMap.getOffset();
+        blur_detail::blur_columns_linebuf(pixels, width, height,
+                                          xyMap.isSerpentine(), keep, seep);
+        return;
+    }
+#else
     if (xyMap.isRectangularGrid()) {
+        CRGB *pixels = leds.data() + xyMap.getOffset();
         for (fl::u8 col = 0; col < width; ++col) {
-            CRGB carryover = CRGB::Black;
-            for (fl::u8 row = 0; row < height; ++row) {
-                CRGB cur = pixels[row * width + col];
-                CRGB part = cur;
-                part.nscale8(seep);
-                cur.nscale8(keep);
-                cur += carryover;
-                if (row)
-                    pixels[(row - 1) * width + col] += part;
-                pixels[row * width + col] = cur;
-                carryover = part;
-            }
+            blur_detail::blur_line_carry(pixels + col, height, width, keep, seep);
         }
         return;
     }
+#endif
     for (fl::u8 col = 0; col < width; ++col) {
         CRGB carryover = CRGB::Black;
         for (fl::u8 i = 0; i < height; ++i) {
@@ -208,48 +374,24 @@ void blurColumns(fl::span<CRGB> leds, fl::u8 width, fl::u8 height,
 }
 
 void blurRows(Canvas<CRGB> &canvas, alpha8 blur_amount) {
-    const int w = canvas.width;
-    const int h = canvas.height;
-    CRGB *pixels = canvas.pixels;
     fl::u8 keep = 255 - blur_amount;
     fl::u8 seep = blur_amount >> 1;
-    for (int row = 0; row < h; ++row) {
-        CRGB carryover = CRGB::Black;
-        CRGB *rowBase = pixels + row * w;
-        for (int col = 0; col < w; ++col) {
-            CRGB cur = rowBase[col];
-            CRGB part = cur;
-            part.nscale8(seep);
-            cur.nscale8(keep);
-            cur += carryover;
-            if (col)
-                rowBase[col - 1] += part;
-            rowBase[col] = cur;
-            carryover = part;
-        }
-    }
+    blur_detail::blur_rows_contiguous(canvas.pixels, canvas.width,
+                                      canvas.height, keep, seep);
 }
 
 void blurColumns(Canvas<CRGB> &canvas, alpha8 blur_amount) {
     const int w = canvas.width;
     const int h = canvas.height;
-    CRGB *pixels = canvas.pixels;
     fl::u8 keep = 255 - blur_amount;
     fl::u8 seep = blur_amount >> 1;
+#if FL_BLUR_STENCIL_SIMD
+    blur_detail::blur_columns_linebuf(canvas.pixels, w, h, false, keep, seep);
+#else
     for (int col = 0; col < w; ++col) {
-        CRGB carryover = CRGB::Black;
-        for (int row = 0; row < h; ++row) {
-            CRGB cur = pixels[row * w + col];
-            CRGB part = cur;
-            part.nscale8(seep);
-            cur.nscale8(keep);
-            cur += carryover;
-            if (row)
-                pixels[(row - 1) * w + col] += part;
-            pixels[row * w + col] = cur;
-            carryover = part;
-        }
+        blur_detail::blur_line_carry(canvas.pixels + col, h, w, keep, seep);
     }
+#endif
 }
 
 void blur2d(Canvas<CRGB> &canvas, alpha8 blur_amount) {
@@ -76,6 +76,50 @@ FL_ALWAYS_INLINE void five_bit_pixel(
     *out_power_5bit = static_cast<u8>(scale);
 }
 
+// Pixels per chunk of the fused encoder. The structure-of-arrays staging is
+// ~28 bytes of stack per pixel and stays in L1 for the whole chunk.
+#if defined(FL_IS_AVR)
+constexpr fl::size kChunk = 8;
+#else
+constexpr fl::size kChunk = 32;
+#endif
+
+// five_bit_pixel() over one chunk, branch-free per lane so the compiler can
+// vectorize it. Lanes whose input was all zero report zero_power instead of
+// the quantized scale; every other case (including scale == 0, where
+// BRIGHT_SCALE[0] == 0 zeroes the channels) falls out of the arithmetic.
+FL_ALWAYS_INLINE void five_bit_chunk(
+    u32 *r, u32 *g, u32 *b, fl::size n, u32 bright_p1, bool apply_brightness,
+    u8 zero_power, u8 *r8, u8 *g8, u8 *b8, u8 *power) {
+    u32 zero[kChunk];
+    for (fl::size i = 0; i < n; ++i) {
+        zero[i] = (r[i] | g[i] | b[i]) == 0;
+    }
+    if (apply_brightness) {
+        for (fl::size i = 0; i < n; ++i) {
+            r[i] = (r[i] * bright_p1) >> 8;
+            g[i] = (g[i] * bright_p1) >> 8;
+            b[i] = (b[i] * bright_p1) >> 8;
+        }
+    }
+    u32 scale[kChunk];
+    for (fl::size i = 0; i < n; ++i) {
+        u32 m = r[i] > g[i] ? r[i] : g[i];
+        m = m > b[i] ? m : b[i];
+        scale[i] = (m + (2047 - (m >> 5))) >> 11;
+    }
+    u32 scalef[kChunk];
+    for (fl::size i = 0; i < n; ++i) {
+        scalef[i] = FL_PGM_READ_DWORD_ALIGNED(&BRIGHT_SCALE[scale[i]]);
+    }
+    for (fl::size i = 0; i < n; ++i) {
+        r8[i] = static_cast<u8>((r[i] * scalef[i] + 0x808000) >> 24);
+        g8[i] = static_cast<u8>((g[i] * scalef[i] + 0x808000) >> 24);
+        b8[i] = static_cast<u8>((b[i] * scalef[i] + 0x808000) >> 24);
+        power[i] = zero[i] ? zero_power : static_cast<u8>(scale[i]);
+    }
+}
+
 } // namespace five_bit_impl
 } // anonymous namespace
 
@@ -178,6 +222,74 @@ void five_bit_hd_gamma_bitshift(
     }
 }
 
+FL_OPTIMIZE_FUNCTION
+fl::size five_bit_hd_gamma_apa102_frames(
+    fl::span<const CRGB> colors, CRGB colors_scale, u8 global_brightness,
+    EOrder rgb_order, fl::span<u8> out) {
+
+    fl::size n = colors.size();
+    if (out.size() / 4 < n) n = out.size() / 4;
+    u8 *dst = out.data();
+
+    if (global_brightness == 0) {
+        for (fl::size i = 0; i < n; ++i, dst += 4) {
+            dst[0] = 0xE0;
+            dst[1] = 0;
+            dst[2] = 0;
+            dst[3] = 0;
+        }
+        return n;
+    }
+
+    const aligned_ptr<const u16, 64> glut(GAMMA_2_8_LUT);
+
+    // Scale 0xff multiplies by 256 and shifts back down, so it needs no
+    // special case here.
+    const u32 rscale_p1 = 1u + colors_scale.r;
+    const u32 gscale_p1 = 1u + colors_scale.g;
+    const u32 bscale_p1 = 1u + colors_scale.b;
+    const bool apply_brightness = (global_brightness != 0xff);
+    const u32 bright_p1 = 1u + static_cast<u32>(global_brightness);
+    const u8 zero_power = (global_brightness <= 31) ? global_brightness : 31;
+
+    // RGB_ORDER octal digits: wire byte k takes channel (order >> 3*(2-k)) & 3.
+    const int order = static_cast<int>(rgb_order);
+    const u8 o0 = (order >> 6) & 0x3;
+    const u8 o1 = (order >> 3) & 0x3;
+    const u8 o2 = order & 0x3;
+
+    u32 r16[five_bit_impl::kChunk];
+    u32 g16[five_bit_impl::kChunk];
+    u32 b16[five_bit_impl::kChunk];
+    u8 rgb8[3][five_bit_impl::kChunk];
+    u8 power[five_bit_impl::kChunk];
+    const u8 *c0 = rgb8[o0];
+    const u8 *c1 = rgb8[o1];
+    const u8 *c2 = rgb8[o2];
+
+    const CRGB *src = colors.data();
+    for (fl::size base = 0; base < n; base += five_bit_impl::kChunk) {
+        const fl::size m = (n - base < five_bit_impl::kChunk) ? n - base
+                                                                : five_bit_impl::kChunk;
+        // Gamma table reads are gathers; everything after them is lane-wise.
+        for (fl::size i = 0; i < m; ++i) {
+            const CRGB &c = src[base + i];
+            r16[i] = (five_bit_impl::gamma_lut_read(glut, c.r) * rscale_p1) >> 8;
+            g16[i] = (five_bit_impl::gamma_lut_read(glut, c.g) * gscale_p1) >> 8;
+            b16[i] = (five_bit_impl::gamma_lut_read(glut, c.b) * bscale_p1) >> 8;
+        }
+        five_bit_impl::five_bit_chunk(r16, g16, b16, m, bright_p1, apply_brightness,
+                                      zero_power, rgb8[0], rgb8[1], rgb8[2], power);
+        for (fl::size i = 0; i < m; ++i, dst += 4) {
+            dst[0] = static_cast<u8>(0xE0 | power[i]);
+            dst[1] = c0[i];
+            dst[2] = c1[i];
+            dst[3] = c2[i];
+        }
+    }
+    return n;
+}
+
 } // namespace fl
 
 FL_OPTIMIZATION_LEVEL_O3_END
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include "fl/gfx/eorder.h"
 #include "fl/stl/int.h"
 #include "fl/stl/span.h"
 #include "fl/stl/noexcept.h"
@@ -33,4 +34,15 @@ void five_bit_hd_gamma_bitshift(
     fl::span<const CRGB> colors, CRGB colors_scale, fl::u8 global_brightness,
     fl::span<CRGBA5> out) FL_NO_EXCEPT;
 
+// Fused gamma + 5-bit brightness + APA102/SK9822 LED-frame encoding.
+// Writes 4 bytes per pixel, [0xE0 | power_5bit][c0][c1][c2], where c0..c2 are
+// the gamma-corrected channels in rgb_order (the controller's RGB_ORDER).
+// Byte-identical to the CRGBA5 variant followed by frame formatting, but
+// works through small stack chunks so no frame-sized intermediate is needed.
+// Start/end frames are not written. Returns the number of pixels encoded:
+// min(colors.size(), out.size() / 4).
+fl::size five_bit_hd_gamma_apa102_frames(
+    fl::span<const CRGB> colors, CRGB colors_scale, fl::u8 global_brightness,
+    EOrder rgb_order, fl::span<fl::u8> out) FL_NO_EXCEPT;
+
 } // namespace fl
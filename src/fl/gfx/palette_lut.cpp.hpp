@@ -0,0 +1,126 @@
+/// @file palette_lut.cpp.hpp
+/// @brief PaletteLUT compile and batched mapping
+
+#include "fl/gfx/palette_lut.h"
+#include "fl/math/scale8.h"
+#include "fl/stl/compiler_control.h"
+#include "fl/stl/cstring.h"
+#include "fl/stl/noexcept.h"
+
+FL_OPTIMIZATION_LEVEL_O3_BEGIN
+
+namespace fl {
+
+namespace {
+
+// Brightness step of ColorFromPalette() for CRGBPalette16/32 (applied
+// after blending). `brightness` is never 255 here.
+FL_ALWAYS_INLINE u8 paletteBrightness(u8 c, u8 brightness) FL_NO_EXCEPT {
+    if (!brightness || !c) {
+        return 0;
+    }
+    u8 out = scale8(c, static_cast<u8>(brightness + 1));
+#if !(FASTLED_SCALE8_FIXED == 1)
+    ++out;
+#endif
+    return out;
+}
+
+} // namespace
+
+PaletteLUT::PaletteLUT() FL_NO_EXCEPT : mVersion(0), mVideoScale(false) {
+    fl::memset(mTable, 0, sizeof(mTable));
+}
+
+template <typename PALETTE>
+bool PaletteLUT::compileFrom(const PALETTE &pal, u8 brightness,
+                             TBlendType blendType, bool videoScale) FL_NO_EXCEPT {
+    bool changed = videoScale != mVideoScale;
+    for (int i = 0; i < kSize; ++i) {
+        const CRGB c = ColorFromPalette(pal, static_cast<u8>(i), brightness, blendType);
+        if (!changed && c != mTable[i]) {
+            changed = true;
+        }
+        mTable[i] = c;
+    }
+    mVideoScale = videoScale;
+    if (changed) {
+        ++mVersion;
+    }
+    return changed;
+}
+
+bool PaletteLUT::compile(const CRGBPalette16 &pal, u8 brightness,
+                         TBlendType blendType) FL_NO_EXCEPT {
+    return compileFrom(pal, brightness, blendType, false);
+}
+
+bool PaletteLUT::compile(const CRGBPalette32 &pal, u8 brightness,
+                         TBlendType blendType) FL_NO_EXCEPT {
+    return compileFrom(pal, brightness, blendType, false);
+}
+
+bool PaletteLUT::compile(const CRGBPalette256 &pal, u8 brightness,
+                         TBlendType blendType) FL_NO_EXCEPT {
+    return compileFrom(pal, brightness, blendType, true);
+}
+
+bool PaletteLUT::compile(const TProgmemRGBPalette16 &pal, u8 brightness,
+                         TBlendType blendType) FL_NO_EXCEPT {
+    return compileFrom(pal, brightness, blendType, false);
+}
+
+bool PaletteLUT::compile(const TProgmemRGBPalette32 &pal, u8 brightness,
+                         TBlendType blendType) FL_NO_EXCEPT {
+    return compileFrom(pal, brightness, blendType, false);
+}
+
+void PaletteLUT::map(fl::span<const u8> indices, fl::span<CRGB> out) const FL_NO_EXCEPT {
+    const fl::size n = indices.size() < out.size() ? indices.size() : out.size();
+    const u8 *idx = indices.data();
+    CRGB *dst = out.data();
+    fl::size i = 0;
+    for (; i + 4 <= n; i += 4) {
+        dst[i] = mTable[idx[i]];
+        dst[i + 1] = mTable[idx[i + 1]];
+        dst[i + 2] = mTable[idx[i + 2]];
+        dst[i + 3] = mTable[idx[i + 3]];
+    }
+    for (; i < n; ++i) {
+        dst[i] = mTable[idx[i]];
+    }
+}
+
+CRGB PaletteLUT::lookup(u8 index, u8 brightness) const FL_NO_EXCEPT {
+    CRGB c = mTable[index];
+    if (brightness == 255) {
+        return c;
+    }
+    if (mVideoScale) {
+        const u8 b1 = static_cast<u8>(brightness + 1);
+        c.r = scale8_video(c.r, b1);
+        c.g = scale8_video(c.g, b1);
+        c.b = scale8_video(c.b, b1);
+    } else {
+        c.r = paletteBrightness(c.r, brightness);
+        c.g = paletteBrightness(c.g, brightness);
+        c.b = paletteBrightness(c.b, brightness);
+    }
+    return c;
+}
+
+void PaletteLUT::map(fl::span<const u8> indices, fl::span<const u8> brightness,
+                     fl::span<CRGB> out) const FL_NO_EXCEPT {
+    fl::size n = indices.size() < out.size() ? indices.size() : out.size();
+    n = brightness.size() < n ? brightness.size() : n;
+    const u8 *idx = indices.data();
+    const u8 *bri = brightness.data();
+    CRGB *dst = out.data();
+    for (fl::size i = 0; i < n; ++i) {
+        dst[i] = lookup(idx[i], bri[i]);
+    }
+}
+
+} // namespace fl
+
+FL_OPTIMIZATION_LEVEL_O3_END
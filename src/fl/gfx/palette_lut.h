@@ -0,0 +1,191 @@
+#pragma once
+
+/// @file palette_lut.h
+/// @brief Palettes compiled into flat lookup tables for batched mapping
+///
+/// ColorFromPalette() re-does segment selection, blending and brightness
+/// scaling on every call. When the same palette colors a whole frame, it is
+/// cheaper to evaluate it once per index and map pixels with a table read:
+///
+/// @code
+/// fl::PaletteLUT lut;
+/// lut.compile(RainbowColors_p);            // 256 x ColorFromPalette()
+/// lut.map(noiseIndices, leds);             // leds[i] = lut[noiseIndices[i]]
+/// lut.map(noiseIndices, noiseBrightness, leds);  // per-pixel brightness
+/// @endcode
+///
+/// - PaletteLUT:          256 entries, u8 index, bit-exact with ColorFromPalette()
+/// - PaletteLUTExtended:  1024 entries, u16 index, samples ColorFromPaletteExtended()
+/// - PaletteLUTHD:        1024 entries, u16 index, samples ColorFromPaletteHD()
+///
+/// The wide tables keep the top 10 bits of the u16 index, which is below
+/// what an 8-bit output can resolve between neighbouring palette entries.
+///
+/// version() changes whenever compile() produces a different table, so a
+/// consumer holding derived data (e.g. a pre-mapped frame) can tell when
+/// it is stale. compile() always rebuilds; it is 256 (or 1024) palette
+/// lookups, so compile once per palette change rather than per pixel.
+
+#include "fl/gfx/colorutils.h"
+#include "fl/gfx/crgb.h"
+#include "fl/gfx/crgb16.h"
+#include "fl/stl/cstring.h"
+#include "fl/stl/int.h"
+#include "fl/stl/span.h"
+#include "fl/stl/noexcept.h"
+
+namespace fl {
+
+/// @brief ColorFromPalette() evaluated for all 256 u8 indices
+class PaletteLUT {
+public:
+    static constexpr int kSize = 256;
+
+    /// @brief All-black table, version() 0
+    PaletteLUT() FL_NO_EXCEPT;
+
+    /// @brief Rebuild from a palette; arguments as for ColorFromPalette()
+    /// @return true if the table contents changed (version() was bumped)
+    bool compile(const CRGBPalette16 &pal, u8 brightness = 255,
+                 TBlendType blendType = LINEARBLEND) FL_NO_EXCEPT;
+    bool compile(const CRGBPalette32 &pal, u8 brightness = 255,
+                 TBlendType blendType = LINEARBLEND) FL_NO_EXCEPT;
+    bool compile(const CRGBPalette256 &pal, u8 brightness = 255,
+                 TBlendType blendType = LINEARBLEND) FL_NO_EXCEPT;
+    bool compile(const TProgmemRGBPalette16 &pal, u8 brightness = 255,
+                 TBlendType blendType = LINEARBLEND) FL_NO_EXCEPT;
+    bool compile(const TProgmemRGBPalette32 &pal, u8 brightness = 255,
+                 TBlendType blendType = LINEARBLEND) FL_NO_EXCEPT;
+
+    const CRGB &operator[](u8 index) const FL_NO_EXCEPT { return mTable[index]; }
+    fl::span<const CRGB> table() const FL_NO_EXCEPT {
+        return fl::span<const CRGB>(mTable, kSize);
+    }
+
+    /// @brief One pixel of the brightness map() below
+    CRGB lookup(u8 index, u8 brightness) const FL_NO_EXCEPT;
+
+    /// @brief Bumped each time compile() changes the table
+    u32 version() const FL_NO_EXCEPT { return mVersion; }
+
+    /// @brief out[i] = (*this)[indices[i]] for min(indices.size(), out.size()) pixels
+    void map(fl::span<const u8> indices, fl::span<CRGB> out) const FL_NO_EXCEPT;
+
+    /// @brief As map(), then scale each pixel by brightness[i]
+    ///
+    /// Identical to ColorFromPalette(pal, indices[i], brightness[i], blend)
+    /// when the table was compiled from `pal` with brightness 255.
+    void map(fl::span<const u8> indices, fl::span<const u8> brightness,
+             fl::span<CRGB> out) const FL_NO_EXCEPT;
+
+private:
+    template <typename PALETTE>
+    bool compileFrom(const PALETTE &pal, u8 brightness, TBlendType blendType,
+                     bool videoScale) FL_NO_EXCEPT;
+
+    CRGB mTable[kSize];
+    u32 mVersion;
+    bool mVideoScale;  // CRGBPalette256 scales brightness with scale8_video
+};
+
+namespace detail {
+
+inline CRGB paletteSampleWide(const CRGBPalette16 &pal, u16 index, u8 brightness,
+                              TBlendType blendType, CRGB *) FL_NO_EXCEPT {
+    return ColorFromPaletteExtended(pal, index, brightness, blendType);
+}
+inline CRGB paletteSampleWide(const CRGBPalette32 &pal, u16 index, u8 brightness,
+                              TBlendType blendType, CRGB *) FL_NO_EXCEPT {
+    return ColorFromPaletteExtended(pal, index, brightness, blendType);
+}
+inline CRGB paletteSampleWide(const CRGBPalette256 &pal, u16 index, u8 brightness,
+                              TBlendType blendType, CRGB *) FL_NO_EXCEPT {
+    return ColorFromPaletteExtended(pal, index, brightness, blendType);
+}
+inline CRGB16 paletteSampleWide(const CRGBPalette16 &pal, u16 index, u8 brightness,
+                                TBlendType blendType, CRGB16 *) FL_NO_EXCEPT {
+    return ColorFromPaletteHD(pal, index, brightness, blendType);
+}
+inline CRGB16 paletteSampleWide(const CRGBPalette32 &pal, u16 index, u8 brightness,
+                                TBlendType blendType, CRGB16 *) FL_NO_EXCEPT {
+    return ColorFromPaletteHD(pal, index, brightness, blendType);
+}
+inline CRGB16 paletteSampleWide(const CRGBPalette256 &pal, u16 index, u8 brightness,
+                                TBlendType blendType, CRGB16 *) FL_NO_EXCEPT {
+    return ColorFromPaletteHD(pal, index, brightness, blendType);
+}
+
+} // namespace detail
+
+/// @brief 1024-entry table for u16 palette indices (see PaletteLUTExtended / PaletteLUTHD)
+template <typename RGB_T>
+class PaletteLUTWide {
+public:
+    static constexpr int kBits = 10;
+    static constexpr int kSize = 1 << kBits;
+    static constexpr int kShift = 16 - kBits;
+
+    PaletteLUTWide() FL_NO_EXCEPT : mVersion(0) {
+        fl::memset(mTable, 0, sizeof(mTable));
+    }
+
+    /// @brief Rebuild by sampling the palette at index (i << kShift)
+    /// @return true if the table contents changed (version() was bumped)
+    template <typename PALETTE>
+    bool compile(const PALETTE &pal, u8 brightness = 255,
+                 TBlendType blendType = LINEARBLEND) FL_NO_EXCEPT {
+        bool changed = false;
+        for (int i = 0; i < kSize; ++i) {
+            const RGB_T c = detail::paletteSampleWide(
+                pal, static_cast<u16>(i << kShift), brightness, blendType,
+                static_cast<RGB_T *>(nullptr));
+            if (!changed && fl::memcmp(&c, &mTable[i], sizeof(RGB_T)) != 0) {
+                changed = true;
+            }
+            mTable[i] = c;
+        }
+        if (changed) {
+            ++mVersion;
+        }
+        return changed;
+    }
+
+    const RGB_T &operator[](u16 index) const FL_NO_EXCEPT {
+        return mTable[index >> kShift];
+    }
+    fl::span<const RGB_T> table() const FL_NO_EXCEPT {
+        return fl::span<const RGB_T>(mTable, kSize);
+    }
+
+    /// @brief Bumped each time compile() changes the table
+    u32 version() const FL_NO_EXCEPT { return mVersion; }
+
+    /// @brief out[i] = (*this)[indices[i]] for min(indices.size(), out.size()) pixels
+    void map(fl::span<const u16> indices, fl::span<RGB_T> out) const FL_NO_EXCEPT {
+        const fl::size n = indices.size() < out.size() ? indices.size() : out.size();
+        const u16 *idx = indices.data();
+        RGB_T *dst = out.data();
+        fl::size i = 0;
+        for (; i + 4 <= n; i += 4) {
+            dst[i] = mTable[idx[i] >> kShift];
+            dst[i + 1] = mTable[idx[i + 1] >> kShift];
+            dst[i + 2] = mTable[idx[i + 2] >> kShift];
+            dst[i + 3] = mTable[idx[i + 3] >> kShift];
+        }
+        for (; i < n; ++i) {
+            dst[i] = mTable[idx[i] >> kShift];
+        }
+    }
+
+private:
+    RGB_T mTable[kSize];
+    u32 mVersion;
+};
+
+/// @brief ColorFromPaletteExtended() sampled into 1024 CRGB entries
+typedef PaletteLUTWide<CRGB> PaletteLUTExtended;
+
+/// @brief ColorFromPaletteHD() sampled into 1024 CRGB16 entries
+typedef PaletteLUTWide<CRGB16> PaletteLUTHD;
+
+} // namespace fl
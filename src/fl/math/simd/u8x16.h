@@ -38,6 +38,12 @@ using platforms::add_sat_u8_16;  // ok bare using
 /// @return Result of saturating subtraction
 using platforms::sub_sat_u8_16;  // ok bare using
 
+/// Wrapping add: (a + b) mod 256. add_u8_16(v, v) shifts every byte left by 1.
+/// @param a First operand (16 uint8_t)
+/// @param b Second operand (16 uint8_t)
+/// @return Result of wrapping addition
+using platforms::add_u8_16;  // ok bare using
+
 /// Scale uint8_t vector by factor: (vec * scale) / 256
 /// @param vec Input vector (16 uint8_t)
 /// @param scale Scale factor (0-255, where 256 = 1.0)
@@ -104,6 +110,21 @@ using platforms::xor_u8_16;  // ok bare using
 /// @return Bitwise AND-NOT result
 using platforms::andnot_u8_16;  // ok bare using
 
+//==============================================================================
+// Comparison Operations
+//==============================================================================
+
+/// Element-wise equality: 0xFF where a == b, 0x00 otherwise
+/// @param a First operand (16 uint8_t)
+/// @param b Second operand (16 uint8_t)
+/// @return Per-byte mask suitable for and/andnot select
+using platforms::cmpeq_u8_16;  // ok bare using
+
+/// Gather the most significant bit of each byte: bit i = MSB of byte i
+/// @param vec Input vector (16 uint8_t)
+/// @return 16-bit mask (byte 0 -> bit 0, byte 15 -> bit 15)
+using platforms::movemask_u8_16;  // ok bare using
+
 //==============================================================================
 // Blend Operations
 //==============================================================================
@@ -3,8 +3,20 @@
 
 #include "fl/math/transposition.h"
 #include "fl/math/math.h"
+#include "fl/math/simd.h"
 #include "fl/stl/vector.h"
 
+/// 1 when the fl::simd backend lowers transpose_*lane_simd() to real vector
+/// instructions (SSE2 and up). Elsewhere movemask_u8_16 is a 16-step scalar
+/// loop and the inline shift kernels are faster, so SPITransposer keeps them.
+#ifndef FL_SPI_TRANSPOSE_SIMD
+#if defined(FASTLED_X86_HAS_SSE2) && FASTLED_X86_HAS_SSE2
+#define FL_SPI_TRANSPOSE_SIMD 1
+#else
+#define FL_SPI_TRANSPOSE_SIMD 0
+#endif
+#endif
+
 FL_OPTIMIZATION_LEVEL_O3_BEGIN
 
 namespace fl {
@@ -42,6 +54,54 @@ void FL_OPTIMIZE_FUNCTION FL_IRAM transpose8x1_noinline(unsigned char *A, unsign
 
 FL_DISABLE_WARNING_POP
 
+// ============================================================================
+// SIMD Multi-Lane Transpose Kernels
+// ============================================================================
+
+// Emits the 8 bit planes of `v`, MSB plane first: plane k is the movemask of
+// v << k. Low mask byte goes to lo[k], high mask byte to hi[k].
+static FASTLED_FORCE_INLINE void emitBitPlanes(simd::simd_u8x16 v, u8* lo, u8* hi) FL_NO_EXCEPT {
+    for (int k = 0; k < 8; k++) {
+        const u16 mask = simd::movemask_u8_16(v);
+        lo[k] = static_cast<u8>(mask);
+        hi[k] = static_cast<u8>(mask >> 8);
+        v = simd::add_u8_16(v, v);
+    }
+}
+
+void FL_IRAM transpose_8lane_simd(const u8* const lanes[8], u8* output,
+                                  size_t num_bytes) FL_NO_EXCEPT {
+    u8 block[16];
+    size_t byte_idx = 0;
+    for (; byte_idx + 2 <= num_bytes; byte_idx += 2) {
+        for (int lane = 0; lane < 8; lane++) {
+            block[lane] = lanes[lane][byte_idx];
+            block[8 + lane] = lanes[lane][byte_idx + 1];
+        }
+        u8* dest = &output[byte_idx * 8];
+        emitBitPlanes(simd::load_u8_16(block), dest, dest + 8);
+    }
+    if (byte_idx < num_bytes) {
+        const u8* tail[8];
+        for (int lane = 0; lane < 8; lane++) {
+            tail[lane] = lanes[lane] + byte_idx;
+        }
+        transpose_8lane_inline(tail, &output[byte_idx * 8], num_bytes - byte_idx);
+    }
+}
+
+void FL_IRAM transpose_16lane_simd(const u8* const lanes[16], u8* output,
+                                   size_t num_bytes) FL_NO_EXCEPT {
+    u8 block[16];
+    for (size_t byte_idx = 0; byte_idx < num_bytes; byte_idx++) {
+        for (int lane = 0; lane < 16; lane++) {
+            block[lane] = lanes[lane][byte_idx];
+        }
+        u8* dest = &output[byte_idx * 16];
+        emitBitPlanes(simd::load_u8_16(block), dest, dest + 8);
+    }
+}
+
 // ============================================================================
 // SPI Multi-Lane Transposer Implementation
 // ============================================================================
@@ -222,8 +282,13 @@ bool SPITransposer::transpose8(const fl::optional<LaneData> lanes[8],
         }
     }
 
-    // Perform transposition using ISR-safe primitive
+    // Perform transposition (vector kernel only where it beats the
+    // ISR-safe primitive)
+#if FL_SPI_TRANSPOSE_SIMD
+    transpose_8lane_simd(lane_ptrs, output.data(), max_size);
+#else
     transpose_8lane_inline(lane_ptrs, output.data(), max_size);
+#endif
 
     if (error) {
         *error = nullptr;  // Success, no error
@@ -231,7 +296,7 @@ bool SPITransposer::transpose8(const fl::optional<LaneData> lanes[8],
     return true;
 }
 
-// interleave_byte_8way removed - now uses transpose_8lane_inline() primitive
+// interleave_byte_8way removed - now uses transpose_8lane_simd() on SSE2, transpose_8lane_inline() elsewhere
 
 // ----------------------------------------------------------------------------
 // 16-Way Transpose (Hex-SPI)
@@ -282,8 +347,13 @@ bool SPITransposer::transpose16(const fl::optional<LaneData> lanes[16],
         }
     }
 
-    // Perform transposition using ISR-safe primitive
+    // Perform transposition (vector kernel only where it beats the
+    // ISR-safe primitive)
+#if FL_SPI_TRANSPOSE_SIMD
+    transpose_16lane_simd(lane_ptrs, output.data(), max_size);
+#else
     transpose_16lane_inline(lane_ptrs, output.data(), max_size);
+#endif
 
     if (error) {
         *error = nullptr;  // Success, no error
@@ -291,7 +361,7 @@ bool SPITransposer::transpose16(const fl::optional<LaneData> lanes[16],
     return true;
 }
 
-// interleave_byte_16way removed - now uses transpose_16lane_inline() primitive
+// interleave_byte_16way removed - now uses transpose_16lane_simd() on SSE2, transpose_16lane_inline() elsewhere
 
 // ----------------------------------------------------------------------------
 // Common Helper Functions
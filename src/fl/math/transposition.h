@@ -297,6 +297,39 @@ inline void transpose_16lane_inline(
     size_t num_bytes
 ) FL_NO_EXCEPT;
 
+/// @brief SIMD bulk version of transpose_8lane_inline()
+///
+/// Produces byte-identical output to transpose_8lane_inline(), which stays as
+/// the reference. Two source byte positions (2 x 8 lanes) are loaded into one
+/// u8x16 register; each output byte is then one movemask of the register,
+/// which is shifted left by one bit between the 8 bit planes.
+/// SPITransposer only calls it where FL_SPI_TRANSPOSE_SIMD is set (SSE2);
+/// on scalar simd backends the inline primitive is faster.
+///
+/// @param lanes Array of 8 lane byte pointers
+/// @param output Output buffer (must have space for num_bytes * 8 bytes)
+/// @param num_bytes Number of bytes to transpose per lane
+void transpose_8lane_simd(
+    const u8* const lanes[8],
+    u8* output,
+    size_t num_bytes
+) FL_NO_EXCEPT;
+
+/// @brief SIMD bulk version of transpose_16lane_inline()
+///
+/// Produces byte-identical output to transpose_16lane_inline(). The 16 lane
+/// bytes of one source position fill one u8x16 register; the movemask of
+/// each bit plane yields the lanes 0-7 and lanes 8-15 output bytes at once.
+///
+/// @param lanes Array of 16 lane byte pointers
+/// @param output Output buffer (must have space for num_bytes * 16 bytes)
+/// @param num_bytes Number of bytes to transpose per lane
+void transpose_16lane_simd(
+    const u8* const lanes[16],
+    u8* output,
+    size_t num_bytes
+) FL_NO_EXCEPT;
+
 /// @brief Generic bit-interleaving primitive for N lanes with M-bit source data (ISR-safe)
 ///
 /// This is a generalized transposition function that can handle:
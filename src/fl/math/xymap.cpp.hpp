@@ -152,6 +152,8 @@ u16 XYMap::getHeight() const { return height; }
 
 u16 XYMap::getTotal() const { return width * height; }
 
+u16 XYMap::getOffset() const { return mOffset; }
+
 XYMap::XyMapType XYMap::getType() const { return type; }
 
 XYMap::XYMap(u16 width, u16 height, XyMapType type)
@@ -119,6 +119,7 @@ class XYMap {
     u16 getWidth() const FL_NO_EXCEPT;
     u16 getHeight() const FL_NO_EXCEPT;
     u16 getTotal() const FL_NO_EXCEPT;
+    u16 getOffset() const FL_NO_EXCEPT;
     XyMapType getType() const FL_NO_EXCEPT;
 
   private:
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "fl/net/http/stream_transport.h"
+#include "fl/log/log.h"
 #include "fl/stl/json.h"
 #include "fl/stl/string.h"
 #include "fl/stl/cstring.h"
@@ -11,6 +12,12 @@ namespace fl {
 namespace net {
 namespace http {
 
+namespace {
+// Binary frames share the serial frame layout (fl/remote/transport/serial.h).
+constexpr u8 kHttpFrameMarker = 0xC1;
+constexpr size_t kHttpFrameHeaderSize = 6;
+} // namespace
+
 // --- StreamHandle implementation ---
 
 StreamHandle::StreamHandle(fl::task::Promise<fl::json> p,
@@ -95,6 +102,11 @@ void HttpStreamTransport::parseChunkedMessages() {
             break;
         }
 
+        if (dispatchFrame(result.mData)) {
+            mLastHeartbeatReceived = getCurrentTimeMs();
+            continue;
+        }
+
         fl::string jsonStr(reinterpret_cast<const char*>(result.mData.data()), result.mData.size()); // ok reinterpret cast
         fl::json json = fl::json::parse(jsonStr.c_str());
         if (json.is_null()) {
@@ -126,6 +138,26 @@ void HttpStreamTransport::parseChunkedMessages() {
     }
 }
 
+bool HttpStreamTransport::dispatchFrame(fl::span<const u8> chunk) {
+    // 0xC1 never starts a JSON text, so the first byte decides.
+    if (chunk.empty() || chunk[0] != kHttpFrameMarker) {
+        return false;
+    }
+    if (chunk.size() < kHttpFrameHeaderSize) {
+        return true;  // truncated frame: drop
+    }
+    const u32 len = static_cast<u32>(chunk[2]) | (static_cast<u32>(chunk[3]) << 8) |
+                    (static_cast<u32>(chunk[4]) << 16) | (static_cast<u32>(chunk[5]) << 24);
+    if (len != chunk.size() - kHttpFrameHeaderSize) {
+        FL_WARN("HttpStreamTransport: frame length %u does not match chunk", static_cast<unsigned>(len));
+        return true;
+    }
+    if (mFrameHandler) {
+        mFrameHandler(chunk[1], chunk.subspan(kHttpFrameHeaderSize));
+    }
+    return true;
+}
+
 bool HttpStreamTransport::resolveRpc(const fl::json& msg, const fl::string& idKey) {
     auto it = mPendingCalls.find(idKey);
     if (it == mPendingCalls.end()) {
@@ -321,6 +353,36 @@ void HttpStreamTransport::writeResponse(const fl::json& response) {
     mLastHeartbeatSent = getCurrentTimeMs();
 }
 
+void HttpStreamTransport::setFrameHandler(FrameHandler handler) {
+    mFrameHandler = fl::move(handler);
+}
+
+void HttpStreamTransport::writeFrame(u8 type, fl::span<const u8> payload) {
+    if (!isConnected()) {
+        return;
+    }
+
+    // Chunk data is header + payload; format it once into the output buffer.
+    const size_t dataLen = kHttpFrameHeaderSize + payload.size();
+    fl::vector<u8> data;
+    data.reserve(dataLen);
+    const u32 n = static_cast<u32>(payload.size());
+    const u8 header[kHttpFrameHeaderSize] = {
+        kHttpFrameMarker, type,
+        static_cast<u8>(n & 0xff), static_cast<u8>((n >> 8) & 0xff),
+        static_cast<u8>((n >> 16) & 0xff), static_cast<u8>((n >> 24) & 0xff)};
+    data.insert(data.end(), header, header + kHttpFrameHeaderSize);
+    data.insert(data.end(), payload.begin(), payload.end());
+
+    fl::vector<u8> out;
+    out.resize(ChunkedWriter::chunkOverhead(dataLen));
+    size_t written = mWriter.writeChunk(data, out);
+    if (written > 0) {
+        sendData(fl::span<const u8>(out.data(), written));
+    }
+    mLastHeartbeatSent = getCurrentTimeMs();
+}
+
 void HttpStreamTransport::update(u32 currentTimeMs) {
     // Update connection state
     mConnection.update(currentTimeMs);
@@ -91,6 +91,19 @@ public:
     /// @param response JSON-RPC response object
     void writeResponse(const fl::json& response);
 
+    // Binary Frames
+
+    /// Binary frame receiver: frame type byte and payload (valid for the call only)
+    using FrameHandler = fl::function<void(u8 type, fl::span<const u8> payload)>;
+
+    /// Receive binary frames. A chunk is a binary frame rather than JSON when
+    /// it uses the serial frame layout: 0xC1 | type | u32 LE length | payload.
+    /// Pixel frames (fl::kPixelFrameType) can go straight to PixelStream::ingest().
+    void setFrameHandler(FrameHandler handler);
+
+    /// Send one binary frame as a single chunk.
+    void writeFrame(u8 type, fl::span<const u8> payload);
+
     // Promise-based RPC API
 
     /// Send a JSON-RPC request, returns promise that resolves with the final response.
@@ -193,6 +206,7 @@ private:
     // Callbacks
     StateCallback mOnConnect;
     StateCallback mOnDisconnect;
+    FrameHandler mFrameHandler;
 
     // Promise-based call tracking
     fl::flat_map<fl::string, PendingCall, fl::StringFastLess> mPendingCalls;
@@ -206,6 +220,7 @@ private:
     bool processIncomingData();
     void handleConnectionStateChange(u32 currentTimeMs);
     void parseChunkedMessages();
+    bool dispatchFrame(fl::span<const u8> chunk);
     bool resolveRpc(const fl::json& msg, const fl::string& idKey);
     bool resolveRpcStream(const fl::json& msg, const fl::string& idKey);
     static fl::string idToString(const fl::json& id);
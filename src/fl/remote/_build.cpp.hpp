@@ -3,6 +3,8 @@
 /// Includes in dependency order: base types, transport, rpc subsystem, then remote
 
 // begin current directory includes
+#include "fl/remote/frame_telemetry.cpp.hpp"
+#include "fl/remote/pixel_stream.cpp.hpp"
 #include "fl/remote/remote.cpp.hpp"
 #include "fl/remote/types.cpp.hpp"
 
@@ -0,0 +1,74 @@
+#include "fl/remote/frame_telemetry.h"
+#include "fl/system/frame_telemetry.h"
+#include "fl/stl/int.h"
+#include "fl/stl/span.h"
+
+namespace fl {
+
+namespace {
+
+fl::json histogramJson(const TimeHistogram& hist) FL_NO_EXCEPT {
+    fl::json obj = fl::json::object();
+    obj.set("count", static_cast<i64>(hist.count()));
+    obj.set("minUs", static_cast<i64>(hist.minUs()));
+    obj.set("maxUs", static_cast<i64>(hist.maxUs()));
+    obj.set("meanUs", static_cast<i64>(hist.meanUs()));
+    obj.set("p50Us", static_cast<i64>(hist.percentileUs(50)));
+    obj.set("p95Us", static_cast<i64>(hist.percentileUs(95)));
+    obj.set("p99Us", static_cast<i64>(hist.percentileUs(99)));
+    fl::json buckets = fl::json::array();
+    for (int i = 0; i < TimeHistogram::kBuckets; ++i) {
+        buckets.push_back(fl::json(static_cast<i64>(hist.bucket(i))));
+    }
+    obj.set("buckets", buckets);
+    return obj;
+}
+
+} // namespace
+
+fl::json frameTelemetryJson() FL_NO_EXCEPT {
+    const FrameTelemetry& telemetry = FrameTelemetry::instance();
+    fl::json out = fl::json::object();
+    out.set("enabled", telemetry.isEnabled());
+    out.set("frames", static_cast<i64>(telemetry.frames()));
+
+    fl::json limits = fl::json::array();
+    for (int i = 0; i < TimeHistogram::kBuckets; ++i) {
+        limits.push_back(fl::json(static_cast<i64>(TimeHistogram::bucketLimitUs(i))));
+    }
+    out.set("bucketLimitsUs", limits);
+
+    fl::json stages = fl::json::object();
+    for (int s = 0; s < FrameTelemetry::kStages; ++s) {
+        const FrameStage stage = static_cast<FrameStage>(s);
+        stages.set(frameStageName(stage), histogramJson(telemetry.histogram(stage)));
+    }
+    out.set("stages", stages);
+
+    FrameTelemetry::FrameRecord records[FrameTelemetry::kHistory];
+    const fl::size n = telemetry.history(fl::span<FrameTelemetry::FrameRecord>(records));
+    fl::json recent = fl::json::array();
+    for (fl::size i = 0; i < n; ++i) {
+        fl::json frame = fl::json::object();
+        frame.set("frame", static_cast<i64>(records[i].frame));
+        frame.set("channels", static_cast<int>(records[i].channels));
+        for (int s = 0; s < FrameTelemetry::kStages; ++s) {
+            frame.set(frameStageName(static_cast<FrameStage>(s)),
+                      static_cast<i64>(records[i].stageUs[s]));
+        }
+        recent.push_back(frame);
+    }
+    out.set("recent", recent);
+    return out;
+}
+
+void bindFrameTelemetry(Remote& remote) FL_NO_EXCEPT {
+    remote.bind("telemetry.get", []() -> fl::json { return frameTelemetryJson(); });
+    remote.bind("telemetry.reset", []() { FrameTelemetry::instance().reset(); });
+    remote.bind("telemetry.enable", [](bool enabled) -> bool {
+        FrameTelemetry::instance().setEnabled(enabled);
+        return FrameTelemetry::instance().isEnabled();
+    });
+}
+
+} // namespace fl
@@ -0,0 +1,35 @@
+#pragma once
+
+/// @file fl/remote/frame_telemetry.h
+/// @brief Remote RPC access to fl::FrameTelemetry
+///
+/// Binds three methods on a Remote:
+///   - `telemetry.get`           -> frameTelemetryJson()
+///   - `telemetry.reset`         -> clears histograms and history
+///   - `telemetry.enable(bool)`  -> runtime on/off, returns the new state
+///
+/// @code
+/// fl::Remote remote(pullRequest, pushResponse);
+/// fl::bindFrameTelemetry(remote);
+/// // {"method":"telemetry.get","params":[],"id":1}
+/// @endcode
+
+#include "fl/remote/remote.h"
+#include "fl/stl/json.h"
+#include "fl/stl/noexcept.h"
+
+namespace fl {
+
+/// @brief Snapshot of FrameTelemetry as JSON
+///
+/// `{"enabled", "frames", "bucketLimitsUs": [...], "stages": {<name>:
+/// {"count", "minUs", "maxUs", "meanUs", "p50Us", "p95Us", "p99Us",
+/// "buckets": [...]}}, "recent": [{"frame", "channels", <name>: us, ...}]}`
+/// with "recent" oldest first. Bucket limits are exclusive upper edges;
+/// the last bucket is open (limit 0).
+fl::json frameTelemetryJson() FL_NO_EXCEPT;
+
+/// @brief Register the telemetry.* methods on `remote`
+void bindFrameTelemetry(Remote& remote) FL_NO_EXCEPT;
+
+} // namespace fl
@@ -0,0 +1,137 @@
+#include "fl/remote/pixel_stream.h"
+#include "fl/remote/remote.h"
+#include "fl/stl/cstring.h"
+
+namespace fl {
+
+namespace {
+
+u32 readLE32(const u8* p) FL_NO_EXCEPT {
+    return static_cast<u32>(p[0]) | (static_cast<u32>(p[1]) << 8) |
+           (static_cast<u32>(p[2]) << 16) | (static_cast<u32>(p[3]) << 24);
+}
+
+} // namespace
+
+int PixelStream::add(const char* name, fl::span<CRGB> target) FL_NO_EXCEPT {
+    if (mChannels.size() > 0xff) {
+        return -1;
+    }
+    Channel channel;
+    channel.name = name ? name : "";
+    channel.pixels = target;
+    mChannels.push_back(fl::move(channel));
+    return static_cast<int>(mChannels.size() - 1);
+}
+
+int PixelStream::add(const char* name, fl::shared_ptr<Frame> frame) FL_NO_EXCEPT {
+    if (!frame) {
+        return -1;
+    }
+    const int id = add(name, frame->rgb());
+    if (id >= 0) {
+        mChannels[id].frame = fl::move(frame);
+    }
+    return id;
+}
+
+fl::span<u8> PixelStream::begin(fl::span<const u8> header, u32 bodySize) FL_NO_EXCEPT {
+    mPending = -1;
+    if (header.size() < kPixelFrameHeaderSize || header[0] >= mChannels.size()) {
+        ++mStats.rejected;
+        return fl::span<u8>();
+    }
+    Channel& ch = mChannels[header[0]];
+    const u8 flags = header[1];
+    const u32 seq = readLE32(header.data() + 2);
+    const u32 first = readLE32(header.data() + 6);
+
+    // Wrap-safe: anything behind the last accepted frame is late, as is a
+    // repeat of a frame that already completed.
+    if (ch.hasSeq && !(flags & kPixelFrameRestart)) {
+        const i32 ahead = static_cast<i32>(seq - ch.seq);
+        if (ahead < 0 || (ahead == 0 && !ch.open)) {
+            ++mStats.late;
+            return fl::span<u8>();
+        }
+    }
+    if (first >= ch.pixels.size()) {
+        ++mStats.rejected;
+        return fl::span<u8>();
+    }
+
+    ch.seq = seq;
+    ch.hasSeq = true;
+    ch.open = true;
+    mPending = header[0];
+    mPendingFlags = flags;
+
+    u8* bytes = reinterpret_cast<u8*>(ch.pixels.data() + first);  // ok reinterpret cast
+    const fl::size room = (ch.pixels.size() - first) * sizeof(CRGB);
+    return fl::span<u8>(bytes, bodySize < room ? bodySize : room);
+}
+
+void PixelStream::end() FL_NO_EXCEPT {
+    if (mPending < 0) {
+        return;
+    }
+    Channel& ch = mChannels[mPending];
+    const u8 channel = static_cast<u8>(mPending);
+    mPending = -1;
+    ++mStats.applied;
+    if (mPendingFlags & kPixelFramePartial) {
+        return;
+    }
+    ch.open = false;
+    if (mOnFrame) {
+        mOnFrame(channel, ch.seq);
+    }
+}
+
+bool PixelStream::ingest(fl::span<const u8> payload) FL_NO_EXCEPT {
+    if (payload.size() < kPixelFrameHeaderSize) {
+        ++mStats.rejected;
+        return false;
+    }
+    const u32 bodySize = static_cast<u32>(payload.size() - kPixelFrameHeaderSize);
+    fl::span<u8> dst = begin(payload.subspan(0, kPixelFrameHeaderSize), bodySize);
+    if (mPending < 0) {
+        return false;
+    }
+    fl::memcpy(dst.data(), payload.data() + kPixelFrameHeaderSize, dst.size());
+    end();
+    return true;
+}
+
+void PixelStream::resetSequence() FL_NO_EXCEPT {
+    for (fl::size i = 0; i < mChannels.size(); ++i) {
+        mChannels[i].hasSeq = false;
+        mChannels[i].open = false;
+    }
+}
+
+fl::json PixelStream::info() const FL_NO_EXCEPT {
+    fl::json channels = fl::json::array();
+    for (fl::size i = 0; i < mChannels.size(); ++i) {
+        const Channel& ch = mChannels[i];
+        fl::json entry = fl::json::object();
+        entry.set("channel", static_cast<i64>(i));
+        entry.set("name", ch.name);
+        entry.set("pixels", static_cast<i64>(ch.pixels.size()));
+        entry.set("seq", ch.hasSeq ? fl::json(static_cast<i64>(ch.seq)) : fl::json());
+        channels.push_back(entry);
+    }
+    fl::json out = fl::json::object();
+    out.set("channels", channels);
+    out.set("applied", static_cast<i64>(mStats.applied));
+    out.set("late", static_cast<i64>(mStats.late));
+    out.set("rejected", static_cast<i64>(mStats.rejected));
+    return out;
+}
+
+void bindPixelStream(Remote& remote, PixelStream& pixels) FL_NO_EXCEPT {
+    PixelStream* stream = &pixels;
+    remote.bind("pixels.info", [stream]() -> fl::json { return stream->info(); });
+}
+
+} // namespace fl
@@ -0,0 +1,119 @@
+#pragma once
+
+/// @file fl/remote/pixel_stream.h
+/// @brief Raw pixel frames from a host, written straight into LED buffers
+///
+/// JSON (and even MessagePack) RPC is the wrong shape for live video: a 60 fps
+/// stream of thousands of LEDs needs the pixel bytes to land in the CRGB
+/// buffer without a DOM, base64 or an intermediate frame copy. A PixelStream
+/// owns a small table of registered targets (CRGB spans or Frames) and
+/// accepts binary pixel frames addressed to them:
+///
+///   channel (u8) | flags (u8) | sequence (u32 LE) | first pixel (u32 LE) | RGB bytes
+///
+/// The serial transport carries them as SerialFrameType::kPixels frames and
+/// writes the RGB bytes into the target as they arrive; HttpStreamTransport
+/// hands complete binary chunks to ingest(). Frames whose sequence number is
+/// older than the last one accepted on their channel are dropped, so a
+/// stalled link never rewinds the strip.
+///
+/// @code
+/// CRGB leds[NUM_LEDS];
+/// fl::PixelStream pixels;
+/// pixels.add("strip", leds);               // channel 0
+/// pixels.onFrame([](fl::u8, fl::u32) { FastLED.show(); });
+/// auto serial = fl::createSerialMuxTransport("REMOTE: ", "", {}, &pixels);
+/// fl::Remote remote(serial.source, serial.sink);
+/// fl::bindPixelStream(remote, pixels);     // pixels.info
+/// @endcode
+
+#include "crgb.h"  // IWYU pragma: keep
+#include "fl/fx/frame.h"
+#include "fl/stl/function.h"
+#include "fl/stl/int.h"
+#include "fl/stl/json.h"
+#include "fl/stl/move.h"
+#include "fl/stl/span.h"
+#include "fl/stl/string.h"
+#include "fl/stl/vector.h"
+#include "fl/stl/noexcept.h"
+
+namespace fl {
+
+class Remote;
+
+/// Frame type byte for pixel frames on binary transports.
+constexpr u8 kPixelFrameType = 'P';
+/// Bytes before the RGB data in a pixel frame payload.
+constexpr fl::size kPixelFrameHeaderSize = 10;
+
+enum PixelFrameFlags : u8 {
+    /// Accept this sequence number unconditionally (host restarted).
+    kPixelFrameRestart = 0x01,
+    /// More chunks with the same sequence number follow; onFrame() waits.
+    kPixelFramePartial = 0x02,
+};
+
+struct PixelStreamStats {
+    u32 applied = 0;   ///< chunks written into a target
+    u32 late = 0;      ///< chunks dropped for an old sequence number
+    u32 rejected = 0;  ///< chunks with a bad header, channel or offset
+};
+
+class PixelStream {
+public:
+    /// Called after the last chunk of a frame has been written.
+    using FrameCallback = fl::function<void(u8 channel, u32 seq)>;
+
+    PixelStream() FL_NO_EXCEPT = default;
+
+    /// Register a target; returns its channel number, or -1 if all 256 are used.
+    int add(const char* name, fl::span<CRGB> target) FL_NO_EXCEPT;
+    /// Register a Frame; the stream keeps it alive.
+    int add(const char* name, fl::shared_ptr<Frame> frame) FL_NO_EXCEPT;
+
+    void onFrame(FrameCallback callback) FL_NO_EXCEPT { mOnFrame = fl::move(callback); }
+
+    /// Start a frame whose header has been received and `bodySize` RGB bytes
+    /// are still to come. Returns where those bytes belong (clipped to the
+    /// target) or an empty span if the frame is dropped; call end() after
+    /// the body either way.
+    fl::span<u8> begin(fl::span<const u8> header, u32 bodySize) FL_NO_EXCEPT;
+    void end() FL_NO_EXCEPT;
+
+    /// Apply one complete payload (header + RGB bytes). Returns false if it
+    /// was dropped.
+    bool ingest(fl::span<const u8> payload) FL_NO_EXCEPT;
+
+    /// Forget sequence numbers so the next frame on every channel is accepted.
+    void resetSequence() FL_NO_EXCEPT;
+
+    const PixelStreamStats& stats() const FL_NO_EXCEPT { return mStats; }
+    fl::size channelCount() const FL_NO_EXCEPT { return mChannels.size(); }
+
+    /// `{"channels": [{"channel", "name", "pixels", "seq"}, ...], "applied",
+    /// "late", "rejected"}` so hosts can discover channel numbers.
+    fl::json info() const FL_NO_EXCEPT;
+
+private:
+    struct Channel {
+        fl::string name;
+        fl::span<CRGB> pixels;
+        fl::shared_ptr<Frame> frame;  // keeps a Frame target alive
+        u32 seq = 0;
+        bool hasSeq = false;
+        bool open = false;  // partial chunks of `seq` are still expected
+    };
+
+    FrameCallback mOnFrame;
+    fl::vector<Channel> mChannels;
+    PixelStreamStats mStats;
+    int mPending = -1;  // channel of the frame between begin() and end()
+    u8 mPendingFlags = 0;
+};
+
+/// @brief Register `pixels.info` (-> PixelStream::info()) on `remote`
+/// @note `pixels` must outlive `remote`.
+void bindPixelStream(Remote& remote, PixelStream& pixels) FL_NO_EXCEPT;
+
+} // namespace fl
@@ -37,16 +37,31 @@ bool Remote::has(const fl::string& name) const {
 // callers don't break, but they're link-DCE-friendly if no caller exists.
 
 #if FL_PLATFORM_HAS_LARGE_MEMORY
-void Remote::sendAsyncResponse(const char* method, const fl::json& result) {
-    fl::string methodName(method);
-    auto it = mAsyncRequests.find(methodName);
-    if (it == mAsyncRequests.end()) {
+namespace {
+constexpr fl::size kMaxPendingAsyncPerMethod = 16;
+} // namespace
+
+bool Remote::takeAsyncRequest(const char* method, bool complete, fl::json& requestId) {
+    auto it = mAsyncRequests.find(fl::string(method));
+    if (it == mAsyncRequests.end() || it->second.empty()) {
         FL_WARN_F("No pending async request for method: %s", method);
-        return;
+        return false;
     }
+    requestId = it->second[0].requestId;
+    if (complete) {
+        it->second.erase(it->second.begin());
+        if (it->second.empty()) {
+            mAsyncRequests.erase(it);
+        }
+    }
+    return true;
+}
 
-    int requestId = it->second.requestId;
-    mAsyncRequests.erase(it);
+void Remote::sendAsyncResponse(const char* method, const fl::json& result) {
+    fl::json requestId;
+    if (!takeAsyncRequest(method, true, requestId)) {
+        return;
+    }
 
     // Build JSON-RPC response
     fl::json response = fl::json::object();
@@ -54,24 +69,16 @@ void Remote::sendAsyncResponse(const char* method, const fl::json& result) {
     response.set("id", requestId);
     response.set("result", result);
 
-    // Send via response sink
-    if (mResponseSink) {
-        mResponseSink(response);
-        FL_DBG_F("Sent async response for %s (id=%s)", method, requestId);
-    }
+    emitResponse(response);
+    FL_DBG_F("Sent async response for %s (id=%s)", method, requestId.to_string());
 }
 
 void Remote::sendStreamUpdate(const char* method, const fl::json& update) {
-    fl::string methodName(method);
-    auto it = mAsyncRequests.find(methodName);
-    if (it == mAsyncRequests.end()) {
-        FL_WARN_F("No pending async request for method: %s", method);
+    fl::json requestId;
+    if (!takeAsyncRequest(method, false, requestId)) {  // stream is still active
         return;
     }
 
-    int requestId = it->second.requestId;
-    // Don't erase - stream is still active
-
     // Build JSON-RPC response with "update" marker
     fl::json response = fl::json::object();
     response.set("jsonrpc", "2.0");
@@ -81,24 +88,16 @@ void Remote::sendStreamUpdate(const char* method, const fl::json& update) {
     resultObj.set("update", update);
     response.set("result", resultObj);
 
-    // Send via response sink
-    if (mResponseSink) {
-        mResponseSink(response);
-        FL_DBG_F("Sent stream update for %s (id=%s)", method, requestId);
-    }
+    emitResponse(response);
+    FL_DBG_F("Sent stream update for %s (id=%s)", method, requestId.to_string());
 }
 
 void Remote::sendStreamFinal(const char* method, const fl::json& result) {
-    fl::string methodName(method);
-    auto it = mAsyncRequests.find(methodName);
-    if (it == mAsyncRequests.end()) {
-        FL_WARN_F("No pending async request for method: %s", method);
+    fl::json requestId;
+    if (!takeAsyncRequest(method, true, requestId)) {  // stream complete
         return;
     }
 
-    int requestId = it->second.requestId;
-    mAsyncRequests.erase(it);  // Stream complete - remove request
-
     // Build JSON-RPC response with "stop" marker
     fl::json response = fl::json::object();
     response.set("jsonrpc", "2.0");
@@ -109,11 +108,8 @@ void Remote::sendStreamFinal(const char* method, const fl::json& result) {
     resultObj.set("stop", true);
     response.set("result", resultObj);
 
-    // Send via response sink
-    if (mResponseSink) {
-        mResponseSink(response);
-        FL_DBG_F("Sent stream final for %s (id=%s)", method, requestId);
-    }
+    emitResponse(response);
+    FL_DBG_F("Sent stream final for %s (id=%s)", method, requestId.to_string());
 }
 #else  // !FL_PLATFORM_HAS_LARGE_MEMORY
 // Low-memory: async-tracking storage is dropped (#3224 Tier 1B RAM-side).
@@ -189,11 +185,17 @@ fl::json Remote::processRpc(const fl::json& request) {
     // running. Low-memory drops the async-tracking machinery (no production
     // LowMemory sketch uses bindAsync / sendAsyncResponse today) -- see
     // #3224 Tier 1B.
-    if (request.contains("id") && request.contains("method")) {
+    const bool storedAsync = request.contains("id") && request.contains("method");
+    if (storedAsync) {
         fl::string methodName = request["method"].as_string().value_or("");
-        int requestId = request["id"].as_int().value_or(0);
-        mAsyncRequests[methodName] = {requestId, receivedAt};
-        FL_DBG_F("Stored request ID for %s (id=%s)", methodName.c_str(), requestId);
+        fl::vector<AsyncRequest>& pending = mAsyncRequests[methodName];
+        // Calls completed through ResponseSend never come back here; cap the
+        // list so they cannot accumulate.
+        if (pending.size() >= kMaxPendingAsyncPerMethod) {
+            pending.erase(pending.begin());
+        }
+        pending.push_back({request["id"], receivedAt});
+        FL_DBG_F("Stored request ID for %s (id=%s)", methodName.c_str(), request["id"].to_string());
     }
 #endif
 
@@ -214,10 +216,16 @@ fl::json Remote::processRpc(const fl::json& request) {
         return nullResponse;
     }
 
-    // For sync functions, remove request ID (not needed)
-    if (request.contains("method")) {
+    // For sync functions, remove the request ID stored above (not needed)
+    if (storedAsync) {
         fl::string methodName = request["method"].as_string().value_or("");
-        mAsyncRequests.erase(methodName);
+        auto it = mAsyncRequests.find(methodName);
+        if (it != mAsyncRequests.end() && !it->second.empty()) {
+            it->second.pop_back();
+            if (it->second.empty()) {
+                mAsyncRequests.erase(it);
+            }
+        }
     }
 #endif
 
@@ -327,10 +335,8 @@ Remote::Remote(RequestSource source, ResponseSink sink, ResponseStreamSink strea
 
     // Set response sink on Rpc for async ACKs
     mRpc.setResponseSink([this](const fl::json& response) {
-        // Send response directly via Server's response sink
-        if (mResponseSink) {
-            mResponseSink(response);
-        }
+        // Send directly (not queued) so async results go out as they complete
+        emitResponse(response);
     });
 
 #if FL_PLATFORM_HAS_LARGE_MEMORY
@@ -339,12 +345,20 @@ Remote::Remote(RequestSource source, ResponseSink sink, ResponseStreamSink strea
             mResponseStreamSink(fl::move(writeJson));
         }
     });
+
+    // Binary requests dispatch straight to Rpc (no scheduling timestamps).
+    setBinaryRequestHandler([this](fl::span<const fl::u8> request, fl::vector<fl::u8>& response) {
+        return mRpc.handleMsgpack(request, response);
+    });
 #endif
 }
 
 // Server Coordination
 
 size_t Remote::update(u32 currentTimeMs) {
+#if FL_PLATFORM_HAS_LARGE_MEMORY
+    mNowMs = currentTimeMs;              // Clock for in-flight timeouts
+#endif
     size_t processed = Server::pull();   // Pull requests from Server
     size_t executed = tick(currentTimeMs);  // Process scheduled tasks
 
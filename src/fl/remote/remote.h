@@ -178,11 +178,12 @@ public:
     // =========================================================================
 
     /// Send async response for a previously-called async method
-    /// The request ID is automatically retrieved from internal storage
+    /// The request ID is automatically retrieved from internal storage; with
+    /// several calls in flight, the oldest one is completed
     void sendAsyncResponse(const char* method, const fl::json& result);
 
     /// Send stream update for a streaming async method (ASYNC_STREAM mode)
-    /// The request ID is automatically retrieved from internal storage
+    /// The request ID is automatically retrieved from internal storage (oldest call)
     void sendStreamUpdate(const char* method, const fl::json& update);
 
     /// Send final stream response for a streaming async method (ASYNC_STREAM mode)
@@ -211,12 +212,14 @@ protected:
     // the corresponding instance state is dead RAM weight. Drop the field
     // declarations entirely on Low-memory to recover several hundred bytes
     // of .bss per Remote instance.
+    // Pipelined calls to one method are completed oldest first.
     struct AsyncRequest {
-        int requestId;
+        fl::json requestId;
         u32 timestamp;
     };
 #if FL_PLATFORM_HAS_LARGE_MEMORY
-    fl::unordered_map<fl::string, AsyncRequest> mAsyncRequests;
+    fl::unordered_map<fl::string, fl::vector<AsyncRequest>> mAsyncRequests;
+    bool takeAsyncRequest(const char* method, bool complete, fl::json& requestId);
     void scheduleFunction(u32 timestamp, u32 receivedAt, const fl::json& jsonRpcRequest);
     void recordResult(const fl::string& funcName, const fl::json& result, u32 scheduledAt, u32 receivedAt, u32 executedAt, bool wasScheduled);
 #endif
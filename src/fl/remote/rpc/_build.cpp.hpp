@@ -3,6 +3,7 @@
 
 #include "fl/remote/rpc/base64.cpp.hpp"
 #include "fl/remote/rpc/json_dispatch.cpp.hpp"
+#include "fl/remote/rpc/msgpack.cpp.hpp"
 #include "fl/remote/rpc/rpc.cpp.hpp"
 #include "fl/remote/rpc/runtime_rpc_binding.cpp.hpp"
 #include "fl/remote/rpc/server.cpp.hpp"
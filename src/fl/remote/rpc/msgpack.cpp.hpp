@@ -0,0 +1,560 @@
+// IWYU pragma: private, include "fl/remote/rpc/msgpack.h"
+
+#include "fl/remote/rpc/msgpack.h"
+#include "fl/stl/cstring.h"  // fl::memcpy
+#include "fl/stl/json/types.h"
+#include "fl/stl/shared_ptr.h"
+#include "fl/stl/string.h"
+
+namespace fl {
+
+namespace {
+// Nesting limit for readJson(); skip() is iterative and has none.
+constexpr int kMsgpackMaxDepth = 32;
+} // namespace
+
+// =============================================================================
+// MsgpackWriter
+// =============================================================================
+
+void MsgpackWriter::putBE(u64 value, int bytes) FL_NO_EXCEPT {
+    for (int shift = (bytes - 1) * 8; shift >= 0; shift -= 8) {
+        mOut.push_back(static_cast<u8>(value >> shift));
+    }
+}
+
+void MsgpackWriter::writeHeader(u8 fix, u8 fixMax, u8 op16, u8 op32, u32 n) FL_NO_EXCEPT {
+    if (n <= fixMax) {
+        mOut.push_back(static_cast<u8>(fix | n));
+    } else if (n <= 0xffff) {
+        mOut.push_back(op16);
+        putBE(n, 2);
+    } else {
+        mOut.push_back(op32);
+        putBE(n, 4);
+    }
+}
+
+void MsgpackWriter::writeNil() FL_NO_EXCEPT { mOut.push_back(0xc0); }
+
+void MsgpackWriter::writeBool(bool value) FL_NO_EXCEPT {
+    mOut.push_back(value ? 0xc3 : 0xc2);
+}
+
+void MsgpackWriter::writeInt(i64 value) FL_NO_EXCEPT {
+    if (value >= 0) {
+        if (value < 0x80) {
+            mOut.push_back(static_cast<u8>(value));
+        } else if (value <= 0xff) {
+            mOut.push_back(0xcc);
+            putBE(static_cast<u64>(value), 1);
+        } else if (value <= 0xffff) {
+            mOut.push_back(0xcd);
+            putBE(static_cast<u64>(value), 2);
+        } else if (value <= 0xffffffffLL) {
+            mOut.push_back(0xce);
+            putBE(static_cast<u64>(value), 4);
+        } else {
+            mOut.push_back(0xcf);
+            putBE(static_cast<u64>(value), 8);
+        }
+    } else if (value >= -32) {
+        mOut.push_back(static_cast<u8>(value));
+    } else if (value >= -128) {
+        mOut.push_back(0xd0);
+        putBE(static_cast<u64>(value), 1);
+    } else if (value >= -32768) {
+        mOut.push_back(0xd1);
+        putBE(static_cast<u64>(value), 2);
+    } else if (value >= -2147483647LL - 1) {
+        mOut.push_back(0xd2);
+        putBE(static_cast<u64>(value), 4);
+    } else {
+        mOut.push_back(0xd3);
+        putBE(static_cast<u64>(value), 8);
+    }
+}
+
+void MsgpackWriter::writeFloat(float value) FL_NO_EXCEPT {
+    u32 bits = 0;
+    fl::memcpy(&bits, &value, sizeof(bits));
+    mOut.push_back(0xca);
+    putBE(bits, 4);
+}
+
+void MsgpackWriter::writeStr(fl::string_view value) FL_NO_EXCEPT {
+    const u32 n = static_cast<u32>(value.size());
+    if (n <= 31) {
+        mOut.push_back(static_cast<u8>(0xa0 | n));
+    } else if (n <= 0xff) {
+        mOut.push_back(0xd9);
+        putBE(n, 1);
+    } else {
+        writeHeader(0, 0, 0xda, 0xdb, n);
+    }
+    const u8* p = reinterpret_cast<const u8*>(value.data());  // ok reinterpret cast
+    mOut.insert(mOut.end(), p, p + n);
+}
+
+void MsgpackWriter::writeBin(fl::span<const u8> value) FL_NO_EXCEPT {
+    const u32 n = static_cast<u32>(value.size());
+    if (n <= 0xff) {
+        mOut.push_back(0xc4);
+        putBE(n, 1);
+    } else {
+        writeHeader(0, 0, 0xc5, 0xc6, n);
+    }
+    mOut.insert(mOut.end(), value.data(), value.data() + n);
+}
+
+void MsgpackWriter::writeArray(u32 count) FL_NO_EXCEPT {
+    writeHeader(0x90, 15, 0xdc, 0xdd, count);
+}
+
+void MsgpackWriter::writeMap(u32 count) FL_NO_EXCEPT {
+    writeHeader(0x80, 15, 0xde, 0xdf, count);
+}
+
+void MsgpackWriter::writeRaw(fl::span<const u8> encoded) FL_NO_EXCEPT {
+    mOut.insert(mOut.end(), encoded.data(), encoded.data() + encoded.size());
+}
+
+void MsgpackWriter::writeJson(const fl::json& value) FL_NO_EXCEPT {
+    const json_value* v = value.internal_value();
+    if (!v) {
+        writeNil();
+        return;
+    }
+    writeValue(*v);
+}
+
+void MsgpackWriter::writeValue(const json_value& value) FL_NO_EXCEPT {
+    if (auto* p = value.data.ptr<bool>()) {
+        writeBool(*p);
+    } else if (auto* p = value.data.ptr<i64>()) {
+        writeInt(*p);
+    } else if (auto* p = value.data.ptr<float>()) {
+        writeFloat(*p);
+    } else if (auto* p = value.data.ptr<fl::string>()) {
+        writeStr(fl::string_view(p->c_str(), p->size()));
+    } else if (auto* p = value.data.ptr<json_array>()) {
+        writeArray(static_cast<u32>(p->size()));
+        for (fl::size i = 0; i < p->size(); ++i) {
+            if ((*p)[i]) {
+                writeValue(*(*p)[i]);
+            } else {
+                writeNil();
+            }
+        }
+    } else if (auto* p = value.data.ptr<json_object>()) {
+        writeMap(static_cast<u32>(p->size()));
+        for (auto it = p->begin(); it != p->end(); ++it) {
+            writeStr(fl::string_view(it->first.c_str(), it->first.size()));
+            if (it->second) {
+                writeValue(*it->second);
+            } else {
+                writeNil();
+            }
+        }
+    } else if (auto* p = value.data.ptr<fl::vector<u8>>()) {
+        writeArray(static_cast<u32>(p->size()));
+        for (fl::size i = 0; i < p->size(); ++i) {
+            writeInt((*p)[i]);
+        }
+    } else if (auto* p = value.data.ptr<fl::vector<i16>>()) {
+        writeArray(static_cast<u32>(p->size()));
+        for (fl::size i = 0; i < p->size(); ++i) {
+            writeInt((*p)[i]);
+        }
+    } else if (auto* p = value.data.ptr<fl::vector<float>>()) {
+        writeArray(static_cast<u32>(p->size()));
+        for (fl::size i = 0; i < p->size(); ++i) {
+            writeFloat((*p)[i]);
+        }
+    } else {
+        writeNil();
+    }
+}
+
+// =============================================================================
+// MsgpackReader
+// =============================================================================
+
+bool MsgpackReader::need(fl::size n) FL_NO_EXCEPT {
+    if (!mOk || mSize - mPos < n) {
+        mOk = false;
+        return false;
+    }
+    return true;
+}
+
+u64 MsgpackReader::getBE(int bytes) FL_NO_EXCEPT {
+    u64 v = 0;
+    for (int i = 0; i < bytes; ++i) {
+        v = (v << 8) | mData[mPos++];
+    }
+    return v;
+}
+
+MsgpackType MsgpackReader::peek() const FL_NO_EXCEPT {
+    if (!mOk || mPos >= mSize) {
+        return MsgpackType::kInvalid;
+    }
+    const u8 b = mData[mPos];
+    if (b <= 0x7f || b >= 0xe0 || (b >= 0xcc && b <= 0xd3)) {
+        return MsgpackType::kInt;
+    }
+    if (b <= 0x8f || b == 0xde || b == 0xdf) {
+        return MsgpackType::kMap;
+    }
+    if (b <= 0x9f || b == 0xdc || b == 0xdd) {
+        return MsgpackType::kArray;
+    }
+    if (b <= 0xbf || (b >= 0xd9 && b <= 0xdb)) {
+        return MsgpackType::kStr;
+    }
+    switch (b) {
+    case 0xc0:
+        return MsgpackType::kNil;
+    case 0xc2:
+    case 0xc3:
+        return MsgpackType::kBool;
+    case 0xc4:
+    case 0xc5:
+    case 0xc6:
+        return MsgpackType::kBin;
+    case 0xca:
+    case 0xcb:
+        return MsgpackType::kFloat;
+    case 0xc1:
+        return MsgpackType::kInvalid;
+    default:
+        return MsgpackType::kExt;  // 0xc7-0xc9, 0xd4-0xd8
+    }
+}
+
+bool MsgpackReader::readNil() FL_NO_EXCEPT {
+    if (peek() != MsgpackType::kNil) {
+        return false;
+    }
+    ++mPos;
+    return true;
+}
+
+bool MsgpackReader::readBool(bool& out) FL_NO_EXCEPT {
+    if (peek() != MsgpackType::kBool) {
+        return false;
+    }
+    out = mData[mPos++] == 0xc3;
+    return true;
+}
+
+bool MsgpackReader::readInt(i64& out) FL_NO_EXCEPT {
+    if (peek() != MsgpackType::kInt) {
+        return false;
+    }
+    const fl::size start = mPos;
+    const u8 b = mData[mPos];
+    if (b <= 0x7f || b >= 0xe0) {
+        out = static_cast<i8>(b);
+        ++mPos;
+        return true;
+    }
+    // 0xcc-0xcf: uint8..uint64, 0xd0-0xd3: int8..int64.
+    const int bytes = 1 << ((b - 0xcc) & 3);
+    if (!need(1 + bytes)) {
+        return false;
+    }
+    ++mPos;
+    const u64 raw = getBE(bytes);
+    if (b <= 0xcf) {
+        if (raw > 0x7fffffffffffffffULL) {
+            mPos = start;
+            return false;
+        }
+        out = static_cast<i64>(raw);
+    } else {
+        switch (bytes) {
+        case 1: out = static_cast<i8>(raw); break;
+        case 2: out = static_cast<i16>(raw); break;
+        case 4: out = static_cast<i32>(raw); break;
+        default: out = static_cast<i64>(raw); break;
+        }
+    }
+    return true;
+}
+
+bool MsgpackReader::readFloat(float& out) FL_NO_EXCEPT {
+    const MsgpackType t = peek();
+    if (t == MsgpackType::kInt) {
+        i64 v = 0;
+        if (!readInt(v)) {
+            return false;
+        }
+        out = static_cast<float>(v);
+        return true;
+    }
+    if (t != MsgpackType::kFloat) {
+        return false;
+    }
+    const bool wide = mData[mPos] == 0xcb;
+    if (!need(wide ? 9 : 5)) {
+        return false;
+    }
+    ++mPos;
+    if (wide) {
+        const u64 bits = getBE(8);
+        double d = 0;
+        fl::memcpy(&d, &bits, sizeof(d));
+        out = static_cast<float>(d);
+    } else {
+        const u32 bits = static_cast<u32>(getBE(4));
+        fl::memcpy(&out, &bits, sizeof(out));
+    }
+    return true;
+}
+
+bool MsgpackReader::readLength(u8 fixBase, u8 fixMask, u8 op8, u8 op16, u8 op32,
+                               u32& out) FL_NO_EXCEPT {
+    if (!need(1)) {
+        return false;
+    }
+    const u8 b = mData[mPos];
+    int bytes = 0;
+    if (fixMask && (b & ~fixMask) == fixBase) {
+        out = b & fixMask;
+        ++mPos;
+        return true;
+    } else if (op8 && b == op8) {
+        bytes = 1;
+    } else if (b == op16) {
+        bytes = 2;
+    } else if (b == op32) {
+        bytes = 4;
+    } else {
+        return false;
+    }
+    if (!need(1 + bytes)) {
+        return false;
+    }
+    ++mPos;
+    out = static_cast<u32>(getBE(bytes));
+    return true;
+}
+
+bool MsgpackReader::readStr(fl::string_view& out) FL_NO_EXCEPT {
+    const fl::size start = mPos;
+    u32 n = 0;
+    if (!readLength(0xa0, 0x1f, 0xd9, 0xda, 0xdb, n)) {
+        return false;
+    }
+    if (!need(n)) {
+        mPos = start;
+        return false;
+    }
+    out = fl::string_view(reinterpret_cast<const char*>(mData + mPos), n);  // ok reinterpret cast
+    mPos += n;
+    return true;
+}
+
+bool MsgpackReader::readBin(fl::span<const u8>& out) FL_NO_EXCEPT {
+    const fl::size start = mPos;
+    u32 n = 0;
+    if (!readLength(0, 0, 0xc4, 0xc5, 0xc6, n)) {
+        return false;
+    }
+    if (!need(n)) {
+        mPos = start;
+        return false;
+    }
+    out = fl::span<const u8>(mData + mPos, n);
+    mPos += n;
+    return true;
+}
+
+bool MsgpackReader::readArray(u32& count) FL_NO_EXCEPT {
+    return readLength(0x90, 0x0f, 0, 0xdc, 0xdd, count);
+}
+
+bool MsgpackReader::readMap(u32& count) FL_NO_EXCEPT {
+    return readLength(0x80, 0x0f, 0, 0xde, 0xdf, count);
+}
+
+bool MsgpackReader::skip() FL_NO_EXCEPT {
+    u64 pending = 1;
+    while (pending > 0) {
+        if (!need(1)) {
+            return false;
+        }
+        --pending;
+        const u8 b = mData[mPos];
+        fl::size header = 1;
+        int lenBytes = 0;  // width of a length field following the opcode
+        u64 children = 0;
+        if (b <= 0x7f || b >= 0xe0 || b == 0xc0 || b == 0xc2 || b == 0xc3) {
+            // single byte
+        } else if (b <= 0x8f) {
+            children = 2u * (b & 0x0f);
+        } else if (b <= 0x9f) {
+            children = b & 0x0f;
+        } else if (b <= 0xbf) {
+            header += b & 0x1f;
+        } else {
+            switch (b) {
+            case 0xc4: case 0xd9: lenBytes = 1; break;
+            case 0xc5: case 0xda: lenBytes = 2; break;
+            case 0xc6: case 0xdb: lenBytes = 4; break;
+            case 0xc7: lenBytes = 1; header += 1; break;  // ext: length then type
+            case 0xc8: lenBytes = 2; header += 1; break;
+            case 0xc9: lenBytes = 4; header += 1; break;
+            case 0xca: header += 4; break;
+            case 0xcb: header += 8; break;
+            case 0xcc: case 0xd0: header += 1; break;
+            case 0xcd: case 0xd1: header += 2; break;
+            case 0xce: case 0xd2: header += 4; break;
+            case 0xcf: case 0xd3: header += 8; break;
+            case 0xd4: header += 2; break;
+            case 0xd5: header += 3; break;
+            case 0xd6: header += 5; break;
+            case 0xd7: header += 9; break;
+            case 0xd8: header += 17; break;
+            case 0xdc: case 0xdd: case 0xde: case 0xdf: {
+                const int w = (b & 1) ? 4 : 2;
+                if (!need(1 + w)) {
+                    return false;
+                }
+                ++mPos;
+                children = getBE(w);
+                if (b >= 0xde) {
+                    children *= 2;
+                }
+                header = 0;
+                break;
+            }
+            default:  // 0xc1 is never used
+                mOk = false;
+                return false;
+            }
+        }
+        if (lenBytes) {
+            if (!need(1 + lenBytes)) {
+                return false;
+            }
+            ++mPos;
+            header += getBE(lenBytes) - 1;
+        }
+        if (!need(header)) {
+            return false;
+        }
+        mPos += header;
+        pending += children;
+        // Every value takes at least one byte, so a count larger than the
+        // rest of the buffer is malformed; this also bounds the loop.
+        if (pending > mSize - mPos) {
+            mOk = false;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool MsgpackReader::skip(fl::span<const u8>& encoded) FL_NO_EXCEPT {
+    const fl::size start = mPos;
+    if (!skip()) {
+        return false;
+    }
+    encoded = fl::span<const u8>(mData + start, mPos - start);
+    return true;
+}
+
+bool MsgpackReader::readJson(fl::json& out) FL_NO_EXCEPT {
+    return readJsonDepth(out, 0);
+}
+
+bool MsgpackReader::readJsonDepth(fl::json& out, int depth) FL_NO_EXCEPT {
+    if (depth > kMsgpackMaxDepth) {
+        mOk = false;
+        return false;
+    }
+    switch (peek()) {
+    case MsgpackType::kNil:
+        readNil();
+        out = fl::json(nullptr);
+        return true;
+    case MsgpackType::kBool: {
+        bool b = false;
+        readBool(b);
+        out = fl::json(b);
+        return true;
+    }
+    case MsgpackType::kInt: {
+        i64 v = 0;
+        if (!readInt(v)) {
+            return false;
+        }
+        out = fl::json(v);
+        return true;
+    }
+    case MsgpackType::kFloat: {
+        float f = 0;
+        if (!readFloat(f)) {
+            return false;
+        }
+        out = fl::json(f);
+        return true;
+    }
+    case MsgpackType::kStr: {
+        fl::string_view s;
+        if (!readStr(s)) {
+            return false;
+        }
+        out = fl::json(fl::string(s.data(), s.size()));
+        return true;
+    }
+    case MsgpackType::kBin: {
+        fl::span<const u8> bytes;
+        if (!readBin(bytes)) {
+            return false;
+        }
+        out = fl::json(fl::make_shared<json_value>(
+            fl::vector<u8>(bytes.data(), bytes.data() + bytes.size())));
+        return true;
+    }
+    case MsgpackType::kArray: {
+        u32 n = 0;
+        if (!readArray(n)) {
+            return false;
+        }
+        out = fl::json::array();
+        for (u32 i = 0; i < n; ++i) {
+            fl::json item;
+            if (!readJsonDepth(item, depth + 1)) {
+                return false;
+            }
+            out.push_back(item);
+        }
+        return true;
+    }
+    case MsgpackType::kMap: {
+        u32 n = 0;
+        if (!readMap(n)) {
+            return false;
+        }
+        out = fl::json::object();
+        for (u32 i = 0; i < n; ++i) {
+            fl::string_view key;
+            fl::json item;
+            if (!readStr(key) || !readJsonDepth(item, depth + 1)) {
+                mOk = false;
+                return false;
+            }
+            out.set(fl::string(key.data(), key.size()), item);
+        }
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+} // namespace fl
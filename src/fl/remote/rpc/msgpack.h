@@ -0,0 +1,109 @@
+#pragma once
+
+#include "fl/stl/int.h"
+#include "fl/stl/json.h"
+#include "fl/stl/span.h"
+#include "fl/stl/string_view.h"
+#include "fl/stl/vector.h"
+#include "fl/stl/noexcept.h"
+
+namespace fl {
+
+// =============================================================================
+// MessagePack codec for binary RPC framing
+// =============================================================================
+//
+// Compact binary alternative to JSON text for fl::Rpc. Byte arrays travel as
+// MessagePack `bin` (no base64), numbers as 1-9 byte integers or float32, and
+// typed RPC bindings decode arguments straight from the buffer into their
+// argument tuple without building an fl::json tree.
+//
+// Only the subset RPC needs is produced: nil, bool, int, float32, str, bin,
+// array and map. The reader accepts every MessagePack format; float64 is
+// narrowed to float and ext values can only be skipped.
+
+enum class MsgpackType : u8 {
+    kNil,
+    kBool,
+    kInt,
+    kFloat,
+    kStr,
+    kBin,
+    kArray,
+    kMap,
+    kExt,
+    kInvalid,  // truncated input or the reserved 0xC1 byte
+};
+
+/// Appends MessagePack values to a caller-owned byte vector, so one buffer
+/// can be reused across responses without reallocating.
+class MsgpackWriter {
+public:
+    explicit MsgpackWriter(fl::vector<u8>& out) FL_NO_EXCEPT : mOut(out) {}
+
+    void writeNil() FL_NO_EXCEPT;
+    void writeBool(bool value) FL_NO_EXCEPT;
+    void writeInt(i64 value) FL_NO_EXCEPT;  // smallest encoding that fits
+    void writeFloat(float value) FL_NO_EXCEPT;
+    void writeStr(fl::string_view value) FL_NO_EXCEPT;
+    void writeBin(fl::span<const u8> value) FL_NO_EXCEPT;
+    void writeArray(u32 count) FL_NO_EXCEPT;  // followed by `count` values
+    void writeMap(u32 count) FL_NO_EXCEPT;    // followed by `count` key/value pairs
+    /// Copies already-encoded MessagePack (for example a request id).
+    void writeRaw(fl::span<const u8> encoded) FL_NO_EXCEPT;
+    /// Encodes a JSON value. Packed numeric arrays stay arrays of numbers.
+    void writeJson(const fl::json& value) FL_NO_EXCEPT;
+
+    fl::vector<u8>& buffer() FL_NO_EXCEPT { return mOut; }
+
+private:
+    void writeHeader(u8 fix, u8 fixMax, u8 op16, u8 op32, u32 n) FL_NO_EXCEPT;
+    void writeValue(const json_value& value) FL_NO_EXCEPT;
+    void putBE(u64 value, int bytes) FL_NO_EXCEPT;
+
+    fl::vector<u8>& mOut;
+};
+
+/// Forward-only cursor over an encoded buffer. Typed reads return false and
+/// leave the cursor in place when the next value has a different type;
+/// truncated input makes every later read fail (see ok()).
+class MsgpackReader {
+public:
+    explicit MsgpackReader(fl::span<const u8> data) FL_NO_EXCEPT
+        : mData(data.data()), mSize(data.size()), mPos(0), mOk(true) {}
+
+    MsgpackType peek() const FL_NO_EXCEPT;
+
+    bool readNil() FL_NO_EXCEPT;
+    bool readBool(bool& out) FL_NO_EXCEPT;
+    bool readInt(i64& out) FL_NO_EXCEPT;  // fails for uint64 above INT64_MAX
+    bool readFloat(float& out) FL_NO_EXCEPT;
+    bool readStr(fl::string_view& out) FL_NO_EXCEPT;  // view into the buffer
+    bool readBin(fl::span<const u8>& out) FL_NO_EXCEPT;  // view into the buffer
+    bool readArray(u32& count) FL_NO_EXCEPT;
+    bool readMap(u32& count) FL_NO_EXCEPT;
+
+    /// Skips one complete value, containers included, without recursion.
+    bool skip() FL_NO_EXCEPT;
+    /// Skips one value and returns its encoded bytes.
+    bool skip(fl::span<const u8>& encoded) FL_NO_EXCEPT;
+    /// Decodes one value into a JSON tree; bin becomes a byte array.
+    bool readJson(fl::json& out) FL_NO_EXCEPT;
+
+    bool ok() const FL_NO_EXCEPT { return mOk; }
+    bool atEnd() const FL_NO_EXCEPT { return mPos >= mSize; }
+    fl::size position() const FL_NO_EXCEPT { return mPos; }
+
+private:
+    bool need(fl::size n) FL_NO_EXCEPT;
+    u64 getBE(int bytes) FL_NO_EXCEPT;
+    bool readLength(u8 fixBase, u8 fixMask, u8 op8, u8 op16, u8 op32, u32& out) FL_NO_EXCEPT;
+    bool readJsonDepth(fl::json& out, int depth) FL_NO_EXCEPT;
+
+    const u8* mData;
+    fl::size mSize;
+    fl::size mPos;
+    bool mOk;
+};
+
+} // namespace fl
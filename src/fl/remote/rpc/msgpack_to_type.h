@@ -0,0 +1,332 @@
+#pragma once
+
+#include "fl/stl/json.h"
+#include "fl/stl/int.h"
+#include "fl/stl/string.h"
+#include "fl/stl/tuple.h"
+#include "fl/stl/type_traits.h"
+#include "fl/stl/vector.h"
+#include "fl/remote/rpc/json_arg_converter.h"  // rpc_storage_type, ConstSpanWrapper
+#include "fl/remote/rpc/msgpack.h"
+#include "fl/remote/rpc/type_conversion_result.h"
+#include "fl/remote/rpc/type_to_json.h"
+#include "fl/stl/noexcept.h"
+
+namespace fl {
+namespace detail {
+
+// =============================================================================
+// MsgpackToType - Decode one MessagePack value straight into a typed slot
+// =============================================================================
+//
+// Binary counterpart of JsonToType. Values are read from the request buffer
+// into the argument tuple in place; no fl::json tree is built. Coercions
+// mirror the JSON converters (bool <-> int, int -> float) with the same
+// warnings, but strings are never parsed as numbers: binary clients are
+// expected to send typed values.
+
+template <typename T, typename Enable = void>
+struct MsgpackToType {
+    static TypeConversionResult read(MsgpackReader& r, T& out) {
+        // Anything JsonToType understands still works, via a small DOM.
+        fl::json j;
+        if (!r.readJson(j)) {
+            return TypeConversionResult::error("malformed value");
+        }
+        fl::tuple<T, TypeConversionResult> conv = JsonToType<T>::convert(j);
+        out = fl::get<0>(conv);
+        return fl::get<1>(conv);
+    }
+};
+
+template <typename T>
+struct MsgpackToType<T, typename fl::enable_if<fl::is_integral<T>::value && !fl::is_same<T, bool>::value>::type> {
+    static TypeConversionResult read(MsgpackReader& r, T& out) {
+        TypeConversionResult result;
+        i64 raw = 0;
+        bool b = false;
+        float f = 0.0f;
+        if (r.readInt(raw)) {
+            // exact
+        } else if (r.readBool(b)) {
+            raw = b ? 1 : 0;
+            result.addWarning(fl::string("bool converted to int ") + fl::to_string(raw));
+        } else if (r.peek() == MsgpackType::kFloat && r.readFloat(f)) {
+            raw = static_cast<i64>(f);
+            if (f != static_cast<float>(raw)) {
+                result.addWarning(fl::string("float ") + fl::to_string(f, 6) +
+                                  " truncated to int " + fl::to_string(raw));
+            }
+        } else {
+            result.setError("expected integer");
+            return result;
+        }
+        out = static_cast<T>(raw);
+        if (static_cast<i64>(out) != raw) {
+            result.addWarning(fl::string("integer overflow/truncation: ") +
+                              fl::to_string(raw) + " converted to " +
+                              fl::to_string(static_cast<i64>(out)));
+        }
+        return result;
+    }
+};
+
+template <>
+struct MsgpackToType<bool, void> {
+    static TypeConversionResult read(MsgpackReader& r, bool& out) {
+        TypeConversionResult result;
+        i64 raw = 0;
+        if (r.readBool(out)) {
+            return result;
+        }
+        if (r.readInt(raw)) {
+            out = raw != 0;
+            result.addWarning(fl::string("int ") + fl::to_string(raw) +
+                              " converted to bool " + (out ? "true" : "false"));
+            return result;
+        }
+        result.setError("expected bool");
+        return result;
+    }
+};
+
+template <typename T>
+struct MsgpackToType<T, typename fl::enable_if<fl::is_floating_point<T>::value>::type> {
+    static TypeConversionResult read(MsgpackReader& r, T& out) {
+        TypeConversionResult result;
+        float raw = 0.0f;
+        bool b = false;
+        if (r.readFloat(raw)) {
+            out = static_cast<T>(raw);
+        } else if (r.readBool(b)) {
+            out = b ? T(1) : T(0);
+            result.addWarning(fl::string("bool converted to float ") + (b ? "1.0" : "0.0"));
+        } else {
+            result.setError("expected number");
+        }
+        return result;
+    }
+};
+
+template <>
+struct MsgpackToType<fl::string, void> {
+    static TypeConversionResult read(MsgpackReader& r, fl::string& out) {
+        fl::string_view s;
+        if (!r.readStr(s)) {
+            return TypeConversionResult::error("expected string");
+        }
+        out.assign(s.data(), s.size());
+        return TypeConversionResult();
+    }
+};
+
+template <>
+struct MsgpackToType<fl::ConstCharPtrWrapper, void> {
+    static TypeConversionResult read(MsgpackReader& r, fl::ConstCharPtrWrapper& out) {
+        return MsgpackToType<fl::string>::read(r, out.value);
+    }
+};
+
+template <>
+struct MsgpackToType<fl::json, void> {
+    static TypeConversionResult read(MsgpackReader& r, fl::json& out) {
+        if (!r.readJson(out)) {
+            return TypeConversionResult::error("malformed value");
+        }
+        return TypeConversionResult();
+    }
+};
+
+template <typename T>
+struct MsgpackToType<fl::vector<T>, void> {
+    static TypeConversionResult read(MsgpackReader& r, fl::vector<T>& out) {
+        TypeConversionResult result;
+        u32 n = 0;
+        if (!r.readArray(n)) {
+            result.setError("expected array for vector parameter");
+            return result;
+        }
+        out.clear();
+        out.reserve(n);
+        for (u32 i = 0; i < n; ++i) {
+            T elem{};
+            TypeConversionResult elemResult = MsgpackToType<T>::read(r, elem);
+            if (elemResult.hasError()) {
+                result.setError("element " + fl::to_string(static_cast<i64>(i)) + ": " +
+                                elemResult.errorMessage());
+                return result;
+            }
+            out.push_back(fl::move(elem));
+        }
+        return result;
+    }
+};
+
+// Byte vectors take MessagePack bin directly (one memcpy, no base64), or an
+// array of small integers.
+template <>
+struct MsgpackToType<fl::vector<fl::u8>, void> {
+    static TypeConversionResult read(MsgpackReader& r, fl::vector<fl::u8>& out) {
+        fl::span<const u8> bytes;
+        if (r.readBin(bytes)) {
+            out.assign(bytes.data(), bytes.data() + bytes.size());
+            return TypeConversionResult();
+        }
+        if (r.peek() != MsgpackType::kArray) {
+            return TypeConversionResult::error("expected bin or integer array for byte vector");
+        }
+        TypeConversionResult result;
+        u32 n = 0;
+        r.readArray(n);
+        out.clear();
+        out.reserve(n);
+        for (u32 i = 0; i < n; ++i) {
+            i64 v = 0;
+            if (!r.readInt(v)) {
+                result.setError("element " + fl::to_string(static_cast<i64>(i)) + ": expected integer");
+                return result;
+            }
+            out.push_back(static_cast<u8>(v));
+        }
+        return result;
+    }
+};
+
+template <typename T>
+struct MsgpackToType<fl::ConstSpanWrapper<T>, void> {
+    static TypeConversionResult read(MsgpackReader& r, fl::ConstSpanWrapper<T>& out) {
+        return MsgpackToType<fl::vector<T>>::read(r, out.value);
+    }
+};
+
+// =============================================================================
+// TypeToMsgpack - Encode a return value
+// =============================================================================
+
+template <typename T, typename Enable = void>
+struct TypeToMsgpack {
+    static void write(MsgpackWriter& w, const T& value) {
+        w.writeJson(TypeToJson<T>::convert(value));
+    }
+};
+
+template <typename T>
+struct TypeToMsgpack<T, typename fl::enable_if<fl::is_integral<T>::value && !fl::is_same<T, bool>::value>::type> {
+    static void write(MsgpackWriter& w, const T& value) {
+        w.writeInt(static_cast<i64>(value));
+    }
+};
+
+template <>
+struct TypeToMsgpack<bool, void> {
+    static void write(MsgpackWriter& w, const bool& value) { w.writeBool(value); }
+};
+
+template <typename T>
+struct TypeToMsgpack<T, typename fl::enable_if<fl::is_floating_point<T>::value>::type> {
+    static void write(MsgpackWriter& w, const T& value) {
+        w.writeFloat(static_cast<float>(value));
+    }
+};
+
+template <>
+struct TypeToMsgpack<fl::string, void> {
+    static void write(MsgpackWriter& w, const fl::string& value) {
+        w.writeStr(fl::string_view(value.c_str(), value.size()));
+    }
+};
+
+template <>
+struct TypeToMsgpack<fl::json, void> {
+    static void write(MsgpackWriter& w, const fl::json& value) { w.writeJson(value); }
+};
+
+template <>
+struct TypeToMsgpack<fl::vector<fl::u8>, void> {
+    static void write(MsgpackWriter& w, const fl::vector<fl::u8>& value) {
+        w.writeBin(fl::span<const u8>(value.data(), value.size()));
+    }
+};
+
+template <typename T>
+struct TypeToMsgpack<fl::vector<T>, void> {
+    static void write(MsgpackWriter& w, const fl::vector<T>& value) {
+        w.writeArray(static_cast<u32>(value.size()));
+        for (fl::size i = 0; i < value.size(); ++i) {
+            TypeToMsgpack<T>::write(w, value[i]);
+        }
+    }
+};
+
+} // namespace detail
+
+// =============================================================================
+// MsgpackArgConverter - Decode a MessagePack params array into a typed tuple
+// =============================================================================
+
+template <typename Signature>
+class MsgpackArgConverter;
+
+template <typename R, typename... Args>
+class MsgpackArgConverter<R(Args...)> {
+public:
+    using args_tuple = typename JsonArgConverter<R(Args...)>::args_tuple;
+
+    static TypeConversionResult convert(MsgpackReader& r, args_tuple& tuple) {
+        TypeConversionResult result;
+        u32 count = 0;
+        if (!r.readArray(count)) {
+            result.setError("arguments must be an array");
+            return result;
+        }
+        if (count != sizeof...(Args)) {
+            result.setError("argument count mismatch: expected " +
+                            fl::to_string(static_cast<i64>(sizeof...(Args))) +
+                            ", got " + fl::to_string(static_cast<i64>(count)));
+            return result;
+        }
+        convertArgs(r, tuple, result, make_index_sequence<sizeof...(Args)>{});
+        return result;
+    }
+
+private:
+    template <fl::size... Is>
+    static void convertArgs(MsgpackReader& r, args_tuple& tuple,
+                            TypeConversionResult& result, index_sequence<Is...>) {
+        int dummy[] = {0, (convertArg<Is>(r, tuple, result), 0)...};
+        (void)dummy;
+    }
+
+    template <fl::size I>
+    static void convertArg(MsgpackReader& r, args_tuple& tuple, TypeConversionResult& result) {
+        if (result.hasError()) return;
+        using StorageType = typename fl::tuple_element<I, args_tuple>::type;
+        TypeConversionResult conv = detail::MsgpackToType<StorageType>::read(r, fl::get<I>(tuple));
+        for (fl::size i = 0; i < conv.warnings().size(); i++) {
+            result.addWarning("arg " + fl::to_string(static_cast<i64>(I)) + ": " + conv.warnings()[i]);
+        }
+        if (conv.hasError()) {
+            result.setError("arg " + fl::to_string(static_cast<i64>(I)) + ": " + conv.errorMessage());
+        }
+    }
+};
+
+template <typename R>
+class MsgpackArgConverter<R()> {
+public:
+    using args_tuple = fl::tuple<>;
+
+    static TypeConversionResult convert(MsgpackReader& r, args_tuple&) {
+        TypeConversionResult result;
+        u32 count = 0;
+        if (!r.readArray(count)) {
+            result.setError("arguments must be an array");
+        } else if (count != 0) {
+            result.setError("argument count mismatch: expected 0, got " +
+                            fl::to_string(static_cast<i64>(count)));
+        }
+        return result;
+    }
+};
+
+} // namespace fl
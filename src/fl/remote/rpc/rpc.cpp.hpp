@@ -3,6 +3,7 @@
 #include "fl/stl/json.h"
 #include "fl/log/log.h"
 #include "fl/system/sketch_macros.h"  // FL_PLATFORM_HAS_LARGE_MEMORY -- gates rpc.discover
+#include "fl/remote/rpc/msgpack.h"
 #include "fl/remote/rpc/rpc_invokers.h"
 #include "fl/remote/rpc/rpc_registry.h"
 #include "fl/remote/rpc/response_send.h"
@@ -109,12 +110,14 @@ void Rpc::bindStreaming(const char* name, fl::StreamingRpcHandler fn) FL_NO_EXCE
 // no-FPU targets where every `.text` byte counts. Large-memory targets
 // keep the descriptive form; Low-memory targets use the short form.
 #if FL_PLATFORM_HAS_LARGE_MEMORY
+#  define FL_RPC_ERR_INVALID_REQUEST "Invalid Request"
 #  define FL_RPC_ERR_NO_METHOD       "Invalid Request: missing 'method'"
 #  define FL_RPC_ERR_METHOD_NOT_STR  "Invalid Request: 'method' must be a string"
 #  define FL_RPC_ERR_METHOD_NOT_FOUND_PREFIX "Method not found: "
 #  define FL_RPC_ERR_PARAMS_NOT_ARRAY "Invalid params: must be an array"
 #  define FL_RPC_ERR_INVALID_PARAMS_PREFIX  "Invalid params: "
 #else
+#  define FL_RPC_ERR_INVALID_REQUEST "request"
 #  define FL_RPC_ERR_NO_METHOD       "method"
 #  define FL_RPC_ERR_METHOD_NOT_STR  "method"
 #  define FL_RPC_ERR_METHOD_NOT_FOUND_PREFIX "404: "
@@ -316,6 +319,166 @@ fl::optional<json> Rpc::handle_maybe(const json& request) {
     return handle(request);
 }
 
+// =============================================================================
+// Rpc::handleMsgpack() - Process MessagePack-encoded requests
+// =============================================================================
+
+#if FL_PLATFORM_HAS_LARGE_MEMORY
+namespace {
+
+// Envelope writer for binary responses. The request id is echoed as its raw
+// encoded bytes, so any id type round-trips without decoding.
+struct MsgpackEnvelope {
+    MsgpackWriter writer;
+    fl::span<const fl::u8> id;
+    bool hasId;
+
+    MsgpackEnvelope(fl::vector<fl::u8>& out, fl::span<const fl::u8> reqId, bool withId) FL_NO_EXCEPT
+        : writer(out), id(reqId), hasId(withId) {}
+
+    void beginResult(u32 fields) FL_NO_EXCEPT {
+        writer.writeMap(fields);
+        writeId();
+        writer.writeStr("result");
+    }
+
+    void error(int code, const fl::string& message) FL_NO_EXCEPT {
+        writer.writeMap(2);
+        writeId();
+        writer.writeStr("error");
+        writer.writeMap(2);
+        writer.writeStr("code");
+        writer.writeInt(code);
+        writer.writeStr("message");
+        writer.writeStr(fl::string_view(message.c_str(), message.size()));
+    }
+
+    void writeId() FL_NO_EXCEPT {
+        writer.writeStr("id");
+        if (hasId) {
+            writer.writeRaw(id);
+        } else {
+            writer.writeNil();
+        }
+    }
+};
+
+} // namespace
+
+bool Rpc::handleMsgpack(fl::span<const fl::u8> request, fl::vector<fl::u8>& response) FL_NO_EXCEPT {
+    static const fl::u8 kNoParams[] = {0x90};  // empty array
+
+    MsgpackReader reader(request);
+    fl::string_view method;
+    fl::span<const fl::u8> id;
+    fl::span<const fl::u8> params(kNoParams, sizeof(kNoParams));
+    bool hasId = false;
+    bool methodSeen = false;
+    bool hasMethod = false;
+    bool valid = true;
+
+    // Scan the envelope in any key order, keeping views into the buffer.
+    u32 fields = 0;
+    if (!reader.readMap(fields)) {
+        valid = false;
+    }
+    for (u32 i = 0; valid && i < fields; ++i) {
+        fl::string_view key;
+        if (!reader.readStr(key)) {
+            valid = false;
+        } else if (key == "method") {
+            methodSeen = true;
+            hasMethod = reader.readStr(method);
+            valid = hasMethod;
+        } else if (key == "id") {
+            hasId = reader.skip(id);
+            valid = hasId;
+        } else if (key == "params") {
+            valid = reader.skip(params);
+        } else {
+            valid = reader.skip();
+        }
+    }
+
+    MsgpackEnvelope envelope(response, id, hasId);
+    if (!valid || !hasMethod) {
+        FL_ERROR_F("RPC: Invalid binary request");
+        if (valid) {
+            envelope.error(-32600, FL_RPC_ERR_NO_METHOD);
+        } else if (methodSeen && !hasMethod) {
+            envelope.error(-32600, FL_RPC_ERR_METHOD_NOT_STR);
+        } else {
+            envelope.error(-32600, FL_RPC_ERR_INVALID_REQUEST);
+        }
+        return true;
+    }
+
+    if (method == "rpc.discover") {
+        if (hasId) {
+            envelope.beginResult(2);
+            envelope.writer.writeJson(schema());
+        }
+        return hasId;
+    }
+
+    fl::string methodName(method.data(), method.size());
+    auto it = mRegistry.find(methodName);
+    if (it == mRegistry.end()) {
+        FL_WARN_F("RPC: Method not found: %s", methodName.c_str());
+        if (!hasId) {
+            return false;
+        }
+        envelope.error(-32601, fl::string(FL_RPC_ERR_METHOD_NOT_FOUND_PREFIX) + methodName);
+        return true;
+    }
+
+    const detail::RpcEntry& entry = it->second;
+    MsgpackReader args(params);
+    TypeConversionResult conv;
+    // The result goes to a scratch buffer: warnings are only known after
+    // the call, and they change the envelope's field count.
+    fl::vector<fl::u8> result;
+    if (entry.mIsStreaming || entry.mIsResponseAware) {
+        // These write JSON to their own sinks; they have no binary form.
+        conv.setError("method requires JSON encoding");
+    } else if (args.peek() != MsgpackType::kArray) {
+        conv.setError(FL_RPC_ERR_PARAMS_NOT_ARRAY);
+    } else {
+        MsgpackWriter resultWriter(result);
+        conv = entry.mInvoker->invokeMsgpack(args, resultWriter);
+    }
+
+    if (!conv.ok()) {
+        FL_ERROR_F("RPC: Invalid params for method '%s': %s", methodName.c_str(), conv.errorMessage().c_str());
+        if (!hasId) {
+            return false;
+        }
+        envelope.error(-32602, fl::string(FL_RPC_ERR_INVALID_PARAMS_PREFIX) + conv.errorMessage());
+        return true;
+    }
+    if (!hasId) {
+        return false;
+    }
+    envelope.beginResult(conv.hasWarning() ? 3 : 2);
+    envelope.writer.writeRaw(result);
+    if (conv.hasWarning()) {
+        envelope.writer.writeStr("warnings");
+        envelope.writer.writeArray(static_cast<u32>(conv.warnings().size()));
+        for (fl::size i = 0; i < conv.warnings().size(); ++i) {
+            const fl::string& w = conv.warnings()[i];
+            envelope.writer.writeStr(fl::string_view(w.c_str(), w.size()));
+        }
+    }
+    return true;
+}
+#else
+bool Rpc::handleMsgpack(fl::span<const fl::u8> request, fl::vector<fl::u8>& response) FL_NO_EXCEPT {
+    (void)request;
+    (void)response;
+    return false;
+}
+#endif
+
 // =============================================================================
 // Rpc::tags() - Returns list of unique tags
 // =============================================================================
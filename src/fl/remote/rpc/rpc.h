@@ -89,6 +89,7 @@
 #include "fl/stl/unordered_map.h"
 #include "fl/stl/type_traits.h"
 #include "fl/stl/initializer_list.h"  // IWYU pragma: keep
+#include "fl/stl/span.h"
 #include "fl/stl/noexcept.h"
 
 namespace fl {
@@ -327,6 +328,14 @@ public:
     /// For notifications (no id), returns nullopt.
     fl::optional<json> handle_maybe(const json& request);
 
+    /// Process a MessagePack-encoded request (see fl/remote/rpc/msgpack.h).
+    /// Request:  map {"method": str, "params": array, "id": any}
+    /// Response: map {"id": ..., "result": ...} or {"id": ..., "error": {"code", "message"}}
+    /// Typed methods decode params straight into their argument tuple. The
+    /// response is appended to `response`; returns false when there is none
+    /// (notifications without an id). Large-memory targets only.
+    bool handleMsgpack(fl::span<const fl::u8> request, fl::vector<fl::u8>& response) FL_NO_EXCEPT;
+
     // =========================================================================
     // Schema and Discovery
     // =========================================================================
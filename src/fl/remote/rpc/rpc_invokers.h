@@ -4,9 +4,11 @@
 #include "fl/stl/tuple.h"
 #include "fl/stl/function.h"
 #include "fl/stl/vector.h"
+#include "fl/remote/rpc/msgpack.h"
 #include "fl/remote/rpc/type_conversion_result.h"
 #include "fl/remote/rpc/typed_rpc_binding.h"
 #include "fl/remote/rpc/type_schema.h"
+#include "fl/system/sketch_macros.h"
 #include "fl/stl/noexcept.h"
 
 namespace fl {
@@ -32,6 +34,23 @@ class ErasedInvoker {
 public:
     virtual ~ErasedInvoker() FL_NO_EXCEPT = default;
     virtual fl::tuple<TypeConversionResult, json> invoke(const json& args) = 0;
+
+#if FL_PLATFORM_HAS_LARGE_MEMORY
+    // Binary transport: `args` is positioned on the MessagePack params array
+    // and the result value is appended to `out`. The default round-trips
+    // through fl::json; TypedInvoker decodes in place instead.
+    virtual TypeConversionResult invokeMsgpack(MsgpackReader& args, MsgpackWriter& out) {
+        json jsonArgs;
+        if (!args.readJson(jsonArgs)) {
+            return TypeConversionResult::error("malformed params");
+        }
+        fl::tuple<TypeConversionResult, json> result = invoke(jsonArgs);
+        if (fl::get<0>(result).ok()) {
+            out.writeJson(fl::get<1>(result));
+        }
+        return fl::get<0>(result);
+    }
+#endif
 };
 
 // =============================================================================
@@ -89,6 +108,12 @@ public:
         return mBinding.invokeWithReturn(args);
     }
 
+#if FL_PLATFORM_HAS_LARGE_MEMORY
+    TypeConversionResult invokeMsgpack(MsgpackReader& args, MsgpackWriter& out) override {
+        return mBinding.invokeMsgpack(args, out);
+    }
+#endif
+
 private:
     TypedRpcBinding<R(Args...)> mBinding;
 };
@@ -104,6 +129,12 @@ public:
         return fl::make_tuple(result, json(nullptr));
     }
 
+#if FL_PLATFORM_HAS_LARGE_MEMORY
+    TypeConversionResult invokeMsgpack(MsgpackReader& args, MsgpackWriter& out) override {
+        return mBinding.invokeMsgpack(args, out);
+    }
+#endif
+
 private:
     TypedRpcBinding<void(Args...)> mBinding;
 };
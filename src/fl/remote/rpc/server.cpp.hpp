@@ -1,8 +1,11 @@
 #include "fl/remote/rpc/server.h"
+#include "fl/log/log.h"
+#include "fl/stl/chrono.h"
 #include "fl/stl/json.h"
 #include "fl/stl/cstddef.h"
 #include "fl/stl/move.h"
 #include "fl/stl/optional.h"
+#include "fl/stl/span.h"
 #include "fl/stl/vector.h"
 
 namespace fl {
@@ -37,19 +40,232 @@ void Server::setResponseStreamSink(ResponseStreamSink sink) FL_NO_EXCEPT {
 #endif
 }
 
+void Server::setBinaryRequestSource(BinaryRequestSource source) FL_NO_EXCEPT {
+#if FL_PLATFORM_HAS_LARGE_MEMORY
+    mBinaryRequestSource = fl::move(source);
+#else
+    (void)source;
+#endif
+}
+
+void Server::setBinaryResponseSink(BinaryResponseSink sink) FL_NO_EXCEPT {
+#if FL_PLATFORM_HAS_LARGE_MEMORY
+    mBinaryResponseSink = fl::move(sink);
+#else
+    (void)sink;
+#endif
+}
+
+void Server::setBinaryRequestHandler(BinaryRequestHandler handler) FL_NO_EXCEPT {
+#if FL_PLATFORM_HAS_LARGE_MEMORY
+    mBinaryRequestHandler = fl::move(handler);
+#else
+    (void)handler;
+#endif
+}
+
+void Server::setMaxInFlight(fl::size maxInFlight, u32 timeoutMs) FL_NO_EXCEPT {
+#if FL_PLATFORM_HAS_LARGE_MEMORY
+    mMaxInFlight = maxInFlight;
+    mInFlightTimeoutMs = timeoutMs;
+    if (maxInFlight == 0) {
+        mInFlight.clear();
+    }
+#else
+    (void)maxInFlight;
+    (void)timeoutMs;
+#endif
+}
+
+fl::size Server::inFlightCount() const FL_NO_EXCEPT {
+#if FL_PLATFORM_HAS_LARGE_MEMORY
+    return mMaxInFlight == 0 ? 0 : mInFlight.size() + outgoingCount();
+#else
+    return 0;
+#endif
+}
+
+namespace {
+
+// ACKs and stream updates leave a request in flight; anything else ends it.
+bool isFinalResponse(const fl::json& response) {
+    if (!response.contains("result")) {
+        return true;
+    }
+    fl::json result = response["result"];
+    if (!result.is_object()) {
+        return true;
+    }
+    if (result.contains("acknowledged")) {
+        return false;
+    }
+    return !(result.contains("update") && !result.contains("stop"));
+}
+
+} // namespace
+
+void Server::emitResponse(const fl::json& response) {
+#if FL_PLATFORM_HAS_LARGE_MEMORY
+    if (!mInFlight.empty() && response.contains("id")) {
+        const fl::string id = response["id"].to_string();
+        for (fl::size i = 0; i < mInFlight.size(); ++i) {
+            if (mInFlight[i].id != id) {
+                continue;
+            }
+            if (isFinalResponse(response)) {
+                mInFlight.erase(mInFlight.begin() + i);
+            } else {
+                mInFlight[i].acknowledged = true;
+            }
+            break;
+        }
+    }
+#endif
+    if (mResponseSink) {
+        mResponseSink(response);
+    }
+}
+
+#if FL_PLATFORM_HAS_LARGE_MEMORY
+// Queued responses, counting each element of a batch response.
+fl::size Server::outgoingCount() const FL_NO_EXCEPT {
+    fl::size count = 0;
+    for (const fl::json& response : mOutgoingQueue) {
+        count += response.is_array() ? response.size() : 1;
+    }
+    return count;
+}
+
+bool Server::backpressured() const FL_NO_EXCEPT {
+    return mMaxInFlight != 0 && mInFlight.size() + outgoingCount() >= mMaxInFlight;
+}
+
+// Stop counting acknowledged calls whose completion never arrived. A late
+// completion is still sent; it just no longer holds a slot.
+void Server::expireInFlight() FL_NO_EXCEPT {
+    if (mInFlightTimeoutMs == 0) {
+        return;
+    }
+    for (fl::size i = mInFlight.size(); i-- > 0;) {
+        if (mInFlight[i].acknowledged && mNowMs - mInFlight[i].since >= mInFlightTimeoutMs) {
+            FL_WARN_F("RPC: request %s still open after %u ms, no longer in flight",
+                      mInFlight[i].id.c_str(), static_cast<unsigned>(mInFlightTimeoutMs));
+            mInFlight.erase(mInFlight.begin() + i);
+        }
+    }
+}
+
+// Runs one request object; returns the response to queue, or null.
+fl::json Server::dispatch(const fl::json& request) {
+    const bool track = mMaxInFlight != 0 && request.is_object() &&
+                       request.contains("id") && !request["id"].is_null();
+    fl::string id;
+    if (track) {
+        id = request["id"].to_string();
+        mInFlight.push_back({id, false, mNowMs});
+    }
+
+    fl::json response = mRequestHandler(request);
+
+    // Skip scheduled acknowledgments and async skip markers.
+    // `noEnqueue` is the new envelope marker (#3228); accept legacy `__skip`
+    // for one release of back-compat.
+    bool isScheduledAck = response.contains("scheduled") && response["scheduled"].as_bool().value_or(false);
+    bool isAsyncSkip = (response.contains("noEnqueue") && response["noEnqueue"].as_bool().value_or(false))
+                   || (response.contains("__skip") && response["__skip"].as_bool().value_or(false));
+    if (isScheduledAck || isAsyncSkip) {
+        response = fl::json();
+    }
+
+    if (track) {
+        // A queued response is counted by the queue; an acknowledged async
+        // call stays until emitResponse() sees its completion.
+        for (fl::size i = mInFlight.size(); i-- > 0;) {
+            if (mInFlight[i].id == id) {
+                if (!response.is_null() || !mInFlight[i].acknowledged) {
+                    mInFlight.erase(mInFlight.begin() + i);
+                }
+                break;
+            }
+        }
+    }
+    return response;
+}
+#endif
+
 size_t Server::update() {
+#if FL_PLATFORM_HAS_LARGE_MEMORY
+    mNowMs = fl::millis();
+#endif
     size_t processed = pull();
     size_t sent = push();
     return processed + sent;
 }
 
 size_t Server::pull() {
+    size_t processed = 0;
+
+#if FL_PLATFORM_HAS_LARGE_MEMORY
+    // Binary frames first: they are the high-rate path.
+    if (mBinaryRequestSource && mBinaryRequestHandler) {
+        while (auto optFrame = mBinaryRequestSource()) {
+            fl::vector<fl::u8> response;
+            if (mBinaryRequestHandler(fl::span<const fl::u8>(optFrame->data(), optFrame->size()), response)) {
+                mOutgoingBinaryQueue.push_back(fl::move(response));
+            }
+            processed++;
+        }
+    }
+#endif
+
     if (!mRequestSource || !mRequestHandler) {
-        return 0;
+        return processed;
     }
 
-    size_t processed = 0;
+#if FL_PLATFORM_HAS_LARGE_MEMORY
+    // Pull until the source is empty or the in-flight bound is reached;
+    // anything left stays in the transport (backpressure).
+    expireInFlight();
+    while (!backpressured()) {
+        auto optRequest = mRequestSource();
+        if (!optRequest) {
+            break;
+        }
+        fl::json request = fl::move(*optRequest);
 
+        if (request.is_array() && request.size() == 0) {
+            fl::json error = fl::json::object();
+            error.set("code", -32600);
+            error.set("message", "Invalid Request: empty batch");
+            fl::json response = fl::json::object();
+            response.set("jsonrpc", "2.0");
+            response.set("error", error);
+            response.set("id", fl::json(nullptr));
+            mOutgoingQueue.push_back(fl::move(response));
+        } else if (request.is_array()) {
+            // JSON-RPC 2.0 batch: one array of responses; notifications and
+            // async calls are omitted, and nothing is sent if none remain.
+            fl::json responses = fl::json::array();
+            for (fl::size i = 0; i < request.size(); ++i) {
+                fl::json response = dispatch(request[i]);
+                const bool notification = request[i].is_object() && !request[i].contains("id");
+                if (!response.is_null() && !notification) {
+                    responses.push_back(response);
+                }
+            }
+            if (responses.size() > 0) {
+                mOutgoingQueue.push_back(fl::move(responses));
+            }
+        } else {
+            fl::json response = dispatch(request);
+            if (!response.is_null()) {
+                mOutgoingQueue.push_back(fl::move(response));
+            }
+        }
+
+        processed++;
+    }
+#else
     // Pull JSON-RPC requests from source until none available
     while (auto optRequest = mRequestSource()) {
         fl::json request = fl::move(*optRequest);
@@ -69,16 +285,28 @@ size_t Server::pull() {
 
         processed++;
     }
+#endif
 
     return processed;
 }
 
 size_t Server::push() {
-    if (!mResponseSink) {
-        return 0;
+    size_t sent = 0;
+
+#if FL_PLATFORM_HAS_LARGE_MEMORY
+    if (mBinaryResponseSink) {
+        for (fl::size i = 0; i < mOutgoingBinaryQueue.size(); ++i) {
+            const fl::vector<fl::u8>& frame = mOutgoingBinaryQueue[i];
+            mBinaryResponseSink(fl::span<const fl::u8>(frame.data(), frame.size()));
+            sent++;
+        }
+        mOutgoingBinaryQueue.clear();
     }
+#endif
 
-    size_t sent = 0;
+    if (!mResponseSink) {
+        return sent;
+    }
 
     // Push queued responses
     while (!mOutgoingQueue.empty()) {
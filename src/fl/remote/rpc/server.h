@@ -4,6 +4,9 @@
 #include "fl/stl/function.h"
 #include "fl/stl/optional.h"
 #include "fl/stl/vector.h"
+#include "fl/stl/span.h"
+#include "fl/stl/string.h"
+#include "fl/stl/int.h"
 #include "fl/stl/noexcept.h"
 #include "fl/remote/rpc/response_stream.h"
 #include "fl/system/sketch_macros.h"
@@ -25,12 +28,29 @@ namespace fl {
  *       return processJsonRpc(req);
  *   });
  *   server.update();  // pull + push
+ *
+ * A second, binary channel carries MessagePack-encoded requests (see
+ * Rpc::handleMsgpack). Each frame is answered in the encoding it arrived
+ * in, so a client opts into binary simply by sending binary frames.
+ *
+ * Pipelining: clients may send JSON-RPC 2.0 batch arrays and keep several
+ * requests in flight. Synchronous results are queued in arrival order;
+ * async results (ResponseSend, sendAsyncResponse) go out as soon as they
+ * complete, so responses can arrive out of order and must be matched by id.
+ * With setMaxInFlight(n), pull() stops reading the source while n requests
+ * are queued or awaiting async completion, leaving further requests in the
+ * transport until the client's earlier calls have been answered. Each
+ * element of a batch counts as one request.
  */
 class Server {
 public:
     using RequestSource = fl::function<fl::optional<fl::json>()>;
     using ResponseSink = fl::function<void(const fl::json&)>;
     using RequestHandler = fl::function<fl::json(const fl::json&)>;
+    using BinaryRequestSource = fl::function<fl::optional<fl::vector<fl::u8>>()>;
+    using BinaryResponseSink = fl::function<void(fl::span<const fl::u8>)>;
+    /// Appends the encoded response to the vector; returns false if none.
+    using BinaryRequestHandler = fl::function<bool(fl::span<const fl::u8>, fl::vector<fl::u8>&)>;
 
     /**
      * @brief Default constructor
@@ -79,8 +99,35 @@ public:
      */
     void setResponseStreamSink(ResponseStreamSink sink) FL_NO_EXCEPT;
 
+    /**
+     * @brief Set binary (MessagePack) request/response callbacks
+     *
+     * Frames are complete encoded requests; transports own the framing.
+     * Ignored on low-memory targets.
+     */
+    void setBinaryRequestSource(BinaryRequestSource source) FL_NO_EXCEPT;
+    void setBinaryResponseSink(BinaryResponseSink sink) FL_NO_EXCEPT;
+    void setBinaryRequestHandler(BinaryRequestHandler handler) FL_NO_EXCEPT;
+
+    /**
+     * @brief Bound the requests in flight (0 = unbounded, the default)
+     *
+     * Counts responses waiting in the outgoing queue (every element of a
+     * batch response) plus async requests that have been acknowledged but
+     * not completed. An acknowledged call still open after `timeoutMs`
+     * stops counting, so a handler that never completes cannot stall the
+     * link (0 = never expire). Ignored on low-memory targets.
+     */
+    void setMaxInFlight(fl::size maxInFlight, u32 timeoutMs = 10000) FL_NO_EXCEPT;
+
+    /// Requests currently counted against setMaxInFlight().
+    fl::size inFlightCount() const FL_NO_EXCEPT;
+
     /**
      * @brief Main update: pull + push
+     *
+     * Uses fl::millis() as the clock for in-flight timeouts; Remote::update()
+     * uses the time it is given.
      */
     size_t update();
 
@@ -95,11 +142,39 @@ public:
     size_t push();
 
 protected:
+    /**
+     * @brief Send a response now rather than through the queue
+     *
+     * Used for async ACKs, stream updates and completions. A final response
+     * retires its id from the in-flight table.
+     */
+    void emitResponse(const fl::json& response);
+
     RequestSource mRequestSource;
     ResponseSink mResponseSink;
     RequestHandler mRequestHandler;
 #if FL_PLATFORM_HAS_LARGE_MEMORY
     ResponseStreamSink mResponseStreamSink;
+    BinaryRequestSource mBinaryRequestSource;
+    BinaryResponseSink mBinaryResponseSink;
+    BinaryRequestHandler mBinaryRequestHandler;
+    fl::vector<fl::vector<fl::u8>> mOutgoingBinaryQueue;
+
+    // Ids of tracked requests that have not produced their final response.
+    struct InFlight {
+        fl::string id;
+        bool acknowledged;  // async ACK sent; completion arrives later
+        u32 since;          // mNowMs when the request was dispatched
+    };
+    fl::vector<InFlight> mInFlight;
+    fl::size mMaxInFlight = 0;
+    u32 mInFlightTimeoutMs = 0;
+    u32 mNowMs = 0;  // clock for in-flight timeouts, set before pull()
+
+    fl::json dispatch(const fl::json& request);
+    fl::size outgoingCount() const FL_NO_EXCEPT;
+    bool backpressured() const FL_NO_EXCEPT;
+    void expireInFlight() FL_NO_EXCEPT;
 #endif
     fl::vector<fl::json> mOutgoingQueue;
 };
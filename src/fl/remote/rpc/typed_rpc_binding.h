@@ -8,6 +8,7 @@
 #include "fl/remote/rpc/type_conversion_result.h"
 #include "fl/remote/rpc/type_to_json.h"
 #include "fl/remote/rpc/json_arg_converter.h"
+#include "fl/remote/rpc/msgpack_to_type.h"
 
 namespace fl {
 
@@ -40,6 +41,19 @@ public:
         return result;
     }
 
+    // Binary transport: decodes the MessagePack params array directly into
+    // the argument tuple and writes nil as the result.
+    TypeConversionResult invokeMsgpack(MsgpackReader& args, MsgpackWriter& out) {
+        StorageTuple tuple{};
+        TypeConversionResult result = MsgpackArgConverter<void(Args...)>::convert(args, tuple);
+        if (!result.ok()) {
+            return result;
+        }
+        invokeImpl(tuple, make_index_sequence<sizeof...(Args)>{});
+        out.writeNil();
+        return result;
+    }
+
 private:
     template <fl::size... Is>
     void invokeImpl(StorageTuple& args, index_sequence<Is...>) {
@@ -85,6 +99,19 @@ public:
         return fl::make_tuple(result, jsonResult);
     }
 
+    // Binary transport: decodes the MessagePack params array directly into
+    // the argument tuple and encodes the return value into `out`.
+    TypeConversionResult invokeMsgpack(MsgpackReader& args, MsgpackWriter& out) {
+        StorageTuple tuple{};
+        TypeConversionResult result = MsgpackArgConverter<R(Args...)>::convert(args, tuple);
+        if (!result.ok()) {
+            return result;
+        }
+        R returnValue = invokeImplWithReturn(tuple, make_index_sequence<sizeof...(Args)>{});
+        detail::TypeToMsgpack<R>::write(out, returnValue);
+        return result;
+    }
+
 private:
     template <fl::size... Is>
     void invokeImpl(StorageTuple& args, index_sequence<Is...>) {
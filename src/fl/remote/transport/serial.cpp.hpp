@@ -4,7 +4,11 @@
 #pragma once
 
 #include "fl/remote/transport/serial.h"
+#include "fl/log/log.h"
+#include "fl/remote/pixel_stream.h"
+#include "fl/stl/cctype.h"
 #include "fl/stl/cstring.h"
+#include "fl/stl/move.h"
 #include "fl/stl/strstream.h"
 
 namespace fl {
@@ -30,4 +34,185 @@ fl::string formatJsonResponse(const fl::json& response, const char* prefix) {
     return ss.str();
 }
 
+fl::optional<fl::json> parseSerialRequestLine(fl::string_view view, const char* prefix) {
+    // Strip prefix if present (string_view: zero-copy)
+    if (prefix && prefix[0] != '\0') {
+        if (view.starts_with(prefix)) {
+            view.remove_prefix(fl::strlen(prefix));
+        }
+    }
+
+    // Trim leading whitespace
+    while (!view.empty() && fl::isspace(view.front())) {
+        view.remove_prefix(1);
+    }
+
+    // Trim trailing whitespace
+    while (!view.empty() && fl::isspace(view.back())) {
+        view.remove_suffix(1);
+    }
+
+    // Only parse requests ('{') and JSON-RPC batches ('[')
+    if (view.empty() || (view[0] != '{' && view[0] != '[')) {
+        return fl::nullopt;
+    }
+
+    // Single copy when parsing JSON (unavoidable - JSON needs owned string)
+    fl::string input(view);
+    return fl::json::parse(input);
+}
+
+// =============================================================================
+// SerialFrameReader
+// =============================================================================
+
+SerialFrameReader::SerialFrameReader(ReadByte readByte, fl::size maxFrame,
+                                     fl::size maxQueued) FL_NO_EXCEPT
+    : mReadByte(fl::move(readByte)),
+      mMaxFrame(maxFrame),
+      mMaxQueued(maxQueued > 0 ? maxQueued : 1),
+      mState(kText),
+      mHeaderLen(0),
+      mRemaining(0),
+      mPixels(nullptr),
+      mPixelPos(0),
+      mLineOverflow(false) {
+    mFrame.type = 0;
+    if (!mReadByte) {
+        mReadByte = []() -> int { return fl::available() > 0 ? fl::read() : -1; };
+    }
+}
+
+void SerialFrameReader::poll() FL_NO_EXCEPT {
+    // A full queue leaves the rest of the input unread (backpressure)
+    // rather than dropping a message that was already accepted.
+    while (!full()) {
+        const int c = mReadByte();
+        if (c < 0) {
+            return;
+        }
+        feed(static_cast<u8>(c));
+    }
+}
+
+void SerialFrameReader::feed(u8 b) FL_NO_EXCEPT {
+    switch (mState) {
+    case kText:
+        if (b == kSerialFrameMarker && mLine.empty() && !mLineOverflow) {
+            mState = kHeader;
+            mHeaderLen = 0;
+        } else if (b == '\n') {
+            if (!mLine.empty() && !mLineOverflow) {
+                mLines.push_back(fl::move(mLine));
+            }
+            mLine.clear();
+            mLineOverflow = false;
+        } else if (b == '\r') {
+            // skip (cross-platform line endings)
+        } else if (mLine.size() < mMaxFrame) {
+            mLine.push_back(static_cast<char>(b));
+        } else {
+            mLineOverflow = true;
+        }
+        return;
+    case kHeader:
+        mHeader[mHeaderLen++] = b;
+        if (mHeaderLen < sizeof(mHeader)) {
+            return;
+        }
+        mRemaining = static_cast<u32>(mHeader[1]) | (static_cast<u32>(mHeader[2]) << 8) |
+                     (static_cast<u32>(mHeader[3]) << 16) | (static_cast<u32>(mHeader[4]) << 24);
+        if (mPixels && mHeader[0] == static_cast<u8>(SerialFrameType::kPixels)) {
+            if (mRemaining < kPixelFrameHeaderSize) {
+                mState = mRemaining == 0 ? kText : kDiscard;
+                return;
+            }
+            mFrame.payload.clear();
+            mState = kPixelHeader;
+            return;
+        }
+        if (mHeader[0] != static_cast<u8>(SerialFrameType::kMsgpackRpc)) {
+            // Nobody pops other types; queueing them would stall the reader.
+            mState = mRemaining == 0 ? kText : kDiscard;
+            return;
+        }
+        if (mRemaining > mMaxFrame) {
+            FL_WARN("SerialFrameReader: dropping %u byte frame", static_cast<unsigned>(mRemaining));
+            mState = kDiscard;
+            return;
+        }
+        mFrame.type = mHeader[0];
+        mFrame.payload.clear();
+        mFrame.payload.reserve(mRemaining);
+        mState = kPayload;
+        if (mRemaining == 0) {
+            finishFrame();
+        }
+        return;
+    case kPayload:
+        mFrame.payload.push_back(b);
+        if (--mRemaining == 0) {
+            finishFrame();
+        }
+        return;
+    case kDiscard:
+        if (--mRemaining == 0) {
+            mState = kText;
+        }
+        return;
+    case kPixelHeader:
+        mFrame.payload.push_back(b);
+        --mRemaining;
+        if (mFrame.payload.size() < kPixelFrameHeaderSize) {
+            return;
+        }
+        mPixelDst = mPixels->begin(
+            fl::span<const u8>(mFrame.payload.data(), mFrame.payload.size()), mRemaining);
+        mPixelPos = 0;
+        mState = kPixelBody;
+        if (mRemaining == 0) {
+            mPixels->end();
+            mState = kText;
+        }
+        return;
+    case kPixelBody:
+        // Bytes past the end of the target (or of a dropped frame) are
+        // consumed and ignored.
+        if (mPixelPos < mPixelDst.size()) {
+            mPixelDst[mPixelPos++] = b;
+        }
+        if (--mRemaining == 0) {
+            mPixels->end();
+            mState = kText;
+        }
+        return;
+    }
+}
+
+void SerialFrameReader::finishFrame() FL_NO_EXCEPT {
+    mFrames.push_back(fl::move(mFrame));
+    mFrame.payload = fl::vector<u8>();
+    mState = kText;
+}
+
+fl::optional<fl::string> SerialFrameReader::popLine() FL_NO_EXCEPT {
+    if (mLines.empty()) {
+        return fl::nullopt;
+    }
+    fl::string line = fl::move(mLines[0]);
+    mLines.erase(mLines.begin());
+    return line;
+}
+
+fl::optional<fl::vector<u8>> SerialFrameReader::popFrame(SerialFrameType type) FL_NO_EXCEPT {
+    for (fl::size i = 0; i < mFrames.size(); ++i) {
+        if (mFrames[i].type == static_cast<u8>(type)) {
+            fl::vector<u8> payload = fl::move(mFrames[i].payload);
+            mFrames.erase(mFrames.begin() + i);
+            return payload;
+        }
+    }
+    return fl::nullopt;
+}
+
 } // namespace fl
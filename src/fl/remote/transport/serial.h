@@ -23,10 +23,14 @@
 #include "fl/stl/function.h"
 #include "fl/stl/optional.h"
 #include "fl/stl/pair.h"
+#include "fl/stl/shared_ptr.h"
+#include "fl/stl/span.h"
 #include "fl/stl/string.h"
 #include "fl/stl/strstream.h"
 #include "fl/stl/string_view.h"
+#include "fl/stl/vector.h"
 #include "fl/remote/rpc/response_stream.h"
+#include "fl/system/sketch_macros.h"
 
 namespace fl {
 
@@ -42,6 +46,115 @@ namespace fl {
 /// @note Generic JSON serialization - works for any JSON, not just JSON-RPC
 fl::string formatJsonResponse(const fl::json& response, const char* prefix = "");
 
+/// @brief Parse one received line as a JSON request
+/// @param line Raw line (without delimiter)
+/// @param prefix Optional prefix to strip before parsing
+/// @return Parsed JSON, or nullopt if the line is not a JSON object
+fl::optional<fl::json> parseSerialRequestLine(fl::string_view line, const char* prefix = "");
+
+// =============================================================================
+// Binary Frames
+// =============================================================================
+// Binary RPC (MessagePack) shares the serial link with JSON lines. A frame is
+//
+//   0xC1 | type (1 byte) | payload length (u32, little-endian) | payload
+//
+// 0xC1 is invalid in UTF-8 and unused by MessagePack, so it never starts a
+// JSON line; a reader demultiplexes lines and frames byte by byte.
+//
+// Pixel frames (see fl/remote/pixel_stream.h) are not buffered: once their
+// 10 byte header is in, the RGB bytes are written straight into the target
+// LED buffer, so they are not limited by FL_SERIAL_FRAME_MAX.
+
+#ifndef FL_SERIAL_FRAME_MAX
+#if FL_PLATFORM_HAS_LARGE_MEMORY
+#define FL_SERIAL_FRAME_MAX 65536
+#else
+#define FL_SERIAL_FRAME_MAX 1024
+#endif
+#endif
+
+#ifndef FL_SERIAL_READER_QUEUE_MAX
+#define FL_SERIAL_READER_QUEUE_MAX 8
+#endif
+
+constexpr u8 kSerialFrameMarker = 0xC1;
+
+enum class SerialFrameType : u8 {
+    kMsgpackRpc = 'M',  ///< MessagePack request/response (Rpc::handleMsgpack)
+    kPixels = 'P',      ///< Raw pixel frame (PixelStream), host to device only
+};
+
+class PixelStream;
+
+/// @brief Non-blocking demultiplexer for JSON lines and binary frames
+/// @note Partial lines and frames are kept across poll() calls, so it never
+///       waits for the rest of a message. Oversized frames are dropped.
+/// @note Only kMsgpackRpc frames are queued; kPixels frames go to the
+///       PixelStream (or are skipped without one), other types are skipped.
+///       Nothing that was queued is ever dropped: once `maxQueued` lines or
+///       frames are waiting, poll() stops reading and the rest of the input
+///       stays in the serial buffer until they are popped. Pop both kinds
+///       (e.g. wire binarySource when using createSerialMuxTransport()).
+class SerialFrameReader {
+public:
+    /// Returns the next input byte, or -1 if none is available yet.
+    using ReadByte = fl::function<int()>;
+
+    /// @param readByte Byte source (default: fl::available()/fl::read())
+    /// @param maxFrame Largest accepted frame payload or line length
+    /// @param maxQueued Completed lines (and, separately, frames) held
+    ///        before poll() stops reading
+    explicit SerialFrameReader(ReadByte readByte = ReadByte(),
+                               fl::size maxFrame = FL_SERIAL_FRAME_MAX,
+                               fl::size maxQueued = FL_SERIAL_READER_QUEUE_MAX) FL_NO_EXCEPT;
+
+    /// Consume available input until it runs out or a queue is full.
+    void poll() FL_NO_EXCEPT;
+
+    /// True while poll() is holding off because `maxQueued` lines or
+    /// frames are waiting to be popped.
+    bool full() const FL_NO_EXCEPT {
+        return mLines.size() >= mMaxQueued || mFrames.size() >= mMaxQueued;
+    }
+
+    /// Next complete line (without '\r'/'\n'), oldest first.
+    fl::optional<fl::string> popLine() FL_NO_EXCEPT;
+
+    /// Next complete frame of `type`, oldest first.
+    fl::optional<fl::vector<u8>> popFrame(SerialFrameType type) FL_NO_EXCEPT;
+
+    /// Route kPixels frames into `pixels` as they arrive instead of queueing
+    /// them (nullptr restores queueing). `pixels` must outlive the reader.
+    void setPixelStream(PixelStream* pixels) FL_NO_EXCEPT { mPixels = pixels; }
+
+private:
+    enum State : u8 { kText, kHeader, kPayload, kDiscard, kPixelHeader, kPixelBody };
+    struct Frame {
+        u8 type;
+        fl::vector<u8> payload;
+    };
+
+    void feed(u8 b) FL_NO_EXCEPT;
+    void finishFrame() FL_NO_EXCEPT;
+
+    ReadByte mReadByte;
+    fl::size mMaxFrame;
+    fl::size mMaxQueued;
+    State mState;
+    u8 mHeader[5];
+    u8 mHeaderLen;
+    u32 mRemaining;
+    PixelStream* mPixels;
+    fl::span<u8> mPixelDst;  // where the current pixel frame body goes
+    fl::size mPixelPos;
+    bool mLineOverflow;
+    fl::string mLine;
+    Frame mFrame;
+    fl::vector<fl::string> mLines;
+    fl::vector<Frame> mFrames;
+};
+
 // =============================================================================
 // Generic I/O Functions (Templated for Testability)
 // =============================================================================
@@ -85,6 +198,19 @@ inline fl::optional<fl::string> readSerialLine(SerialReader& serial, char delimi
     return fl::readLine(delimiter, '\r', timeoutMs);
 }
 
+/// @brief Write one binary frame (header + payload)
+/// @tparam SerialOut Type providing write(const char*, size)
+template<typename SerialOut>
+void writeSerialFrame(SerialOut& serial, SerialFrameType type, fl::span<const u8> payload) {
+    const u32 n = static_cast<u32>(payload.size());
+    const char header[6] = {
+        static_cast<char>(kSerialFrameMarker), static_cast<char>(type),
+        static_cast<char>(n & 0xff), static_cast<char>((n >> 8) & 0xff),
+        static_cast<char>((n >> 16) & 0xff), static_cast<char>((n >> 24) & 0xff)};
+    serial.write(header, sizeof(header));
+    serial.write(reinterpret_cast<const char*>(payload.data()), payload.size());  // ok reinterpret cast
+}
+
 /// @brief Serial adapter using fl:: output functions (fl::println)
 /// @note Works across all FastLED platforms
 struct SerialWriter {
@@ -127,34 +253,7 @@ createSerialRequestSource(const char* prefix = "") {
             return fl::nullopt;
         }
 
-        // Use string_view for zero-copy prefix stripping and trimming
-        fl::string_view view = *line;
-
-        // Strip prefix if present
-        if (prefix && prefix[0] != '\0') {
-            if (view.starts_with(prefix)) {
-                view.remove_prefix(fl::strlen(prefix));
-            }
-        }
-
-        // Trim leading whitespace
-        while (!view.empty() && fl::isspace(view.front())) {
-            view.remove_prefix(1);
-        }
-
-        // Trim trailing whitespace
-        while (!view.empty() && fl::isspace(view.back())) {
-            view.remove_suffix(1);
-        }
-
-        // Only parse if input starts with '{'
-        if (view.empty() || view[0] != '{') {
-            return fl::nullopt;
-        }
-
-        // Single copy when parsing JSON (unavoidable - JSON needs owned string)
-        fl::string input(view);
-        return fl::json::parse(input);
+        return parseSerialRequestLine(*line, prefix);
     };
 }
 
@@ -195,6 +294,58 @@ createSerialResponseStreamSink(const char* prefix = "REMOTE: ") FL_NO_EXCEPT {
     };
 }
 
+/// @brief JSON and binary callbacks sharing one serial link
+/// @note Hand `source`/`sink` to the fl::Remote constructor and the binary
+///       pair to setBinaryRequestSource()/setBinaryResponseSink().
+struct SerialMuxTransport {
+    fl::function<fl::optional<fl::json>()> source;
+    fl::function<void(const fl::json&)> sink;
+    fl::function<fl::optional<fl::vector<u8>>()> binarySource;
+    fl::function<void(fl::span<const u8>)> binarySink;
+};
+
+/// @brief Create a serial transport that carries JSON lines and MessagePack frames
+/// @param responsePrefix Prefix for outgoing JSON responses (default: "REMOTE: ")
+/// @param requestPrefix Prefix to strip from incoming JSON lines (default: "")
+/// @param readByte Byte source for testing (default: fl::available()/fl::read())
+/// @param pixels Optional PixelStream receiving kPixels frames in place
+///
+/// Example:
+/// @code
+/// auto serial = fl::createSerialMuxTransport();
+/// fl::Remote remote(serial.source, serial.sink);
+/// remote.setBinaryRequestSource(serial.binarySource);
+/// remote.setBinaryResponseSink(serial.binarySink);
+/// @endcode
+inline SerialMuxTransport
+createSerialMuxTransport(const char* responsePrefix = "REMOTE: ", const char* requestPrefix = "",
+                         SerialFrameReader::ReadByte readByte = SerialFrameReader::ReadByte(),
+                         PixelStream* pixels = nullptr) {
+    fl::shared_ptr<SerialFrameReader> reader = fl::make_shared<SerialFrameReader>(fl::move(readByte));
+    reader->setPixelStream(pixels);
+    SerialMuxTransport t;
+    t.source = [reader, requestPrefix]() -> fl::optional<fl::json> {
+        reader->poll();
+        while (auto line = reader->popLine()) {
+            if (auto request = parseSerialRequestLine(*line, requestPrefix)) {
+                return request;
+            }
+        }
+        return fl::nullopt;
+    };
+    t.sink = createSerialResponseSink(responsePrefix);
+    t.binarySource = [reader]() -> fl::optional<fl::vector<u8>> {
+        reader->poll();
+        return reader->popFrame(SerialFrameType::kMsgpackRpc);
+    };
+    t.binarySink = [](fl::span<const u8> payload) {
+        SerialWriter serial;
+        writeSerialFrame(serial, SerialFrameType::kMsgpackRpc, payload);
+        fl::flush();
+    };
+    return t;
+}
+
 /// @brief Create RequestSource and ResponseSink pair for serial I/O
 /// @param responsePrefix Prefix for outgoing responses (default: "REMOTE: ")
 /// @param requestPrefix Prefix to strip from incoming requests (default: "")
@@ -19,6 +19,8 @@
 #include "fl/stl/ios.cpp.hpp"
 #include "fl/stl/istream.cpp.hpp"
 #include "fl/stl/json.cpp.hpp"
+#include "fl/stl/json_document.cpp.hpp"
+#include "fl/stl/json_reader.cpp.hpp"
 #include "fl/stl/json_stream_writer.cpp.hpp"
 #include "fl/stl/malloc.cpp.hpp"
 #include "fl/stl/memory_resource.cpp.hpp"
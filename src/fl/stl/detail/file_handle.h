@@ -53,6 +53,12 @@ public:
     virtual bool available() const { return is_open() && !is_eof(); }
     virtual fl::size_t bytes_left() const;
 
+    // Zero-copy read-only view of the whole file, for backends that can
+    // provide one (mmap on POSIX test hosts, fully loaded WASM files). Stays
+    // valid until close() or destruction. Empty when unsupported; callers
+    // fall back to read().
+    virtual fl::span<const fl::u8> map() { return fl::span<const fl::u8>(); }
+
     // Convenience: read into u8 buffer
     fl::size_t read(fl::u8* dst, fl::size_t n) {
         return read(reinterpret_cast<char*>(dst), n); // ok reinterpret cast
@@ -1,9 +1,11 @@
 
 #include "fl/stl/json.h"
+#include "fl/stl/json_document.h"
 #include "fl/stl/json/types.h"
 #include "fl/system/sketch_macros.h"  // FL_PLATFORM_HAS_LARGE_MEMORY -- gates ieee754_format_decimal
 #include "fl/stl/string.h"
 #include "fl/stl/vector.h"
+#include "fl/stl/algorithm.h"  // fl::stable_sort (json_document members)
 #include "fl/stl/deque.h"
 #include "fl/stl/span.h"
 #include "fl/stl/charconv.h"
@@ -1106,6 +1108,284 @@ public:
     }
 };
 
+// Builds a json_document tree into a json_arena (no per-node allocation).
+// Children of open containers collect in one reusable scratch vector and are
+// copied into the arena as a contiguous run when the container closes.
+// Object members are sorted and de-duplicated (last wins) at that point,
+// matching the flat_map that JsonBuilder fills.
+class ArenaBuilder : public JsonVisitor {
+private:
+    struct Frame {
+        u32 start;        // first child in mScratch
+        bool object;
+        bool expect_key;  // objects: next STRING is a key
+    };
+
+    fl::json_arena& mArena;
+    fl::vector<fl::detail::json_member> mScratch;
+    fl::vector_inlined<Frame, 16> mStack;
+    fl::detail::json_node mRoot;
+    bool mHasRoot;
+
+    static fl::detail::json_node make_node(fl::detail::json_node_type type) {
+        fl::detail::json_node n;
+        n.type = type;
+        n.size = 0;
+        n.i = 0;
+        return n;
+    }
+
+    // Unescaped strings (keys and values) are views into the source; only
+    // strings with escape sequences are rewritten into the arena.
+    bool make_string(const fl::span<const char>& value, fl::string_view* out) {
+        if (!has_escape_sequences(value)) {
+            *out = fl::string_view(value.data(), value.size());
+            return true;
+        }
+        char* dst = static_cast<char*>(mArena.allocate(value.size()));
+        if (!dst) return false;
+        fl::size n = 0;
+        for (fl::size i = 0; i < value.size(); i++) {
+            char c = value[i];
+            if (c == '\\' && i + 1 < value.size()) {
+                switch (value[i + 1]) {
+                    case '"':  c = '"'; i++; break;
+                    case '\\': c = '\\'; i++; break;
+                    case '/':  c = '/'; i++; break;
+                    case 'b':  c = '\b'; i++; break;
+                    case 'f':  c = '\f'; i++; break;
+                    case 'n':  c = '\n'; i++; break;
+                    case 'r':  c = '\r'; i++; break;
+                    case 't':  c = '\t'; i++; break;
+                    default:   break;  // Pass through unknown escapes
+                }
+            }
+            dst[n++] = c;
+        }
+        *out = fl::string_view(dst, n);
+        return true;
+    }
+
+    void push_value(const fl::detail::json_node& node) {
+        if (mStack.empty()) {
+            mRoot = node;
+            mHasRoot = true;
+            return;
+        }
+        Frame& top = mStack.back();
+        if (top.object) {
+            mScratch.back().value = node;  // member pushed when its key arrived
+            top.expect_key = true;
+        } else {
+            fl::detail::json_member m;
+            m.value = node;
+            mScratch.push_back(m);
+        }
+    }
+
+    // Numeric arrays get the packed representation classify_array() picks
+    // for JsonBuilder (u8, i16 or float elements). Returns false to keep a
+    // generic array; on true, node->u8s is nullptr on OOM.
+    bool pack_array(const fl::detail::json_member* items, fl::size count,
+                    fl::detail::json_node* node) {
+        i64 min_val = fl::numeric_limits<i64>::max();
+        i64 max_val = fl::numeric_limits<i64>::min();
+        bool has_float = false;
+        for (fl::size i = 0; i < count; i++) {
+            const fl::detail::json_node& n = items[i].value;
+            if (n.type == fl::detail::json_node_type::kInt) {
+                min_val = n.i < min_val ? n.i : min_val;
+                max_val = n.i > max_val ? n.i : max_val;
+            } else if (n.type == fl::detail::json_node_type::kFloat) {
+                if (float_bits_magnitude_exceeds_2_24(fl::bit_cast<u32>(n.f))) {
+                    return false;
+                }
+                has_float = true;
+            } else {
+                return false;
+            }
+        }
+
+        if (!has_float && min_val >= 0 && max_val <= 255) {
+            u8* dst = static_cast<u8*>(mArena.allocate(count));
+            for (fl::size i = 0; dst && i < count; i++) dst[i] = static_cast<u8>(items[i].value.i);
+            node->type = fl::detail::json_node_type::kArrayU8;
+            node->u8s = dst;
+        } else if (!has_float && min_val >= -32768 && max_val <= 32767) {
+            i16* dst = static_cast<i16*>(mArena.allocate(count * sizeof(i16)));
+            for (fl::size i = 0; dst && i < count; i++) dst[i] = static_cast<i16>(items[i].value.i);
+            node->type = fl::detail::json_node_type::kArrayI16;
+            node->i16s = dst;
+        } else if (has_float || (min_val >= -16777216 && max_val <= 16777216)) {
+            float* dst = static_cast<float*>(mArena.allocate(count * sizeof(float)));
+            for (fl::size i = 0; dst && i < count; i++) {
+                const fl::detail::json_node& n = items[i].value;
+                dst[i] = n.type == fl::detail::json_node_type::kFloat
+                             ? n.f
+                             : static_cast<float>(static_cast<fl::i32>(n.i));
+            }
+            node->type = fl::detail::json_node_type::kArrayF32;
+            node->f32s = dst;
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    bool close_container(bool object) {
+        if (mStack.empty() || mStack.back().object != object) {
+            return false;
+        }
+        const u32 start = mStack.back().start;
+        mStack.pop_back();
+        fl::detail::json_member* first = mScratch.data() + start;
+        fl::size count = mScratch.size() - start;
+
+        fl::detail::json_node node = make_node(object ? fl::detail::json_node_type::kObject
+                                                      : fl::detail::json_node_type::kArray);
+        if (object && count > 1) {
+            fl::stable_sort(first, first + count,
+                            [](const fl::detail::json_member& a, const fl::detail::json_member& b) {
+                                return fl::detail::json_key_less(a.key, b.key);
+                            });
+            fl::size out = 0;
+            for (fl::size i = 0; i < count; i++) {
+                if (out > 0 && first[out - 1].key == first[i].key) {
+                    first[out - 1] = first[i];
+                } else {
+                    first[out++] = first[i];
+                }
+            }
+            count = out;
+        }
+        if (count > 0) {
+            if (object) {
+                auto* dst = static_cast<fl::detail::json_member*>(
+                    mArena.allocate(count * sizeof(fl::detail::json_member)));
+                if (!dst) return false;
+                fl::memcpy(dst, first, count * sizeof(fl::detail::json_member));
+                node.members = dst;
+            } else if (!pack_array(first, count, &node)) {
+                auto* dst = static_cast<fl::detail::json_node*>(
+                    mArena.allocate(count * sizeof(fl::detail::json_node)));
+                if (!dst) return false;
+                for (fl::size i = 0; i < count; i++) {
+                    dst[i] = first[i].value;
+                }
+                node.items = dst;
+            } else if (!node.u8s) {
+                return false;
+            }
+        }
+        node.size = static_cast<u32>(count);
+        mScratch.resize(start);
+        push_value(node);
+        return true;
+    }
+
+public:
+    explicit ArenaBuilder(fl::json_arena& arena) FL_NO_EXCEPT
+        : mArena(arena), mRoot(make_node(fl::detail::json_node_type::kNull)), mHasRoot(false) {
+        mScratch.reserve(64);
+    }
+
+    ParseState on_token(JsonToken token, const fl::span<const char>& value) override {
+        switch (token) {
+            case JsonToken::LBRACE:
+            case JsonToken::LBRACKET: {
+                if (mStack.size() > static_cast<fl::size>(MAX_JSON_DEPTH)) {
+                    return ParseState::ERROR;
+                }
+                Frame f;
+                f.start = static_cast<u32>(mScratch.size());
+                f.object = token == JsonToken::LBRACE;
+                f.expect_key = f.object;
+                mStack.push_back(f);
+                return ParseState::KEEP_GOING;
+            }
+
+            case JsonToken::RBRACE:
+                return close_container(true) ? ParseState::KEEP_GOING : ParseState::ERROR;
+
+            case JsonToken::RBRACKET:
+                return close_container(false) ? ParseState::KEEP_GOING : ParseState::ERROR;
+
+            case JsonToken::STRING: {
+                fl::string_view str;
+                if (!make_string(value, &str)) return ParseState::ERROR;
+                if (!mStack.empty() && mStack.back().expect_key) {
+                    fl::detail::json_member m;
+                    m.key = str;
+                    m.value = make_node(fl::detail::json_node_type::kNull);
+                    mScratch.push_back(m);
+                    mStack.back().expect_key = false;
+                } else {
+                    fl::detail::json_node n = make_node(fl::detail::json_node_type::kString);
+                    n.str = str.data();
+                    n.size = static_cast<u32>(str.size());
+                    push_value(n);
+                }
+                return ParseState::KEEP_GOING;
+            }
+
+            case JsonToken::NUMBER: {
+                // Same int/float split and number parsing as JsonBuilder.
+                bool is_float = false;
+                for (size_t i = 0; i < value.size(); i++) {
+                    if (value[i] == '.' || value[i] == 'e' || value[i] == 'E') {
+                        is_float = true;
+                        break;
+                    }
+                }
+                fl::detail::json_node n = make_node(fl::detail::json_node_type::kInt);
+#if FL_PLATFORM_HAS_LARGE_MEMORY
+                if (is_float) {
+                    n.type = fl::detail::json_node_type::kFloat;
+                    n.f = fl::bit_cast<float>(fl::ieee754_parse_decimal(value.data(), value.size()));
+                } else {
+                    n.i = static_cast<i64>(fl::parseInt(value.data(), value.size()));
+                }
+#else
+                (void)is_float;
+                n.i = static_cast<i64>(fl::parseInt(value.data(), value.size()));
+#endif
+                push_value(n);
+                return ParseState::KEEP_GOING;
+            }
+
+            case JsonToken::TRUE:
+            case JsonToken::FALSE: {
+                fl::detail::json_node n = make_node(fl::detail::json_node_type::kBool);
+                n.b = token == JsonToken::TRUE;
+                push_value(n);
+                return ParseState::KEEP_GOING;
+            }
+
+            case JsonToken::NULL_VALUE:
+                push_value(make_node(fl::detail::json_node_type::kNull));
+                return ParseState::KEEP_GOING;
+
+            case JsonToken::COLON:
+            case JsonToken::COMMA:
+            case JsonToken::END_OF_INPUT:
+                return ParseState::KEEP_GOING;
+
+            default:
+                // Packed-array tokens never appear: the tokenizer runs
+                // without lookahead for this builder.
+                return ParseState::ERROR;
+        }
+    }
+
+    // Copies the root node into the arena; nullptr on failure.
+    const fl::detail::json_node* finish() {
+        if (!mHasRoot || !mStack.empty()) return nullptr;
+        auto* root = static_cast<fl::detail::json_node*>(mArena.allocate(sizeof(fl::detail::json_node)));
+        if (root) *root = mRoot;
+        return root;
+    }
+};
+
 }  // namespace
 
 // PARSE2 IMPLEMENTATION - Milestone 8: Two-phase parser with validation
@@ -1127,6 +1407,48 @@ fl::shared_ptr<json_value> json_value::parse2(const fl::string& txt) {
     return builder.get_result();
 }
 
+// Arena DOM: validate, then build into a single arena (see json_document.h).
+json_document json_document::parse_impl(fl::string_view text, bool copy,
+                                        memory_resource* resource) FL_NO_EXCEPT {
+    json_document doc;
+    // Roughly one node per 8-16 source bytes; size blocks off the input so
+    // small documents use one block and large ones only a handful.
+    fl::size block = text.size() + (copy ? text.size() : 0);
+    if (block > FL_JSON_ARENA_MAX_BLOCK) block = FL_JSON_ARENA_MAX_BLOCK;
+    doc.mArena = json_arena(block, resource);
+
+    fl::string_view src = text;
+    if (copy && !text.empty()) {
+        char* owned = static_cast<char*>(doc.mArena.allocate(text.size()));
+        if (!owned) {
+            FL_WARN("json_document: out of memory copying %u bytes",
+                    static_cast<unsigned>(text.size()));
+            return doc;
+        }
+        fl::memcpy(owned, text.data(), text.size());
+        src = fl::string_view(owned, text.size());
+    }
+
+    JsonTokenizer tokenizer(false);
+    JsonValidator validator;
+    if (!tokenizer.parse(src, validator) || !validator.is_valid()) {
+        doc.mArena.release();
+        return doc;
+    }
+    ArenaBuilder builder(doc.mArena);
+    if (!tokenizer.parse(src, builder)) {
+        FL_WARN("json_document: out of memory building %u byte document",
+                static_cast<unsigned>(text.size()));
+        doc.mArena.release();
+        return doc;
+    }
+    doc.mRoot = builder.finish();  // nullptr for empty input
+    if (!doc.mRoot) {
+        doc.mArena.release();
+    }
+    return doc;
+}
+
 // Phase 1 validation only (for testing - MUST allocate zero heap memory)
 bool json_value::parse2_validate_only(const fl::string& txt) {
     return parse2_validate_only(fl::string_view(txt.c_str(), txt.length()));
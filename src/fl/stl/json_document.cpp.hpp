@@ -0,0 +1,269 @@
+#pragma once
+
+// IWYU pragma: private
+
+// json_arena, json_ref and json_document. The arena-building parser itself
+// lives in json.cpp.hpp next to the tokenizer it drives.
+
+#include "fl/stl/json_document.h"
+
+#include "fl/stl/algorithm.h" // fl::lower_bound
+#include "fl/stl/cstring.h"   // fl::memcmp
+#include "fl/stl/move.h"      // fl::move
+
+namespace fl {
+
+// ---------------------------------------------------------------------------
+// json_arena
+// ---------------------------------------------------------------------------
+
+namespace {
+constexpr fl::size kJsonArenaAlign = 8;
+constexpr fl::size kJsonArenaHeader = (sizeof(void *) + sizeof(fl::size) + kJsonArenaAlign - 1) &
+                                      ~(kJsonArenaAlign - 1);
+} // namespace
+
+json_arena::json_arena(fl::size block_size, memory_resource *resource) FL_NO_EXCEPT
+    : mResource(resource ? resource : default_memory_resource()),
+      mBlockSize(block_size < 256 ? 256 : block_size),
+      mHead(nullptr),
+      mCur(nullptr),
+      mEnd(nullptr),
+      mBlockCount(0),
+      mReserved(0),
+      mUsed(0) {}
+
+json_arena::~json_arena() FL_NO_EXCEPT { release(); }
+
+json_arena::json_arena(json_arena &&other) FL_NO_EXCEPT
+    : mResource(other.mResource),
+      mBlockSize(other.mBlockSize),
+      mHead(nullptr),
+      mCur(nullptr),
+      mEnd(nullptr),
+      mBlockCount(0),
+      mReserved(0),
+      mUsed(0) {
+    swap(other);
+}
+
+json_arena &json_arena::operator=(json_arena &&other) FL_NO_EXCEPT {
+    if (this != &other) {
+        release();
+        swap(other);
+    }
+    return *this;
+}
+
+void json_arena::swap(json_arena &other) FL_NO_EXCEPT {
+    fl::swap(mResource, other.mResource);
+    fl::swap(mBlockSize, other.mBlockSize);
+    fl::swap(mHead, other.mHead);
+    fl::swap(mCur, other.mCur);
+    fl::swap(mEnd, other.mEnd);
+    fl::swap(mBlockCount, other.mBlockCount);
+    fl::swap(mReserved, other.mReserved);
+    fl::swap(mUsed, other.mUsed);
+}
+
+void *json_arena::allocate(fl::size bytes) FL_NO_EXCEPT {
+    if (bytes == 0) {
+        return nullptr;
+    }
+    bytes = (bytes + kJsonArenaAlign - 1) & ~(kJsonArenaAlign - 1);
+    if (static_cast<fl::size>(mEnd - mCur) < bytes) {
+        // Oversized requests get a dedicated block linked behind the
+        // current one, so the remainder of the current block stays usable.
+        const bool dedicated = bytes > mBlockSize - kJsonArenaHeader;
+        const fl::size total = dedicated ? bytes + kJsonArenaHeader : mBlockSize;
+        char *raw = static_cast<char *>(mResource->allocate(total));
+        if (!raw) {
+            return nullptr;
+        }
+        Block *block = reinterpret_cast<Block *>(raw);
+        block->size = total;
+        ++mBlockCount;
+        mReserved += total;
+        mUsed += bytes;
+        if (dedicated && mHead) {
+            block->next = mHead->next;
+            mHead->next = block;
+            return raw + kJsonArenaHeader;
+        }
+        block->next = mHead;
+        mHead = block;
+        mCur = raw + kJsonArenaHeader;
+        mEnd = raw + total;
+    } else {
+        mUsed += bytes;
+    }
+    void *p = mCur;
+    mCur += bytes;
+    return p;
+}
+
+void json_arena::release() FL_NO_EXCEPT {
+    Block *block = mHead;
+    while (block) {
+        Block *next = block->next;
+        mResource->deallocate(block, block->size);
+        block = next;
+    }
+    mHead = nullptr;
+    mCur = nullptr;
+    mEnd = nullptr;
+    mBlockCount = 0;
+    mReserved = 0;
+    mUsed = 0;
+}
+
+// ---------------------------------------------------------------------------
+// json_ref
+// ---------------------------------------------------------------------------
+
+namespace detail {
+
+bool json_key_less(fl::string_view a, fl::string_view b) FL_NO_EXCEPT {
+    if (a.size() != b.size()) {
+        return a.size() < b.size();
+    }
+    return a.size() > 0 && fl::memcmp(a.data(), b.data(), a.size()) < 0;
+}
+
+} // namespace detail
+
+const detail::json_node *json_ref::find(fl::string_view key) const FL_NO_EXCEPT {
+    if (!is_object()) {
+        return nullptr;
+    }
+    const detail::json_member *first = mNode.members;
+    const detail::json_member *last = first + mNode.size;
+    const detail::json_member *it = fl::lower_bound(
+        first, last, key, [](const detail::json_member &m, const fl::string_view &k) {
+            return detail::json_key_less(m.key, k);
+        });
+    if (it == last || it->key != key) {
+        return nullptr;
+    }
+    return &it->value;
+}
+
+json_ref json_ref::operator[](fl::size idx) const FL_NO_EXCEPT {
+    if (!is_array() || idx >= mNode.size) {
+        return json_ref();
+    }
+    detail::json_node n;
+    n.size = 0;
+    switch (mNode.type) {
+    case detail::json_node_type::kArrayU8:
+        n.type = detail::json_node_type::kInt;
+        n.i = mNode.u8s[idx];
+        return json_ref(n);
+    case detail::json_node_type::kArrayI16:
+        n.type = detail::json_node_type::kInt;
+        n.i = mNode.i16s[idx];
+        return json_ref(n);
+    case detail::json_node_type::kArrayF32:
+        n.type = detail::json_node_type::kFloat;
+        n.f = mNode.f32s[idx];
+        return json_ref(n);
+    default:
+        return json_ref(mNode.items[idx]);
+    }
+}
+
+json_ref json_ref::operator[](fl::string_view key) const FL_NO_EXCEPT {
+    const detail::json_node *node = find(key);
+    return node ? json_ref(*node) : json_ref();
+}
+
+json_ref::iterator json_ref::begin() const FL_NO_EXCEPT {
+    return iterator(*this, 0);
+}
+
+json_ref::iterator json_ref::end() const FL_NO_EXCEPT {
+    return iterator(*this, size());
+}
+
+json_value json_ref::scalar() const FL_NO_EXCEPT {
+    switch (mNode.type) {
+    case detail::json_node_type::kBool:
+        return json_value(mNode.b);
+    case detail::json_node_type::kInt:
+        return json_value(mNode.i);
+    case detail::json_node_type::kFloat:
+        return json_value(mNode.f);
+    case detail::json_node_type::kString:
+        return json_value(fl::string(mNode.str, mNode.size));
+    default:
+        return json_value();
+    }
+}
+
+json json_ref::to_json() const FL_NO_EXCEPT {
+    switch (mNode.type) {
+    case detail::json_node_type::kNull:
+        return json(nullptr);
+    case detail::json_node_type::kBool:
+        return json(mNode.b);
+    case detail::json_node_type::kInt:
+        return json(mNode.i);
+    case detail::json_node_type::kFloat:
+        return json(mNode.f);
+    case detail::json_node_type::kString:
+        return json(fl::string(mNode.str, mNode.size));
+    case detail::json_node_type::kArrayU8:
+        return json(fl::make_shared<json_value>(fl::vector<u8>(mNode.u8s, mNode.u8s + mNode.size)));
+    case detail::json_node_type::kArrayI16:
+        return json(fl::make_shared<json_value>(fl::vector<i16>(mNode.i16s, mNode.i16s + mNode.size)));
+    case detail::json_node_type::kArrayF32:
+        return json(fl::make_shared<json_value>(fl::vector<float>(mNode.f32s, mNode.f32s + mNode.size)));
+    case detail::json_node_type::kArray: {
+        json out = json::array();
+        for (u32 i = 0; i < mNode.size; ++i) {
+            out.push_back(json_ref(mNode.items[i]).to_json());
+        }
+        return out;
+    }
+    case detail::json_node_type::kObject: {
+        json out = json::object();
+        for (u32 i = 0; i < mNode.size; ++i) {
+            const detail::json_member &m = mNode.members[i];
+            out.set(fl::string(m.key.data(), m.key.size()), json_ref(m.value).to_json());
+        }
+        return out;
+    }
+    }
+    return json();
+}
+
+// ---------------------------------------------------------------------------
+// json_document
+// ---------------------------------------------------------------------------
+
+json_document::json_document() FL_NO_EXCEPT : mArena(), mRoot(nullptr) {}
+
+json_document::json_document(json_document &&other) FL_NO_EXCEPT
+    : mArena(fl::move(other.mArena)), mRoot(other.mRoot) {
+    other.mRoot = nullptr;
+}
+
+json_document &json_document::operator=(json_document &&other) FL_NO_EXCEPT {
+    if (this != &other) {
+        mArena = fl::move(other.mArena);
+        mRoot = other.mRoot;
+        other.mRoot = nullptr;
+    }
+    return *this;
+}
+
+json_document json_document::parse(fl::string_view text, memory_resource *resource) FL_NO_EXCEPT {
+    return parse_impl(text, false, resource);
+}
+
+json_document json_document::parse_owned(fl::string_view text,
+                                          memory_resource *resource) FL_NO_EXCEPT {
+    return parse_impl(text, true, resource);
+}
+
+} // namespace fl
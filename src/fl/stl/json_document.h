@@ -0,0 +1,382 @@
+#pragma once
+
+// json_document — read-only JSON DOM built into a single bump arena.
+//
+// fl::json allocates one shared_ptr<json_value> per node, a vector or
+// flat_map per container and an fl::string per key. Parsing a large
+// document (UI description, screenmap) therefore makes thousands of small,
+// long-lived heap allocations, which fragments the heap badly on ESP32.
+//
+// json_document parses into an arena instead: every node, container and
+// unescaped string comes out of a few large blocks that are released
+// together when the document is destroyed. Keys and strings without escape
+// sequences are string_views into the source text, so nothing is copied.
+//
+//   fl::json_document doc = fl::json_document::parse(text);   // borrows text
+//   int brightness = doc["config"]["brightness"] | 255;
+//   fl::string name = doc["config"]["name"] | fl::string("unknown");
+//   for (auto m : doc["strips"][0]) { ... m.key ... m.value ... }
+//
+// parse() borrows the input: the text must outlive the document. Use
+// parse_owned() to copy the text into the arena first.
+//
+// Lookups go through json_ref, a pointer-sized handle with the read side of
+// the fl::json API (operator[], operator|, is_*/as_*/try_as, size,
+// contains). Scalar conversions follow fl::json exactly. The document is
+// immutable; to_json() converts a subtree into a regular fl::json when it
+// needs to be edited or serialized.
+
+#include "fl/stl/int.h"
+#include "fl/stl/json.h"
+#include "fl/stl/memory_resource.h"
+#include "fl/stl/optional.h"
+#include "fl/stl/span.h"
+#include "fl/stl/string.h"
+#include "fl/stl/string_view.h"
+#include "fl/stl/type_traits.h"
+#include "fl/stl/noexcept.h"
+
+#ifndef FL_JSON_ARENA_MAX_BLOCK
+#if FL_PLATFORM_HAS_LARGE_MEMORY
+#define FL_JSON_ARENA_MAX_BLOCK (64 * 1024)
+#else
+#define FL_JSON_ARENA_MAX_BLOCK 2048
+#endif
+#endif
+
+namespace fl {
+
+// Bump allocator: carves allocations out of blocks obtained from a
+// memory_resource and frees them all at once. Requests larger than the
+// block size get a dedicated block.
+class json_arena {
+  public:
+    explicit json_arena(fl::size block_size = 1024,
+                        memory_resource *resource = default_memory_resource()) FL_NO_EXCEPT;
+    ~json_arena() FL_NO_EXCEPT;
+
+    json_arena(json_arena &&other) FL_NO_EXCEPT;
+    json_arena &operator=(json_arena &&other) FL_NO_EXCEPT;
+    json_arena(const json_arena &) FL_NO_EXCEPT = delete;
+    json_arena &operator=(const json_arena &) FL_NO_EXCEPT = delete;
+
+    // 8-byte aligned. Returns nullptr for bytes == 0 or when the resource
+    // is out of memory.
+    void *allocate(fl::size bytes) FL_NO_EXCEPT;
+
+    // Frees every block.
+    void release() FL_NO_EXCEPT;
+
+    fl::size block_count() const FL_NO_EXCEPT { return mBlockCount; }
+    fl::size bytes_reserved() const FL_NO_EXCEPT { return mReserved; }
+    fl::size bytes_used() const FL_NO_EXCEPT { return mUsed; }
+
+  private:
+    struct Block {
+        Block *next;
+        fl::size size;  // total bytes including this header
+    };
+
+    void swap(json_arena &other) FL_NO_EXCEPT;
+
+    memory_resource *mResource;
+    fl::size mBlockSize;
+    Block *mHead;
+    char *mCur;
+    char *mEnd;
+    fl::size mBlockCount;
+    fl::size mReserved;
+    fl::size mUsed;
+};
+
+namespace detail {
+
+// kArrayU8/kArrayI16/kArrayF32 are numeric arrays packed the same way
+// json::parse() packs them (vector<u8>, vector<i16>, vector<float>).
+enum class json_node_type : u8 {
+    kNull, kBool, kInt, kFloat, kString, kArray, kObject, kArrayU8, kArrayI16, kArrayF32
+};
+
+struct json_member;
+
+// One value. Strings point into the source or the arena; containers point
+// at `size` contiguous children (or packed numbers) in the arena.
+struct json_node {
+    json_node_type type;
+    u32 size;  // string bytes, array elements or object members
+    union {
+        bool b;
+        i64 i;
+        float f;
+        const char *str;
+        const json_node *items;
+        const json_member *members;
+        const u8 *u8s;
+        const i16 *i16s;
+        const float *f32s;
+    };
+};
+
+struct json_member {
+    fl::string_view key;
+    json_node value;
+};
+
+// Member order within an object: length first, then bytes (the same
+// ordering as StringFastLess, so iteration matches fl::json).
+bool json_key_less(fl::string_view a, fl::string_view b) FL_NO_EXCEPT;
+
+inline bool json_node_is_array(json_node_type t) FL_NO_EXCEPT {
+    return t == json_node_type::kArray || t >= json_node_type::kArrayU8;
+}
+
+} // namespace detail
+
+// Lightweight, copyable handle to a value in a json_document (a 16-byte
+// copy of the node; containers still point into the arena). A default
+// constructed (or missing) json_ref behaves like JSON null.
+class json_ref {
+  public:
+    class iterator;
+
+    json_ref() FL_NO_EXCEPT { mNode.type = detail::json_node_type::kNull; mNode.size = 0; mNode.i = 0; }
+    explicit json_ref(const detail::json_node &node) FL_NO_EXCEPT : mNode(node) {}
+
+    bool is_null() const FL_NO_EXCEPT { return is(detail::json_node_type::kNull); }
+    bool has_value() const FL_NO_EXCEPT { return !is_null(); }
+    bool is_bool() const FL_NO_EXCEPT { return is(detail::json_node_type::kBool); }
+    bool is_int() const FL_NO_EXCEPT { return is(detail::json_node_type::kInt); }
+    bool is_float() const FL_NO_EXCEPT { return is(detail::json_node_type::kFloat); }
+    bool is_number() const FL_NO_EXCEPT { return is_int() || is_float(); }
+    bool is_string() const FL_NO_EXCEPT { return is(detail::json_node_type::kString); }
+    bool is_array() const FL_NO_EXCEPT { return detail::json_node_is_array(mNode.type); }
+    bool is_object() const FL_NO_EXCEPT { return is(detail::json_node_type::kObject); }
+
+    // Conversions, identical to the fl::json accessors of the same name.
+    fl::optional<bool> as_bool() const FL_NO_EXCEPT { return scalar().as_bool(); }
+    fl::optional<i64> as_int() const FL_NO_EXCEPT { return scalar().as_int(); }
+    template <typename IntType>
+    fl::optional<IntType> as_int() const FL_NO_EXCEPT {
+        return scalar().template as_int<IntType>();
+    }
+    fl::optional<float> as_float() const FL_NO_EXCEPT { return scalar().as_float(); }
+    template <typename FloatType>
+    fl::optional<FloatType> as_float() const FL_NO_EXCEPT {
+        return scalar().template as_float<FloatType>();
+    }
+    fl::optional<fl::string> as_string() const FL_NO_EXCEPT { return scalar().as_string(); }
+
+    // Zero-copy string access; empty for non-strings.
+    fl::string_view as_string_view() const FL_NO_EXCEPT {
+        return is_string() ? fl::string_view(mNode.str, mNode.size) : fl::string_view();
+    }
+
+    template <typename T>
+    fl::optional<T> try_as() const FL_NO_EXCEPT {
+        return as_impl(static_cast<T *>(nullptr));
+    }
+    template <typename T>
+    fl::optional<T> as() const FL_NO_EXCEPT { return try_as<T>(); }
+
+    // Default-value operator: same rules as fl::json (exact type, or a
+    // numeric conversion; anything else yields the fallback).
+    template <typename T>
+    T operator|(const T &fallback) const FL_NO_EXCEPT {
+        return default_or(fallback, static_cast<T *>(nullptr));
+    }
+    template <typename T>
+    T as_or(const T &fallback) const FL_NO_EXCEPT {
+        auto result = try_as<T>();
+        return result.has_value() ? *result : fallback;
+    }
+
+    // Navigation. Missing keys, out-of-range indexes and type mismatches
+    // return a null json_ref, so lookups chain safely.
+    json_ref operator[](fl::size idx) const FL_NO_EXCEPT;
+    json_ref operator[](int idx) const FL_NO_EXCEPT {
+        return idx < 0 ? json_ref() : (*this)[static_cast<fl::size>(idx)];
+    }
+    json_ref operator[](fl::string_view key) const FL_NO_EXCEPT;
+    json_ref operator[](const char *key) const FL_NO_EXCEPT { return (*this)[fl::string_view(key)]; }
+    json_ref operator[](const fl::string &key) const FL_NO_EXCEPT {
+        return (*this)[fl::string_view(key.c_str(), key.size())];
+    }
+
+    bool contains(fl::size idx) const FL_NO_EXCEPT { return is_array() && idx < mNode.size; }
+    bool contains(fl::string_view key) const FL_NO_EXCEPT { return find(key) != nullptr; }
+
+    // Elements of an array, members of an object, 0 otherwise.
+    fl::size size() const FL_NO_EXCEPT {
+        return (is_array() || is_object()) ? mNode.size : 0;
+    }
+
+    // Iterates object members (sorted by key, like fl::json) or array
+    // elements (with empty keys).
+    iterator begin() const FL_NO_EXCEPT;
+    iterator end() const FL_NO_EXCEPT;
+
+    // Copies the numeric elements of an array into `out` with conversion.
+    // Stops at the first non-numeric element. Returns the count copied.
+    template <typename T>
+    fl::size copy_to(fl::span<T> out) const FL_NO_EXCEPT {
+        if (!is_array()) {
+            return 0;
+        }
+        const fl::size count = mNode.size < out.size() ? mNode.size : out.size();
+        fl::size n = 0;
+        switch (mNode.type) {
+        case detail::json_node_type::kArrayU8:
+            for (; n < count; ++n) out[n] = static_cast<T>(mNode.u8s[n]);
+            break;
+        case detail::json_node_type::kArrayI16:
+            for (; n < count; ++n) out[n] = static_cast<T>(mNode.i16s[n]);
+            break;
+        case detail::json_node_type::kArrayF32:
+            for (; n < count; ++n) out[n] = static_cast<T>(mNode.f32s[n]);
+            break;
+        default:
+            for (; n < count; ++n) {
+                const detail::json_node &item = mNode.items[n];
+                if (item.type == detail::json_node_type::kInt) {
+                    out[n] = static_cast<T>(item.i);
+                } else if (item.type == detail::json_node_type::kFloat) {
+                    out[n] = static_cast<T>(item.f);
+                } else {
+                    break;
+                }
+            }
+            break;
+        }
+        return n;
+    }
+
+    // Deep copy into a regular, mutable fl::json.
+    json to_json() const FL_NO_EXCEPT;
+    fl::string to_string() const FL_NO_EXCEPT { return to_json().to_string(); }
+
+    const detail::json_node &node() const FL_NO_EXCEPT { return mNode; }
+
+  private:
+    bool is(detail::json_node_type t) const FL_NO_EXCEPT { return mNode.type == t; }
+    const detail::json_node *find(fl::string_view key) const FL_NO_EXCEPT;
+
+    // Scalars as a temporary json_value so conversions reuse the fl::json
+    // visitors. Only strings allocate; containers come back as null.
+    json_value scalar() const FL_NO_EXCEPT;
+
+    template <typename T>
+    typename fl::enable_if<fl::is_integral<T>::value && !fl::is_same<T, bool>::value, fl::optional<T>>::type
+    as_impl(T *) const FL_NO_EXCEPT { return as_int<T>(); }
+    fl::optional<bool> as_impl(bool *) const FL_NO_EXCEPT { return as_bool(); }
+    template <typename T>
+    typename fl::enable_if<fl::is_floating_point<T>::value, fl::optional<T>>::type
+    as_impl(T *) const FL_NO_EXCEPT { return as_float<T>(); }
+    fl::optional<fl::string> as_impl(fl::string *) const FL_NO_EXCEPT { return as_string(); }
+    fl::optional<fl::string_view> as_impl(fl::string_view *) const FL_NO_EXCEPT {
+        return is_string() ? fl::optional<fl::string_view>(as_string_view()) : fl::nullopt;
+    }
+    template <typename T>
+    fl::optional<fl::vector<T>> as_impl(fl::vector<T> *) const FL_NO_EXCEPT {
+        if (!is_array() || mNode.size == 0) {
+            return fl::nullopt;
+        }
+        fl::vector<T> result;
+        result.resize(mNode.size);
+        result.resize(copy_to(fl::span<T>(result.data(), result.size())));
+        return result.empty() ? fl::nullopt : fl::optional<fl::vector<T>>(fl::move(result));
+    }
+
+    template <typename T>
+    T default_or(const T &fallback, T *) const FL_NO_EXCEPT {
+        if (!is_number() && !is_bool()) {
+            return fallback;
+        }
+        return scalar() | fallback;
+    }
+    fl::string default_or(const fl::string &fallback, fl::string *) const FL_NO_EXCEPT {
+        return is_string() ? fl::string(mNode.str, mNode.size) : fallback;
+    }
+    fl::string_view default_or(const fl::string_view &fallback, fl::string_view *) const FL_NO_EXCEPT {
+        return is_string() ? as_string_view() : fallback;
+    }
+
+    detail::json_node mNode;
+};
+
+struct json_ref_member {
+    fl::string_view key;
+    json_ref value;
+};
+
+class json_ref::iterator {
+  public:
+    iterator() FL_NO_EXCEPT : mRef(), mIndex(0) {}
+    iterator(const json_ref &ref, fl::size index) FL_NO_EXCEPT : mRef(ref), mIndex(index) {}
+
+    json_ref_member operator*() const FL_NO_EXCEPT {
+        json_ref_member m;
+        if (mRef.is_object()) {
+            m.key = mRef.mNode.members[mIndex].key;
+            m.value = json_ref(mRef.mNode.members[mIndex].value);
+        } else {
+            m.value = mRef[mIndex];
+        }
+        return m;
+    }
+    iterator &operator++() FL_NO_EXCEPT {
+        ++mIndex;
+        return *this;
+    }
+    bool operator==(const iterator &o) const FL_NO_EXCEPT { return mIndex == o.mIndex; }
+    bool operator!=(const iterator &o) const FL_NO_EXCEPT { return !(*this == o); }
+
+  private:
+    json_ref mRef;
+    fl::size mIndex;
+};
+
+// Owns the arena (and, for parse_owned(), the source text) behind a tree
+// of json_ref handles. Move-only.
+class json_document {
+  public:
+    json_document() FL_NO_EXCEPT;
+    json_document(json_document &&other) FL_NO_EXCEPT;
+    json_document &operator=(json_document &&other) FL_NO_EXCEPT;
+    json_document(const json_document &) FL_NO_EXCEPT = delete;
+    json_document &operator=(const json_document &) FL_NO_EXCEPT = delete;
+
+    // Parses `text` without copying it; keys and plain strings reference
+    // it, so it must outlive the document. Invalid JSON yields a document
+    // with ok() == false and a null root, like json::parse().
+    static json_document parse(fl::string_view text,
+                               memory_resource *resource = default_memory_resource()) FL_NO_EXCEPT;
+
+    // As parse(), but copies `text` into the arena first.
+    static json_document parse_owned(fl::string_view text,
+                                     memory_resource *resource = default_memory_resource()) FL_NO_EXCEPT;
+
+    bool ok() const FL_NO_EXCEPT { return mRoot != nullptr; }
+    json_ref root() const FL_NO_EXCEPT { return mRoot ? json_ref(*mRoot) : json_ref(); }
+
+    // Root shortcuts so a document reads like an fl::json.
+    bool is_null() const FL_NO_EXCEPT { return root().is_null(); }
+    bool is_object() const FL_NO_EXCEPT { return root().is_object(); }
+    bool is_array() const FL_NO_EXCEPT { return root().is_array(); }
+    fl::size size() const FL_NO_EXCEPT { return root().size(); }
+    template <typename K>
+    json_ref operator[](const K &key) const FL_NO_EXCEPT { return root()[key]; }
+    template <typename T>
+    T operator|(const T &fallback) const FL_NO_EXCEPT { return root() | fallback; }
+    json to_json() const FL_NO_EXCEPT { return root().to_json(); }
+
+    const json_arena &arena() const FL_NO_EXCEPT { return mArena; }
+
+  private:
+    static json_document parse_impl(fl::string_view text, bool copy,
+                                    memory_resource *resource) FL_NO_EXCEPT;
+
+    json_arena mArena;
+    const detail::json_node *mRoot;
+};
+
+} // namespace fl
@@ -0,0 +1,586 @@
+#pragma once
+
+// IWYU pragma: private
+
+#include "fl/stl/json_reader.h"
+
+#include "fl/stl/bit_cast.h"
+#include "fl/stl/charconv.h"        // fl::parseInt
+#include "fl/stl/cstring.h"         // fl::memcpy, fl::memmove
+#include "fl/stl/detail/file_handle.h"
+#include "fl/stl/ieee754_string.h"  // fl::ieee754_parse_decimal
+#include "fl/stl/move.h"
+#include "fl/system/sketch_macros.h"  // FL_PLATFORM_HAS_LARGE_MEMORY
+
+namespace fl {
+
+namespace {
+
+// Bytes kept free for raw input while a token is being assembled; tokens
+// longer than (capacity - kJsonReaderReserve) are truncated.
+constexpr fl::size kJsonReaderReserve = 16;
+constexpr fl::size kJsonReaderMinBuffer = 32;
+
+inline bool json_reader_is_ws(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+inline bool json_reader_is_literal(char c) {
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+           c == '-' || c == '+' || c == '.';
+}
+
+} // namespace
+
+json_reader::json_reader(fl::size buffer_size) FL_NO_EXCEPT {
+    mOwned.resize(buffer_size < kJsonReaderMinBuffer ? kJsonReaderMinBuffer : buffer_size);
+    init(mOwned.data(), mOwned.size());
+}
+
+json_reader::json_reader(fl::span<char> buffer) FL_NO_EXCEPT {
+    init(buffer.data(), buffer.size());
+}
+
+json_reader::json_reader(fl::string_view text, fl::size buffer_size) FL_NO_EXCEPT
+    : json_reader(buffer_size) {
+    set_source(text);
+}
+
+void json_reader::init(char *buf, fl::size cap) FL_NO_EXCEPT {
+    mBuf = buf;
+    mCap = cap;
+    mPos = 0;
+    mLen = 0;
+    mInput = nullptr;
+    mInputLen = 0;
+    mEof = false;
+    mEvent = json_event::kNone;
+    mText = buf;
+    mTextLen = 0;
+    mTruncated = false;
+    mNumberIsFloat = false;
+    mRootDone = false;
+    mError = nullptr;
+    mDepth = 0;
+    mState = kStart;
+    mPathLen = 0;
+    mPathBad = 0;
+    if (!buf || cap < kJsonReaderMinBuffer) {
+        fail("json_reader: buffer too small");
+    }
+}
+
+void json_reader::set_source(source_fn source) FL_NO_EXCEPT {
+    mSource = fl::move(source);
+    mInput = nullptr;
+    mInputLen = 0;
+}
+
+void json_reader::set_source(filebuf &file) FL_NO_EXCEPT {
+    filebuf *f = &file;
+    set_source(source_fn([f](char *dst, fl::size max) -> fl::size {
+        return f->read(dst, max);
+    }));
+}
+
+void json_reader::set_source(fl::string_view text) FL_NO_EXCEPT {
+    mSource = source_fn();
+    mInput = text.data();
+    mInputLen = text.size();
+}
+
+json_event json_reader::fail(const char *msg) FL_NO_EXCEPT {
+    if (mEvent != json_event::kError) {
+        mError = msg;
+    }
+    mEvent = json_event::kError;
+    mText = mBuf;
+    mTextLen = 0;
+    return mEvent;
+}
+
+// Moves unread input to the front of the buffer and reads more.
+bool json_reader::refill() FL_NO_EXCEPT {
+    if (mEof) {
+        return false;
+    }
+    const fl::size keep = mLen - mPos;
+    if (keep > 0 && mPos > 0) {
+        fl::memmove(mBuf, mBuf + mPos, keep);
+    }
+    mPos = 0;
+    mLen = keep;
+    fl::size got = 0;
+    if (mSource) {
+        got = mSource(mBuf + mLen, mCap - mLen);
+    } else if (mInputLen > 0) {
+        got = mInputLen < mCap - mLen ? mInputLen : mCap - mLen;
+        fl::memcpy(mBuf + mLen, mInput, got);
+        mInput += got;
+        mInputLen -= got;
+    }
+    if (got == 0) {
+        mEof = true;
+        return false;
+    }
+    mLen += got;
+    return true;
+}
+
+// Token assembly ran out of input: compact the token text [start, w) and
+// the unread bytes [i, mLen) to the front of the buffer, then read more.
+bool json_reader::refill_token(fl::size &start, fl::size &w, fl::size &i) FL_NO_EXCEPT {
+    if (mEof) {
+        return false;
+    }
+    const fl::size text = w - start;
+    const fl::size raw = mLen - i;
+    if (start > 0) {
+        fl::memmove(mBuf, mBuf + start, text);
+    }
+    if (i > text) {
+        fl::memmove(mBuf + text, mBuf + i, raw);
+    }
+    start = 0;
+    w = text;
+    i = text;
+    mPos = 0;
+    mLen = text + raw;
+    // refill() keeps [mPos, mLen) -- everything now in the buffer.
+    return refill();
+}
+
+int json_reader::peek_nonws() FL_NO_EXCEPT {
+    for (;;) {
+        while (mPos < mLen) {
+            const char c = mBuf[mPos];
+            if (!json_reader_is_ws(c)) {
+                return static_cast<u8>(c);
+            }
+            ++mPos;
+        }
+        if (!refill()) {
+            return -1;
+        }
+    }
+}
+
+// At mBuf[mPos] == '"'. Unescapes in place; text() points into the buffer.
+bool json_reader::lex_string() FL_NO_EXCEPT {
+    fl::size start = mPos + 1;
+    fl::size w = start;
+    fl::size i = start;
+    const fl::size limit = mCap - kJsonReaderReserve;
+    for (;;) {
+        if (i >= mLen || (mBuf[i] == '\\' && i + 1 >= mLen)) {
+            if (!refill_token(start, w, i)) {
+                return false;
+            }
+            continue;
+        }
+        char c = mBuf[i];
+        if (c == '"') {
+            mText = mBuf + start;
+            mTextLen = w - start;
+            mPos = i + 1;
+            return true;
+        }
+        if (c == '\\') {
+            // Same escapes as json::parse(); unknown ones pass through.
+            ++i;
+            switch (mBuf[i]) {
+                case '"':  c = '"'; ++i; break;
+                case '\\': c = '\\'; ++i; break;
+                case '/':  c = '/'; ++i; break;
+                case 'b':  c = '\b'; ++i; break;
+                case 'f':  c = '\f'; ++i; break;
+                case 'n':  c = '\n'; ++i; break;
+                case 'r':  c = '\r'; ++i; break;
+                case 't':  c = '\t'; ++i; break;
+                default:   break;
+            }
+        } else {
+            ++i;
+        }
+        if (w - start < limit) {
+            mBuf[w++] = c;
+        } else {
+            mTruncated = true;
+        }
+    }
+}
+
+// Number or true/false/null at mBuf[mPos].
+bool json_reader::lex_literal() FL_NO_EXCEPT {
+    fl::size start = mPos;
+    fl::size w = start;
+    fl::size i = start;
+    const fl::size limit = mCap - kJsonReaderReserve;
+    for (;;) {
+        if (i >= mLen) {
+            if (!refill_token(start, w, i)) {
+                break;  // end of input ends the token
+            }
+            continue;
+        }
+        const char c = mBuf[i];
+        if (!json_reader_is_literal(c)) {
+            break;
+        }
+        ++i;
+        if (w - start < limit) {
+            mBuf[w++] = c;
+        } else {
+            mTruncated = true;
+        }
+    }
+    mText = mBuf + start;
+    mTextLen = w - start;
+    mPos = i;
+
+    const fl::string_view t = text();
+    if (t == "true" || t == "false") {
+        mEvent = json_event::kBool;
+        return true;
+    }
+    if (t == "null") {
+        mEvent = json_event::kNull;
+        return true;
+    }
+    if (t.empty() || mTruncated || !(t[0] == '-' || (t[0] >= '0' && t[0] <= '9'))) {
+        fail("json_reader: invalid literal");
+        return false;
+    }
+    mNumberIsFloat = false;
+    for (fl::size k = 0; k < t.size(); ++k) {
+        if (t[k] == '.' || t[k] == 'e' || t[k] == 'E') {
+            mNumberIsFloat = true;
+            break;
+        }
+    }
+    mEvent = json_event::kNumber;
+    return true;
+}
+
+bool json_reader::value_allowed() const FL_NO_EXCEPT {
+    if (mDepth == 0) {
+        return !mRootDone;
+    }
+    if (mObject[mDepth - 1]) {
+        return mState == kNeedValue;
+    }
+    return mState == kStart || mState == kNeedValue;
+}
+
+void json_reader::set_segment(fl::string_view key, bool is_key, u32 index) FL_NO_EXCEPT {
+    const int k = mDepth - 1;
+    if (mPathBad > k) {
+        mPathBad = 0;
+    }
+    fl::size len = mBase[k];
+    char digits[10];
+    fl::size ndigits = 0;
+    if (!is_key) {
+        do {
+            digits[ndigits++] = static_cast<char>('0' + index % 10);
+            index /= 10;
+        } while (index > 0);
+    }
+    bool ok = len < FL_JSON_READER_MAX_PATH;
+    if (ok) {
+        mPath[len++] = '/';
+    }
+    if (is_key) {
+        // RFC 6901: '~' -> "~0", '/' -> "~1".
+        for (fl::size n = 0; ok && n < key.size(); ++n) {
+            const char c = key[n];
+            const bool esc = c == '~' || c == '/';
+            if (len + (esc ? 2 : 1) > FL_JSON_READER_MAX_PATH) {
+                ok = false;
+                break;
+            }
+            if (esc) {
+                mPath[len++] = '~';
+                mPath[len++] = c == '~' ? '0' : '1';
+            } else {
+                mPath[len++] = c;
+            }
+        }
+        ok = ok && !mTruncated;
+    } else if (len + ndigits > FL_JSON_READER_MAX_PATH) {
+        ok = false;
+    } else {
+        while (ndigits > 0) {
+            mPath[len++] = digits[--ndigits];
+        }
+    }
+    if (ok) {
+        mPathLen = static_cast<u16>(len);
+    } else {
+        mPathLen = mBase[k];
+        mPathBad = mDepth;
+    }
+}
+
+void json_reader::begin_value() FL_NO_EXCEPT {
+    if (mDepth == 0) {
+        mRootDone = true;
+    } else if (!mObject[mDepth - 1]) {
+        set_segment(fl::string_view(), false, mIndex[mDepth - 1]++);
+    }
+    mState = kAfterValue;
+}
+
+json_event json_reader::open(bool object) FL_NO_EXCEPT {
+    if (mDepth >= FL_JSON_READER_MAX_DEPTH) {
+        return fail("json_reader: nesting too deep");
+    }
+    mSaved[mDepth] = mState;
+    mObject[mDepth] = object;
+    mIndex[mDepth] = 0;
+    mBase[mDepth] = mPathLen;
+    ++mDepth;
+    mState = kStart;
+    mEvent = object ? json_event::kBeginObject : json_event::kBeginArray;
+    return mEvent;
+}
+
+void json_reader::pop() FL_NO_EXCEPT {
+    --mDepth;
+    mState = mSaved[mDepth];
+    mPathLen = mBase[mDepth];
+    if (mPathBad > mDepth) {
+        mPathBad = 0;
+    }
+}
+
+json_event json_reader::close(bool object) FL_NO_EXCEPT {
+    if (mDepth == 0 || mObject[mDepth - 1] != object ||
+        (mState != kStart && mState != kAfterValue)) {
+        return fail(object ? "json_reader: unexpected '}'" : "json_reader: unexpected ']'");
+    }
+    ++mPos;
+    pop();
+    mEvent = object ? json_event::kEndObject : json_event::kEndArray;
+    return mEvent;
+}
+
+json_event json_reader::next() FL_NO_EXCEPT {
+    if (mEvent == json_event::kError || mEvent == json_event::kEnd) {
+        return mEvent;
+    }
+    mTruncated = false;
+    mTextLen = 0;
+    for (;;) {
+        const int c = peek_nonws();
+        if (c < 0) {
+            if (mDepth == 0 && mRootDone) {
+                mEvent = json_event::kEnd;
+                return mEvent;
+            }
+            return fail("json_reader: unexpected end of input");
+        }
+        switch (c) {
+            case ',':
+                if (mDepth == 0 || mState != kAfterValue) {
+                    return fail("json_reader: unexpected ','");
+                }
+                ++mPos;
+                mState = mObject[mDepth - 1] ? kNeedKey : kNeedValue;
+                continue;
+            case ':':
+                if (mDepth == 0 || mState != kNeedColon) {
+                    return fail("json_reader: unexpected ':'");
+                }
+                ++mPos;
+                mState = kNeedValue;
+                continue;
+            case '}':
+                return close(true);
+            case ']':
+                return close(false);
+            case '{':
+            case '[':
+                if (!value_allowed()) {
+                    return fail("json_reader: unexpected value");
+                }
+                ++mPos;
+                begin_value();
+                return open(c == '{');
+            case '"':
+                if (mDepth > 0 && mObject[mDepth - 1] && (mState == kStart || mState == kNeedKey)) {
+                    if (!lex_string()) {
+                        return fail("json_reader: unterminated string");
+                    }
+                    set_segment(text(), true, 0);
+                    mState = kNeedColon;
+                    mEvent = json_event::kKey;
+                    return mEvent;
+                }
+                if (!value_allowed()) {
+                    return fail("json_reader: unexpected string");
+                }
+                if (!lex_string()) {
+                    return fail("json_reader: unterminated string");
+                }
+                begin_value();
+                mEvent = json_event::kString;
+                return mEvent;
+            default:
+                if (!value_allowed()) {
+                    return fail("json_reader: unexpected character");
+                }
+                if (!lex_literal()) {
+                    return mEvent;
+                }
+                begin_value();
+                return mEvent;
+        }
+    }
+}
+
+// Raw scan to the matching close bracket: only string quotes/escapes and
+// brackets are looked at, nothing is tokenized or stored.
+bool json_reader::skip() FL_NO_EXCEPT {
+    if (mEvent != json_event::kBeginObject && mEvent != json_event::kBeginArray) {
+        return mEvent != json_event::kError;
+    }
+    int depth = 1;
+    bool in_string = false;
+    bool escape = false;
+    for (;;) {
+        const char *p = mBuf + mPos;
+        const char *end = mBuf + mLen;
+        while (p < end) {
+            const char c = *p++;
+            if (in_string) {
+                if (escape) {
+                    escape = false;
+                } else if (c == '\\') {
+                    escape = true;
+                } else if (c == '"') {
+                    in_string = false;
+                }
+            } else if (c == '"') {
+                in_string = true;
+            } else if (c == '{' || c == '[') {
+                ++depth;
+            } else if ((c == '}' || c == ']') && --depth == 0) {
+                mPos = static_cast<fl::size>(p - mBuf);
+                const bool object = c == '}';
+                if (mObject[mDepth - 1] != object) {
+                    fail("json_reader: mismatched bracket");
+                    return false;
+                }
+                pop();
+                mEvent = object ? json_event::kEndObject : json_event::kEndArray;
+                return true;
+            }
+        }
+        mPos = mLen;
+        if (!refill()) {
+            fail("json_reader: unexpected end of input");
+            return false;
+        }
+    }
+}
+
+namespace {
+
+// JSON pointer `p` relative to `target`: 0 unrelated, 1 equal, 2 ancestor.
+int json_pointer_relation(fl::string_view p, fl::string_view target) {
+    if (p.size() > target.size() || fl::memcmp(p.data(), target.data(), p.size()) != 0) {
+        return 0;
+    }
+    if (p.size() == target.size()) {
+        return 1;
+    }
+    return target[p.size()] == '/' ? 2 : 0;
+}
+
+} // namespace
+
+bool json_reader::find(fl::string_view json_pointer) FL_NO_EXCEPT {
+    for (;;) {
+        const json_event e = next();
+        switch (e) {
+            case json_event::kEnd:
+            case json_event::kError:
+                return false;
+            case json_event::kEndObject:
+            case json_event::kEndArray:
+                continue;
+            default:
+                break;
+        }
+        const int rel = pointer_overflow() ? 0 : json_pointer_relation(pointer(), json_pointer);
+        if (e == json_event::kKey) {
+            if (rel == 1) {
+                const json_event v = next();
+                return v != json_event::kError && v != json_event::kEnd;
+            }
+            if (rel == 0) {
+                // Not on the way to the target: drop the member's value.
+                const json_event v = next();
+                if ((v == json_event::kBeginObject || v == json_event::kBeginArray) && !skip()) {
+                    return false;
+                }
+                if (v == json_event::kError) {
+                    return false;
+                }
+            }
+            continue;
+        }
+        if (rel == 1) {
+            return true;
+        }
+        if (rel == 0 && !skip()) {
+            return false;
+        }
+    }
+}
+
+i64 json_reader::int_value() const FL_NO_EXCEPT {
+    if (mEvent != json_event::kNumber) {
+        return 0;
+    }
+#if FL_PLATFORM_HAS_LARGE_MEMORY
+    if (mNumberIsFloat) {
+        return static_cast<i64>(float_value());
+    }
+#endif
+    return static_cast<i64>(fl::parseInt(mText, mTextLen));
+}
+
+float json_reader::float_value() const FL_NO_EXCEPT {
+    if (mEvent != json_event::kNumber) {
+        return 0.0f;
+    }
+#if FL_PLATFORM_HAS_LARGE_MEMORY
+    if (mNumberIsFloat) {
+        return fl::bit_cast<float>(fl::ieee754_parse_decimal(mText, mTextLen));
+    }
+#endif
+    // Low-memory targets parse float literals as integers, like json::parse().
+    return static_cast<float>(static_cast<fl::i32>(fl::parseInt(mText, mTextLen)));
+}
+
+bool json_reader::read(bool &out) FL_NO_EXCEPT {
+    if (mEvent != json_event::kBool) {
+        skip();
+        return false;
+    }
+    out = bool_value();
+    return true;
+}
+
+bool json_reader::read(fl::string &out) FL_NO_EXCEPT {
+    if (mEvent != json_event::kString) {
+        skip();
+        return false;
+    }
+    out.assign(mText, mTextLen);
+    return !mTruncated;
+}
+
+} // namespace fl
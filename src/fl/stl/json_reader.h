@@ -0,0 +1,240 @@
+#pragma once
+
+// json_reader — pull (SAX-style) JSON reader over chunked input.
+//
+// Reads JSON through a fixed-size buffer refilled from a source callback
+// (file, socket, in-memory text), one event at a time, without building a
+// DOM. Memory use is the buffer plus a small fixed path/depth stack,
+// regardless of document size.
+//
+//   fl::json_reader reader(1024);
+//   reader.set_source(*file.rdbuf());
+//   fl::vector<float> xs;
+//   if (reader.find("/map/strip1/x") && reader.read(xs)) { ... }
+//
+// find() walks forward to the value at an RFC 6901 JSON pointer, skipping
+// every subtree that cannot contain it with a raw byte scan (no
+// tokenizing, no allocation). It only moves forward, so look up several
+// paths in document order, or drive next() directly:
+//
+//   while (reader.next() == fl::json_event::kKey) {   // inside an object
+//       if (reader.text() == "fps") { reader.next(); fps = reader.int_value(); }
+//       else { reader.next(); reader.skip(); }
+//   }
+//
+// Strings longer than the buffer are truncated (truncated() reports it)
+// rather than failing, so large values can always be skipped. Numbers
+// follow json::parse(): a literal with '.', 'e' or 'E' is a float, anything
+// else an integer.
+//
+// A socket source is a callback around read_some():
+//
+//   reader.set_source([&](char *dst, fl::size n) -> fl::size {
+//       fl::asio::error_code ec;
+//       return sock.read_some(fl::span<u8>((u8 *)dst, n), ec);  // 0 = end
+//   });
+
+#include "fl/stl/function.h"
+#include "fl/stl/int.h"
+#include "fl/stl/span.h"
+#include "fl/stl/string.h"
+#include "fl/stl/string_view.h"
+#include "fl/stl/type_traits.h"
+#include "fl/stl/vector.h"
+#include "fl/stl/noexcept.h"
+
+#ifndef FL_JSON_READER_MAX_DEPTH
+#define FL_JSON_READER_MAX_DEPTH 32
+#endif
+
+#ifndef FL_JSON_READER_MAX_PATH
+#define FL_JSON_READER_MAX_PATH 128
+#endif
+
+namespace fl {
+
+class filebuf;
+
+enum class json_event : u8 {
+    kNone,         // next() not called yet
+    kBeginObject,
+    kEndObject,
+    kBeginArray,
+    kEndArray,
+    kKey,          // text() is the (unescaped) member name
+    kString,       // text() is the (unescaped) value
+    kNumber,       // text() is the literal; see int_value()/float_value()
+    kBool,
+    kNull,
+    kEnd,          // complete document consumed
+    kError,        // malformed input; see error()
+};
+
+class json_reader {
+  public:
+    // Returns up to `max` bytes written to `dst`; 0 means end of input.
+    using source_fn = fl::function<fl::size(char *dst, fl::size max)>;
+
+    // Owns a heap buffer of `buffer_size` bytes (one allocation).
+    explicit json_reader(fl::size buffer_size = 256) FL_NO_EXCEPT;
+    // Uses caller storage; no allocation at all.
+    explicit json_reader(fl::span<char> buffer) FL_NO_EXCEPT;
+    // Reads from in-memory text (which must outlive the reader).
+    explicit json_reader(fl::string_view text, fl::size buffer_size = 256) FL_NO_EXCEPT;
+
+    json_reader(const json_reader &) FL_NO_EXCEPT = delete;
+    json_reader &operator=(const json_reader &) FL_NO_EXCEPT = delete;
+
+    void set_source(source_fn source) FL_NO_EXCEPT;
+    void set_source(filebuf &file) FL_NO_EXCEPT;
+    void set_source(fl::string_view text) FL_NO_EXCEPT;
+
+    // Advances to the next event. Separators are consumed silently.
+    json_event next() FL_NO_EXCEPT;
+    json_event event() const FL_NO_EXCEPT { return mEvent; }
+
+    // Payload of the current kKey/kString/kNumber/kBool/kNull event. Valid
+    // until the next call that reads input.
+    fl::string_view text() const FL_NO_EXCEPT { return fl::string_view(mText, mTextLen); }
+    // The current string or key did not fit in the buffer and was cut.
+    bool truncated() const FL_NO_EXCEPT { return mTruncated; }
+
+    bool bool_value() const FL_NO_EXCEPT { return mEvent == json_event::kBool && mText[0] == 't'; }
+    bool is_float() const FL_NO_EXCEPT { return mEvent == json_event::kNumber && mNumberIsFloat; }
+    // Numeric value of the current kNumber event (0 otherwise), converted
+    // the way json's operator| converts.
+    i64 int_value() const FL_NO_EXCEPT;
+    float float_value() const FL_NO_EXCEPT;
+
+    // JSON pointer of the current value (for kKey: of the member's value;
+    // for end events: of the container). Empty string is the root.
+    fl::string_view pointer() const FL_NO_EXCEPT { return fl::string_view(mPath, mPathLen); }
+    // The pointer exceeded FL_JSON_READER_MAX_PATH and is not usable.
+    bool pointer_overflow() const FL_NO_EXCEPT { return mPathBad != 0; }
+    // Number of open containers.
+    int depth() const FL_NO_EXCEPT { return mDepth; }
+
+    // If the current event opens a container, consumes it through the
+    // matching end event. Otherwise does nothing. False on error.
+    bool skip() FL_NO_EXCEPT;
+
+    // Advances to the start of the value at `json_pointer` (for example
+    // "/map/strip1/x" or "/strips/0/pins"), skipping unrelated subtrees.
+    // Searches forward from the current position; false if the document
+    // ends first.
+    bool find(fl::string_view json_pointer) FL_NO_EXCEPT;
+
+    // Typed extraction of the current value (the event find() or next()
+    // just returned). Containers are consumed through their end event.
+    // Returns false on a type mismatch, leaving `out` unspecified.
+    bool read(bool &out) FL_NO_EXCEPT;
+    bool read(fl::string &out) FL_NO_EXCEPT;
+    template <typename T>
+    typename fl::enable_if<fl::is_arithmetic<T>::value && !fl::is_same<T, bool>::value, bool>::type
+    read(T &out) FL_NO_EXCEPT {
+        if (mEvent != json_event::kNumber) {
+            skip();
+            return false;
+        }
+        out = is_float() ? static_cast<T>(float_value()) : static_cast<T>(int_value());
+        return true;
+    }
+    // Numeric array into a vector (cleared first). Non-numeric elements
+    // are skipped and make the result false.
+    template <typename T>
+    bool read(fl::vector<T> &out) FL_NO_EXCEPT {
+        out.clear();
+        return read_numbers([&out](const json_reader &r) {
+            out.push_back(r.is_float() ? static_cast<T>(r.float_value())
+                                       : static_cast<T>(r.int_value()));
+        });
+    }
+    // Numeric array into fixed storage, for constant-memory extraction.
+    // Elements past out.size() are consumed and dropped. Returns the
+    // number of elements stored (0 if the value is not an array).
+    template <typename T>
+    fl::size read_array(fl::span<T> out) FL_NO_EXCEPT {
+        fl::size n = 0;
+        read_numbers([&out, &n](const json_reader &r) {
+            if (n < out.size()) {
+                out[n++] = r.is_float() ? static_cast<T>(r.float_value())
+                                        : static_cast<T>(r.int_value());
+            }
+        });
+        return n;
+    }
+
+    const char *error() const FL_NO_EXCEPT { return mError; }
+
+  private:
+    enum State : u8 { kStart, kNeedKey, kNeedColon, kNeedValue, kAfterValue };
+
+    void init(char *buf, fl::size cap) FL_NO_EXCEPT;
+    json_event fail(const char *msg) FL_NO_EXCEPT;
+    int peek_nonws() FL_NO_EXCEPT;
+    bool refill() FL_NO_EXCEPT;
+    bool refill_token(fl::size &start, fl::size &w, fl::size &i) FL_NO_EXCEPT;
+    bool lex_string() FL_NO_EXCEPT;
+    bool lex_literal() FL_NO_EXCEPT;
+    bool value_allowed() const FL_NO_EXCEPT;
+    void begin_value() FL_NO_EXCEPT;
+    void set_segment(fl::string_view key, bool is_key, u32 index) FL_NO_EXCEPT;
+    json_event open(bool object) FL_NO_EXCEPT;
+    json_event close(bool object) FL_NO_EXCEPT;
+    void pop() FL_NO_EXCEPT;
+
+    // Calls sink(*this) for each number in the current array.
+    template <typename Sink>
+    bool read_numbers(Sink sink) FL_NO_EXCEPT {
+        if (mEvent != json_event::kBeginArray) {
+            skip();
+            return false;
+        }
+        const int depth = mDepth;
+        bool ok = true;
+        for (;;) {
+            const json_event e = next();
+            if (e == json_event::kNumber) {
+                sink(*this);
+            } else if (e == json_event::kEndArray && mDepth < depth) {
+                return ok;
+            } else if (e == json_event::kError || e == json_event::kEnd) {
+                return false;
+            } else {
+                ok = false;
+                skip();
+            }
+        }
+    }
+
+    fl::vector<char> mOwned;
+    char *mBuf;
+    fl::size mCap;
+    fl::size mPos;  // next unread byte
+    fl::size mLen;  // end of buffered input
+    source_fn mSource;
+    const char *mInput;  // in-memory source when mSource is empty
+    fl::size mInputLen;
+    bool mEof;
+
+    json_event mEvent;
+    const char *mText;
+    fl::size mTextLen;
+    bool mTruncated;
+    bool mNumberIsFloat;
+    bool mRootDone;
+    const char *mError;
+
+    int mDepth;
+    State mState;  // state of the innermost container (or the root)
+    bool mObject[FL_JSON_READER_MAX_DEPTH];
+    State mSaved[FL_JSON_READER_MAX_DEPTH];  // parent state while nested
+    u32 mIndex[FL_JSON_READER_MAX_DEPTH];    // next array index
+    u16 mBase[FL_JSON_READER_MAX_DEPTH];     // path length of the container
+
+    char mPath[FL_JSON_READER_MAX_PATH];
+    u16 mPathLen;
+    int mPathBad;  // depth whose segment overflowed, 0 = none
+};
+
+} // namespace fl
@@ -5,6 +5,7 @@
 #include "fl/system/engine_events.cpp.hpp"
 #include "fl/system/fastled_internal.cpp.hpp"
 #include "fl/system/file_system.cpp.hpp"
+#include "fl/system/frame_telemetry.cpp.hpp"
 #include "fl/system/heap.cpp.hpp"
 #include "fl/system/pin.cpp.hpp"
 #include "fl/system/pins.cpp.hpp"
@@ -0,0 +1,204 @@
+/// @file frame_telemetry.cpp.hpp
+/// @brief FrameTelemetry histograms and frame ring buffer
+
+#include "fl/system/frame_telemetry.h"
+#include "fl/stl/chrono.h"
+#include "fl/stl/cstring.h"
+#include "fl/stl/singleton.h"
+#include "fl/stl/noexcept.h"
+
+namespace fl {
+
+namespace {
+
+// ENCODE and ENQUEUE are sampled per channel; everything else per frame.
+bool isPerChannelStage(int stage) FL_NO_EXCEPT {
+    return stage == static_cast<int>(FrameStage::ENCODE) ||
+           stage == static_cast<int>(FrameStage::ENQUEUE);
+}
+
+} // namespace
+
+const char* frameStageName(FrameStage stage) FL_NO_EXCEPT {
+    switch (stage) {
+        case FrameStage::FRAME: return "frame";
+        case FrameStage::DRAW: return "draw";
+        case FrameStage::THROTTLE: return "throttle";
+        case FrameStage::POWER: return "power";
+        case FrameStage::ENCODE: return "encode";
+        case FrameStage::ENQUEUE: return "enqueue";
+        case FrameStage::WAIT: return "wait";
+        case FrameStage::COUNT: break;
+    }
+    return "";
+}
+
+// ============================================================================
+// TimeHistogram
+// ============================================================================
+
+void TimeHistogram::record(u32 us) FL_NO_EXCEPT {
+    mBuckets[bucketFor(us)]++;
+    if (mCount == 0 || us < mMin) {
+        mMin = us;
+    }
+    if (us > mMax) {
+        mMax = us;
+    }
+    mCount++;
+    mSum += us;
+}
+
+void TimeHistogram::reset() FL_NO_EXCEPT {
+    fl::memset(mBuckets, 0, sizeof(mBuckets));
+    mCount = 0;
+    mMin = 0;
+    mMax = 0;
+    mSum = 0;
+}
+
+u32 TimeHistogram::bucketLimitUs(int i) FL_NO_EXCEPT {
+    if (i >= kBuckets - 1) {
+        return 0;
+    }
+    return static_cast<u32>(1) << i;
+}
+
+int TimeHistogram::bucketFor(u32 us) FL_NO_EXCEPT {
+    int bucket = 0;
+    while (us != 0 && bucket < kBuckets - 1) {
+        us >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+u32 TimeHistogram::percentileUs(u8 pct) const FL_NO_EXCEPT {
+    if (mCount == 0) {
+        return 0;
+    }
+    if (pct > 100) {
+        pct = 100;
+    }
+    const u64 target = (static_cast<u64>(mCount) * pct + 99) / 100;
+    u64 seen = 0;
+    for (int i = 0; i < kBuckets; ++i) {
+        seen += mBuckets[i];
+        if (seen >= target && seen > 0) {
+            const u32 limit = bucketLimitUs(i);
+            // Bucket i covers values below `limit`; the last bucket is open.
+            const u32 upper = limit ? limit - 1 : mMax;
+            return upper < mMax ? upper : mMax;
+        }
+    }
+    return mMax;
+}
+
+// ============================================================================
+// FrameTelemetry
+// ============================================================================
+
+FrameTelemetry& FrameTelemetry::instance() FL_NO_EXCEPT {
+    return Singleton<FrameTelemetry>::instance();
+}
+
+FrameTelemetry::FrameTelemetry() FL_NO_EXCEPT
+    : mEnabled(FASTLED_FRAME_TELEMETRY ? true : false) {
+    reset();
+}
+
+void FrameTelemetry::reset() FL_NO_EXCEPT {
+    for (int i = 0; i < kStages; ++i) {
+        mHistograms[i].reset();
+    }
+    fl::memset(mHistory, 0, sizeof(mHistory));
+    fl::memset(&mCurrent, 0, sizeof(mCurrent));
+    mFrames = 0;
+    mFrameStartUs = 0;
+    mLastEndUs = 0;
+    mHaveLastEnd = false;
+    mInFrame = false;
+}
+
+void FrameTelemetry::beginFrame(u32 nowUs) FL_NO_EXCEPT {
+    if (!mEnabled) {
+        return;
+    }
+    fl::memset(&mCurrent, 0, sizeof(mCurrent));
+    mInFrame = true;
+    mFrameStartUs = nowUs;
+    if (mHaveLastEnd) {
+        mCurrent.stageUs[static_cast<int>(FrameStage::DRAW)] = nowUs - mLastEndUs;
+    }
+}
+
+void FrameTelemetry::addStage(FrameStage stage, u32 us) FL_NO_EXCEPT {
+    if (!mEnabled) {
+        return;
+    }
+    const int idx = static_cast<int>(stage);
+    if (isPerChannelStage(idx)) {
+        mHistograms[idx].record(us);
+        if (stage == FrameStage::ENQUEUE) {
+            mCurrent.channels++;
+        }
+    } else if (!mInFrame) {
+        // Outside FastLED.show() (e.g. a direct ChannelManager wait): no
+        // frame to fold into, so it is a sample of its own.
+        mHistograms[idx].record(us);
+        return;
+    }
+    mCurrent.stageUs[idx] += us;
+}
+
+void FrameTelemetry::endFrame(u32 nowUs) FL_NO_EXCEPT {
+    if (!mEnabled || !mInFrame) {
+        return;
+    }
+    mInFrame = false;
+    mFrames++;
+    mCurrent.frame = mFrames;
+    mCurrent.stageUs[static_cast<int>(FrameStage::FRAME)] = nowUs - mFrameStartUs;
+
+    for (int i = 0; i < kStages; ++i) {
+        if (isPerChannelStage(i)) {
+            continue;  // Already sampled per channel in addStage().
+        }
+        if (i == static_cast<int>(FrameStage::DRAW) && !mHaveLastEnd) {
+            continue;  // First frame: no previous show() to measure from.
+        }
+        mHistograms[i].record(mCurrent.stageUs[i]);
+    }
+    mHistory[(mFrames - 1) % kHistory] = mCurrent;
+    mLastEndUs = nowUs;
+    mHaveLastEnd = true;
+}
+
+fl::size FrameTelemetry::history(fl::span<FrameRecord> out) const FL_NO_EXCEPT {
+    const fl::size stored = mFrames < kHistory ? mFrames : kHistory;
+    const fl::size n = out.size() < stored ? out.size() : stored;
+    for (fl::size i = 0; i < n; ++i) {
+        const u32 frame = mFrames - static_cast<u32>(n) + static_cast<u32>(i);
+        out[i] = mHistory[frame % kHistory];
+    }
+    return n;
+}
+
+// ============================================================================
+// ScopedFrameStage
+// ============================================================================
+
+ScopedFrameStage::ScopedFrameStage(FrameStage stage) FL_NO_EXCEPT
+    : mStage(stage), mActive(FrameTelemetry::instance().isEnabled()), mStartUs(0) {
+    if (mActive) {
+        mStartUs = fl::micros();
+    }
+}
+
+ScopedFrameStage::~ScopedFrameStage() FL_NO_EXCEPT {
+    if (mActive) {
+        FrameTelemetry::instance().addStage(mStage, fl::micros() - mStartUs);
+    }
+}
+
+} // namespace fl
@@ -0,0 +1,179 @@
+#pragma once
+
+/**
+## Frame Telemetry
+
+Built-in record of where FastLED.show() time goes, so regressions can be
+found in the field without hand-instrumenting every sketch.
+
+### Stages (fl::FrameStage):
+- `FRAME`    — whole FastLED.show() call
+- `DRAW`     — user code between the end of one show() and the next
+- `THROTTLE` — setMaxRefreshRate() wait
+- `POWER`    — power-limiting brightness calculation
+- `ENCODE`   — pixel encode, one sample per channel
+- `ENQUEUE`  — driver enqueue, one sample per channel
+- `WAIT`     — waiting for drivers (DMA/RMT) to finish or accept a frame
+
+Every stage feeds a fixed-size log2 histogram. `ENCODE` and `ENQUEUE` get
+one sample per channel; the rest get one sample per frame. The last
+`kHistory` frames are also kept as per-stage totals in a ring buffer.
+
+### Usage:
+```cpp
+const fl::TimeHistogram& enc = fl::FrameTelemetry::instance().histogram(fl::FrameStage::ENCODE);
+FL_WARN("encode p95 <= " << enc.percentileUs(95) << " us");
+```
+Remote access: fl::bindFrameTelemetry() in fl/remote/frame_telemetry.h.
+
+### Configuration:
+- `FASTLED_FRAME_TELEMETRY` — compile the hooks in (default: SKETCH_HAS_LARGE_MEMORY)
+- FrameTelemetry::setEnabled() — runtime switch (default on when compiled in)
+
+All recording happens on the thread that calls FastLED.show().
+ */
+
+#include "fl/stl/int.h"
+#include "fl/stl/span.h"
+#include "fl/system/sketch_macros.h"
+#include "fl/stl/noexcept.h"
+
+#ifndef FASTLED_FRAME_TELEMETRY
+#define FASTLED_FRAME_TELEMETRY SKETCH_HAS_LARGE_MEMORY
+#endif
+
+namespace fl {
+
+/// @brief Stages of a FastLED.show() call tracked by FrameTelemetry
+enum class FrameStage : fl::u8 {
+    FRAME = 0,
+    DRAW,
+    THROTTLE,
+    POWER,
+    ENCODE,
+    ENQUEUE,
+    WAIT,
+    COUNT
+};
+
+/// @brief Lower-case stage name ("frame", "draw", ...), "" for COUNT
+const char* frameStageName(FrameStage stage) FL_NO_EXCEPT;
+
+/// @brief Fixed-size histogram of microsecond durations
+///
+/// Bucket 0 holds 0 us; bucket i (1..kBuckets-2) holds [2^(i-1), 2^i) us;
+/// the last bucket holds everything from 2^(kBuckets-2) us (~0.26 s) up.
+class TimeHistogram {
+public:
+    static constexpr int kBuckets = 20;
+
+    TimeHistogram() FL_NO_EXCEPT { reset(); }
+
+    void record(fl::u32 us) FL_NO_EXCEPT;
+    void reset() FL_NO_EXCEPT;
+
+    fl::u32 count() const FL_NO_EXCEPT { return mCount; }
+    fl::u32 minUs() const FL_NO_EXCEPT { return mCount ? mMin : 0; }
+    fl::u32 maxUs() const FL_NO_EXCEPT { return mMax; }
+    fl::u32 meanUs() const FL_NO_EXCEPT {
+        return mCount ? static_cast<fl::u32>(mSum / mCount) : 0;
+    }
+    fl::u64 totalUs() const FL_NO_EXCEPT { return mSum; }
+    fl::u32 bucket(int i) const FL_NO_EXCEPT { return mBuckets[i]; }
+
+    /// @brief Exclusive upper edge of bucket `i` in us (0 for the last bucket)
+    static fl::u32 bucketLimitUs(int i) FL_NO_EXCEPT;
+
+    /// @brief Bucket index a duration falls into
+    static int bucketFor(fl::u32 us) FL_NO_EXCEPT;
+
+    /// @brief Upper bound for the `pct`-th percentile (bucket edge, capped at maxUs())
+    fl::u32 percentileUs(fl::u8 pct) const FL_NO_EXCEPT;
+
+private:
+    fl::u32 mBuckets[kBuckets];
+    fl::u32 mCount;
+    fl::u32 mMin;
+    fl::u32 mMax;
+    fl::u64 mSum;
+};
+
+/// @brief Per-frame stage histograms plus a ring buffer of recent frames
+class FrameTelemetry {
+public:
+    static constexpr int kStages = static_cast<int>(FrameStage::COUNT);
+    static constexpr fl::size kHistory = 32;
+
+    /// @brief Per-stage totals of one frame
+    struct FrameRecord {
+        fl::u32 frame;              ///< Frame number (1-based)
+        fl::u16 channels;           ///< Channels encoded or enqueued
+        fl::u32 stageUs[kStages];   ///< Indexed by FrameStage
+    };
+
+    static FrameTelemetry& instance() FL_NO_EXCEPT;
+
+    FrameTelemetry() FL_NO_EXCEPT;
+
+    void setEnabled(bool enabled) FL_NO_EXCEPT { mEnabled = enabled; }
+    bool isEnabled() const FL_NO_EXCEPT { return mEnabled; }
+
+    /// @brief Start of FastLED.show(); records DRAW since the previous endFrame()
+    void beginFrame(fl::u32 nowUs) FL_NO_EXCEPT;
+
+    /// @brief Add `us` to a stage of the current frame
+    void addStage(FrameStage stage, fl::u32 us) FL_NO_EXCEPT;
+
+    /// @brief End of FastLED.show(); records FRAME and commits the frame
+    void endFrame(fl::u32 nowUs) FL_NO_EXCEPT;
+
+    const TimeHistogram& histogram(FrameStage stage) const FL_NO_EXCEPT {
+        return mHistograms[static_cast<int>(stage)];
+    }
+
+    /// @brief Frames committed since the last reset()
+    fl::u32 frames() const FL_NO_EXCEPT { return mFrames; }
+
+    /// @brief Copy up to out.size() most recent frames, oldest first
+    /// @return Number of records written
+    fl::size history(fl::span<FrameRecord> out) const FL_NO_EXCEPT;
+
+    void reset() FL_NO_EXCEPT;
+
+private:
+    TimeHistogram mHistograms[kStages];
+    FrameRecord mHistory[kHistory];
+    FrameRecord mCurrent;
+    fl::u32 mFrames;
+    fl::u32 mFrameStartUs;
+    fl::u32 mLastEndUs;
+    bool mHaveLastEnd;
+    bool mInFrame;
+    bool mEnabled;
+};
+
+/// @brief RAII timer adding its lifetime to a FrameTelemetry stage
+class ScopedFrameStage {
+public:
+    explicit ScopedFrameStage(FrameStage stage) FL_NO_EXCEPT;
+    ~ScopedFrameStage() FL_NO_EXCEPT;
+
+    ScopedFrameStage(const ScopedFrameStage&) FL_NO_EXCEPT = delete;
+    ScopedFrameStage& operator=(const ScopedFrameStage&) FL_NO_EXCEPT = delete;
+
+private:
+    FrameStage mStage;
+    bool mActive;
+    fl::u32 mStartUs;
+};
+
+} // namespace fl
+
+#if FASTLED_FRAME_TELEMETRY
+#define FL_FRAME_STAGE_CONCAT(stage, line) fl::ScopedFrameStage __fl_frame_stage_##line(fl::FrameStage::stage)
+#define FL_FRAME_STAGE_IMPL(stage, line) FL_FRAME_STAGE_CONCAT(stage, line)
+/// @brief Time the rest of the enclosing scope into FrameStage::stage
+#define FL_FRAME_STAGE(stage) FL_FRAME_STAGE_IMPL(stage, __LINE__)
+#else
+#define FL_FRAME_STAGE(stage) do {} while(0)
+#endif // FASTLED_FRAME_TELEMETRY
@@ -3,6 +3,7 @@
 
 // begin current directory includes
 #include "fl/task/executor.cpp.hpp"
+#include "fl/task/parallel_for.cpp.hpp"
 #include "fl/task/scheduler.cpp.hpp"
 #include "fl/task/task.cpp.hpp"
 
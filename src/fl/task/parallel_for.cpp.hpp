@@ -0,0 +1,134 @@
+// IWYU pragma: private
+
+/// @file fl/task/parallel_for.cpp.hpp
+/// @brief Persistent worker pool behind fl::task::parallelFor().
+
+#include "fl/task/parallel_for.h"
+
+#if FASTLED_PARALLEL_FOR
+#include "fl/stl/atomic.h"
+#include "fl/stl/condition_variable.h"
+#include "fl/stl/mutex.h"
+#include "fl/stl/singleton.h"
+#include "fl/stl/thread.h"
+#endif
+
+namespace fl {
+namespace task {
+
+#if FASTLED_PARALLEL_FOR
+namespace {
+
+/// Threads are started on first use and then parked on `mWake` between
+/// calls, so a call costs one notify and one wait instead of spawning and
+/// joining up to kMaxParallelWorkers - 1 threads. The pool is a never-destroyed
+/// Singleton; parked workers simply die with the process.
+class WorkerPool {
+  public:
+    static WorkerPool& instance() FL_NO_EXCEPT {
+        return fl::Singleton<WorkerPool>::instance();
+    }
+
+    /// Run `job` over [0, count) on the caller plus `helpers` pooled threads.
+    void run(fl::size count, fl::size helpers,
+             const fl::function<void(fl::size)>& job) FL_NO_EXCEPT {
+        // One fan-out at a time; a second caller waits for the pool.
+        fl::unique_lock<fl::mutex> runLock(mRunMutex);
+        {
+            fl::unique_lock<fl::mutex> lock(mMutex);
+            while (mStarted < helpers) {
+                const fl::size index = mStarted++;
+                const u32 generation = mGeneration;
+                fl::thread worker([this, index, generation]() {
+                    workerLoop(index, generation);
+                });
+                worker.detach();
+            }
+            mJob = &job;
+            mCount = count;
+            mNext.store(0);
+            mWanted = helpers;
+            mBusy = helpers;
+            ++mGeneration;
+        }
+        mWake.notify_all();
+
+        drain();  // The calling thread works too.
+
+        fl::unique_lock<fl::mutex> lock(mMutex);
+        while (mBusy != 0) {
+            mDone.wait(lock);
+        }
+        mJob = nullptr;
+    }
+
+  private:
+    void drain() FL_NO_EXCEPT {
+        for (;;) {
+            const fl::size i = mNext.fetch_add(1);
+            if (i >= mCount) {
+                return;
+            }
+            (*mJob)(i);
+        }
+    }
+
+    void workerLoop(fl::size index, u32 seen) FL_NO_EXCEPT {
+        fl::unique_lock<fl::mutex> lock(mMutex);
+        for (;;) {
+            while (mGeneration == seen) {
+                mWake.wait(lock);
+            }
+            seen = mGeneration;
+            if (index >= mWanted) {
+                continue;  // Not needed for this fan-out; stay parked.
+            }
+            lock.unlock();
+            drain();
+            lock.lock();
+            if (--mBusy == 0) {
+                mDone.notify_one();
+            }
+        }
+    }
+
+    fl::mutex mRunMutex;
+    fl::mutex mMutex;  // Guards everything below except mNext.
+    fl::condition_variable mWake;
+    fl::condition_variable mDone;
+    fl::size mStarted = 0;  // Detached workers spawned so far.
+    u32 mGeneration = 0;
+    const fl::function<void(fl::size)>* mJob = nullptr;
+    fl::size mCount = 0;
+    fl::atomic<fl::size> mNext{0};
+    fl::size mWanted = 0;
+    fl::size mBusy = 0;
+};
+
+} // namespace
+#endif
+
+void parallelFor(fl::size count, fl::u8 workers,
+                 const fl::function<void(fl::size)>& job) FL_NO_EXCEPT {
+#if FASTLED_PARALLEL_FOR
+    if (workers > kMaxParallelWorkers) {
+        workers = kMaxParallelWorkers;
+    }
+    if (workers > 1 && count > 1) {
+        fl::size helpers = static_cast<fl::size>(workers - 1);
+        if (helpers > count - 1) {
+            helpers = count - 1;
+        }
+        WorkerPool::instance().run(count, helpers, job);
+        return;
+    }
+#else
+    (void)workers;
+#endif
+    for (fl::size i = 0; i < count; ++i) {
+        job(i);
+    }
+}
+
+} // namespace task
+} // namespace fl
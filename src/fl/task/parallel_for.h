@@ -0,0 +1,46 @@
+#pragma once
+
+/// @file fl/task/parallel_for.h
+/// @brief Fan a batch of independent jobs across a persistent pool of
+///        `fl::thread` workers on host builds.
+///
+/// Used by ChannelManager's parallel encode stage and by FxEngine's tiled
+/// rendering. On stub/WASM builds with pthreads the jobs are spread across up
+/// to N threads (the caller is one of them). Workers are started on first
+/// use and stay parked on a condition variable between calls. Everywhere
+/// else `fl::thread` is a synchronous fake, so parallelFor() compiles to a
+/// plain loop.
+
+#include "fl/stl/function.h"
+#include "fl/stl/noexcept.h"
+#include "fl/stl/stdint.h"
+#include "fl/stl/thread_config.h"
+#include "platforms/is_platform.h"
+
+#ifndef FASTLED_PARALLEL_FOR
+#if (defined(FL_IS_STUB) || defined(FL_IS_WASM)) && FASTLED_MULTITHREADED
+#define FASTLED_PARALLEL_FOR 1
+#else
+#define FASTLED_PARALLEL_FOR 0
+#endif
+#endif
+
+namespace fl {
+namespace task {
+
+/// @brief Upper bound on parallelFor() workers (including the calling thread).
+constexpr fl::u8 kMaxParallelWorkers = 16;
+
+/// @brief True when parallelFor() can actually run jobs concurrently.
+constexpr bool parallelForSupported() FL_NO_EXCEPT {
+    return FASTLED_PARALLEL_FOR != 0;
+}
+
+/// @brief Invoke `job(i)` for every i in [0, count), using up to `workers`
+///        threads. Returns once every job has finished.
+/// @note Jobs are claimed dynamically, so uneven job costs still balance.
+void parallelFor(fl::size count, fl::u8 workers,
+                 const fl::function<void(fl::size)>& job) FL_NO_EXCEPT;
+
+} // namespace task
+} // namespace fl
@@ -1,6 +1,9 @@
 
 #include "fl/video/pixel_stream.h"
 #include "fl/log/log.h"
+#include "fl/fled/detail/delta_rle.h"
+#include "fl/fx/frame.h"
+#include "fl/stl/cstring.h"
 #include "fl/stl/limits.h"
 #include "fl/stl/noexcept.h"
 
@@ -15,6 +18,7 @@ namespace {
 constexpr fl::u8 kFledMagic[4] = {'F', 'L', 'E', 'D'};
 constexpr fl::u8 kFledVersionV1 = 1;
 constexpr fl::u8 kFledPixelFormatRgb8 = 0x00;
+constexpr fl::u8 kFledPixelFormatRgb8DeltaRle = 0x80;
 constexpr fl::size_t kFledHeaderBytes = 12;
 // Defensive cap on the embedded JSON to bound the worst-case heap
 // allocation if a malformed file claims a giant json_length. Real
@@ -32,6 +36,7 @@ bool PixelStream::begin(filebuf_ptr h) {
     mHandle = h;
     mPayloadOffset = 0;
     mEmbeddedScreenMapJson.clear();
+    mDeltaRle = false;
     // Probe seekability: if seek-to-start succeeds, this is a seekable file.
     mType = mHandle->seek(0, seek_dir::beg) ? kFile : kStreaming;
     if (mType == kFile) {
@@ -48,7 +53,8 @@ bool PixelStream::begin(filebuf_ptr h) {
                 && static_cast<fl::u8>(hdr[2]) == kFledMagic[2]
                 && static_cast<fl::u8>(hdr[3]) == kFledMagic[3]
                 && static_cast<fl::u8>(hdr[4]) == kFledVersionV1
-                && static_cast<fl::u8>(hdr[5]) == kFledPixelFormatRgb8;
+                && (static_cast<fl::u8>(hdr[5]) == kFledPixelFormatRgb8
+                    || static_cast<fl::u8>(hdr[5]) == kFledPixelFormatRgb8DeltaRle);
             if (isFled) {
                 const fl::u32 jsonLen =
                     static_cast<fl::u32>(static_cast<fl::u8>(hdr[8]))
@@ -71,6 +77,11 @@ bool PixelStream::begin(filebuf_ptr h) {
                     if (jr == jsonLenSz) {
                         mPayloadOffset = kFledHeaderBytes + jsonLenSz;
                         // Stream is now positioned at the first frame byte.
+                        mapPayload();
+                        if (static_cast<fl::u8>(hdr[5]) == kFledPixelFormatRgb8DeltaRle) {
+                            mDeltaRle = true;
+                            indexDeltaRle();
+                        }
                         return mHandle->available();
                     }
                     // JSON slurp short-read — abandon FLED interpretation.
@@ -81,12 +92,164 @@ bool PixelStream::begin(filebuf_ptr h) {
             // reads see the file from byte 0 as raw RGB triplets.
             mHandle->seek(0, seek_dir::beg);
         }
+        mapPayload();
         return mHandle->available();
     }
     return mHandle->available(mbytesPerFrame);
 }
 
+void PixelStream::mapPayload() {
+    fl::span<const fl::u8> whole = mHandle->map();
+    if (mbytesPerFrame > 0 && whole.size() > mPayloadOffset) {
+        mMapped = whole.slice(mPayloadOffset, whole.size());
+    }
+}
+
+bool PixelStream::copyMappedFrame(fl::size_t payloadPos, Frame *frame) {
+    // Mirrors a readRGB8() of one frame: copy out of the mapping, then move
+    // the handle so framesRemaining()/atEnd() see the same position.
+    const fl::size_t bytes = static_cast<fl::size_t>(mbytesPerFrame);
+    if (payloadPos + bytes > mMapped.size()) {
+        return false;
+    }
+    fl::memcpy(frame->rgb().data(), mMapped.data() + payloadPos, bytes);
+    mHandle->seek(mPayloadOffset + payloadPos + bytes);
+    return true;
+}
+
+fl::span<const CRGB> PixelStream::frameView(fl::u32 frameNumber) const FL_NO_EXCEPT {
+    const fl::size_t bytes = static_cast<fl::size_t>(mbytesPerFrame);
+    const fl::size_t start = static_cast<fl::size_t>(frameNumber) * bytes;
+    if (mMapped.empty() || mDeltaRle || start + bytes > mMapped.size()) {
+        return fl::span<const CRGB>();
+    }
+    // CRGB is three packed u8 channels, so the payload is a CRGB array.
+    const CRGB *pixels = reinterpret_cast<const CRGB *>(mMapped.data() + start); // ok reinterpret cast
+    return fl::span<const CRGB>(pixels, bytes / 3);
+}
+
+bool PixelStream::readPayload(fl::size_t payloadPos, fl::u8 *dst, fl::size_t len) {
+    if (isMapped()) {
+        if (payloadPos + len > mMapped.size()) {
+            return false;
+        }
+        fl::memcpy(dst, mMapped.data() + payloadPos, len);
+        return true;
+    }
+    return mHandle->seek(mPayloadOffset + payloadPos)
+        && mHandle->read(dst, len) == len;
+}
+
+void PixelStream::indexDeltaRle() {
+    mKeyframes.clear();
+    mFrameCount = 0;
+    mNextFrame = 0;
+    mRef.assign(static_cast<fl::size>(mbytesPerFrame), 0);
+    // Walk the record headers only; record bodies are skipped, so this is
+    // one small read per frame (none at all when mapped).
+    const fl::size_t payloadBytes = mHandle->size() - mPayloadOffset;
+    fl::size_t at = 0;
+    fl::u8 hdr[fl::fled::kDeltaRleRecordHeaderBytes];
+    while (at + sizeof(hdr) <= payloadBytes && readPayload(at, hdr, sizeof(hdr))) {
+        fl::fled::DeltaRleKind kind;
+        fl::u32 len = 0;
+        if (!fl::fled::readDeltaRleRecordHeader(hdr, &kind, &len)
+            || len > payloadBytes - at - sizeof(hdr)) {
+            break;
+        }
+        if (kind == fl::fled::DeltaRleKind::Keyframe) {
+            Keyframe key = {mFrameCount, at};
+            mKeyframes.push_back(key);
+        } else if (mFrameCount == 0) {
+            break; // A payload must open with a keyframe.
+        }
+        ++mFrameCount;
+        at += sizeof(hdr) + len;
+    }
+    if (at != payloadBytes) {
+        FL_WARN_F("PixelStream: delta/RLE payload truncated after %u frames",
+                  static_cast<unsigned>(mFrameCount));
+    }
+    mHandle->seek(mPayloadOffset);
+}
+
+bool PixelStream::decodeNextRecord(Frame *frame) {
+    if (mNextFrame >= mFrameCount
+        || frame->rgb().size() * 3 < static_cast<fl::size>(mbytesPerFrame)) {
+        return false;
+    }
+    const fl::size_t pos = mHandle->pos() - mPayloadOffset;
+    fl::u8 hdr[fl::fled::kDeltaRleRecordHeaderBytes];
+    fl::fled::DeltaRleKind kind;
+    fl::u32 len = 0;
+    if (!readPayload(pos, hdr, sizeof(hdr))
+        || !fl::fled::readDeltaRleRecordHeader(hdr, &kind, &len)) {
+        return false;
+    }
+
+    fl::u8 *dst = reinterpret_cast<fl::u8 *>(frame->rgb().data()); // ok reinterpret cast
+    fl::fled::DeltaRleDecoder decoder;
+    decoder.begin(kind, fl::span<fl::u8>(mRef.data(), mRef.size()),
+                  fl::span<fl::u8>(dst, mRef.size()));
+    const fl::size_t body = pos + sizeof(hdr);
+    bool ok = true;
+    if (isMapped()) {
+        ok = body + len <= mMapped.size()
+            && decoder.feed(mMapped.slice(body, body + len));
+    } else {
+        // Stream the record through a small stack buffer; the encoded
+        // frame is never held in memory as a whole.
+        fl::u8 chunk[64];
+        fl::size_t left = len;
+        while (ok && left > 0) {
+            const fl::size_t want = left < sizeof(chunk) ? left : sizeof(chunk);
+            const fl::size_t got = mHandle->read(chunk, want);
+            ok = got == want && decoder.feed(fl::span<const fl::u8>(chunk, got));
+            left -= got;
+        }
+    }
+    if (!ok || !decoder.finished()) {
+        FL_WARN_F("PixelStream: malformed delta/RLE record %u",
+                  static_cast<unsigned>(mNextFrame));
+        return false;
+    }
+    mHandle->seek(mPayloadOffset + body + len);
+    ++mNextFrame;
+    return true;
+}
+
+bool PixelStream::seekDeltaRle(fl::u32 frameNumber, Frame *frame) {
+    if (frameNumber >= mFrameCount || mKeyframes.empty()) {
+        return false;
+    }
+    // Last keyframe at or before frameNumber.
+    fl::size lo = 0;
+    fl::size hi = mKeyframes.size();
+    while (hi - lo > 1) {
+        const fl::size mid = (lo + hi) / 2;
+        if (mKeyframes[mid].frame <= frameNumber) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    const Keyframe &key = mKeyframes[lo];
+    // Restart from the keyframe when going backwards or when it is closer
+    // than the current position; otherwise keep replaying deltas.
+    if (frameNumber < mNextFrame || key.frame > mNextFrame) {
+        mHandle->seek(mPayloadOffset + key.offset);
+        mNextFrame = key.frame;
+    }
+    while (mNextFrame <= frameNumber) {
+        if (!decodeNextRecord(frame)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void PixelStream::close() {
+    mMapped = fl::span<const fl::u8>();
     mHandle.reset();
 }
 
@@ -115,9 +278,15 @@ bool PixelStream::readFrame(Frame *frame) {
     if (!frame) {
         return false;
     }
+    if (mDeltaRle) {
+        return decodeNextRecord(frame);
+    }
     if (mType == kFile && !framesRemaining()) {
         return false;
     }
+    if (isMapped()) {
+        return copyMappedFrame(mHandle->pos() - mPayloadOffset, frame);
+    }
     size_t n = mHandle->readRGB8(frame->rgb());
     if (mType == kFile) {
         DBG("pos: " << mHandle->pos());
@@ -131,6 +300,9 @@ bool PixelStream::hasFrame(fl::u32 frameNumber) {
         DBG("Not implemented and therefore always returns true");
         return true;
     }
+    if (mDeltaRle) {
+        return frameNumber < mFrameCount;
+    }
     // Use size_t throughout so frameNumber * bytesPerFrame doesn't overflow
     // u32 for high-LED-count grids past ~1M frames.
     fl::size_t total_bytes = mHandle->size();
@@ -146,8 +318,14 @@ bool PixelStream::readFrameAt(fl::u32 frameNumber, Frame *frame) {
         FL_DBG_F("Streaming handle doesn't support seeking");
         return false;
     }
+    if (mDeltaRle) {
+        return seekDeltaRle(frameNumber, frame);
+    }
     fl::size_t frameBytes = static_cast<fl::size_t>(frameNumber)
         * static_cast<fl::size_t>(mbytesPerFrame);
+    if (isMapped()) {
+        return copyMappedFrame(frameBytes, frame);
+    }
     mHandle->seek(mPayloadOffset + frameBytes);
     if (mHandle->bytesLeft() == 0) {
         return false;
@@ -167,6 +345,9 @@ bool PixelStream::readFrameAt(fl::u32 frameNumber, Frame *frame) {
 i32 PixelStream::framesRemaining() const {
     if (mbytesPerFrame == 0)
         return 0;
+    if (mDeltaRle) {
+        return static_cast<i32>(mFrameCount - mNextFrame);
+    }
     i32 bytes_left = bytesRemaining();
     if (bytes_left <= 0) {
         return 0;
@@ -181,6 +362,9 @@ i32 PixelStream::framesDisplayed() const {
     if (mbytesPerFrame == 0) {
         return 0;
     }
+    if (mDeltaRle) {
+        return static_cast<i32>(mNextFrame);
+    }
     fl::size_t pos = mHandle->pos();
     if (pos < mPayloadOffset) return 0;
     return static_cast<i32>((pos - mPayloadOffset) / mbytesPerFrame);
@@ -208,6 +392,7 @@ bool PixelStream::rewind() {
     // Rewind to the start of the payload, not the start of the file —
     // skips the FLED header on container-formatted streams.
     mHandle->seek(mPayloadOffset);
+    mNextFrame = 0;
     return true;
 }
 
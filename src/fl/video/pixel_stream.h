@@ -4,7 +4,9 @@
 #include "fl/stl/shared_ptr.h"         // For FASTLED_SHARED_PTR macros
 #include "fl/stl/int.h"
 #include "fl/stl/noexcept.h"
+#include "fl/stl/span.h"
 #include "fl/stl/string.h"
+#include "fl/stl/vector.h"
 namespace fl {
 class filebuf;
 using filebuf_ptr = fl::shared_ptr<filebuf>;
@@ -24,6 +26,17 @@ FASTLED_SHARED_PTR(PixelStream);
 // consumed, the embedded screenmap JSON is stashed, and frame reads start
 // past the header. Legacy headerless `.rgb` files keep working unchanged.
 // Spec: https://github.com/zackees/ledmapper/blob/main/docs/fled-format.md
+//
+// Memory-mapped playback: when a seekable handle can expose its contents
+// via filebuf::map() (fully loaded WASM files, POSIX test hosts), begin()
+// keeps a view of the frame payload. readFrame()/readFrameAt() then copy
+// straight out of the mapping without read() calls, and frameView() hands
+// out frames with no copy at all for random seeks and scrubbing.
+//
+// FLED files using the Rgb8DeltaRle pixel format (0x80, keyframes plus
+// XOR-delta records) are decoded on the fly into the caller's Frame.
+// begin() indexes the keyframes so readFrameAt() seeks to the nearest one
+// and replays the deltas after it.
 class PixelStream {
   public:
     enum Type {
@@ -45,6 +58,14 @@ class PixelStream {
     bool readFrame(Frame *frame);
     bool readFrameAt(fl::u32 frameNumber, Frame *frame);
     bool hasFrame(fl::u32 frameNumber);
+
+    // True when begin() mapped the payload (see class comment).
+    bool isMapped() const FL_NO_EXCEPT { return !mMapped.empty(); }
+    // Zero-copy view of a whole frame inside the mapping. Empty if the
+    // stream is not mapped, the payload is delta/RLE coded, or the frame is
+    // out of range. Valid until
+    // close() / the next begin().
+    fl::span<const CRGB> frameView(fl::u32 frameNumber) const FL_NO_EXCEPT;
     i32 framesRemaining() const; // -1 if this is a stream.
     i32 framesDisplayed() const;
     bool available() const;
@@ -69,6 +90,26 @@ class PixelStream {
     // `.rgb` files; 12 + jsonLength for FLED-formatted files.
     fl::size_t mPayloadOffset = 0;
     fl::string mEmbeddedScreenMapJson;
+    // Payload bytes (past the FLED header) when the handle is mapped.
+    fl::span<const fl::u8> mMapped;
+
+    // Rgb8DeltaRle payload state. Offsets are relative to mPayloadOffset.
+    struct Keyframe {
+        fl::u32 frame;
+        fl::size_t offset;
+    };
+    bool mDeltaRle = false;
+    fl::vector<Keyframe> mKeyframes;
+    fl::u32 mFrameCount = 0;
+    fl::u32 mNextFrame = 0;    // Record the handle is positioned at.
+    fl::vector<fl::u8> mRef;   // Last decoded frame, base for deltas.
+
+    void mapPayload();
+    bool copyMappedFrame(fl::size_t payloadPos, Frame *frame);
+    void indexDeltaRle();
+    bool readPayload(fl::size_t payloadPos, fl::u8 *dst, fl::size_t len);
+    bool decodeNextRecord(Frame *frame);
+    bool seekDeltaRle(fl::u32 frameNumber, Frame *frame);
 
   public:
     virtual ~PixelStream() FL_NO_EXCEPT;
@@ -104,6 +104,7 @@ bool VideoImpl::draw(fl::u32 now, fl::span<CRGB> leds) {
         return false;
     }
     mFrameInterpolator->draw(now, leds);
+    prefetchAhead(now);
 
     fl::u32 time = mTime->time();
     fl::u32 brightness = 255;
@@ -332,6 +333,50 @@ bool VideoImpl::updateBufferFromFile(fl::u32 now, bool forward) {
     return true;
 }
 
+void VideoImpl::prefetchAhead(fl::u32 now) {
+    if (mReadAhead == 0) {
+        return;
+    }
+    fl::u32 currFrameNumber = 0;
+    fl::u32 nextFrameNumber = 0;
+    mFrameInterpolator->needsFrame(now, &currFrameNumber, &nextFrameNumber);
+    fl::u32 newest = 0;
+    if (!mFrameInterpolator->get_newest_frame_number(&newest) ||
+        newest < nextFrameNumber || newest - nextFrameNumber >= mReadAhead) {
+        return;
+    }
+    const fl::u32 target = newest + 1;
+
+    // Only read what is already there: never block, never wrap around.
+    if (mStream->getType() == PixelStream::kFile) {
+        if (!mStream->hasFrame(target)) {
+            return;
+        }
+    } else if (!mStream->available()) {
+        return;
+    }
+
+    // Recycle only frames the playhead has already passed.
+    FramePtr frame;
+    if (mFrameInterpolator->full()) {
+        fl::u32 oldest = 0;
+        if (!mFrameInterpolator->get_oldest_frame_number(&oldest) ||
+            oldest >= currFrameNumber) {
+            return;
+        }
+        frame = mFrameInterpolator->erase(oldest);
+    }
+    if (!frame) {
+        frame = fl::make_shared<Frame>(mPixelsPerFrame);
+    }
+    const bool ok = mStream->getType() == PixelStream::kFile
+                        ? mStream->readFrameAt(target, frame.get())
+                        : mStream->readFrame(frame.get());
+    if (ok) {
+        mFrameInterpolator->insert(target, frame);
+    }
+}
+
 bool VideoImpl::updateBufferIfNecessary(fl::u32 prev, fl::u32 now) {
     const bool forward = now >= prev;
 
@@ -54,6 +54,13 @@ class VideoImpl {
     bool needsFrame(fl::u32 now) const;
     i32 durationMicros() const; // -1 if this is a stream.
 
+    // Read-ahead: keep up to `frames` frames decoded past the playhead,
+    // reading at most one per draw() so stream/SD I/O lands on draws that
+    // don't cross a frame boundary instead of stalling the one that does.
+    // Bounded by the frame buffer (frameHistoryCount). 0 (default) = off.
+    void setReadAhead(fl::u32 frames) { mReadAhead = frames; }
+    fl::u32 readAhead() const { return mReadAhead; }
+
     // FLED v1 container accessors. Forwards to the underlying PixelStream;
     // empty / false for legacy headerless `.rgb` files.
     bool hasEmbeddedScreenMap() const FL_NO_EXCEPT;
@@ -63,6 +70,7 @@ class VideoImpl {
     bool updateBufferIfNecessary(fl::u32 prev, fl::u32 now);
     bool updateBufferFromFile(fl::u32 now, bool forward);
     bool updateBufferFromStream(fl::u32 now);
+    void prefetchAhead(fl::u32 now);
     fl::u32 mPixelsPerFrame = 0;
     PixelStreamPtr mStream;
     fl::u32 mPrevNow = 0;
@@ -71,6 +79,7 @@ class VideoImpl {
     fl::u32 mFadeInTime = 1000;
     fl::u32 mFadeOutTime = 1000;
     float mTimeScale = 1.0f;
+    fl::u32 mReadAhead = 0;
 };
 
 } // namespace video
@@ -580,6 +580,172 @@ fl::u8 inoise8(fl::u16 x, fl::u16 y, fl::u16 z) {
     return ans;
 }
 
+// Row kernels: y and z are constant along a row, so everything derived
+// from them is hoisted, and the eight gradient hashes of an x cell are
+// looked up once per cell instead of once per sample. Each block of
+// kNoiseRowLanes samples is gathered first (hashes, fades, offsets) and
+// then run through a straight-line lane loop. The arithmetic is that of
+// the scalar inoise16()/inoise8(), so results stay bit-exact.
+static const int kNoiseRowLanes = 8;
+
+// Select-only forms of grad16() and LERP() for inoise16_row(). Same
+// results, but no if/else, so the 16-bit lane loop if-converts. (The 8-bit
+// lane loop is faster with grad8()/lerp7by8() as they are.)
+static fl::i16 inline __attribute__((always_inline)) grad16_lane(fl::u8 hash, fl::i16 x, fl::i16 y, fl::i16 z) {
+    hash = hash&15;
+    fl::i16 u = hash<8?x:y;
+    fl::i16 v = hash<4?y:hash==12||hash==14?x:z;
+    u = (hash&1) ? static_cast<fl::i16>(-u) : u;
+    v = (hash&2) ? static_cast<fl::i16>(-v) : v;
+    return AVG15(u,v);
+}
+
+static fl::i16 inline __attribute__((always_inline)) lerp16_lane(fl::i16 a, fl::i16 b, fract16 frac) {
+#ifdef FADE_12
+    return LERP(a,b,frac);
+#else
+    // lerp15by16()
+    const bool up = b > a;
+    const fl::u16 delta = up ? static_cast<fl::u16>(b - a) : static_cast<fl::u16>(a - b);
+    const fl::u16 scaled = scale16(delta, frac);
+    return up ? static_cast<fl::i16>(a + scaled) : static_cast<fl::i16>(a - scaled);
+#endif
+}
+
+FL_OPTIMIZATION_LEVEL_O3_BEGIN
+
+void inoise16_row(fl::u16 *out, int count, fl::u32 x, fl::i32 dx, fl::u32 y, fl::u32 z)
+{
+    const fl::u8 Y = (y>>16)&0xFF;
+    const fl::u8 Z = (z>>16)&0xFF;
+    fl::u16 v = y & 0xFFFF;
+    fl::u16 w = z & 0xFFFF;
+    const fl::i16 yy = (v >> 1) & 0x7FFF;
+    const fl::i16 zz = (w >> 1) & 0x7FFF;
+    const fl::u16 N = 0x8000L;
+    v = EASE16(v); w = EASE16(w);
+
+    const fl::u32 step = static_cast<fl::u32>(dx);
+    int cellX = -1;
+    fl::u8 hash[8] = {0};
+
+    fl::u8 g[8][kNoiseRowLanes];
+    fl::i16 xxs[kNoiseRowLanes];
+    fl::u16 us[kNoiseRowLanes];
+
+    for (int base = 0; base < count; base += kNoiseRowLanes) {
+        const int lanes = (count - base) < kNoiseRowLanes ? (count - base) : kNoiseRowLanes;
+
+        for (int k = 0; k < lanes; ++k, x += step) {
+            const fl::u8 X = (x>>16)&0xFF;
+            if (X != cellX) {
+                cellX = X;
+                fl::u8 A = NOISE_P(X)+Y;
+                fl::u8 AA = NOISE_P(A)+Z;
+                fl::u8 AB = NOISE_P(A+1)+Z;
+                fl::u8 B = NOISE_P(X+1)+Y;
+                fl::u8 BA = NOISE_P(B) + Z;
+                fl::u8 BB = NOISE_P(B+1)+Z;
+                hash[0] = NOISE_P(AA);   hash[1] = NOISE_P(BA);
+                hash[2] = NOISE_P(AB);   hash[3] = NOISE_P(BB);
+                hash[4] = NOISE_P(AA+1); hash[5] = NOISE_P(BA+1);
+                hash[6] = NOISE_P(AB+1); hash[7] = NOISE_P(BB+1);
+            }
+            for (int c = 0; c < 8; ++c) {
+                g[c][k] = hash[c];
+            }
+            fl::u16 u = x & 0xFFFF;
+            xxs[k] = (u >> 1) & 0x7FFF;
+            us[k] = EASE16(u);
+        }
+
+        for (int k = 0; k < lanes; ++k) {
+            const fl::i16 xx = xxs[k];
+            const fl::u16 u = us[k];
+            fl::i16 X1 = lerp16_lane(grad16_lane(g[0][k], xx, yy, zz), grad16_lane(g[1][k], xx - N, yy, zz), u);
+            fl::i16 X2 = lerp16_lane(grad16_lane(g[2][k], xx, yy-N, zz), grad16_lane(g[3][k], xx - N, yy - N, zz), u);
+            fl::i16 X3 = lerp16_lane(grad16_lane(g[4][k], xx, yy, zz-N), grad16_lane(g[5][k], xx - N, yy, zz-N), u);
+            fl::i16 X4 = lerp16_lane(grad16_lane(g[6][k], xx, yy-N, zz-N), grad16_lane(g[7][k], xx - N, yy - N, zz - N), u);
+
+            fl::i16 Y1 = lerp16_lane(X1,X2,v);
+            fl::i16 Y2 = lerp16_lane(X3,X4,v);
+
+            // Same scaling as inoise16(x, y, z).
+            fl::i32 ans = lerp16_lane(Y1,Y2,w);
+            ans = ans + 19052L;
+            fl::u32 pan = ans;
+            pan *= 440L;
+            out[base + k] = (pan>>8);
+        }
+    }
+}
+
+void inoise8_row(fl::u8 *out, int count, fl::u16 x, fl::i16 dx, fl::u16 y, fl::u16 z)
+{
+    const fl::u8 Y = y>>8;
+    const fl::u8 Z = z>>8;
+    fl::u8 v = y;
+    fl::u8 w = z;
+    const fl::i8 yy = ((fl::u8)(y)>>1) & 0x7F;
+    const fl::i8 zz = ((fl::u8)(z)>>1) & 0x7F;
+    const fl::u8 N = 0x80;
+    v = EASE8(v); w = EASE8(w);
+
+    const fl::u16 step = static_cast<fl::u16>(dx);
+    int cellX = -1;
+    fl::u8 hash[8] = {0};
+
+    fl::u8 g[8][kNoiseRowLanes];
+    fl::i8 xxs[kNoiseRowLanes];
+    fl::u8 us[kNoiseRowLanes];
+
+    for (int base = 0; base < count; base += kNoiseRowLanes) {
+        const int lanes = (count - base) < kNoiseRowLanes ? (count - base) : kNoiseRowLanes;
+
+        for (int k = 0; k < lanes; ++k, x += step) {
+            const fl::u8 X = x>>8;
+            if (X != cellX) {
+                cellX = X;
+                fl::u8 A = NOISE_P(X)+Y;
+                fl::u8 AA = NOISE_P(A)+Z;
+                fl::u8 AB = NOISE_P(A+1)+Z;
+                fl::u8 B = NOISE_P(X+1)+Y;
+                fl::u8 BA = NOISE_P(B) + Z;
+                fl::u8 BB = NOISE_P(B+1)+Z;
+                hash[0] = NOISE_P(AA);   hash[1] = NOISE_P(BA);
+                hash[2] = NOISE_P(AB);   hash[3] = NOISE_P(BB);
+                hash[4] = NOISE_P(AA+1); hash[5] = NOISE_P(BA+1);
+                hash[6] = NOISE_P(AB+1); hash[7] = NOISE_P(BB+1);
+            }
+            for (int c = 0; c < 8; ++c) {
+                g[c][k] = hash[c];
+            }
+            xxs[k] = ((fl::u8)(x)>>1) & 0x7F;
+            fl::u8 u = x;
+            us[k] = EASE8(u);
+        }
+
+        for (int k = 0; k < lanes; ++k) {
+            const fl::i8 xx = xxs[k];
+            const fl::u8 u = us[k];
+            fl::i8 X1 = lerp7by8(grad8(g[0][k], xx, yy, zz), grad8(g[1][k], xx - N, yy, zz), u);
+            fl::i8 X2 = lerp7by8(grad8(g[2][k], xx, yy-N, zz), grad8(g[3][k], xx - N, yy - N, zz), u);
+            fl::i8 X3 = lerp7by8(grad8(g[4][k], xx, yy, zz-N), grad8(g[5][k], xx - N, yy, zz-N), u);
+            fl::i8 X4 = lerp7by8(grad8(g[6][k], xx, yy-N, zz-N), grad8(g[7][k], xx - N, yy - N, zz - N), u);
+
+            fl::i8 Y1 = lerp7by8(X1,X2,v);
+            fl::i8 Y2 = lerp7by8(X3,X4,v);
+
+            // Same scaling as inoise8(x, y, z).
+            fl::i8 n = lerp7by8(Y1,Y2,w);
+            n += 64;
+            out[base + k] = qadd8(n, n);
+        }
+    }
+}
+
+FL_OPTIMIZATION_LEVEL_O3_END
+
 fl::i8 inoise8_raw(fl::u16 x, fl::u16 y)
 {
     // Find the unit cube containing the point
@@ -701,6 +867,10 @@ void fill_raw_noise16into8(fl::u8 *pData, fl::u8 num_points, fl::u8 octaves, fl:
   }
 }
 
+// The 2D fills evaluate each row in chunks through inoise16_row() /
+// inoise8_row() and then apply the per-pixel blend exactly as before.
+static const int kNoiseFillChunk = 32;
+
 /// Fill a 2D 8-bit buffer with noise, using inoise8() 
 /// @param pData the array of data to fill with noise values
 /// @param width the width of the 2D buffer
@@ -727,12 +897,16 @@ void fill_raw_2dnoise8(fl::u8 *pData, int width, int height, fl::u8 octaves, fl:
   scaley *= skip;
 
   fract8 invamp = 255-amplitude;
-  fl::u16 xx = x;
+  fl::u8 noise_row[kNoiseFillChunk];
   for(int i = 0; i < height; ++i, y+=scaley) {
     fl::u8 *pRow = pData + (i*width);
-    xx = x;
-    for(int j = 0; j < width; ++j, xx+=scalex) {
-      fl::u8 noise_base = inoise8(xx,y,time);
+    for(int j = 0; j < width; ++j) {
+      const int c = j % kNoiseFillChunk;
+      if(c == 0) {
+        const int n = (width - j) < kNoiseFillChunk ? (width - j) : kNoiseFillChunk;
+        inoise8_row(noise_row, n, static_cast<fl::u16>(x + j*scalex), scalex, y, time);
+      }
+      fl::u8 noise_base = noise_row[c];
       noise_base = (0x80 & noise_base) ? (noise_base - 127) : (127 - noise_base);
       noise_base = scale8(noise_base<<1,amplitude);
       if(skip == 1) {
@@ -764,10 +938,17 @@ void fill_raw_2dnoise16(fl::u16 *pData, int width, int height, fl::u8 octaves, f
   scalex *= skip;
   scaley *= skip;
   fract16 invamp = 65535-amplitude;
+  fl::u16 noise_row[kNoiseFillChunk];
   for(int i = 0; i < height; i+=skip, y+=scaley) {
     fl::u16 *pRow = pData + (i*width);
-    for(int j = 0,xx=x; j < width; j+=skip, xx+=scalex) {
-      fl::u16 noise_base = inoise16(xx,y,time);
+    for(int j = 0, s = 0; j < width; j+=skip, ++s) {
+      const int c = s % kNoiseFillChunk;
+      if(c == 0) {
+        const int left = (width - j + skip - 1) / skip;
+        const int n = left < kNoiseFillChunk ? left : kNoiseFillChunk;
+        inoise16_row(noise_row, n, x + static_cast<fl::u32>(s)*static_cast<fl::u32>(scalex), scalex, y, time);
+      }
+      fl::u16 noise_base = noise_row[c];
       noise_base = (0x8000 & noise_base) ? noise_base - (32767) : 32767 - noise_base;
       noise_base = scale16(noise_base<<1, amplitude);
       if(skip==1) {
@@ -801,13 +982,18 @@ void fill_raw_2dnoise16into8(fl::u8 *pData, int width, int height, fl::u8 octave
 
   scalex *= skip;
   scaley *= skip;
-  fl::u32 xx;
   fract8 invamp = 255-amplitude;
+  fl::u16 noise_row[kNoiseFillChunk];
   for(int i = 0; i < height; i+=skip, y+=scaley) {
     fl::u8 *pRow = pData + (i*width);
-    xx = x;
-    for(int j = 0; j < width; j+=skip, xx+=scalex) {
-      fl::u16 noise_base = inoise16(xx,y,time);
+    for(int j = 0, s = 0; j < width; j+=skip, ++s) {
+      const int c = s % kNoiseFillChunk;
+      if(c == 0) {
+        const int left = (width - j + skip - 1) / skip;
+        const int n = left < kNoiseFillChunk ? left : kNoiseFillChunk;
+        inoise16_row(noise_row, n, x + static_cast<fl::u32>(s)*static_cast<fl::u32>(scalex), scalex, y, time);
+      }
+      fl::u16 noise_base = noise_row[c];
       noise_base = (0x8000 & noise_base) ? noise_base - (32767) : 32767 - noise_base;
       noise_base = scale8(noise_base>>7,amplitude);
       if(skip==1) {
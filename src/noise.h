@@ -115,6 +115,25 @@ extern fl::i8 inoise8_raw(fl::u16 x);
 /// @} 8-Bit Raw Noise Functions
 
 
+/// @name Batched Row Noise Functions
+/// Evaluate a run of samples along the x axis in one call. y and z are
+/// fixed for the whole row, so their lattice cell, fade and gradient
+/// offsets are computed once, and the corner hashes of an x cell are
+/// reused by every sample that lands in it. Samples are evaluated in
+/// blocks of 8 lanes. Results are bit-exact with the scalar functions.
+/// @{
+
+/// Fill `out[i] = inoise16(x + i*dx, y, z)` for `i` in `[0, count)`
+/// @param dx step between samples, added with 32-bit wraparound
+extern void inoise16_row(fl::u16 *out, int count, fl::u32 x, fl::i32 dx, fl::u32 y, fl::u32 z);
+
+/// Fill `out[i] = inoise8(x + i*dx, y, z)` for `i` in `[0, count)`
+/// @param dx step between samples, added with 16-bit wraparound
+extern void inoise8_row(fl::u8 *out, int count, fl::u16 x, fl::i16 dx, fl::u16 y, fl::u16 z);
+
+/// @} Batched Row Noise Functions
+
+
 /// @name 32-Bit Simplex Noise Functions
 /// @{
 
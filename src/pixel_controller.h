@@ -25,6 +25,7 @@
 #include "eorder.h"
 #include "dither_mode.h"
 #include "pixel_iterator.h"
+#include "fl/chipsets/encoders/prepare_frame.h"
 #include "crgb.h"
 #include "fl/stl/variant.h"  // for PixelControllerAny.
 
@@ -403,6 +404,22 @@ struct PixelController {
             d[2] = e[2] - d[2];
     }
 
+    /// Runs loadAndScale<0..2>() + stepDithering() over every remaining pixel
+    /// in one bulk pass, writing wire-order bytes to `out` (mLenRemaining * 3
+    /// bytes). The controller itself is not advanced.
+    /// @see fl::prepareFrameRGB()
+    void prepareFrame(fl::u8 *out) const {
+        fl::FramePrep prep;
+        for (int k = 0; k < 3; ++k) {
+            const fl::u8 slot = static_cast<fl::u8>(RGB_BYTE(RGB_ORDER, k));
+            prep.order[k] = slot;
+            prep.scale[k] = mColorAdjustment.premixed.raw[slot];
+            prep.dither[k] = d[slot];
+            prep.ditherMax[k] = e[slot];
+        }
+        fl::prepareFrameRGB(mData, static_cast<fl::size>(mLenRemaining), mAdvance, prep, out);
+    }
+
     /// Some chipsets pre-cycle the first byte, which means we want to cycle byte 0's dithering separately
     FASTLED_FORCE_INLINE void preStepFirstByteDithering() {
         d[RO(0)] = e[RO(0)] - d[RO(0)];
@@ -198,6 +198,23 @@ FASTLED_FORCE_INLINE FL_IRAM simd_u8x16 andnot_u8_16(simd_u8x16 a, simd_u8x16 b)
     return vbicq_u8(b, a);  // Note: vbicq_u8(x, y) computes x & ~y, so we swap parameters
 }
 
+FASTLED_FORCE_INLINE FL_IRAM simd_u8x16 cmpeq_u8_16(simd_u8x16 a, simd_u8x16 b) FL_NO_EXCEPT {
+    return vceqq_u8(a, b);
+}
+
+FASTLED_FORCE_INLINE FL_IRAM simd_u8x16 add_u8_16(simd_u8x16 a, simd_u8x16 b) FL_NO_EXCEPT {
+    return vaddq_u8(a, b);
+}
+
+FASTLED_FORCE_INLINE FL_IRAM u16 movemask_u8_16(simd_u8x16 vec) FL_NO_EXCEPT {
+    // NEON has no movemask: move each MSB to its bit position within the
+    // half, then fold each half with widening pairwise adds.
+    static const int8_t kShifts[16] = {0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7};
+    uint8x16_t bits = vshlq_u8(vshrq_n_u8(vec, 7), vld1q_s8(kShifts));
+    uint64x2_t sums = vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(bits)));
+    return static_cast<u16>(vgetq_lane_u64(sums, 0) | (vgetq_lane_u64(sums, 1) << 8));
+}
+
 //==============================================================================
 // Float32 SIMD Operations (NEON)
 //==============================================================================
@@ -757,6 +774,30 @@ FASTLED_FORCE_INLINE FL_IRAM simd_u8x16 andnot_u8_16(simd_u8x16 a, simd_u8x16 b)
     return result;
 }
 
+FASTLED_FORCE_INLINE FL_IRAM simd_u8x16 cmpeq_u8_16(simd_u8x16 a, simd_u8x16 b) FL_NO_EXCEPT {
+    simd_u8x16 result;
+    for (int i = 0; i < 16; ++i) {
+        result.data[i] = (a.data[i] == b.data[i]) ? 0xFF : 0x00;
+    }
+    return result;
+}
+
+FASTLED_FORCE_INLINE FL_IRAM simd_u8x16 add_u8_16(simd_u8x16 a, simd_u8x16 b) FL_NO_EXCEPT {
+    simd_u8x16 result;
+    for (int i = 0; i < 16; ++i) {
+        result.data[i] = static_cast<u8>(a.data[i] + b.data[i]);
+    }
+    return result;
+}
+
+FASTLED_FORCE_INLINE FL_IRAM u16 movemask_u8_16(simd_u8x16 vec) FL_NO_EXCEPT {
+    u16 mask = 0;
+    for (int i = 0; i < 16; ++i) {
+        mask |= static_cast<u16>((vec.data[i] >> 7) << i);
+    }
+    return mask;
+}
+
 //==============================================================================
 // Int32 SIMD Operations (Scalar Fallback)
 //==============================================================================
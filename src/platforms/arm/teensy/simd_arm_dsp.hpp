@@ -485,6 +485,30 @@ FASTLED_FORCE_INLINE FL_IRAM simd_u8x16 andnot_u8_16(simd_u8x16 a, simd_u8x16 b)
     return r;
 }
 
+FASTLED_FORCE_INLINE FL_IRAM simd_u8x16 cmpeq_u8_16(simd_u8x16 a, simd_u8x16 b) FL_NO_EXCEPT {
+    simd_u8x16 result;
+    for (int i = 0; i < 16; ++i) {
+        result.data[i] = (a.data[i] == b.data[i]) ? 0xFF : 0x00;
+    }
+    return result;
+}
+
+FASTLED_FORCE_INLINE FL_IRAM simd_u8x16 add_u8_16(simd_u8x16 a, simd_u8x16 b) FL_NO_EXCEPT {
+    simd_u8x16 result;
+    for (int i = 0; i < 16; ++i) {
+        result.data[i] = static_cast<u8>(a.data[i] + b.data[i]);
+    }
+    return result;
+}
+
+FASTLED_FORCE_INLINE FL_IRAM u16 movemask_u8_16(simd_u8x16 vec) FL_NO_EXCEPT {
+    u16 mask = 0;
+    for (int i = 0; i < 16; ++i) {
+        mask |= static_cast<u16>((vec.data[i] >> 7) << i);
+    }
+    return mask;
+}
+
 //==============================================================================
 // u16x8 Operations
 //==============================================================================
@@ -324,6 +324,35 @@ class ChannelEngineRMTImpl : public ChannelEngineRMT {
         mEnqueuedChannels.push_back(channelData);
     }
 
+    /// Hand the channel an internal-DRAM pool buffer to encode into, so
+    /// processPendingChannels() transmits it without the PSRAM copy. The
+    /// lease is reused frame to frame until transmission takes it over.
+    fl::span<u8> acquireEncodeBuffer(const ChannelData& data,
+                                     fl::size bytes) FL_NO_EXCEPT override {
+        EncodeLease* lease = findEncodeLease(&data);
+        if (lease) {
+            if (lease->buffer.size() >= bytes) {
+                return lease->buffer;
+            }
+            mBufferPool.releaseInternal(lease->buffer);
+            lease->buffer = mBufferPool.acquireInternal(bytes);
+            if (lease->buffer.empty()) {
+                dropEncodeLease(&data);
+                return fl::span<u8>();
+            }
+            return lease->buffer;
+        }
+        if (mEncodeLeases.size() >= mEncodeLeases.capacity()) {
+            return fl::span<u8>();
+        }
+        fl::span<u8> buffer = mBufferPool.acquireInternal(bytes);
+        if (buffer.empty()) {
+            return fl::span<u8>();
+        }
+        mEncodeLeases.push_back({&data, buffer});
+        return buffer;
+    }
+
     void show() FL_NO_EXCEPT override {
         FL_SCOPED_TRACE;
         if (mEnqueuedChannels.empty()) {
@@ -1184,11 +1213,20 @@ class ChannelEngineRMTImpl : public ChannelEngineRMT {
             channel->reset_us = pending.reset_us;
             channel->transmissionComplete.store(false, fl::memory_order_release);
 
-            // Acquire buffer from pool (PSRAM -> DRAM/DMA transfer)
-            // Note: dataSize already retrieved earlier for channel acquisition
-            fl::span<u8> pooledBuffer = channel->useDMA ?
-                mBufferPool.acquireDMA(dataSize) :
-                mBufferPool.acquireInternal(dataSize);
+            // A frame encoded into a leased pool buffer is already in
+            // internal DRAM: non-DMA channels transmit it in place.
+            EncodeLease* lease = pending.data->hasExternalEncoded() ?
+                findEncodeLease(pending.data.get()) : nullptr;
+            fl::span<u8> pooledBuffer;
+            if (lease && !channel->useDMA) {
+                pooledBuffer = lease->buffer.slice(0, dataSize);
+            } else {
+                // Acquire buffer from pool (PSRAM -> DRAM/DMA transfer)
+                // Note: dataSize already retrieved earlier for channel acquisition
+                pooledBuffer = channel->useDMA ?
+                    mBufferPool.acquireDMA(dataSize) :
+                    mBufferPool.acquireInternal(dataSize);
+            }
 
             if (pooledBuffer.empty()) {
 #if FL_HAS_WARN
@@ -1202,9 +1240,18 @@ class ChannelEngineRMTImpl : public ChannelEngineRMT {
 
             // Copy data from PSRAM to pooled buffer using writeWithPadding
             // Note: writeWithPadding uses zero padding since RMT can handle any byte array size
+            // (a no-op when the frame was encoded into pooledBuffer).
             pending.data->writeWithPadding(pooledBuffer);
 
-            // Store pooled buffer in channel state for release on completion
+            // Store pooled buffer in channel state for release on completion.
+            // The transmission now owns a leased buffer; a DMA channel has
+            // copied out of it, so it goes back to the pool.
+            if (lease) {
+                if (channel->useDMA) {
+                    mBufferPool.releaseInternal(lease->buffer);
+                }
+                dropEncodeLease(pending.data.get());
+            }
             channel->pooledBuffer = pooledBuffer;
 
             bool enable_success = mPeripheral.enableChannel(channel->channel);
@@ -1465,6 +1512,34 @@ class ChannelEngineRMTImpl : public ChannelEngineRMT {
     /// @brief Buffer pool for PSRAM -> DRAM/DMA memory transfer
     RMTBufferPool mBufferPool;
 
+    /// @brief Pool buffer handed out by acquireEncodeBuffer() that no
+    /// transmission owns yet
+    struct EncodeLease {
+        const ChannelData* data;
+        fl::span<u8> buffer;
+    };
+    fl::vector_inlined<EncodeLease, 16> mEncodeLeases;
+
+    EncodeLease* findEncodeLease(const ChannelData* data) FL_NO_EXCEPT {
+        for (auto& lease : mEncodeLeases) {
+            if (lease.data == data) {
+                return &lease;
+            }
+        }
+        return nullptr;
+    }
+
+    /// @brief Remove the lease for `data` without releasing its buffer
+    void dropEncodeLease(const ChannelData* data) FL_NO_EXCEPT {
+        for (fl::size i = 0; i < mEncodeLeases.size(); ++i) {
+            if (mEncodeLeases[i].data == data) {
+                mEncodeLeases[i] = mEncodeLeases[mEncodeLeases.size() - 1];
+                mEncodeLeases.pop_back();
+                return;
+            }
+        }
+    }
+
     /// @brief Track DMA channel usage
     ///
     /// ESP32-S3 Hardware Limitation: Only 1 RMT DMA channel available
@@ -17,3 +17,4 @@
 #include "platforms/stub/spi_hw_manager_stub.cpp.hpp"
 #include "platforms/stub/stub_gpio.cpp.hpp"
 #include "platforms/stub/time_stub.cpp.hpp"
+#include "platforms/stub/virtual_bus_driver.cpp.hpp"
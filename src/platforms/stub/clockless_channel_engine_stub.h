@@ -10,6 +10,11 @@
 /// calls fl::stub::simulateWS2812Output() on enqueue(), which fires
 /// SimEdgeObserver callbacks. NativeRxDevice registers as an observer in
 /// begin() and captures those edges, completing the TX→RX loopback simulation.
+///
+/// For encode benchmarks (e.g. `ChannelManager::setEncodeWorkers()`), call
+/// setSimulateEdges(false) so the per-bit wire simulation does not swamp the
+/// encoder cost, and read channelCount()/byteCount() to confirm every channel
+/// arrived.
 
 #include "fl/channels/driver.h"
 #include "fl/channels/data.h"
@@ -37,6 +42,10 @@ public:
         if (!channelData || channelData->getData().empty()) return;
         if (!channelData->isClockless()) return;
 
+        mChannelCount++;
+        mByteCount += channelData->getData().size();
+        if (!mSimulateEdges) return;
+
         // Simulate WS2812 GPIO output — fires SimEdgeObserver callbacks so
         // any registered NativeRxDevice captures the edges.
         const fl::ChipsetTimingConfig& timing = channelData->getTiming();
@@ -63,6 +72,25 @@ public:
     virtual Capabilities getCapabilities() const FL_NO_EXCEPT override {
         return Capabilities(true, false);  // Clockless only
     }
+
+    /// @brief Enable/disable the per-bit SimEdgeObserver simulation (default on)
+    void setSimulateEdges(bool enabled) FL_NO_EXCEPT { mSimulateEdges = enabled; }
+
+    /// @brief Channels enqueued since the last resetCounters()
+    fl::u32 channelCount() const FL_NO_EXCEPT { return mChannelCount; }
+
+    /// @brief Encoded bytes enqueued since the last resetCounters()
+    fl::u64 byteCount() const FL_NO_EXCEPT { return mByteCount; }
+
+    void resetCounters() FL_NO_EXCEPT {
+        mChannelCount = 0;
+        mByteCount = 0;
+    }
+
+private:
+    bool mSimulateEdges = true;
+    fl::u32 mChannelCount = 0;
+    fl::u64 mByteCount = 0;
 };
 
 }  // namespace stub
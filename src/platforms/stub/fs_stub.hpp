@@ -24,6 +24,8 @@
   #include <unistd.h>
   #include <sys/stat.h>
   #include <dirent.h>   // For directory iteration
+  #include <fcntl.h>    // For open() in StubFileHandle::map()
+  #include <sys/mman.h> // For mmap()
 #include "fl/stl/noexcept.h"
 #endif
 
@@ -35,6 +37,7 @@ private:
     fl::string mPath;
     fl::size_t mSize;
     fl::size_t mPos;
+    void* mMap = nullptr;
 
 public:
     StubFileHandle(const fl::string& path) FL_NO_EXCEPT : mPath(path), mPos(0) {
@@ -48,9 +51,7 @@ public:
     }
 
     ~StubFileHandle() override {
-        if (mFile.is_open()) {
-            mFile.close();
-        }
+        close();
     }
 
     bool is_open() const FL_NO_EXCEPT override {
@@ -116,11 +117,37 @@ public:
     using filebuf::seek; // Pull in single-arg overload
 
     void close() FL_NO_EXCEPT override {
+#ifndef FL_IS_WIN
+        if (mMap) {
+            ::munmap(mMap, mSize);
+            mMap = nullptr;
+        }
+#endif
         if (mFile.is_open()) {
             mFile.close();
         }
     }
 
+    // Maps the host file read-only on first use (POSIX only).
+    fl::span<const fl::u8> map() FL_NO_EXCEPT override {
+#ifndef FL_IS_WIN
+        if (!mMap && mFile.is_open() && mSize > 0) {
+            int fd = ::open(mPath.c_str(), O_RDONLY);
+            if (fd >= 0) {
+                void* p = ::mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+                ::close(fd); // The mapping holds its own reference.
+                if (p != MAP_FAILED) {
+                    mMap = p;
+                }
+            }
+        }
+        if (mMap) {
+            return fl::span<const fl::u8>(static_cast<const fl::u8*>(mMap), mSize);
+        }
+#endif
+        return fl::span<const fl::u8>();
+    }
+
     bool is_eof() const FL_NO_EXCEPT override {
         return mPos >= mSize;
     }
@@ -0,0 +1,209 @@
+// IWYU pragma: private
+
+/// @file platforms/stub/virtual_bus_driver.cpp.hpp
+/// @brief VirtualBusDriver scheduling and wire-time model
+
+#include "platforms/stub/virtual_bus_driver.h"
+#include "fl/channels/config.h"
+#include "fl/log/log.h"
+#include "fl/stl/chrono.h"
+#include "fl/stl/move.h"
+#include "fl/stl/noexcept.h"
+
+namespace fl {
+namespace stub {
+
+namespace {
+
+// True when `now` has reached `mark` on the wrapping fl::micros() clock.
+bool reached(u32 now, u32 mark) FL_NO_EXCEPT {
+    return static_cast<i32>(now - mark) >= 0;
+}
+
+} // namespace
+
+VirtualBusDriver::VirtualBusDriver(const VirtualBusConfig& config) FL_NO_EXCEPT
+    : mConfig(config) {
+    if (mConfig.lanes == 0) {
+        FL_WARN_F("VirtualBusDriver: lanes must be >= 1, using 1");
+        mConfig.lanes = 1;
+    }
+    // One lane budget shared by both protocols: a channel of either kind
+    // occupies one of `lanes` slots while it transmits.
+    if (mConfig.clockless) {
+        PinGroup& group = mGroups[mNumGroups++];
+        group.instance_id = 0;
+        group.protocol = Protocol::Clockless;
+        group.data_pins = PinSet::anyOutput();
+        group.max_concurrent = mConfig.lanes;
+        group.shared_budget_id = 1;
+    }
+    if (mConfig.spi) {
+        PinGroup& group = mGroups[mNumGroups++];
+        group.instance_id = 1;
+        group.protocol = Protocol::Spi;
+        group.data_pins = PinSet::anyOutput();
+        group.clock_pins = PinSet::anyOutput();
+        group.max_concurrent = mConfig.lanes;
+        group.shared_budget_id = 1;
+    }
+    resetStats();
+}
+
+VirtualBusDriver::~VirtualBusDriver() {
+    releaseTransmitting();
+}
+
+bool VirtualBusDriver::canHandle(const ChannelDataPtr& data) const FL_NO_EXCEPT {
+    if (!data) {
+        return false;
+    }
+    const DriverCapabilities caps = getDriverCapabilities();
+    return (data->isClockless() && caps.supports_clockless) ||
+           (data->isSpi() && caps.supports_spi);
+}
+
+void VirtualBusDriver::enqueue(ChannelDataPtr channelData) FL_NO_EXCEPT {
+    if (!channelData || channelData->encoded().empty()) {
+        return;
+    }
+    mEnqueuedChannels.push_back(fl::move(channelData));
+}
+
+u32 VirtualBusDriver::channelWireUs(const ChannelData& data) FL_NO_EXCEPT {
+    const u64 bits = static_cast<u64>(data.encoded().size()) * 8;
+    if (data.isSpi()) {
+        const SpiChipsetConfig* spi = data.getChipset().ptr<SpiChipsetConfig>();
+        const u32 clockHz = spi->timing.clock_hz ? spi->timing.clock_hz : 1;
+        return static_cast<u32>((bits * 1000000 + clockHz - 1) / clockHz);
+    }
+    const ChipsetTimingConfig& timing = data.getTiming();
+    const u64 ns = bits * timing.total_period_ns();
+    return static_cast<u32>((ns + 999) / 1000) + timing.reset_us;
+}
+
+void VirtualBusDriver::show() FL_NO_EXCEPT {
+    if (mEnqueuedChannels.empty()) {
+        return;
+    }
+
+    // Lane count and channel cap come from the published capabilities, so
+    // the schedule always matches what the driver advertises.
+    const u8 lanes = mNumGroups ? getPinGroups()[0].max_concurrent : 1;
+    const u8 maxChannels = getDriverCapabilities().max_total_channels;
+
+    u32 now = fl::micros();
+    if (mRealTime && !mTransmittingChannels.empty() && !reached(now, mFrameEndUs)) {
+        // Previous frame is still on the wire: hardware would stall here.
+        const u32 waitStart = now;
+        while (!reached(now, mFrameEndUs)) {
+            now = fl::micros();
+        }
+        mStats.blockedUs += now - waitStart;
+    }
+    if (mStats.frames == 0) {
+        mFirstFrameUs = now;
+    }
+    releaseTransmitting();
+
+    mTransmittingChannels = fl::move(mEnqueuedChannels);
+    mEnqueuedChannels.clear();
+    if (maxChannels && mTransmittingChannels.size() > maxChannels) {
+        mStats.channelsDropped += mTransmittingChannels.size() - maxChannels;
+        mTransmittingChannels.resize(maxChannels);
+    }
+
+    mLaneFreeUs.assign(lanes, 0);
+    u32 lastStart = 0;
+    u32 frameEnd = 0;
+    for (fl::size i = 0; i < mTransmittingChannels.size(); ++i) {
+        ChannelData& data = *mTransmittingChannels[i];
+        data.setInUse(true);
+
+        fl::size lane = 0;
+        for (fl::size l = 1; l < mLaneFreeUs.size(); ++l) {
+            if (mLaneFreeUs[l] < mLaneFreeUs[lane]) {
+                lane = l;
+            }
+        }
+        const u32 start = mLaneFreeUs[lane];
+        const u32 duration = channelWireUs(data);
+        mLaneFreeUs[lane] = start + duration;
+
+        lastStart = start > lastStart ? start : lastStart;
+        frameEnd = mLaneFreeUs[lane] > frameEnd ? mLaneFreeUs[lane] : frameEnd;
+        mStats.laneBusyUs += duration;
+        mStats.bytes += data.encoded().size();
+        mStats.channels++;
+    }
+
+    mStats.lanes = lanes;
+    mStats.frames++;
+    mStats.lastWireUs = frameEnd;
+    mStats.maxWireUs = frameEnd > mStats.maxWireUs ? frameEnd : mStats.maxWireUs;
+    mStats.wireUs += frameEnd;
+    mStats.lastSubmitUs = lastStart;
+    mStats.submitUs += lastStart;
+
+    if (mRealTime) {
+        mSubmitDoneUs = now + lastStart;
+        mFrameEndUs = now + frameEnd;
+        mStats.elapsedUs = mFrameEndUs - mFirstFrameUs;
+    } else {
+        // Frames are modelled back to back; nothing stays on the wire.
+        mStats.elapsedUs = mStats.wireUs;
+        releaseTransmitting();
+    }
+}
+
+IChannelDriver::DriverState VirtualBusDriver::poll() FL_NO_EXCEPT {
+    if (mTransmittingChannels.empty()) {
+        return DriverState(DriverState::READY);
+    }
+    const u32 now = fl::micros();
+    if (!reached(now, mSubmitDoneUs)) {
+        return DriverState(DriverState::BUSY);
+    }
+    if (!reached(now, mFrameEndUs)) {
+        return DriverState(DriverState::DRAINING);
+    }
+    releaseTransmitting();
+    return DriverState(DriverState::READY);
+}
+
+fl::string VirtualBusDriver::getName() const FL_NO_EXCEPT {
+    return fl::string::from_literal("VIRTUAL");
+}
+
+IChannelDriver::Capabilities VirtualBusDriver::getCapabilities() const FL_NO_EXCEPT {
+    return Capabilities(mConfig.clockless, mConfig.spi);
+}
+
+DriverCapabilities VirtualBusDriver::getDriverCapabilities() const FL_NO_EXCEPT {
+    DriverCapabilities caps;
+    caps.name = "VIRTUAL";
+    caps.supports_clockless = mConfig.clockless;
+    caps.supports_spi = mConfig.spi;
+    caps.max_total_channels = mConfig.maxChannels;
+    caps.flags.mixed_protocols_ok = 1;
+    return caps;
+}
+
+fl::span<const PinGroup> VirtualBusDriver::getPinGroups() const FL_NO_EXCEPT {
+    return fl::span<const PinGroup>(mGroups, mNumGroups);
+}
+
+void VirtualBusDriver::resetStats() FL_NO_EXCEPT {
+    mStats = VirtualBusStats();
+    mStats.lanes = mConfig.lanes;
+}
+
+void VirtualBusDriver::releaseTransmitting() FL_NO_EXCEPT {
+    for (fl::size i = 0; i < mTransmittingChannels.size(); ++i) {
+        mTransmittingChannels[i]->setInUse(false);
+    }
+    mTransmittingChannels.clear();
+}
+
+}  // namespace stub
+}  // namespace fl
@@ -0,0 +1,141 @@
+#pragma once
+
+// IWYU pragma: private
+
+/// @file platforms/stub/virtual_bus_driver.h
+/// @brief Host-side channel driver that models wire time instead of ignoring it
+///
+/// ClocklessChannelEngineStub and the platform mocks accept a frame and are
+/// READY again immediately, so a host build cannot tell whether 32 strips of
+/// 1000 WS2812s fit in a 60 FPS budget. VirtualBusDriver schedules every
+/// enqueued channel on a fixed number of lanes using that channel's own
+/// timing:
+///
+///   - Clockless: bytes * 8 * (T1 + T2 + T3) + reset_us
+///   - SPI:       bytes * 8 / clock_hz
+///
+/// The lane count and per-frame channel cap are published through
+/// getPinGroups() (PinGroup::max_concurrent) and getDriverCapabilities()
+/// (max_total_channels), and the scheduler reads them back from there, so
+/// a configuration describes the hardware being planned for. Channels are
+/// assigned in enqueue order to the lane that frees up first, like a
+/// driver that refills RMT/DMA slots as they finish.
+///
+/// In real-time mode (default) poll() reports BUSY until the last channel
+/// has started and DRAINING until the last latch has elapsed on
+/// fl::micros(), so FastLED.show() blocks the way it would on hardware. With
+/// setRealTime(false) the schedule is only accounted for in getStats() and
+/// the driver is READY immediately, which is handy for fast sweeps.
+///
+/// Usage:
+/// @code
+/// auto bus = fl::make_shared<fl::stub::VirtualBusDriver>(VirtualBusConfig(8));
+/// fl::ChannelManager::instance().addDriver(1000, bus);
+/// // ... FastLED.show() a few times ...
+/// const auto& s = bus->getStats();
+/// fl::printf("%.1f FPS max, %.0f%% busy\n", s.achievableFps(), 100 * s.utilization());
+/// @endcode
+
+#include "fl/channels/driver.h"
+#include "fl/channels/data.h"
+#include "fl/stl/int.h"
+#include "fl/stl/noexcept.h"
+#include "fl/stl/string.h"
+#include "fl/stl/vector.h"
+
+namespace fl {
+namespace stub {
+
+/// @brief Hardware being modelled by a VirtualBusDriver
+struct VirtualBusConfig {
+    fl::u8 lanes = 8;          ///< Channels on the wire at once (PinGroup::max_concurrent)
+    fl::u8 maxChannels = 0;    ///< Channels accepted per frame; extra are dropped. 0 = unbounded
+    bool clockless = true;     ///< Accept clockless (WS2812-style) channels
+    bool spi = true;           ///< Accept SPI (APA102-style) channels
+
+    VirtualBusConfig() FL_NO_EXCEPT = default;
+    explicit VirtualBusConfig(fl::u8 lanes, fl::u8 maxChannels = 0) FL_NO_EXCEPT
+        : lanes(lanes), maxChannels(maxChannels) {}
+};
+
+/// @brief Accumulated schedule statistics (see VirtualBusDriver::getStats())
+struct VirtualBusStats {
+    fl::u8 lanes = 0;              ///< Lane count the frames were scheduled on
+    fl::u32 frames = 0;            ///< show() calls that transmitted something
+    fl::u32 channels = 0;          ///< Channels scheduled
+    fl::u32 channelsDropped = 0;   ///< Channels over maxChannels
+    fl::u64 bytes = 0;             ///< Encoded bytes scheduled
+    fl::u32 lastWireUs = 0;        ///< First bit to last latch of the last frame
+    fl::u32 maxWireUs = 0;         ///< Worst lastWireUs seen
+    fl::u64 wireUs = 0;            ///< Sum of per-frame wire time
+    fl::u32 lastSubmitUs = 0;      ///< show() until the last channel got a lane, last frame
+    fl::u64 submitUs = 0;          ///< Sum of per-frame submit time (modelled show() blocking)
+    fl::u64 blockedUs = 0;         ///< show() waiting for the previous frame to leave the wire
+    fl::u64 laneBusyUs = 0;        ///< Sum of per-channel transmit time
+    fl::u64 elapsedUs = 0;         ///< Wall time covered: first frame start to last frame end
+
+    /// @brief Frame rate the wire allows with zero CPU cost
+    double achievableFps() const FL_NO_EXCEPT {
+        return wireUs ? 1e6 * frames / static_cast<double>(wireUs) : 0.0;
+    }
+
+    /// @brief Fraction of lane-time spent transmitting, 0..1
+    double utilization() const FL_NO_EXCEPT {
+        const double capacity = static_cast<double>(lanes) * static_cast<double>(elapsedUs);
+        return capacity > 0 ? static_cast<double>(laneBusyUs) / capacity : 0.0;
+    }
+
+    /// @brief Average modelled show() blocking time per frame
+    double avgSubmitUs() const FL_NO_EXCEPT {
+        return frames ? static_cast<double>(submitUs) / frames : 0.0;
+    }
+};
+
+/// @brief Timing-accurate virtual LED bus for capacity planning on a host
+class VirtualBusDriver : public IChannelDriver {
+public:
+    explicit VirtualBusDriver(const VirtualBusConfig& config = VirtualBusConfig()) FL_NO_EXCEPT;
+    ~VirtualBusDriver() override;
+
+    bool canHandle(const ChannelDataPtr& data) const FL_NO_EXCEPT override;
+    void enqueue(ChannelDataPtr channelData) FL_NO_EXCEPT override;
+    void show() FL_NO_EXCEPT override;
+    DriverState poll() FL_NO_EXCEPT override;
+
+    fl::string getName() const FL_NO_EXCEPT override;
+    Capabilities getCapabilities() const FL_NO_EXCEPT override;
+    DriverCapabilities getDriverCapabilities() const FL_NO_EXCEPT override;
+    fl::span<const PinGroup> getPinGroups() const FL_NO_EXCEPT override;
+
+    /// @brief Pace poll() against fl::micros() (default true)
+    void setRealTime(bool enabled) FL_NO_EXCEPT { mRealTime = enabled; }
+    bool getRealTime() const FL_NO_EXCEPT { return mRealTime; }
+
+    /// @brief Wire time of one channel on this bus, in microseconds
+    static fl::u32 channelWireUs(const ChannelData& data) FL_NO_EXCEPT;
+
+    const VirtualBusStats& getStats() const FL_NO_EXCEPT { return mStats; }
+    void resetStats() FL_NO_EXCEPT;
+
+private:
+    void releaseTransmitting() FL_NO_EXCEPT;
+
+    VirtualBusConfig mConfig;
+    PinGroup mGroups[2];
+    fl::u8 mNumGroups = 0;
+    bool mRealTime = true;
+
+    fl::vector<ChannelDataPtr> mEnqueuedChannels;
+    fl::vector<ChannelDataPtr> mTransmittingChannels;
+    fl::vector<fl::u32> mLaneFreeUs;    // Per-lane free time, relative to frame start
+
+    // Absolute fl::micros() marks of the frame on the wire (real-time mode).
+    fl::u32 mSubmitDoneUs = 0;
+    fl::u32 mFrameEndUs = 0;
+    fl::u32 mFirstFrameUs = 0;
+
+    VirtualBusStats mStats;
+};
+
+}  // namespace stub
+}  // namespace fl
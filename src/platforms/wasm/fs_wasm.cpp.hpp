@@ -93,6 +93,16 @@ class FileData {
         return bytesToActuallyRead;
     }
 
+    // The whole file once every byte has arrived. Nothing appends to a
+    // complete file, so the view stays valid for the handle's lifetime.
+    fl::span<const u8> view() {
+        fl::unique_lock<fl::mutex> lock(mMutex);
+        if (mData.size() != mCapacity) {
+            return fl::span<const u8>();
+        }
+        return fl::span<const u8>(mData.data(), mData.size());
+    }
+
     bool ready(size_t pos) {
         fl::unique_lock<fl::mutex> lock(mMutex);
         return mData.size() == mCapacity || pos < mData.size();
@@ -209,6 +219,8 @@ class WasmFileHandle : public fl::filebuf {
         // No need to do anything for in-memory files
     }
 
+    fl::span<const fl::u8> map() override { return mData->view(); }
+
     bool is_eof() const override { return mPos >= mData->capacity(); }
     bool has_error() const override { return false; }
     void clear_error() override {}
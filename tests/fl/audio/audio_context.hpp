@@ -183,3 +183,96 @@ FL_TEST_CASE("audio::Context - silence flag") {
     ctx.setSilent(true);
     FL_CHECK(ctx.isSilent());
 }
+
+FL_TEST_CASE("audio::Context - FFT arena reuses preallocated bins") {
+    audio::Context ctx(makeSineAudioSample(440.0f, 0));
+    const int shapes[] = {16, 32};
+    ctx.reserveFFTArena(fl::span<const int>(shapes, 2));
+    FL_CHECK(ctx.hasFFTArena());
+
+    const audio::fft::Bins* b16 = ctx.peekFFT(16);
+    const audio::fft::Bins* b32 = ctx.peekFFT(32);
+    FL_REQUIRE(b16 != nullptr);
+    FL_REQUIRE(b32 != nullptr);
+    FL_CHECK(ctx.hasFFT());
+    FL_CHECK(ctx.peekFFT(16) == b16);  // Same frame: served from the slot.
+
+    // Arena results match the heap-backed path.
+    audio::Context ref(makeSineAudioSample(440.0f, 0));
+    auto refBins = ref.getFFT(16);
+    FL_REQUIRE_EQ(refBins->raw().size(), b16->raw().size());
+    for (fl::size i = 0; i < b16->raw().size(); ++i) {
+        FL_CHECK_EQ(refBins->raw()[i], b16->raw()[i]);
+    }
+
+    // Steady state: every frame recomputes into the same two slots.
+    for (int frame = 1; frame <= 5; ++frame) {
+        ctx.setSample(makeSineAudioSample(440.0f + frame * 100.0f, frame));
+        FL_CHECK(ctx.peekFFT(16) == b16);
+        FL_CHECK(ctx.getFFT(32).get() == b32);
+    }
+    const audio::Context::FFTArenaStats& stats = ctx.getFFTArenaStats();
+    FL_CHECK_EQ(stats.computed, 12u);
+    FL_CHECK_EQ(stats.hits, 1u);
+    FL_CHECK_EQ(stats.exhausted, 0u);
+}
+
+FL_TEST_CASE("audio::Context - FFT arena exhaustion falls back to the heap") {
+    audio::Context ctx(makeSineAudioSample(1000.0f, 0));
+    const int shapes[] = {16};
+    ctx.reserveFFTArena(fl::span<const int>(shapes, 1));
+
+    const audio::fft::Bins* a = ctx.peekFFT(16);
+    // A second 16-band shape in the same frame has no free slot.
+    const audio::fft::Bins* b = ctx.peekFFT(16, 200.0f, 4000.0f);
+    // No slot at all for 8 bands.
+    const audio::fft::Bins* c = ctx.peekFFT(8);
+    FL_REQUIRE(a != nullptr);
+    FL_REQUIRE(b != nullptr);
+    FL_REQUIRE(c != nullptr);
+    FL_CHECK(a != b);
+    FL_CHECK_EQ(c->bands(), 8u);
+    FL_CHECK_EQ(ctx.getFFTArenaStats().exhausted, 2u);
+
+    // A slot idle for a whole frame can rebind to other args.
+    ctx.setSample(makeSineAudioSample(1000.0f, 1));
+    ctx.setSample(makeSineAudioSample(1000.0f, 2));
+    ctx.resetFFTArenaStats();
+    FL_CHECK(ctx.peekFFT(16, 200.0f, 4000.0f) == a);
+    FL_CHECK_EQ(ctx.getFFTArenaStats().exhausted, 0u);
+}
+
+FL_TEST_CASE("audio::Context - peekFFT pointers survive cache eviction") {
+    audio::Context ctx(makeSineAudioSample(440.0f, 0));
+    const audio::fft::Bins* first = ctx.peekFFT(16);
+    FL_REQUIRE(first != nullptr);
+    // More shapes than the heap cache holds push `first` out of it.
+    for (int bands = 4; bands < 9; ++bands) {
+        FL_REQUIRE(ctx.peekFFT(bands) != nullptr);
+    }
+
+    audio::Context ref(makeSineAudioSample(440.0f, 0));
+    auto refBins = ref.getFFT(16);
+    FL_REQUIRE_EQ(first->raw().size(), refBins->raw().size());
+    for (fl::size i = 0; i < first->raw().size(); ++i) {
+        FL_CHECK_EQ(first->raw()[i], refBins->raw()[i]);
+    }
+
+    // Nothing else owns the evicted bins, so the next frame recycles them.
+    ctx.setSample(makeSineAudioSample(880.0f, 1));
+    FL_CHECK(ctx.peekFFT(16) == first);
+}
+
+FL_TEST_CASE("audio::Context - FFT history reads from the arena") {
+    audio::Context ctx(makeSineAudioSample(440.0f, 0));
+    const int shapes[] = {16};
+    ctx.reserveFFTArena(fl::span<const int>(shapes, 1));
+    ctx.setFFTHistoryDepth(3);
+    for (int frame = 0; frame < 4; ++frame) {
+        ctx.peekFFT(16);
+        ctx.setSample(makeSineAudioSample(440.0f, frame + 1));
+    }
+    FL_CHECK_EQ(ctx.getFFTHistory().size(), 3u);
+    FL_REQUIRE(ctx.getHistoricalFFT(0) != nullptr);
+    FL_CHECK_EQ(ctx.getHistoricalFFT(0)->bands(), 16u);
+}
@@ -4,6 +4,7 @@
 #include "tests/fl/audio/test_helpers.h"
 #include "fl/audio/audio.h"
 #include "fl/audio/audio_processor.h"
+#include "fl/stl/cstring.h"
 #include "fl/stl/vector.h"
 #include "fl/math/math.h"
 #include "fl/math/math.h"
@@ -641,4 +642,126 @@ FL_TEST_CASE("audio::detector::FrequencyBands - burst mode identical timestamps
     FL_CHECK_GT(bassNorm, 0.5f);
 }
 
+FL_TEST_CASE("audio::Processor - detector update interval skips frames") {
+    audio::Processor processor;
+    processor.setDetectorUpdateInterval("EnergyAnalyzer", 4);
+    int fired = 0;
+    processor.onEnergy([&fired](float) { ++fired; });
+
+    audio::Sample sample = makeSample(440.0f, 1000, 10000.0f);
+    for (int i = 0; i < 8; ++i) {
+        processor.update(sample);
+    }
+    FL_CHECK_EQ(fired, 2);
+    FL_CHECK_EQ(processor.getScheduleStats().detectorRuns, 2u);
+    FL_CHECK_EQ(processor.getScheduleStats().skippedInterval, 6u);
+
+    // Back to every frame once the interval is lowered
+    processor.setDetectorUpdateInterval("EnergyAnalyzer", 1);
+    processor.update(sample);
+    FL_CHECK_EQ(fired, 3);
+}
+
+FL_TEST_CASE("audio::Processor - detectors sharing an interval run on different frames") {
+    audio::Processor processor;
+    processor.setDetectorUpdateInterval("EnergyAnalyzer", 2);
+    processor.setDetectorUpdateInterval("Silence", 2);
+    int energy = 0;
+    processor.onEnergy([&energy](float) { ++energy; });
+    processor.onSilence([](fl::u8) {});
+
+    audio::Sample sample = makeSample(440.0f, 1000, 10000.0f);
+    processor.update(sample);
+    FL_CHECK_EQ(processor.getScheduleStats().detectorRuns, 1u);
+    FL_CHECK_EQ(energy, 1);
+    processor.update(sample);
+    FL_CHECK_EQ(processor.getScheduleStats().detectorRuns, 2u);
+    processor.update(sample);
+    FL_CHECK_EQ(processor.getScheduleStats().detectorRuns, 3u);
+    FL_CHECK_EQ(energy, 2);
+}
+
+FL_TEST_CASE("audio::Processor - key and mood run every 8th frame by default") {
+    audio::Processor processor;
+    processor.getKeyConfidence();
+    processor.getMoodArousal();
+
+    audio::Sample sample = makeSample(440.0f, 1000, 10000.0f);
+    for (int i = 0; i < 16; ++i) {
+        processor.update(sample);
+    }
+    FL_CHECK_EQ(processor.getScheduleStats().detectorRuns, 4u);
+    FL_CHECK_EQ(processor.getScheduleStats().skippedInterval, 28u);
+
+    processor.setDetectorUpdateInterval("KeyDetector", 1);
+    for (int i = 0; i < 8; ++i) {
+        processor.update(sample);
+    }
+    FL_CHECK_EQ(processor.getScheduleStats().detectorRuns, 4u + 8u + 1u);
+}
+
+FL_TEST_CASE("audio::Processor - polled detectors keep running by default") {
+    audio::Processor processor;
+    processor.getVocalConfidence();
+
+    audio::Sample sample = makeSample(440.0f, 1000, 10000.0f);
+    for (int i = 0; i < 200; ++i) {
+        processor.update(sample);
+    }
+    FL_CHECK_EQ(processor.getScheduleStats().detectorRuns, 200u);
+    FL_CHECK_EQ(processor.getScheduleStats().skippedIdle, 0u);
+}
+
+FL_TEST_CASE("audio::Processor - schedule runs dependencies first") {
+    audio::Processor processor;
+    processor.onBackbeat([](fl::u8, float, float) {});
+    processor.onNoteOn([](fl::u8, fl::u8) {});
+
+    fl::vector<const char*> order = processor.getSchedule();
+    auto indexOf = [&order](const char* name) {
+        for (fl::size i = 0; i < order.size(); ++i) {
+            if (fl::strcmp(order[i], name) == 0) {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    };
+    FL_REQUIRE_EQ(order.size(), 5u);
+    FL_CHECK_LT(indexOf("Beat"), indexOf("Downbeat"));
+    FL_CHECK_LT(indexOf("Downbeat"), indexOf("Backbeat"));
+    FL_CHECK_LT(indexOf("Pitch"), indexOf("Note"));
+}
+
+FL_TEST_CASE("audio::Processor - poll timeout idles unpolled detectors") {
+    audio::Processor processor;
+    processor.setPollTimeoutFrames(2);
+    processor.getVocalConfidence();
+
+    audio::Sample sample = makeSample(440.0f, 1000, 10000.0f);
+    for (int i = 0; i < 10; ++i) {
+        processor.update(sample);
+    }
+    FL_CHECK_EQ(processor.getScheduleStats().detectorRuns, 2u);
+    FL_CHECK_EQ(processor.getScheduleStats().skippedIdle, 8u);
+
+    // Polling again resumes updates
+    processor.getVocalConfidence();
+    processor.update(sample);
+    FL_CHECK_EQ(processor.getScheduleStats().detectorRuns, 3u);
+}
+
+FL_TEST_CASE("audio::Processor - subscribed detector keeps idle dependency running") {
+    audio::Processor processor;
+    processor.setPollTimeoutFrames(1);
+    processor.onDownbeat([]() {});
+
+    audio::Sample sample = makeSample(440.0f, 1000, 10000.0f);
+    for (int i = 0; i < 5; ++i) {
+        processor.update(sample);
+    }
+    // Beat has no callbacks of its own but Downbeat reads it every frame
+    FL_CHECK_EQ(processor.getScheduleStats().detectorRuns, 10u);
+    FL_CHECK_EQ(processor.getScheduleStats().skippedIdle, 0u);
+}
+
 } // FL_TEST_FILE
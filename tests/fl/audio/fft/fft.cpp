@@ -1399,4 +1399,51 @@ FL_TEST_CASE("Args::resolveModeEnums") {
     }
 }
 
+FL_TEST_CASE("FFT::runBatch matches per-window run()") {
+    // 4 overlapping 512-sample windows, hop 256, chirp input so every
+    // window has a different spectrum.
+    const int window = 512;
+    const int hop = 256;
+    const int total = window + 3 * hop + 100;  // trailing partial window
+    fl::vector<int16_t> pcm(total);
+    for (int i = 0; i < total; ++i) {
+        float t = static_cast<float>(i) / 44100.0f;
+        float freq = 200.0f + 4000.0f * static_cast<float>(i) / total;
+        pcm[i] = int16_t(16000 * fl::sin(2 * FL_PI * freq * t));
+    }
+    FL_CHECK_EQ(fl::audio::fft::FFT::windowCount(total, window, hop),
+                fl::size(4));
+
+    fl::audio::fft::Args args(window, 16);
+    fl::audio::fft::FFT fft;
+
+    fl::vector<fl::audio::fft::Bins> batch;
+    for (int i = 0; i < 6; ++i) {
+        batch.push_back(fl::audio::fft::Bins(16));
+    }
+    fl::span<const fl::i16> all(pcm.data(), pcm.size());
+    const fl::size ran = fft.runBatch(all, hop, batch, args);
+    FL_REQUIRE_EQ(ran, fl::size(4));
+
+    for (int w = 0; w < 4; ++w) {
+        fl::audio::fft::Bins single(16);
+        fft.run(all.slice(w * hop, w * hop + window), &single, args);
+        FL_REQUIRE_EQ(batch[w].raw().size(), single.raw().size());
+        for (fl::size b = 0; b < single.raw().size(); ++b) {
+            FL_CHECK_EQ(batch[w].raw()[b], single.raw()[b]);
+        }
+    }
+    // Bins past the last full window are left untouched.
+    FL_CHECK(batch[4].raw().empty());
+    FL_CHECK(batch[5].raw().empty());
+
+    // Output span shorter than the backlog caps the batch.
+    FL_CHECK_EQ(fft.runBatch(all, hop, fl::span<fl::audio::fft::Bins>(batch.data(), 2), args),
+                fl::size(2));
+    // Degenerate inputs.
+    FL_CHECK_EQ(fft.runBatch(all, 0, batch, args), fl::size(0));
+    FL_CHECK_EQ(fft.runBatch(all.slice(0, window - 1), hop, batch, args),
+                fl::size(0));
+}
+
 } // FL_TEST_FILE
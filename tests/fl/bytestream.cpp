@@ -79,6 +79,13 @@ FL_TEST_CASE("memorybuf basic operations") {
     }
 
 
+    FL_SUBCASE("map() is unsupported; callers fall back to read()") {
+        fl::memorybuf stream(4);
+        fl::u8 testData[] = {1, 2, 3};
+        stream.write(fl::span<const fl::u8>(testData, 3));
+        FL_CHECK(stream.map().empty());
+    }
+
     FL_SUBCASE("Write after partial read") {
         fl::memorybuf stream(10);
         fl::u8 testData[] = {1, 2, 3, 4, 5};
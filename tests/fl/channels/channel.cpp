@@ -8,9 +8,12 @@
 #include "fl/channels/bus_traits.h"
 #include "fl/channels/channel.h"
 #include "fl/channels/data.h"
+#include "fl/task/parallel_for.h"
 #include "fl/channels/driver.h"
 #include "fl/channels/manager.h"
 #include "fl/chipsets/chipset_timing_config.h"
+#include "fl/chipsets/encoders/apa102.h"
+#include "fl/chipsets/encoders/ws2812.h"
 #include "fl/gfx/fill.h"
 #include "fl/math/screenmap.h"
 #include "fl/math/xymap.h"
@@ -691,3 +694,464 @@ FL_TEST_CASE("[#2517] Re-enabling the driver resumes enqueue and re-arms the lat
     channel->showLeds(0);
     FL_CHECK_EQ(fakeDriver->enqueueCount, 2);
 }
+
+// ============ Pipelined show() ring buffers ============
+// With ChannelManager::setPipelineDepth(N > 1) each channel rotates through N
+// ChannelData buffers so frame N+1 encodes while the driver still owns frame N.
+
+namespace {
+
+/// Fake driver that holds every enqueued buffer "in flight" until it has been
+/// polled `releaseAfterPolls` times, mimicking a DMA transfer.
+class InFlightFakeDriver : public IChannelDriver {
+public:
+    explicit InFlightFakeDriver(const char* name) : mName(name) {}
+
+    fl::vector<ChannelDataPtr> mEnqueued;
+    fl::vector<ChannelDataPtr> mInFlight;
+    int releaseAfterPolls = -1;  // -1 = hold forever
+
+    bool canHandle(const ChannelDataPtr& data) const override {
+        (void)data;
+        return true;
+    }
+
+    void enqueue(ChannelDataPtr channelData) override {
+        channelData->setInUse(true);
+        mEnqueued.push_back(channelData);
+        mInFlight.push_back(channelData);
+    }
+
+    void show() override {}
+
+    DriverState poll() override {
+        if (releaseAfterPolls > 0) {
+            --releaseAfterPolls;
+        }
+        if (releaseAfterPolls == 0) {
+            for (auto& data : mInFlight) {
+                data->setInUse(false);
+            }
+            mInFlight.clear();
+        }
+        return mInFlight.empty() ? DriverState::READY : DriverState::BUSY;
+    }
+
+    fl::string getName() const override { return mName; }
+
+    Capabilities getCapabilities() const override {
+        return Capabilities(true, true);
+    }
+
+private:
+    fl::string mName;
+};
+
+}  // namespace
+
+FL_TEST_CASE("Pipelined show() encodes into a free ring buffer while the previous frame is in flight") {
+    auto& mgr = freshBusTestManager();
+    auto fakeDriver = fl::make_shared<InFlightFakeDriver>("PIPELINE_TEST");
+    mgr.addDriver(9000, fakeDriver);
+
+    CRGB leds[4] = {};
+    auto channel = Channel::create(makeSilentDropTestConfig(fl::span<CRGB>(leds, 4)));
+    FL_REQUIRE(channel != nullptr);
+
+    mgr.setPipelineDepth(2);
+    FL_CHECK(mgr.isPipelined());
+
+    auto cleanup = fl::make_scope_exit([&]() {
+        channel->removeFromDrawList();
+        fakeDriver->releaseAfterPolls = 0;
+        mgr.setPipelineDepth(1);
+        mgr.clearAllDrivers();
+    });
+    channel->addToDrawList();
+
+    // Frames 1 and 2 land in distinct buffers without waiting on the driver.
+    channel->showLeds(0);
+    channel->showLeds(0);
+    FL_REQUIRE_EQ(fakeDriver->mEnqueued.size(), 2u);
+    FL_CHECK(fakeDriver->mEnqueued[0].get() != fakeDriver->mEnqueued[1].get());
+    FL_CHECK_EQ(mgr.getPipelineStats().fenceWaits, 0u);
+
+    // Frame 3: both buffers still in flight -> the channel fences until the
+    // driver retires them (the onBeginFrame() poll plus one fence poll).
+    fakeDriver->releaseAfterPolls = 2;
+    channel->showLeds(0);
+    FL_REQUIRE_EQ(fakeDriver->mEnqueued.size(), 3u);
+    FL_CHECK_EQ(mgr.getPipelineStats().fenceWaits, 1u);
+    FL_CHECK(fakeDriver->mEnqueued[2].get() == fakeDriver->mEnqueued[0].get());
+
+    const ChannelManager::PipelineStats& stats = mgr.getPipelineStats();
+    FL_CHECK_EQ(stats.frames, 3u);
+    FL_CHECK(stats.maxFrameUs >= stats.lastFrameUs);
+
+    mgr.resetPipelineStats();
+    FL_CHECK_EQ(mgr.getPipelineStats().frames, 0u);
+}
+
+FL_TEST_CASE("Pipeline depth 1 keeps the legacy single-buffer behaviour") {
+    auto& mgr = freshBusTestManager();
+    auto fakeDriver = fl::make_shared<InFlightFakeDriver>("PIPELINE_LEGACY");
+    fakeDriver->releaseAfterPolls = 0;  // Release on every poll
+    mgr.addDriver(9000, fakeDriver);
+
+    CRGB leds[4] = {};
+    auto channel = Channel::create(makeSilentDropTestConfig(fl::span<CRGB>(leds, 4)));
+    FL_REQUIRE(channel != nullptr);
+    auto cleanup = fl::make_scope_exit([&]() {
+        channel->removeFromDrawList();
+        mgr.clearAllDrivers();
+    });
+    channel->addToDrawList();
+
+    FL_CHECK_FALSE(mgr.isPipelined());
+    channel->showLeds(0);
+    channel->showLeds(0);
+    FL_REQUIRE_EQ(fakeDriver->mEnqueued.size(), 2u);
+    FL_CHECK(fakeDriver->mEnqueued[0].get() == fakeDriver->mEnqueued[1].get());
+    FL_CHECK_EQ(mgr.getPipelineStats().fenceWaits, 0u);
+}
+
+// ============ Parallel encode stage ============
+
+FL_TEST_CASE("Parallel encode produces the same bytes as serial encode") {
+    auto& mgr = freshBusTestManager();
+    auto mockEngine = fl::make_shared<ByteCapturingMockEngine>("PARALLEL_ENCODE_TEST");
+    mgr.addDriver(9000, mockEngine);
+
+    const int kChannels = 6;
+    const int kLeds = 16;
+    CRGB leds[kChannels][kLeds];
+    fl::vector<ChannelPtr> channels;
+    for (int c = 0; c < kChannels; ++c) {
+        for (int i = 0; i < kLeds; ++i) {
+            leds[c][i] = CRGB(static_cast<u8>(c * 40 + i), static_cast<u8>(i * 9),
+                              static_cast<u8>(255 - c * 30));
+        }
+        auto timing = makeTimingConfig<TIMING_WS2812_800KHZ>();
+        ChannelConfig config(10 + c, timing, fl::span<CRGB>(leds[c], kLeds), GRB);
+        channels.push_back(Channel::create(config));
+        FastLED.add(channels.back());
+    }
+
+    auto cleanup = fl::make_scope_exit([&]() {
+        mgr.setEncodeWorkers(1);
+        for (auto& channel : channels) {
+            channel->removeFromDrawList();
+        }
+        mgr.clearAllDrivers();
+    });
+
+    auto captureFrame = [&]() {
+        mockEngine->mCapturedChannels.clear();
+        FastLED.show();
+        fl::vector<fl::vector<u8>> frame;
+        for (const auto& data : mockEngine->mCapturedChannels) {
+            const auto& bytes = data->getData();
+            frame.push_back(fl::vector<u8>(bytes.begin(), bytes.end()));
+        }
+        return frame;
+    };
+
+    mgr.setEncodeWorkers(1);
+    fl::vector<fl::vector<u8>> serial = captureFrame();
+
+    mgr.setEncodeWorkers(4);
+    if (fl::task::parallelForSupported()) {
+        FL_CHECK_EQ(mgr.getEncodeWorkers(), 4);
+    } else {
+        FL_CHECK_EQ(mgr.getEncodeWorkers(), 1);
+    }
+    fl::vector<fl::vector<u8>> parallel = captureFrame();
+
+    FL_REQUIRE_EQ(serial.size(), static_cast<fl::size>(kChannels));
+    FL_REQUIRE_EQ(parallel.size(), serial.size());
+    for (fl::size c = 0; c < serial.size(); ++c) {
+        FL_CHECK_EQ(serial[c].size(), static_cast<fl::size>(kLeds * 3));
+        FL_CHECK(serial[c] == parallel[c]);
+    }
+}
+
+FL_TEST_CASE("Parallel encode copies showColor()'s temporary colour") {
+    auto& mgr = freshBusTestManager();
+    auto mockEngine = fl::make_shared<ByteCapturingMockEngine>("PARALLEL_SHOWCOLOR_TEST");
+    mgr.addDriver(9000, mockEngine);
+
+    const int kLeds = 4;
+    CRGB leds[2][kLeds];
+    fl::vector<ChannelPtr> channels;
+    for (int c = 0; c < 2; ++c) {
+        auto timing = makeTimingConfig<TIMING_WS2812_800KHZ>();
+        ChannelConfig config(20 + c, timing, fl::span<CRGB>(leds[c], kLeds), RGB);
+        channels.push_back(Channel::create(config));
+        channels.back()->setDither(DISABLE_DITHER);
+    }
+    auto cleanup = fl::make_scope_exit([&]() {
+        mgr.setEncodeWorkers(1);
+        mgr.clearAllDrivers();
+    });
+
+    mgr.setEncodeWorkers(4);
+    mockEngine->mCapturedChannels.clear();
+    for (int c = 0; c < 2; ++c) {
+        CRGB color(static_cast<u8>(10 + c), 20, 30);
+        channels[c]->showColorInternal(color, kLeds, 255);
+        color = CRGB::Black;  // The deferred frame must not see this.
+    }
+    mgr.onEndFrame();
+
+    FL_REQUIRE_EQ(mockEngine->mCapturedChannels.size(), 2u);
+    for (int c = 0; c < 2; ++c) {
+        const auto& bytes = mockEngine->mCapturedChannels[c]->getData();
+        FL_REQUIRE_EQ(bytes.size(), static_cast<fl::size>(kLeds * 3));
+        for (int i = 0; i < kLeds; ++i) {
+            FL_CHECK_EQ(bytes[i * 3 + 0], 10 + c);
+            FL_CHECK_EQ(bytes[i * 3 + 1], 20);
+            FL_CHECK_EQ(bytes[i * 3 + 2], 30);
+        }
+    }
+}
+
+// ============ Direct encode into driver buffers ============
+
+namespace {
+
+/// Fake driver that owns a "DMA" region and lends it to the channel encoder.
+class BufferLendingFakeDriver : public ByteCapturingMockEngine {
+public:
+    explicit BufferLendingFakeDriver(fl::size capacity)
+        : ByteCapturingMockEngine("BUFFER_LENDING"), mDma(capacity, 0xEE) {}
+
+    fl::vector<u8> mDma;
+    fl::size lastRequest = 0;
+
+    fl::span<u8> acquireEncodeBuffer(const ChannelData& data, fl::size bytes) override {
+        (void)data;
+        lastRequest = bytes;
+        return fl::span<u8>(mDma.data(), mDma.size());
+    }
+};
+
+}  // namespace
+
+FL_TEST_CASE("Channel encodes straight into a driver-provided buffer") {
+    const int kLeds = 5;
+    CRGB leds[kLeds];
+    for (int i = 0; i < kLeds; ++i) {
+        leds[i] = CRGB(static_cast<u8>(10 + i), static_cast<u8>(100 + i), static_cast<u8>(200 + i));
+    }
+    SpiChipsetConfig spiConfig{5, 6, SpiEncoder::apa102()};
+    ChannelConfig config(spiConfig, fl::span<CRGB>(leds, kLeds), RGB, ChannelOptions());
+
+    // Encode once through a plain driver for the reference bytes.
+    fl::vector<u8> reference;
+    {
+        auto& mgr = freshBusTestManager();
+        auto plain = fl::make_shared<ByteCapturingMockEngine>("PLAIN");
+        mgr.addDriver(9000, plain);
+        auto channel = Channel::create(config);
+        FL_REQUIRE(channel != nullptr);
+        channel->addToDrawList();
+        channel->showLeds(255);
+        FL_REQUIRE_EQ(plain->mCapturedChannels.size(), 1u);
+        const auto& bytes = plain->mCapturedChannels[0]->getData();
+        reference.assign(bytes.begin(), bytes.end());
+        channel->removeFromDrawList();
+        mgr.clearAllDrivers();
+    }
+
+    auto& mgr = freshBusTestManager();
+    auto lending = fl::make_shared<BufferLendingFakeDriver>(64);
+    mgr.addDriver(9000, lending);
+    auto channel = Channel::create(config);
+    FL_REQUIRE(channel != nullptr);
+    auto cleanup = fl::make_scope_exit([&]() {
+        channel->removeFromDrawList();
+        mgr.clearAllDrivers();
+    });
+    channel->addToDrawList();
+    channel->showLeds(255);
+
+    const fl::size expected = apa102EncodedSize(kLeds);
+    FL_CHECK_EQ(reference.size(), expected);
+    FL_CHECK_EQ(lending->lastRequest, expected);
+    FL_REQUIRE_EQ(lending->mCapturedChannels.size(), 1u);
+    const ChannelDataPtr& data = lending->mCapturedChannels[0];
+    FL_CHECK(data->hasExternalEncoded());
+    FL_CHECK(data->encoded().data() == lending->mDma.data());
+    FL_CHECK_EQ(data->encoded().size(), expected);
+    FL_CHECK_EQ(data->getSize(), expected);
+    FL_CHECK(data->getData().empty());
+
+    // Same bytes as the channel's own buffer, and no write past the frame.
+    for (fl::size i = 0; i < expected && i < reference.size(); ++i) {
+        FL_CHECK_EQ(lending->mDma[i], reference[i]);
+    }
+    FL_CHECK_EQ(lending->mDma[expected], 0xEE);
+}
+
+FL_TEST_CASE("Channel falls back to its own exactly-sized buffer when the driver lends none") {
+    auto& mgr = freshBusTestManager();
+    auto lending = fl::make_shared<BufferLendingFakeDriver>(4);  // Too small
+    mgr.addDriver(9000, lending);
+
+    CRGB leds[6] = {};
+    auto channel = Channel::create(makeSilentDropTestConfig(fl::span<CRGB>(leds, 6)));
+    FL_REQUIRE(channel != nullptr);
+    auto cleanup = fl::make_scope_exit([&]() {
+        channel->removeFromDrawList();
+        mgr.clearAllDrivers();
+    });
+    channel->addToDrawList();
+    channel->showLeds(255);
+
+    FL_REQUIRE_EQ(lending->mCapturedChannels.size(), 1u);
+    const ChannelDataPtr& data = lending->mCapturedChannels[0];
+    FL_CHECK_FALSE(data->hasExternalEncoded());
+    FL_CHECK_EQ(data->getData().size(), ws2812EncodedSize(6, 3));
+    FL_CHECK(data->encoded().data() == data->getData().data());
+}
+
+FL_TEST_CASE("Channel keeps getData() populated while encode listeners are registered") {
+    auto& mgr = freshBusTestManager();
+    auto lending = fl::make_shared<BufferLendingFakeDriver>(64);
+    mgr.addDriver(9000, lending);
+
+    auto& events = ChannelEvents::instance();
+    fl::size seen = 0;
+    int listenerId = events.onChannelDataEncoded.add(
+        [&](const IChannel&, const ChannelData& data) { seen = data.getData().size(); });
+
+    CRGB leds[6] = {};
+    auto channel = Channel::create(makeSilentDropTestConfig(fl::span<CRGB>(leds, 6)));
+    FL_REQUIRE(channel != nullptr);
+    auto cleanup = fl::make_scope_exit([&]() {
+        events.onChannelDataEncoded.remove(listenerId);
+        channel->removeFromDrawList();
+        mgr.clearAllDrivers();
+    });
+    channel->addToDrawList();
+    channel->showLeds(255);
+
+    FL_CHECK_EQ(lending->lastRequest, 0u);
+    FL_CHECK_EQ(seen, ws2812EncodedSize(6, 3));
+    FL_REQUIRE_EQ(lending->mCapturedChannels.size(), 1u);
+    FL_CHECK_FALSE(lending->mCapturedChannels[0]->hasExternalEncoded());
+}
+
+// ============ Skip unchanged frames ============
+
+namespace {
+
+ChannelConfig makeSkipTestConfig(bool spi, fl::span<CRGB> leds) {
+    ChannelOptions options;
+    options.mDitherMode = DISABLE_DITHER;
+    options.mSkipUnchanged = true;
+    if (spi) {
+        SpiChipsetConfig spiConfig{5, 6, SpiEncoder::apa102()};
+        return ChannelConfig(spiConfig, leds, RGB, options);
+    }
+    auto timing = makeTimingConfig<TIMING_WS2812_800KHZ>();
+    return ChannelConfig(7, timing, leds, GRB, options);
+}
+
+}  // namespace
+
+FL_TEST_CASE("setSkipUnchanged - latched SPI strip is not re-sent while unchanged") {
+    auto& mgr = freshBusTestManager();
+    auto mockEngine = fl::make_shared<ByteCapturingMockEngine>("SKIP_SPI");
+    mgr.addDriver(9000, mockEngine);
+
+    CRGB leds[8];
+    fl::fill_solid(leds, 8, CRGB(10, 20, 30));
+    auto channel = Channel::create(makeSkipTestConfig(true, fl::span<CRGB>(leds, 8)));
+    FL_REQUIRE(channel != nullptr);
+    auto cleanup = fl::make_scope_exit([&]() {
+        channel->removeFromDrawList();
+        mgr.clearAllDrivers();
+    });
+    channel->addToDrawList();
+    FL_CHECK(channel->getSkipUnchanged());
+
+    channel->showLeds(200);
+    channel->showLeds(200);
+    channel->showLeds(200);
+    FL_CHECK_EQ(mockEngine->mCapturedChannels.size(), 1u);
+    FL_CHECK_EQ(channel->getChangeStats().frames, 3u);
+    FL_CHECK_EQ(channel->getChangeStats().encodesSkipped, 2u);
+    FL_CHECK_EQ(channel->getChangeStats().transmitsSkipped, 2u);
+
+    // A pixel edit and a brightness change each force a fresh frame.
+    leds[3] = CRGB::Red;
+    channel->showLeds(200);
+    FL_CHECK_EQ(mockEngine->mCapturedChannels.size(), 2u);
+    channel->showLeds(100);
+    FL_CHECK_EQ(mockEngine->mCapturedChannels.size(), 3u);
+    channel->showLeds(100);
+    FL_CHECK_EQ(mockEngine->mCapturedChannels.size(), 3u);
+
+    // Config changes drop the cached frame.
+    channel->setGamma(2.2f);
+    channel->showLeds(100);
+    FL_CHECK_EQ(mockEngine->mCapturedChannels.size(), 4u);
+}
+
+FL_TEST_CASE("setSkipUnchanged - clockless strip is re-sent from the cached encoding") {
+    auto& mgr = freshBusTestManager();
+    auto mockEngine = fl::make_shared<ByteCapturingMockEngine>("SKIP_CLOCKLESS");
+    mgr.addDriver(9000, mockEngine);
+
+    CRGB leds[6];
+    for (int i = 0; i < 6; ++i) {
+        leds[i] = CRGB(static_cast<u8>(i * 40), 7, 200);
+    }
+    auto channel = Channel::create(makeSkipTestConfig(false, fl::span<CRGB>(leds, 6)));
+    FL_REQUIRE(channel != nullptr);
+    auto cleanup = fl::make_scope_exit([&]() {
+        channel->removeFromDrawList();
+        mgr.clearAllDrivers();
+    });
+    channel->addToDrawList();
+
+    channel->showLeds(255);
+    FL_REQUIRE_EQ(mockEngine->mCapturedChannels.size(), 1u);
+    const auto& first = mockEngine->mCapturedChannels[0]->getData();
+    fl::vector<u8> firstBytes(first.begin(), first.end());
+
+    channel->showLeds(255);
+    FL_REQUIRE_EQ(mockEngine->mCapturedChannels.size(), 2u);
+    const auto& second = mockEngine->mCapturedChannels[1]->getData();
+    FL_CHECK(fl::vector<u8>(second.begin(), second.end()) == firstBytes);
+    FL_CHECK_EQ(channel->getChangeStats().encodesSkipped, 1u);
+    FL_CHECK_EQ(channel->getChangeStats().transmitsSkipped, 0u);
+
+    leds[0] = CRGB::Blue;
+    channel->showLeds(255);
+    FL_CHECK_EQ(channel->getChangeStats().encodesSkipped, 1u);
+    const auto& third = mockEngine->mCapturedChannels[2]->getData();
+    FL_CHECK(fl::vector<u8>(third.begin(), third.end()) != firstBytes);
+}
+
+FL_TEST_CASE("setSkipUnchanged - off by default, every frame is encoded and sent") {
+    auto& mgr = freshBusTestManager();
+    auto mockEngine = fl::make_shared<ByteCapturingMockEngine>("SKIP_OFF");
+    mgr.addDriver(9000, mockEngine);
+
+    CRGB leds[4] = {};
+    auto channel = Channel::create(makeSilentDropTestConfig(fl::span<CRGB>(leds, 4)));
+    FL_REQUIRE(channel != nullptr);
+    auto cleanup = fl::make_scope_exit([&]() {
+        channel->removeFromDrawList();
+        mgr.clearAllDrivers();
+    });
+    channel->addToDrawList();
+    FL_CHECK_FALSE(channel->getSkipUnchanged());
+
+    channel->showLeds(255);
+    channel->showLeds(255);
+    FL_CHECK_EQ(mockEngine->mCapturedChannels.size(), 2u);
+    FL_CHECK_EQ(channel->getChangeStats().frames, 0u);
+}
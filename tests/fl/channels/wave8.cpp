@@ -1372,4 +1372,72 @@ FL_TEST_CASE("wave8Transpose_4 matches between nibble LUT and byte LUT") {
     }
 }
 
+FL_TEST_CASE("wave8_expand_span_simd == byte LUT for all 256 bytes across real chipsets") {
+    // The kernel compiles against whatever fl::simd backend the host has, so
+    // this checks the select-mask identity even where wave8ExpandSpan() still
+    // dispatches to the byte loop.
+    const RealTimingEntry entries[] = {
+        {"WS2812_800KHZ",  makeRealTiming<TIMING_WS2812_800KHZ>()},
+        {"SK6812",         makeRealTiming<TIMING_SK6812>()},
+        {"TM1809_800KHZ",  makeRealTiming<TIMING_TM1809_800KHZ>()},
+        {"WS2811_400KHZ",  makeRealTiming<TIMING_WS2811_400KHZ>()},
+        {"UCS1903_400KHZ", makeRealTiming<TIMING_UCS1903_400KHZ>()},
+    };
+
+    u8 input[256];
+    for (int b = 0; b < 256; ++b) {
+        input[b] = static_cast<u8>(b);
+    }
+
+    for (const auto& entry : entries) {
+        Wave8BitExpansionLut nibble = buildWave8ExpansionLUT(entry.timing);
+        Wave8ByteExpansionLut byteLut = buildWave8ByteExpansionLUT(nibble);
+
+        Wave8Byte got[256];
+        const fl::size done = detail::wave8_expand_span_simd(
+            input, 256, byteLut.lut[0x00].symbols[0].data,
+            byteLut.lut[0xFF].symbols[0].data, got);
+        FL_REQUIRE_EQ(done, fl::size(256));
+
+        for (int b = 0; b < 256; ++b) {
+            for (int s = 0; s < 8; ++s) {
+                FL_INFO("chipset=" << entry.name << " byte=0x" << b
+                        << " symbol=" << s);
+                FL_REQUIRE(got[b].symbols[s].data ==
+                           byteLut.lut[b].symbols[s].data);
+            }
+        }
+    }
+}
+
+FL_TEST_CASE("wave8ExpandSpan == wave8ExpandSpan_scalar (odd length, short output)") {
+    ChipsetTiming timing = makeRealTiming<TIMING_WS2812_800KHZ>();
+    Wave8ByteExpansionLut lut =
+        buildWave8ByteExpansionLUT(buildWave8ExpansionLUT(timing));
+
+    u8 input[301];
+    u32 seed = 0x1234567u;
+    for (int i = 0; i < 301; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        input[i] = static_cast<u8>(seed >> 24);
+    }
+
+    Wave8Byte ref[301];
+    Wave8Byte got[301];
+    fl::memset(got, 0, sizeof(got));
+    FL_CHECK_EQ(wave8ExpandSpan_scalar(input, lut, ref), fl::size(301));
+    FL_CHECK_EQ(wave8ExpandSpan(input, lut, got), fl::size(301));
+    FL_CHECK(fl::memcmp(ref, got, sizeof(ref)) == 0);
+
+    // Output shorter than input: stops at the output size, never writes past.
+    Wave8Byte shortOut[5];
+    fl::memset(shortOut, 0xA5, sizeof(shortOut));
+    FL_CHECK_EQ(wave8ExpandSpan(fl::span<const u8>(input, 301), lut,
+                                fl::span<Wave8Byte>(shortOut, 3)),
+                fl::size(3));
+    FL_CHECK(fl::memcmp(shortOut, ref, 3 * sizeof(Wave8Byte)) == 0);
+    FL_CHECK(shortOut[3].symbols[0].data == 0xA5);
+    FL_CHECK(shortOut[4].symbols[7].data == 0xA5);
+}
+
 } // FL_TEST_FILE
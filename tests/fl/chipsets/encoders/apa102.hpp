@@ -3,6 +3,8 @@
 
 #include "test.h"
 #include "fl/chipsets/encoders/apa102.h"
+#include "fl/gfx/crgb.h"
+#include "fl/gfx/five_bit_hd_gamma.h"
 #include "fl/stl/array.h"
 #include "fl/stl/iterator.h"
 #include "fl/stl/cstddef.h"
@@ -10,6 +12,7 @@
 #include "fl/stl/int.h"
 #include "fl/stl/allocator.h"
 #include "fl/stl/vector.h"
+#include "fl/stl/cstring.h"
 
 namespace test_apa102 {
 using namespace test_apa102;
@@ -497,4 +500,75 @@ FL_TEST_CASE("encodeAPA102_AutoBrightness() - end frame boundary 20 LEDs") {
     verifyEndFrame(output, 4 + 20 * 4, 20);
 }
 
+//=============================================================================
+// five_bit_hd_gamma_apa102_frames() - fused HD gamma
+//=============================================================================
+
+// Reference: two-pass CRGBA5 gamma followed by LED-frame formatting.
+static fl::vector<fl::u8> twoPassFrames(const fl::vector<CRGB>& leds, CRGB scale,
+                                        fl::u8 brightness, fl::EOrder order) {
+    fl::vector<fl::CRGBA5> gamma(leds.size());
+    fl::five_bit_hd_gamma_bitshift(fl::span<const CRGB>(leds.data(), leds.size()),
+                                   scale, brightness,
+                                   fl::span<fl::CRGBA5>(gamma.data(), gamma.size()));
+    const int o = static_cast<int>(order);
+    fl::vector<fl::u8> out;
+    for (size_t i = 0; i < gamma.size(); ++i) {
+        out.push_back(0xE0 | gamma[i].brightness_5bit);
+        out.push_back(gamma[i].color.raw[(o >> 6) & 3]);
+        out.push_back(gamma[i].color.raw[(o >> 3) & 3]);
+        out.push_back(gamma[i].color.raw[o & 3]);
+    }
+    return out;
+}
+
+static fl::vector<CRGB> hdGammaTestPixels(size_t n) {
+    fl::vector<CRGB> leds(n);
+    fl::u32 seed = 12345;
+    for (size_t i = 0; i < n; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        leds[i] = CRGB(static_cast<fl::u8>(seed >> 8), static_cast<fl::u8>(seed >> 16),
+                       static_cast<fl::u8>(seed >> 24));
+        if (i % 7 == 0) leds[i] = CRGB(0, 0, 0);
+        if (i % 11 == 0) leds[i].g = 0;
+        if (i % 13 == 0) leds[i] = CRGB(1, 0, 2);
+    }
+    return leds;
+}
+
+FL_TEST_CASE("five_bit_hd_gamma_apa102_frames() - matches two-pass CRGBA5") {
+    const fl::vector<CRGB> leds = hdGammaTestPixels(301);
+    const fl::EOrder orders[] = {fl::EOrder::RGB, fl::EOrder::BGR, fl::EOrder::GRB,
+                                 fl::EOrder::BRG};
+    const CRGB scales[] = {CRGB(255, 255, 255), CRGB(255, 200, 180), CRGB(0, 1, 128)};
+    const fl::u8 brightness[] = {255, 254, 128, 31, 30, 1, 0};
+    fl::vector<fl::u8> fused(leds.size() * 4);
+    for (fl::EOrder order : orders) {
+        for (const CRGB& scale : scales) {
+            for (fl::u8 bri : brightness) {
+                const size_t n = fl::five_bit_hd_gamma_apa102_frames(
+                    fl::span<const CRGB>(leds.data(), leds.size()), scale, bri, order,
+                    fl::span<fl::u8>(fused.data(), fused.size()));
+                FL_REQUIRE(n == leds.size());
+                const fl::vector<fl::u8> expected = twoPassFrames(leds, scale, bri, order);
+                for (size_t i = 0; i < expected.size(); ++i) {
+                    FL_REQUIRE(fused[i] == expected[i]);
+                }
+            }
+        }
+    }
+}
+
+FL_TEST_CASE("five_bit_hd_gamma_apa102_frames() - output span limits count") {
+    const fl::vector<CRGB> leds = hdGammaTestPixels(10);
+    fl::u8 out[4 * 3 + 2];
+    fl::memset(out, 0xAA, sizeof(out));
+    const size_t n = fl::five_bit_hd_gamma_apa102_frames(
+        fl::span<const CRGB>(leds.data(), leds.size()), CRGB(255, 255, 255), 255,
+        fl::EOrder::BGR, fl::span<fl::u8>(out, sizeof(out)));
+    FL_CHECK(n == 3);
+    FL_CHECK(out[12] == 0xAA);
+    FL_CHECK(out[13] == 0xAA);
+}
+
 } // namespace test_apa102
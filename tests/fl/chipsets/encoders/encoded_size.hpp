@@ -0,0 +1,121 @@
+/// @file encoded_size.hpp
+/// @brief *EncodedSize() helpers must match what each encoder writes, and
+///        SpanSink must accept a frame of exactly that size.
+
+#include "fl/chipsets/encoders/apa102.h"
+#include "fl/chipsets/encoders/hd108.h"
+#include "fl/chipsets/encoders/lpd6803.h"
+#include "fl/chipsets/encoders/lpd8806.h"
+#include "fl/chipsets/encoders/output_sink.h"
+#include "fl/chipsets/encoders/p9813.h"
+#include "fl/chipsets/encoders/sk9822.h"
+#include "fl/chipsets/encoders/sm16716.h"
+#include "fl/chipsets/encoders/tm1812.h"
+#include "fl/chipsets/encoders/ws2801.h"
+#include "fl/chipsets/encoders/ws2803.h"
+#include "fl/chipsets/encoders/ws2812.h"
+#include "fl/stl/array.h"
+#include "fl/stl/iterator.h"
+#include "fl/stl/span.h"
+#include "fl/stl/vector.h"
+#include "test.h"
+
+using namespace fl;
+
+namespace test_encoded_size {
+
+// Counts straddling the 2-pixel, 32-LED and 64-byte-latch boundaries.
+const size_t kCounts[] = {0, 1, 2, 3, 21, 22, 31, 32, 33, 63, 64, 65, 100};
+
+fl::vector<fl::array<u8, 3>> rgbPixels(size_t n) {
+    fl::vector<fl::array<u8, 3>> px(n);
+    for (size_t i = 0; i < n; ++i) {
+        px[i] = {static_cast<u8>(i * 7), static_cast<u8>(i * 13), static_cast<u8>(i * 29)};
+    }
+    return px;
+}
+
+// Checks that both buffers hold `expected` identical bytes and that nothing
+// was written past the span.
+void checkSame(size_t expected, const fl::vector<u8> &ref, const SpanSink &sink,
+               const fl::vector<u8> &buf) {
+    FL_CHECK_EQ(ref.size(), expected);
+    FL_CHECK_EQ(sink.size(), expected);
+    FL_CHECK_EQ(sink.remaining(), 0u);
+    for (size_t i = 0; i < expected && i < ref.size(); ++i) {
+        FL_REQUIRE_EQ(buf[i], ref[i]);
+    }
+    for (size_t i = expected; i < buf.size(); ++i) {
+        FL_REQUIRE_EQ(buf[i], 0xEE);
+    }
+}
+
+// Runs ENCODE (which writes to `out`) once into a vector and once into a
+// SpanSink holding exactly `expected` bytes.
+#define CHECK_ENCODED_SIZE(expected, ENCODE)                                   \
+    do {                                                                       \
+        const size_t kExpected = (expected);                                   \
+        fl::vector<u8> ref;                                                    \
+        {                                                                      \
+            auto out = fl::back_inserter(ref);                                 \
+            ENCODE;                                                            \
+        }                                                                      \
+        fl::vector<u8> buf(kExpected + 4, 0xEE);                               \
+        SpanSink sink(fl::span<u8>(buf.data(), kExpected));                    \
+        {                                                                      \
+            auto out = fl::back_inserter(sink);                                \
+            ENCODE;                                                            \
+        }                                                                      \
+        checkSame(kExpected, ref, sink, buf);                                  \
+    } while (0)
+
+} // namespace test_encoded_size
+
+using namespace test_encoded_size;
+
+FL_TEST_CASE("EncodedSize - matches encoder output for every SPI chipset") {
+    for (size_t n : kCounts) {
+        auto px = rgbPixels(n);
+        fl::vector<u8> bri(n, 17);
+        auto b = px.begin();
+        auto e = px.end();
+
+        CHECK_ENCODED_SIZE(apa102EncodedSize(n), encodeAPA102(b, e, out));
+        CHECK_ENCODED_SIZE(apa102EncodedSize(n), encodeAPA102_HD(b, e, bri.begin(), out));
+        CHECK_ENCODED_SIZE(sk9822EncodedSize(n), encodeSK9822(b, e, out));
+        CHECK_ENCODED_SIZE(sk9822EncodedSize(n), encodeSK9822_HD(b, e, bri.begin(), out));
+        CHECK_ENCODED_SIZE(hd108EncodedSize(n), encodeHD108(b, e, out));
+        CHECK_ENCODED_SIZE(hd108EncodedSize(n), encodeHD108_HD(b, e, bri.begin(), out));
+        CHECK_ENCODED_SIZE(ws2801EncodedSize(n), encodeWS2801(b, e, out));
+        CHECK_ENCODED_SIZE(ws2803EncodedSize(n), encodeWS2803(b, e, out));
+        CHECK_ENCODED_SIZE(p9813EncodedSize(n), encodeP9813(b, e, out));
+        CHECK_ENCODED_SIZE(lpd8806EncodedSize(n), encodeLPD8806(b, e, out));
+        CHECK_ENCODED_SIZE(lpd6803EncodedSize(n), encodeLPD6803(b, e, out));
+        CHECK_ENCODED_SIZE(sm16716EncodedSize(n), encodeSM16716(b, e, out));
+    }
+}
+
+FL_TEST_CASE("EncodedSize - matches encoder output for clockless chipsets") {
+    for (size_t n : kCounts) {
+        auto px = rgbPixels(n);
+        CHECK_ENCODED_SIZE(ws2812EncodedSize(n, 3), encodeWS2812_RGB(px.begin(), px.end(), out));
+
+        fl::vector<fl::array<u8, 5>> px5(n);
+        CHECK_ENCODED_SIZE(tm1812RGBWWEncodedSize(n), encodeTM1812_RGBWW(px5.begin(), px5.end(), out));
+    }
+}
+
+FL_TEST_CASE("SpanSink - fills the span prefix and reports what was written") {
+    fl::array<u8, 4> buf = {0, 0, 0, 0};
+    SpanSink sink(fl::span<u8>(buf.data(), 2));
+    sink.push_back(1);
+    sink.push_back(2);
+    FL_CHECK_EQ(sink.size(), 2u);
+    FL_CHECK_EQ(sink.remaining(), 0u);
+    FL_CHECK_EQ(sink.written().size(), 2u);
+    FL_CHECK_EQ(buf[0], 1);
+    FL_CHECK_EQ(buf[1], 2);
+    FL_CHECK_EQ(buf[2], 0);
+}
+
+#undef CHECK_ENCODED_SIZE
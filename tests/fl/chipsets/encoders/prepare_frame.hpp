@@ -0,0 +1,144 @@
+/// @file prepare_frame.hpp
+/// @brief Bulk PixelController::prepareFrame() must match the per-pixel path
+///
+/// prepareFrame() (fl::prepareFrameRGB) does scale, dither and reorder for a
+/// whole strip at once. Every byte has to equal what loadAndScale<0..2>() +
+/// stepDithering() produce pixel by pixel, for every color order, for both
+/// the SIMD blocks and the scalar tail, and for solid-fill controllers.
+
+#include "fl/chipsets/encoders/pixel_iterator.h"
+#include "fl/chipsets/encoders/prepare_frame.h"
+#include "fl/chipsets/encoders/ws2812.h"
+#include "fl/stl/vector.h"
+#include "crgb.h"
+#include "dither_mode.h"
+#include "eorder.h"
+#include "pixel_controller.h"
+#include "test.h"
+
+namespace test_prepare_frame {
+
+using namespace fl;
+
+ColorAdjustment makeAdjustment(u8 r, u8 g, u8 b) {
+    ColorAdjustment adj = ColorAdjustment::noAdjustment();
+    adj.premixed = CRGB(r, g, b);
+    return adj;
+}
+
+fl::vector<CRGB> makePixels(int count) {
+    fl::vector<CRGB> leds(count);
+    u32 x = 0x12345678;
+    for (int i = 0; i < count; ++i) {
+        x = x * 1664525u + 1013904223u;
+        leds[i] = CRGB(static_cast<u8>(x >> 24), static_cast<u8>(x >> 16),
+                       static_cast<u8>(x >> 8));
+        if (i % 5 == 0) {
+            leds[i].g = 0;  // zero bytes are never dithered
+        }
+    }
+    return leds;
+}
+
+// Reference: what ScaledPixelIteratorRGB pulls one pixel at a time. Takes
+// the controller by reference: copying one rewinds mLenRemaining.
+template <typename PC> fl::vector<u8> perPixel(PC &pc) {
+    fl::vector<u8> out;
+    while (pc.has(1)) {
+        u8 b0, b1, b2;
+        pc.loadAndScaleRGB(&b0, &b1, &b2);
+        out.push_back(b0);
+        out.push_back(b1);
+        out.push_back(b2);
+        pc.stepDithering();
+        pc.advanceData();
+    }
+    return out;
+}
+
+template <typename PC> void setDither(PC &pc, u8 d0, u8 d1, u8 d2, u8 e0, u8 e1, u8 e2) {
+    pc.d[0] = d0;
+    pc.d[1] = d1;
+    pc.d[2] = d2;
+    pc.e[0] = e0;
+    pc.e[1] = e1;
+    pc.e[2] = e2;
+}
+
+template <EOrder ORDER> void checkOrder(int count) {
+    fl::vector<CRGB> leds = makePixels(count);
+    PixelController<ORDER> pc(leds.data(), count, makeAdjustment(200, 255, 97),
+                              DISABLE_DITHER);
+    setDither(pc, 3, 1, 6, 7, 2, 9);
+
+    fl::vector<u8> bulk(static_cast<fl::size>(count) * 3, 0xAA);
+    pc.prepareFrame(bulk.data());
+    FL_CHECK(bulk == perPixel(pc));
+}
+
+} // namespace test_prepare_frame
+
+using namespace test_prepare_frame;
+
+FL_TEST_CASE("prepareFrame - matches per-pixel path for every color order") {
+    // 0..40 covers empty, tail-only, one SIMD block and block + odd tail.
+    for (int count = 0; count <= 40; ++count) {
+        checkOrder<RGB>(count);
+        checkOrder<GRB>(count);
+        checkOrder<BGR>(count);
+        checkOrder<RBG>(count);
+        checkOrder<GBR>(count);
+        checkOrder<BRG>(count);
+    }
+}
+
+FL_TEST_CASE("prepareFrame - saturating dither and full-range scales") {
+    fl::vector<CRGB> leds(48, CRGB(250, 1, 255));
+    PixelController<GRB> pc(leds.data(), 48, makeAdjustment(255, 0, 128), DISABLE_DITHER);
+    setDither(pc, 9, 0, 255, 20, 255, 1);
+    fl::vector<u8> bulk(48 * 3);
+    pc.prepareFrame(bulk.data());
+    FL_CHECK(bulk == perPixel(pc));
+}
+
+FL_TEST_CASE("prepareFrame - solid fill controller (stride 0)") {
+    CRGB color(17, 99, 201);
+    PixelController<BRG> pc(color, 21, makeAdjustment(180, 90, 255), DISABLE_DITHER);
+    setDither(pc, 1, 2, 3, 4, 5, 6);
+    fl::vector<u8> bulk(21 * 3);
+    pc.prepareFrame(bulk.data());
+    FL_CHECK(bulk == perPixel(pc));
+}
+
+FL_TEST_CASE("prepareFrame - resumes from a partially consumed controller") {
+    fl::vector<CRGB> leds = makePixels(37);
+    PixelController<GRB> pc(leds.data(), 37, makeAdjustment(128, 255, 64), DISABLE_DITHER);
+    setDither(pc, 2, 4, 1, 5, 9, 3);
+    pc.stepDithering();
+    pc.advanceData();
+    pc.stepDithering();
+    pc.advanceData();
+    pc.stepDithering();
+    pc.advanceData();
+
+    fl::vector<u8> bulk(34 * 3);
+    pc.prepareFrame(bulk.data());
+    FL_CHECK(bulk == perPixel(pc));
+}
+
+FL_TEST_CASE("PixelIterator::writeWS2812 - staged output matches per-pixel encode") {
+    fl::vector<CRGB> leds = makePixels(53);
+    PixelController<GRB> pc(leds.data(), 53, makeAdjustment(230, 240, 250), DISABLE_DITHER);
+    setDither(pc, 1, 2, 3, 3, 5, 7);
+
+    PixelController<GRB> consumed(pc);
+    fl::vector<u8> expected;
+    fl::vector<u8> reference = perPixel(consumed);
+    const fl::array<u8, 3> *px = reinterpret_cast<const fl::array<u8, 3> *>(reference.data());  // ok reinterpret cast
+    encodeWS2812_RGB(px, px + 53, fl::back_inserter(expected));
+
+    PixelIterator it = pc.as_iterator(RgbwInvalid());
+    fl::vector<u8> actual;
+    it.writeWS2812(&actual);
+    FL_CHECK(actual == expected);
+}
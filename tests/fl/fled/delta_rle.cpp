@@ -0,0 +1,131 @@
+// Tests for the Rgb8DeltaRle (0x80) FLED payload coding in
+// src/fl/fled/detail/delta_rle.h. See FLED_FORMAT.md "Delta/RLE Payload".
+
+#include "fl/fled/detail/delta_rle.h"
+#include "fl/fled/detail/pixel_format.h"
+#include "fl/fled/fled.h"
+#include "fl/stl/int.h"
+#include "fl/stl/move.h"
+#include "fl/stl/span.h"
+#include "fl/stl/vector.h"
+#include "test.h"
+
+FL_TEST_FILE(FL_FILEPATH) {
+
+using namespace fl;
+
+namespace {
+
+constexpr fl::size kLeds = 50;
+constexpr fl::size kFrameBytes = kLeds * 3;
+
+// Slowly-changing content: a single lit pixel walking along a dim strip.
+fl::vector<fl::u8> makeFrames(fl::size frames) {
+    fl::vector<fl::u8> raw(frames * kFrameBytes, 0x10);
+    for (fl::size f = 0; f < frames; ++f) {
+        fl::u8 *frame = raw.data() + f * kFrameBytes;
+        const fl::size led = f % kLeds;
+        frame[led * 3 + 0] = 0xff;
+        frame[led * 3 + 1] = static_cast<fl::u8>(f);
+        frame[led * 3 + 2] = static_cast<fl::u8>(f * 7);
+    }
+    return raw;
+}
+
+// Decodes every record in `payload`, feeding `chunkSize` bytes at a time.
+fl::vector<fl::u8> decodeAll(fl::span<const fl::u8> payload, fl::size chunkSize) {
+    fl::vector<fl::u8> out;
+    fl::vector<fl::u8> ref(kFrameBytes, 0);
+    fl::vector<fl::u8> dst(kFrameBytes, 0);
+    fl::fled::DeltaRleDecoder decoder;
+    fl::size at = 0;
+    while (at < payload.size()) {
+        fl::fled::DeltaRleKind kind;
+        fl::u32 len = 0;
+        FL_REQUIRE(fl::fled::readDeltaRleRecordHeader(payload.data() + at, &kind, &len));
+        at += fl::fled::kDeltaRleRecordHeaderBytes;
+        decoder.begin(kind, fl::span<fl::u8>(ref.data(), ref.size()),
+                      fl::span<fl::u8>(dst.data(), dst.size()));
+        for (fl::size k = 0; k < len; k += chunkSize) {
+            const fl::size end = k + chunkSize < len ? k + chunkSize : len;
+            FL_REQUIRE(decoder.feed(payload.slice(at + k, at + end)));
+        }
+        FL_REQUIRE(decoder.finished());
+        out.insert(out.end(), dst.begin(), dst.end());
+        at += len;
+    }
+    return out;
+}
+
+} // namespace
+
+FL_TEST_CASE("DeltaRle - round trip is lossless for any chunking") {
+    fl::vector<fl::u8> raw = makeFrames(75);
+    fl::vector<fl::u8> encoded = fl::fled::encodeDeltaRlePayload(
+        fl::span<const fl::u8>(raw.data(), raw.size()), kFrameBytes, 30);
+    fl::span<const fl::u8> payload(encoded.data(), encoded.size());
+
+    FL_CHECK_EQ(fl::fled::countDeltaRleFrames(payload), fl::size(75));
+    FL_CHECK(decodeAll(payload, 1) == raw);
+    FL_CHECK(decodeAll(payload, 7) == raw);
+    FL_CHECK(decodeAll(payload, encoded.size()) == raw);
+}
+
+FL_TEST_CASE("DeltaRle - keyframe interval and compression") {
+    fl::vector<fl::u8> raw = makeFrames(60);
+    fl::vector<fl::u8> encoded = fl::fled::encodeDeltaRlePayload(
+        fl::span<const fl::u8>(raw.data(), raw.size()), kFrameBytes, 30);
+
+    // Records 0 and 30 are keyframes, everything else is a delta.
+    fl::size at = 0;
+    for (fl::size f = 0; f < 60; ++f) {
+        fl::fled::DeltaRleKind kind;
+        fl::u32 len = 0;
+        FL_REQUIRE(fl::fled::readDeltaRleRecordHeader(encoded.data() + at, &kind, &len));
+        const bool key = (f % 30) == 0;
+        FL_CHECK_EQ(kind == fl::fled::DeltaRleKind::Keyframe, key);
+        at += fl::fled::kDeltaRleRecordHeaderBytes + len;
+    }
+    // A moving dot on a static background should shrink by well over 5x.
+    FL_CHECK_LT(encoded.size() * 5, raw.size());
+}
+
+FL_TEST_CASE("DeltaRle - runs that overflow the frame are rejected") {
+    fl::vector<fl::u8> ref(4, 0);
+    fl::vector<fl::u8> dst(4, 0);
+    fl::fled::DeltaRleDecoder decoder;
+    decoder.begin(fl::fled::DeltaRleKind::Keyframe,
+                  fl::span<fl::u8>(ref.data(), ref.size()),
+                  fl::span<fl::u8>(dst.data(), dst.size()));
+    const fl::u8 tooLong[] = {0x83, 0xaa};  // run of 5 into a 4-byte frame
+    FL_CHECK_FALSE(decoder.feed(fl::span<const fl::u8>(tooLong, 2)));
+
+    decoder.begin(fl::fled::DeltaRleKind::Keyframe,
+                  fl::span<fl::u8>(ref.data(), ref.size()),
+                  fl::span<fl::u8>(dst.data(), dst.size()));
+    const fl::u8 shortRun[] = {0x80, 0xaa};  // run of 2: frame not complete
+    FL_CHECK(decoder.feed(fl::span<const fl::u8>(shortRun, 2)));
+    FL_CHECK_FALSE(decoder.finished());
+}
+
+FL_TEST_CASE("DeltaRle - Fled::frameCount counts records for 0x80") {
+    fl::vector<fl::u8> raw = makeFrames(12);
+    fl::vector<fl::u8> encoded = fl::fled::encodeDeltaRlePayload(
+        fl::span<const fl::u8>(raw.data(), raw.size()), kFrameBytes, 4);
+
+    const char env[] = "{}";
+    fl::vector<fl::u8> buf;
+    const fl::u8 header[12] = {'F', 'L', 'E', 'D', 1,
+                               static_cast<fl::u8>(fl::fled::PixelFormat::Rgb8DeltaRle),
+                               0, 0, sizeof(env) - 1, 0, 0, 0};
+    buf.insert(buf.end(), header, header + 12);
+    buf.insert(buf.end(), env, env + sizeof(env) - 1);
+    buf.insert(buf.end(), encoded.begin(), encoded.end());
+
+    Fled f = Fled::loadFromVector(fl::move(buf));
+    FL_REQUIRE(static_cast<bool>(f));
+    FL_CHECK_EQ(f.bytesPerLed(), fl::u8(0));
+    FL_CHECK_EQ(f.frameCount(kLeds), fl::size(12));
+}
+
+} // FL_TEST_FILE
@@ -0,0 +1,148 @@
+// Batched SoA render kernel (render_values_fp) vs scalar render_value_fp,
+// and the flat polar tables it reads from.
+
+#include "test.h"
+#include "fl/fx/2d/animartrix.hpp"
+#include "fl/fx/2d/animartrix_detail/render_value_simd.h"
+#include "fl/stl/vector.h"
+
+namespace {
+
+struct SoaGrid {
+    fl::vector<fl::i32> angle;
+    fl::vector<fl::i32> dist;
+    fl::vector<fl::i32> z;
+    fl::vector<fl::i32> offset_x;
+    fl::vector<fl::i32> offset_y;
+};
+
+// Flat s16x16 copies of an Engine's polar tables plus per-pixel z and offset
+// ramps.
+SoaGrid makeSoaGrid(int w, int h) {
+    fl::Context ctx;
+    fl::init(ctx, w, h);
+    const fl::Engine &e = *ctx.mEngine;
+    SoaGrid g;
+    const int n = w * h;
+    for (int i = 0; i < n; i++) {
+        g.angle.push_back(fl::s16x16(e.polar_theta.data()[i] * 3 + 0.25f).raw());
+        g.dist.push_back(fl::s16x16(e.distance.data()[i]).raw());
+        g.z.push_back(fl::s16x16(e.distance.data()[i] * 1.5f - 4.0f).raw());
+        g.offset_x.push_back(fl::s16x16(i * 0.37f - 2.0f).raw());
+        g.offset_y.push_back(fl::s16x16(1.5f - i * 0.11f).raw());
+    }
+    return g;
+}
+
+// Which kernel inputs are per-pixel arrays; the rest come from `anim`.
+struct KernelInputs {
+    bool angle = true;
+    bool z = false;
+    bool offsets = false;
+};
+
+int maxKernelError(const fl::render_parameters &anim, const SoaGrid &g,
+                   KernelInputs inputs) {
+    fl::i32 fade_lut[257];
+    fl::perlin_s16x16::init_fade_lut(fade_lut);
+    const fl::u8 *perm = fl::PERLIN_NOISE;
+    const int n = static_cast<int>(g.angle.size());
+
+    fl::render_parameters_fp p = fl::to_render_parameters_fp(anim);
+    fl::vector<fl::i32> batch(n, -1);
+    fl::render_inputs_fp in;
+    in.angle = inputs.angle ? g.angle.data() : nullptr;
+    in.dist = g.dist.data();
+    in.z = inputs.z ? g.z.data() : nullptr;
+    in.offset_x = inputs.offsets ? g.offset_x.data() : nullptr;
+    in.offset_y = inputs.offsets ? g.offset_y.data() : nullptr;
+    fl::render_values_fp(p, in, n, fade_lut, perm, batch.data());
+
+    int worst = 0;
+    for (int i = 0; i < n; i++) {
+        fl::render_parameters_fp lane = p;
+        lane.dist_raw = g.dist[i];
+        if (inputs.angle) {
+            lane.angle_raw = g.angle[i];
+        }
+        if (inputs.z) {
+            lane.z_raw = g.z[i];
+        }
+        if (inputs.offsets) {
+            lane.offset_x_raw = g.offset_x[i];
+            lane.offset_y_raw = g.offset_y[i];
+        }
+        const int ref = fl::render_value_fp(lane, fade_lut, perm);
+        FL_CHECK_GE(batch[i], 0);
+        FL_CHECK_LT(batch[i], 256);
+        const int diff = batch[i] > ref ? batch[i] - ref : ref - batch[i];
+        if (diff > worst) {
+            worst = diff;
+        }
+    }
+    return worst;
+}
+
+}  // namespace
+
+FL_TEST_CASE("animartrix - polar tables are flat and x-major") {
+    fl::Context ctx;
+    fl::init(ctx, 5, 3);
+    fl::Engine &e = *ctx.mEngine;
+    FL_CHECK_EQ(e.distance.size(), fl::size(15));
+    FL_CHECK_EQ(e.polar_theta.size(), fl::size(15));
+    for (int x = 0; x < 5; x++) {
+        for (int y = 0; y < 3; y++) {
+            FL_CHECK_EQ(e.distance[x][y], e.distance.data()[x * 3 + y]);
+            FL_CHECK_EQ(e.polar_theta[x][y], e.polar_theta.data()[x * 3 + y]);
+        }
+    }
+
+    // Re-initialising with a different size rebuilds every row.
+    fl::init(ctx, 4, 8);
+    FL_CHECK_EQ(e.distance.size(), fl::size(32));
+    const float cx = (4 / 2) - 0.5f;
+    const float cy = (8 / 2) - 0.5f;
+    FL_CHECK_EQ(e.distance[3][7], fl::hypotf(3 - cx, 7 - cy));
+}
+
+FL_TEST_CASE("animartrix - render_values_fp matches render_value_fp") {
+    // 11x6 = 66 pixels: 16 SIMD iterations plus a 2-pixel scalar tail.
+    SoaGrid g = makeSoaGrid(11, 6);
+
+    fl::render_parameters anim;
+    anim.scale_x = 0.1f;
+    anim.scale_y = 0.13f;
+    anim.scale_z = 0.1f;
+    anim.offset_x = 3.5f;
+    anim.offset_y = -1.25f;
+    anim.z = 0;
+
+    KernelInputs inputs;
+    FL_SUBCASE("2D noise, [0, 1] limits") {
+        FL_CHECK_LT(maxKernelError(anim, g, inputs), 2);
+    }
+    FL_SUBCASE("3D noise with per-pixel z") {
+        inputs.z = true;
+        FL_CHECK_LT(maxKernelError(anim, g, inputs), 2);
+    }
+    FL_SUBCASE("uniform angle") {
+        anim.angle = 1.75f;
+        inputs.angle = false;
+        FL_CHECK_LT(maxKernelError(anim, g, inputs), 2);
+    }
+    FL_SUBCASE("per-pixel offsets") {
+        inputs.offsets = true;
+        FL_CHECK_LT(maxKernelError(anim, g, inputs), 2);
+    }
+    FL_SUBCASE("3D noise with uniform z, [-1, 1] limits") {
+        anim.z = 7.0f;
+        anim.low_limit = -1;
+        FL_CHECK_LT(maxKernelError(anim, g, inputs), 2);
+    }
+    FL_SUBCASE("general limit range") {
+        anim.low_limit = -0.5f;
+        anim.high_limit = 0.75f;
+        FL_CHECK_LT(maxKernelError(anim, g, inputs), 2);
+    }
+}
@@ -20,6 +20,9 @@
 #include "fl/stl/string.h"
 #include "fl/stl/utility.h"
 #include "fl/math/xymap.h"
+#include "fl/math/random8.h"
+#include "fl/fx/2d/noisepalette.h"
+#include "fl/fx/detail/tile_render.h"
 
 FL_TEST_FILE(FL_FILEPATH) {
 
@@ -223,4 +226,94 @@ FL_TEST_CASE("test_fixed_fps") {
     FL_CHECK_EQ(leds[0], CRGB(127, 0, 0));
 }
 
+FL_TEST_CASE("TileRenderer - bands cover every row once per pass") {
+    fl::TileRenderer tiles;
+    tiles.setWorkers(3);
+    tiles.setBandsPerWorker(2);
+    fl::vector<int> hits(2 * 10, 0);
+    tiles.beginFrame();
+    tiles.run(10, 2, [&](uint8_t pass, uint16_t y0, uint16_t y1) {
+        for (uint16_t y = y0; y < y1; ++y) {
+            hits[pass * 10 + y] += 1;
+        }
+    });
+    tiles.endFrame();
+    for (int h : hits) {
+        FL_CHECK_EQ(h, 1);
+    }
+    const fl::TileStats &stats = tiles.stats();
+    FL_CHECK_EQ(stats.workers, 3);
+    FL_REQUIRE_EQ(stats.tiles.size(), fl::size(12));
+    FL_CHECK_EQ(stats.tiles[0].y0, 0);
+    FL_CHECK_EQ(stats.tiles[5].y1, 10);
+    FL_CHECK_EQ(stats.tiles[6].pass, 1);
+    FL_CHECK_GE(stats.imbalance(), 0.0f);
+}
+
+FL_TEST_CASE("FxEngine - tiled NoisePalette matches serial rendering") {
+    constexpr uint16_t W = 16;
+    constexpr uint16_t H = 12;
+    constexpr uint16_t N = W * H;
+    fl::XYMap xy = fl::XYMap::constructRectangularGrid(W, H);
+
+    // Same noise origin for both; preset 3 has no colour loop, so the
+    // palette hue counter shared by all NoisePalettes does not matter.
+    random16_set_seed(1234);
+    auto serialFx = fl::make_shared<fl::NoisePalette>(xy);
+    random16_set_seed(1234);
+    auto tiledFx = fl::make_shared<fl::NoisePalette>(xy);
+    serialFx->setPalettePreset(3);
+    tiledFx->setPalettePreset(3);
+    FL_CHECK(tiledFx->isPixelIndependent());
+
+    fl::FxEngine serial(N, false);
+    fl::FxEngine tiled(N, false);
+    serial.addFx(serialFx);
+    tiled.addFx(tiledFx);
+    tiled.setTileWorkers(4);
+    FL_CHECK_EQ(tiled.getTileWorkers(), 4);
+
+    CRGB a[N];
+    CRGB b[N];
+    for (uint32_t frame = 0; frame < 4; ++frame) {
+        serial.draw(frame * 16, a);
+        tiled.draw(frame * 16, b);
+        for (uint16_t i = 0; i < N; ++i) {
+            FL_REQUIRE_EQ(a[i], b[i]);
+        }
+    }
+
+    // 2 passes x (4 workers x 2 bands).
+    const fl::TileStats &stats = tiled.getTileStats();
+    FL_CHECK_EQ(stats.tiles.size(), fl::size(16));
+    FL_CHECK(serial.getTileStats().tiles.empty());
+}
+
+FL_TEST_CASE("FxEngine - transition layers keep separate tile stats") {
+    constexpr uint16_t N = 16 * 12;
+    auto wide = fl::make_shared<fl::NoisePalette>(
+        fl::XYMap::constructRectangularGrid(16, 12));
+    auto tall = fl::make_shared<fl::NoisePalette>(
+        fl::XYMap::constructRectangularGrid(12, 16));
+
+    fl::FxEngine engine(N, false);
+    engine.addFx(wide);
+    engine.addFx(tall);
+    engine.setTileWorkers(2, 1);
+
+    CRGB leds[N];
+    engine.draw(0, leds);
+    FL_CHECK(engine.nextFx(1000));
+    engine.draw(100, leds);  // starts the transition
+    engine.draw(600, leds);
+
+    // Both effects drew this frame; each keeps its own 2 passes x 2 bands.
+    const fl::TileStats &current = engine.getTileStats(0);
+    const fl::TileStats &incoming = engine.getTileStats(1);
+    FL_REQUIRE_EQ(current.tiles.size(), fl::size(4));
+    FL_REQUIRE_EQ(incoming.tiles.size(), fl::size(4));
+    FL_CHECK_EQ(current.tiles[3].y1, 12);
+    FL_CHECK_EQ(incoming.tiles[3].y1, 16);
+}
+
 } // FL_TEST_FILE
@@ -18,6 +18,9 @@
 #include "fl/fx/fx2d.h"
 #include "fl/stl/move.h"
 #include "fl/stl/string.h"
+#include "fl/stl/cstring.h"
+#include "fl/fx/frame.h"
+#include "fl/fled/detail/delta_rle.h"
 #include "fl/math/xymap.h"
 #include "fl/video/pixel_stream.h"
 #include "FastLED.h"
@@ -82,6 +85,164 @@ class FakeFilebuf : public fl::filebuf {
     size_t mPos = 0;
 };
 
+// FakeFilebuf that also exposes its bytes through filebuf::map(), like the
+// mmap-backed host file handle.
+class MappedFakeFilebuf : public FakeFilebuf {
+  public:
+    fl::span<const fl::u8> map() override {
+        return fl::span<const fl::u8>(data.data(), data.size());
+    }
+};
+
+static void writeFledHeader(FakeFilebuf &file, const char *json,
+                            uint8_t pixelFormat = 0) {
+    const fl::u32 len = static_cast<fl::u32>(fl::strlen(json));
+    const uint8_t hdr[12] = {'F', 'L', 'E', 'D', 1, pixelFormat, 0, 0,
+                             static_cast<uint8_t>(len & 0xFF),
+                             static_cast<uint8_t>((len >> 8) & 0xFF),
+                             static_cast<uint8_t>((len >> 16) & 0xFF),
+                             static_cast<uint8_t>((len >> 24) & 0xFF)};
+    file.writeData(hdr, sizeof(hdr));
+    file.writeData(reinterpret_cast<const uint8_t *>(json), len); // ok reinterpret cast
+}
+
+FL_TEST_CASE("PixelStream mapped FLED payload serves frames without read()") {
+    auto file = fl::make_shared<MappedFakeFilebuf>();
+    writeFledHeader(*file, "{}");
+    CRGB frame[LEDS_PER_FRAME];
+    for (uint32_t f = 0; f < 4; f++) {
+        for (uint32_t i = 0; i < LEDS_PER_FRAME; i++) {
+            frame[i] = CRGB(f * 10 + 10, i, 0);
+        }
+        file->writeCRGB(frame, LEDS_PER_FRAME);
+    }
+
+    fl::PixelStream stream(LEDS_PER_FRAME * 3);
+    FL_REQUIRE(stream.begin(file));
+    FL_REQUIRE(stream.isMapped());
+    FL_CHECK(stream.embeddedScreenMapJson() == "{}");
+
+    fl::span<const CRGB> view = stream.frameView(2);
+    FL_REQUIRE_EQ(view.size(), LEDS_PER_FRAME);
+    FL_CHECK_EQ(view[0], CRGB(30, 0, 0));
+    FL_CHECK_EQ(view[7], CRGB(30, 7, 0));
+    FL_CHECK(stream.frameView(4).empty());
+
+    fl::Frame out(LEDS_PER_FRAME);
+    FL_REQUIRE(stream.readFrameAt(1, &out));
+    FL_CHECK_EQ(out.rgb()[5], CRGB(20, 5, 0));
+    // Position tracking matches the read() path.
+    FL_CHECK_EQ(stream.framesDisplayed(), 2);
+    FL_CHECK_EQ(stream.framesRemaining(), 2);
+    FL_REQUIRE(stream.readFrame(&out));
+    FL_CHECK_EQ(out.rgb()[5], CRGB(30, 5, 0));
+    FL_CHECK_EQ(stream.framesRemaining(), 1);
+}
+
+// Writes `frames` frames of a pixel walking over a dim background as a
+// delta/RLE FLED file and returns the raw frames for comparison.
+static fl::vector<CRGB> writeDeltaRleFled(FakeFilebuf &file, uint32_t frames,
+                                          fl::u16 keyframeInterval) {
+    fl::vector<CRGB> raw(frames * LEDS_PER_FRAME, CRGB(4, 4, 4));
+    for (uint32_t f = 0; f < frames; f++) {
+        raw[f * LEDS_PER_FRAME + (f % LEDS_PER_FRAME)] = CRGB(255, f, 0);
+    }
+    fl::vector<fl::u8> payload = fl::fled::encodeDeltaRlePayload(
+        fl::span<const fl::u8>(&raw[0].r, raw.size() * 3), LEDS_PER_FRAME * 3,
+        keyframeInterval);
+    writeFledHeader(file, "{}", 0x80);
+    file.writeData(payload.data(), payload.size());
+    return raw;
+}
+
+static bool frameEquals(const fl::Frame &frame, const fl::vector<CRGB> &raw,
+                        uint32_t frameNumber) {
+    for (uint32_t i = 0; i < LEDS_PER_FRAME; i++) {
+        if (frame.rgb()[i] != raw[frameNumber * LEDS_PER_FRAME + i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void checkDeltaRleStream(FakeFilebufPtr file) {
+    fl::vector<CRGB> raw = writeDeltaRleFled(*file, 40, 8);
+    fl::PixelStream stream(LEDS_PER_FRAME * 3);
+    FL_REQUIRE(stream.begin(file));
+    FL_CHECK_EQ(stream.framesRemaining(), 40);
+    FL_CHECK(stream.hasFrame(39));
+    FL_CHECK_FALSE(stream.hasFrame(40));
+    FL_CHECK(stream.frameView(0).empty());
+
+    fl::Frame out(LEDS_PER_FRAME);
+    for (uint32_t f = 0; f < 10; f++) {
+        FL_REQUIRE(stream.readFrame(&out));
+        FL_CHECK(frameEquals(out, raw, f));
+    }
+    FL_CHECK_EQ(stream.framesDisplayed(), 10);
+
+    // Forward past a keyframe, backwards, repeat, then step.
+    const uint32_t seeks[] = {35, 3, 17, 17, 18, 0, 39};
+    for (uint32_t target : seeks) {
+        FL_REQUIRE(stream.readFrameAt(target, &out));
+        FL_CHECK(frameEquals(out, raw, target));
+    }
+    FL_CHECK_EQ(stream.framesRemaining(), 0);
+    FL_CHECK_FALSE(stream.readFrame(&out));
+    FL_CHECK_FALSE(stream.readFrameAt(40, &out));
+
+    FL_REQUIRE(stream.rewind());
+    FL_REQUIRE(stream.readFrame(&out));
+    FL_CHECK(frameEquals(out, raw, 0));
+}
+
+FL_TEST_CASE("PixelStream decodes delta/RLE FLED payloads") {
+    checkDeltaRleStream(fl::make_shared<FakeFilebuf>());
+}
+
+FL_TEST_CASE("PixelStream decodes mapped delta/RLE FLED payloads") {
+    auto file = fl::make_shared<MappedFakeFilebuf>();
+    checkDeltaRleStream(file);
+}
+
+FL_TEST_CASE("PixelStream without map() support is not mapped") {
+    FakeFilebufPtr file = fl::make_shared<FakeFilebuf>();
+    CRGB frame[LEDS_PER_FRAME] = {};
+    file->writeCRGB(frame, LEDS_PER_FRAME);
+    fl::PixelStream stream(LEDS_PER_FRAME * 3);
+    FL_REQUIRE(stream.begin(file));
+    FL_CHECK_FALSE(stream.isMapped());
+    FL_CHECK(stream.frameView(0).empty());
+}
+
+FL_TEST_CASE("video read-ahead buffers frames past the playhead") {
+    fl::Video video(LEDS_PER_FRAME, FPS, 4);
+    video.setFade(0, 0);
+    video.setReadAhead(2);
+    FakeFilebufPtr fileHandle = fl::make_shared<FakeFilebuf>();
+    CRGB frame[LEDS_PER_FRAME];
+    for (uint32_t f = 0; f < 6; f++) {
+        for (uint32_t i = 0; i < LEDS_PER_FRAME; i++) {
+            frame[i] = CRGB(f * 40 + 40, 0, 0);
+        }
+        fileHandle->writeCRGB(frame, LEDS_PER_FRAME);
+    }
+    video.begin(fileHandle);
+
+    // Draws within frame 0 load frames 0/1, then read ahead 2 and 3.
+    CRGB leds[LEDS_PER_FRAME];
+    FL_REQUIRE(video.draw(0, leds));
+    FL_REQUIRE(video.draw(1, leds));
+    FL_REQUIRE(video.draw(2, leds));
+
+    // Wipe the file: frames 2/3 must now come from the read-ahead buffer.
+    for (size_t i = 0; i < fileHandle->data.size(); i++) {
+        fileHandle->data[i] = 0;
+    }
+    FL_REQUIRE(video.draw(2 * FRAME_TIME + 1, leds));
+    FL_CHECK_GE(leds[0].r, 120);
+}
+
 FL_TEST_CASE("PixelStream zero frame size reports no displayed frames") {
     FakeFilebufPtr fileHandle = fl::make_shared<FakeFilebuf>();
     const uint8_t byte = 0x42;
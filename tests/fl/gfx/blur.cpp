@@ -603,6 +603,99 @@ FL_TEST_CASE("blur2d with rectangular XYMap matches Canvas path") {
     }
 }
 
+// The rectangular/serpentine fast paths must match the generic per-pixel
+// XYMap path bit for bit. A user-function XYMap always takes the generic
+// path, so it serves as the reference.
+static fl::u16 xy_rect_fn(fl::u16 x, fl::u16 y, fl::u16 w, fl::u16 h) {
+    return fl::xy_line_by_line(x, y, w, h);
+}
+
+static fl::u16 xy_serp_fn(fl::u16 x, fl::u16 y, fl::u16 w, fl::u16 h) {
+    return fl::xy_serpentine(x, y, w, h);
+}
+
+static void fill_noisy(CRGB *pixels, int n, fl::u32 seed) {
+    for (int i = 0; i < n; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        // Mix in full-scale bytes so the saturating adds get exercised.
+        fl::u8 hi = (seed >> 28) == 0 ? 255 : 0;
+        pixels[i] = CRGB(static_cast<fl::u8>((seed >> 8) | hi),
+                         static_cast<fl::u8>(seed >> 16),
+                         static_cast<fl::u8>(seed >> 24));
+    }
+}
+
+static bool same_pixels(const CRGB *a, const CRGB *b, int n) {
+    for (int i = 0; i < n; ++i) {
+        if (a[i] != b[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+FL_TEST_CASE("blurRows/blurColumns fast paths match generic XYMap path") {
+    const fl::u8 widths[] = {1, 2, 5, 16, 17, 40};
+    const fl::u8 heights[] = {1, 2, 3, 8};
+    const fl::u8 amounts[] = {0, 1, 64, 128, 172, 255};
+    CRGB fast[40 * 8];
+    CRGB ref[40 * 8];
+    for (fl::u8 w : widths) {
+        for (fl::u8 h : heights) {
+            const int n = w * h;
+            XYMap rectMap = XYMap::constructRectangularGrid(w, h);
+            XYMap serpMap = XYMap::constructSerpentine(w, h);
+            XYMap rectRef = XYMap::constructWithUserFunction(w, h, xy_rect_fn);
+            XYMap serpRef = XYMap::constructWithUserFunction(w, h, xy_serp_fn);
+            for (fl::u8 amount : amounts) {
+                fl::span<CRGB> f(fast, n);
+                fl::span<CRGB> r(ref, n);
+
+                fill_noisy(fast, n, w * 131 + h * 7 + amount);
+                fill_noisy(ref, n, w * 131 + h * 7 + amount);
+                gfx::blurRows(f, w, h, amount, rectMap);
+                gfx::blurRows(r, w, h, amount, rectRef);
+                FL_CHECK(same_pixels(fast, ref, n));
+
+                fill_noisy(fast, n, w * 17 + h + amount);
+                fill_noisy(ref, n, w * 17 + h + amount);
+                gfx::blurColumns(f, w, h, amount, rectMap);
+                gfx::blurColumns(r, w, h, amount, rectRef);
+                FL_CHECK(same_pixels(fast, ref, n));
+
+                fill_noisy(fast, n, w * 3 + h * 71 + amount);
+                fill_noisy(ref, n, w * 3 + h * 71 + amount);
+                gfx::blur2d(f, w, h, amount, serpMap);
+                gfx::blur2d(r, w, h, amount, serpRef);
+                FL_CHECK(same_pixels(fast, ref, n));
+
+                // Canvas path against the rectangular reference.
+                fill_noisy(fast, n, w + h + amount);
+                fill_noisy(ref, n, w + h + amount);
+                gfx::Canvas<CRGB> canvas(f, w, h);
+                gfx::blur2d(canvas, alpha8(amount));
+                gfx::blur2d(r, w, h, amount, rectRef);
+                FL_CHECK(same_pixels(fast, ref, n));
+            }
+        }
+    }
+}
+
+FL_TEST_CASE("blurRows/blurColumns honour XYMap offset") {
+    const fl::u8 W = 6, H = 4;
+    const fl::u16 kOffset = 5;
+    const int N = W * H + kOffset;
+    CRGB fast[N];
+    CRGB ref[N];
+    fill_noisy(fast, N, 99);
+    fill_noisy(ref, N, 99);
+    XYMap serpMap = XYMap::constructSerpentine(W, H, kOffset);
+    XYMap serpRef = XYMap::constructWithUserFunction(W, H, xy_serp_fn, kOffset);
+    gfx::blur2d(fl::span<CRGB>(fast, N), W, H, 96, serpMap);
+    gfx::blur2d(fl::span<CRGB>(ref, N), W, H, 96, serpRef);
+    FL_CHECK(same_pixels(fast, ref, N));
+}
+
 // ── CanvasMapped tests: verify identical results to Canvas ──────────────
 
 // Helper: fill pixel arrays with deterministic test data.
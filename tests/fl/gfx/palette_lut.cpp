@@ -0,0 +1,160 @@
+// Unit tests for PaletteLUT / PaletteLUTExtended / PaletteLUTHD.
+
+#include "test.h"
+#include "fl/gfx/palette_lut.h"
+#include "fl/gfx/colorutils.h"
+#include "fl/stl/vector.h"
+
+FL_TEST_FILE(FL_FILEPATH) {
+
+using namespace fl;
+
+namespace {
+
+const TBlendType kBlends[] = {NOBLEND, LINEARBLEND, LINEARBLEND_NOWRAP};
+const u8 kBrightness[] = {255, 254, 128, 1, 0};
+
+CRGBPalette16 makePalette16() {
+    return CRGBPalette16(CRGB::Red, CRGB(10, 200, 30), CRGB::Blue, CRGB::Black,
+                         CRGB(255, 255, 1), CRGB(1, 2, 3), CRGB::White, CRGB(90, 0, 180),
+                         CRGB(0, 0, 1), CRGB(128, 64, 32), CRGB::Green, CRGB(200, 10, 10),
+                         CRGB::Black, CRGB(3, 250, 7), CRGB(77, 77, 77), CRGB::Orange);
+}
+
+template <typename PALETTE>
+void checkCompileMatches(const PALETTE &pal) {
+    for (TBlendType blend : kBlends) {
+        for (u8 bri : kBrightness) {
+            PaletteLUT lut;
+            lut.compile(pal, bri, blend);
+            for (int i = 0; i < 256; ++i) {
+                const CRGB expected = ColorFromPalette(pal, static_cast<u8>(i), bri, blend);
+                FL_REQUIRE(lut[static_cast<u8>(i)] == expected);
+            }
+        }
+    }
+}
+
+// map(indices, brightness, out) == ColorFromPalette(pal, idx, bri) for
+// every index/brightness pair.
+template <typename PALETTE>
+void checkPerPixelBrightness(const PALETTE &pal) {
+    PaletteLUT lut;
+    lut.compile(pal);
+    fl::vector<u8> idx(256);
+    fl::vector<u8> bri(256);
+    fl::vector<CRGB> out(256);
+    for (int i = 0; i < 256; ++i) {
+        idx[i] = static_cast<u8>(i);
+    }
+    for (int b = 0; b < 256; ++b) {
+        for (int i = 0; i < 256; ++i) {
+            bri[i] = static_cast<u8>(b);
+        }
+        lut.map(idx, bri, out);
+        for (int i = 0; i < 256; ++i) {
+            const CRGB expected =
+                ColorFromPalette(pal, static_cast<u8>(i), static_cast<u8>(b));
+            FL_REQUIRE(out[i] == expected);
+        }
+    }
+}
+
+} // namespace
+
+FL_TEST_CASE("PaletteLUT - compile matches ColorFromPalette") {
+    const CRGBPalette16 pal16 = makePalette16();
+    checkCompileMatches(pal16);
+
+    CRGBPalette32 pal32;
+    for (int i = 0; i < 32; ++i) {
+        pal32[i] = CRGB(static_cast<u8>(i * 8), static_cast<u8>(255 - i * 7),
+                        static_cast<u8>(i * i));
+    }
+    checkCompileMatches(pal32);
+
+    const CRGBPalette256 pal256(pal16);
+    checkCompileMatches(pal256);
+
+    checkCompileMatches(RainbowColors_p);
+    checkCompileMatches(LavaColors_p);
+}
+
+FL_TEST_CASE("PaletteLUT - per-pixel brightness matches ColorFromPalette") {
+    checkPerPixelBrightness(makePalette16());
+    checkPerPixelBrightness(PartyColors_p);
+    checkPerPixelBrightness(CRGBPalette256(makePalette16()));
+}
+
+FL_TEST_CASE("PaletteLUT - map copies table entries") {
+    PaletteLUT lut;
+    lut.compile(RainbowColors_p);
+    const u8 idx[] = {0, 17, 255, 128, 3, 3, 99};
+    CRGB out[7];
+    lut.map(idx, out);
+    for (int i = 0; i < 7; ++i) {
+        FL_CHECK(out[i] == ColorFromPalette(RainbowColors_p, idx[i]));
+    }
+
+    // Shorter output span limits the count.
+    CRGB shortOut[3] = {CRGB::Black, CRGB::Black, CRGB::Black};
+    lut.map(idx, fl::span<CRGB>(shortOut, 2));
+    FL_CHECK(shortOut[1] == lut[17]);
+    FL_CHECK(shortOut[2] == CRGB(CRGB::Black));
+}
+
+FL_TEST_CASE("PaletteLUT - version tracks table changes") {
+    PaletteLUT lut;
+    FL_CHECK_EQ(lut.version(), 0u);
+    for (int i = 0; i < 256; ++i) {
+        FL_REQUIRE(lut[static_cast<u8>(i)] == CRGB(CRGB::Black));
+    }
+
+    FL_CHECK(lut.compile(RainbowColors_p));
+    FL_CHECK_EQ(lut.version(), 1u);
+
+    // Same palette again: nothing changes.
+    FL_CHECK_FALSE(lut.compile(RainbowColors_p));
+    FL_CHECK_EQ(lut.version(), 1u);
+
+    FL_CHECK(lut.compile(RainbowColors_p, 100));
+    FL_CHECK_EQ(lut.version(), 2u);
+
+    FL_CHECK(lut.compile(OceanColors_p));
+    FL_CHECK_EQ(lut.version(), 3u);
+}
+
+FL_TEST_CASE("PaletteLUTExtended - samples ColorFromPaletteExtended") {
+    const CRGBPalette16 pal16 = makePalette16();
+    PaletteLUTExtended lut;
+    FL_CHECK(lut.compile(pal16, 200, LINEARBLEND));
+    FL_CHECK_EQ(lut.version(), 1u);
+    for (int i = 0; i < PaletteLUTExtended::kSize; ++i) {
+        const u16 index = static_cast<u16>(i << PaletteLUTExtended::kShift);
+        FL_REQUIRE(lut[index] == ColorFromPaletteExtended(pal16, index, 200, LINEARBLEND));
+        // Low bits below the table resolution select the same entry.
+        FL_REQUIRE(lut[static_cast<u16>(index | 0x3F)] == lut[index]);
+    }
+
+    const u16 idx[] = {0, 1000, 65535, 32768, 12345};
+    CRGB out[5];
+    lut.map(idx, out);
+    for (int i = 0; i < 5; ++i) {
+        FL_CHECK(out[i] == lut[idx[i]]);
+    }
+}
+
+FL_TEST_CASE("PaletteLUTHD - samples ColorFromPaletteHD") {
+    PaletteLUTHD lut;
+    const CRGBPalette32 pal32(makePalette16());
+    lut.compile(pal32, 255, LINEARBLEND);
+    for (int i = 0; i < PaletteLUTHD::kSize; ++i) {
+        const u16 index = static_cast<u16>(i << PaletteLUTHD::kShift);
+        const CRGB16 expected = ColorFromPaletteHD(pal32, index, u8(255), LINEARBLEND);
+        FL_REQUIRE(lut[index].r == expected.r);
+        FL_REQUIRE(lut[index].g == expected.g);
+        FL_REQUIRE(lut[index].b == expected.b);
+    }
+}
+
+} // FL_TEST_FILE
@@ -1490,6 +1490,52 @@ FL_TEST_CASE("andnot_u8_16: (~a) & b") {
     FL_REQUIRE(dst[7] == 0x00);  // (~0xFF) & 0x55 = 0
 }
 
+FL_TEST_CASE("cmpeq_u8_16: 0xFF where equal, 0x00 otherwise") {
+    uint8_t a[16] = {0x00, 0xFF, 0x80, 0x01, 0x7F, 0x10, 0x00, 0xAA, 0, 0, 0, 0, 0, 0, 0, 0x55};
+    uint8_t b[16] = {0x00, 0xFF, 0x00, 0x01, 0xFF, 0x01, 0x80, 0xAA, 0, 1, 0, 1, 0, 1, 0, 0x55};
+    uint8_t dst[16];
+
+    auto va = simd::load_u8_16(a);
+    auto vb = simd::load_u8_16(b);
+    simd::store_u8_16(dst, simd::cmpeq_u8_16(va, vb));
+
+    for (int i = 0; i < 16; ++i) {
+        FL_REQUIRE(dst[i] == (a[i] == b[i] ? 0xFF : 0x00));
+    }
+}
+
+FL_TEST_CASE("add_u8_16: wraps modulo 256") {
+    uint8_t a[16] = {0, 1, 0x7F, 0x80, 0xFF, 0xFF, 200, 100, 0x55, 0xAA, 3, 250, 128, 64, 32, 16};
+    uint8_t b[16] = {0, 1, 0x01, 0x80, 0x01, 0xFF, 100, 100, 0xAA, 0x55, 4, 10,  128, 64, 32, 16};
+    uint8_t dst[16];
+
+    auto va = simd::load_u8_16(a);
+    auto vb = simd::load_u8_16(b);
+    simd::store_u8_16(dst, simd::add_u8_16(va, vb));
+
+    for (int i = 0; i < 16; ++i) {
+        FL_REQUIRE(dst[i] == static_cast<uint8_t>(a[i] + b[i]));
+    }
+}
+
+FL_TEST_CASE("movemask_u8_16: bit i is the MSB of byte i") {
+    uint8_t a[16] = {0x80, 0x7F, 0xFF, 0x00, 0x81, 0x01, 0xC0, 0x40,
+                     0x00, 0x80, 0x00, 0x80, 0xFE, 0x7E, 0x00, 0xFF};
+    uint16_t expected = 0;
+    for (int i = 0; i < 16; ++i) {
+        expected |= static_cast<uint16_t>((a[i] >> 7) << i);
+    }
+    FL_CHECK_EQ(simd::movemask_u8_16(simd::load_u8_16(a)), expected);
+
+    uint8_t zeros[16] = {0};
+    uint8_t ones[16];
+    for (int i = 0; i < 16; ++i) {
+        ones[i] = 0xFF;
+    }
+    FL_CHECK_EQ(simd::movemask_u8_16(simd::load_u8_16(zeros)), 0u);
+    FL_CHECK_EQ(simd::movemask_u8_16(simd::load_u8_16(ones)), 0xFFFFu);
+}
+
 FL_TEST_CASE("add_u16_8 via widen/narrow round-trip (UADD16 contract)") {
     // The public API doesn't expose load_u16_8/store_u16_8 — every backend
     // hands `simd_u16x8` back as either a struct, an SSE __m128i, or a
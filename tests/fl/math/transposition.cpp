@@ -0,0 +1,68 @@
+#include "fl/math/transposition.h"
+#include "fl/stl/vector.h"
+#include "test.h"
+
+using namespace fl;
+
+namespace {
+
+fl::vector<u8> makeLane(size_t num_bytes, u32 seed) {
+    fl::vector<u8> lane(num_bytes);
+    for (size_t i = 0; i < num_bytes; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        lane[i] = static_cast<u8>(seed >> 24);
+    }
+    return lane;
+}
+
+} // namespace
+
+FL_TEST_CASE("transpose_8lane_simd - matches scalar reference") {
+    // Odd sizes exercise the scalar tail after the two-position SIMD blocks.
+    const size_t sizes[] = {0, 1, 2, 3, 7, 16, 33, 300};
+    for (size_t n : sizes) {
+        fl::vector<u8> lanes[8];
+        const u8* ptrs[8];
+        for (int lane = 0; lane < 8; ++lane) {
+            lanes[lane] = makeLane(n, 0x1234u + lane);
+            ptrs[lane] = lanes[lane].data();
+        }
+        fl::vector<u8> expected(n * 8, 0xEE);
+        fl::vector<u8> actual(n * 8, 0x11);
+        transpose_8lane_inline(ptrs, expected.data(), n);
+        transpose_8lane_simd(ptrs, actual.data(), n);
+        FL_CHECK(actual == expected);
+    }
+}
+
+FL_TEST_CASE("transpose_16lane_simd - matches scalar reference") {
+    const size_t sizes[] = {0, 1, 2, 5, 64, 301};
+    for (size_t n : sizes) {
+        fl::vector<u8> lanes[16];
+        const u8* ptrs[16];
+        for (int lane = 0; lane < 16; ++lane) {
+            lanes[lane] = makeLane(n, 0xBEEFu + lane);
+            ptrs[lane] = lanes[lane].data();
+        }
+        fl::vector<u8> expected(n * 16, 0xEE);
+        fl::vector<u8> actual(n * 16, 0x11);
+        transpose_16lane_inline(ptrs, expected.data(), n);
+        transpose_16lane_simd(ptrs, actual.data(), n);
+        FL_CHECK(actual == expected);
+    }
+}
+
+FL_TEST_CASE("transpose_8lane_simd - single set bit lands in the right plane") {
+    // Lane 5, bit 6 of byte 0 -> output byte 1 (second MSB plane), bit 5.
+    u8 lane_bytes[8][2] = {};
+    lane_bytes[5][0] = 0x40;
+    const u8* ptrs[8];
+    for (int lane = 0; lane < 8; ++lane) {
+        ptrs[lane] = lane_bytes[lane];
+    }
+    u8 out[16];
+    transpose_8lane_simd(ptrs, out, 2);
+    for (int i = 0; i < 16; ++i) {
+        FL_CHECK_EQ(out[i], i == 1 ? 0x20 : 0x00);
+    }
+}
@@ -359,4 +359,50 @@ FL_TEST_CASE("HttpStreamTransport: Error Handling") {
     }
 }
 
+FL_TEST_CASE("HttpStreamTransport: Binary Frames") {
+    MockStreamTransport sender("localhost", 47501);
+    MockStreamTransport receiver("localhost", 47501);
+    sender.connect();
+    receiver.connect();
+
+    struct Received {
+        fl::vector<u8> types;
+        fl::vector<fl::vector<u8>> payloads;
+    } received;
+    Received* out = &received;
+    receiver.setFrameHandler([out](u8 type, fl::span<const u8> payload) {
+        out->types.push_back(type);
+        out->payloads.push_back(fl::vector<u8>(payload.begin(), payload.end()));
+    });
+
+    fl::vector<u8> payload(300);
+    for (size_t i = 0; i < payload.size(); ++i) {
+        payload[i] = static_cast<u8>(i);
+    }
+    sender.writeFrame('P', payload);
+    fl::vector<u8> wire = sender.getSentData();
+    FL_REQUIRE(!wire.empty());
+    receiver.injectRecvData(wire.data(), wire.size());
+    receiver.injectRecvChunk(R"({"jsonrpc":"2.0","method":"test","id":1})");
+
+    // JSON requests still reach readRequest(); frames go to the handler.
+    auto request = receiver.readRequest();
+    FL_REQUIRE(request);
+    FL_CHECK((*request)["method"].as_string() == "test");
+    FL_REQUIRE_EQ(received.types.size(), 1u);
+    FL_CHECK_EQ(received.types[0], 'P');
+    FL_REQUIRE_EQ(received.payloads[0].size(), payload.size());
+    FL_CHECK(received.payloads[0] == payload);
+
+    // A frame whose length disagrees with its chunk is dropped.
+    const u8 bad[] = {0xC1, 'P', 9, 0, 0, 0, 1, 2};
+    char hexSize[8];
+    fl::snprintf(hexSize, sizeof(hexSize), "%X\r\n", static_cast<unsigned>(sizeof(bad)));
+    receiver.injectRecvData(reinterpret_cast<const uint8_t*>(hexSize), fl::strlen(hexSize));
+    receiver.injectRecvData(bad, sizeof(bad));
+    receiver.injectRecvData(reinterpret_cast<const uint8_t*>("\r\n"), 2);
+    FL_CHECK(!receiver.readRequest());
+    FL_CHECK_EQ(received.types.size(), 1u);
+}
+
 } // FL_TEST_FILE
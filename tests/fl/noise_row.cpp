@@ -0,0 +1,178 @@
+/// @file noise_row.cpp
+/// Bit-exactness of the batched row kernels (inoise16_row / inoise8_row)
+/// and of the 2D noise fills built on them, against the scalar functions.
+
+#include "noise.h"
+#include "fl/stl/cstring.h"
+#include "fl/stl/stdint.h"
+#include "fl/stl/vector.h"
+#include "test.h"
+
+FL_TEST_FILE(FL_FILEPATH) {
+using namespace fl;
+
+namespace {
+
+u32 lcg(u32& state) {
+    state = state * 1664525u + 1013904223u;
+    return state;
+}
+
+// Scalar references: the fills as they were written before the row kernels.
+void ref_fill_raw_2dnoise8(u8 *pData, int width, int height, u8 octaves, q44 freq44, fract8 amplitude, int skip, u16 x, i16 scalex, u16 y, i16 scaley, u16 time) {
+  if(octaves > 1) {
+    ref_fill_raw_2dnoise8(pData, width, height, octaves-1, freq44, amplitude, skip+1, x*freq44, freq44 * scalex, y*freq44, freq44 * scaley, time);
+  } else {
+    amplitude=255;
+  }
+  scalex *= skip;
+  scaley *= skip;
+  fract8 invamp = 255-amplitude;
+  u16 xx = x;
+  for(int i = 0; i < height; ++i, y+=scaley) {
+    u8 *pRow = pData + (i*width);
+    xx = x;
+    for(int j = 0; j < width; ++j, xx+=scalex) {
+      u8 noise_base = inoise8(xx,y,time);
+      noise_base = (0x80 & noise_base) ? (noise_base - 127) : (127 - noise_base);
+      noise_base = scale8(noise_base<<1,amplitude);
+      if(skip == 1) {
+        pRow[j] = scale8(pRow[j],invamp) + noise_base;
+      } else {
+        for(int ii = i; ii<(i+skip) && ii<height; ++ii) {
+          u8 *pRow = pData + (ii*width);
+          for(int jj=j; jj<(j+skip) && jj<width; ++jj) {
+            pRow[jj] = scale8(pRow[jj],invamp) + noise_base;
+          }
+        }
+      }
+    }
+  }
+}
+
+void ref_fill_raw_2dnoise16into8(u8 *pData, int width, int height, u8 octaves, q44 freq44, fract8 amplitude, int skip, u32 x, i32 scalex, u32 y, i32 scaley, u32 time) {
+  if(octaves > 1) {
+    ref_fill_raw_2dnoise16into8(pData, width, height, octaves-1, freq44, amplitude, skip+1, x*freq44, scalex *freq44, y*freq44, scaley * freq44, time);
+  } else {
+    amplitude=255;
+  }
+  scalex *= skip;
+  scaley *= skip;
+  u32 xx;
+  fract8 invamp = 255-amplitude;
+  for(int i = 0; i < height; i+=skip, y+=scaley) {
+    u8 *pRow = pData + (i*width);
+    xx = x;
+    for(int j = 0; j < width; j+=skip, xx+=scalex) {
+      u16 noise_base = inoise16(xx,y,time);
+      noise_base = (0x8000 & noise_base) ? noise_base - (32767) : 32767 - noise_base;
+      noise_base = scale8(noise_base>>7,amplitude);
+      if(skip==1) {
+        pRow[j] = qadd8(scale8(pRow[j],invamp),noise_base);
+      } else {
+        for(int ii = i; ii<(i+skip) && ii<height; ++ii) {
+          u8 *pRow = pData + (ii*width);
+          for(int jj=j; jj<(j+skip) && jj<width; ++jj) {
+            pRow[jj] = scale8(pRow[jj],invamp) + noise_base;
+          }
+        }
+      }
+    }
+  }
+}
+
+void ref_fill_raw_2dnoise16(u16 *pData, int width, int height, u8 octaves, q88 freq88, fract16 amplitude, int skip, u32 x, i32 scalex, u32 y, i32 scaley, u32 time) {
+  if(octaves > 1) {
+    ref_fill_raw_2dnoise16(pData, width, height, octaves-1, freq88, amplitude, skip, x *freq88 , scalex *freq88, y * freq88, scaley * freq88, time);
+  } else {
+    amplitude=65535;
+  }
+  scalex *= skip;
+  scaley *= skip;
+  fract16 invamp = 65535-amplitude;
+  for(int i = 0; i < height; i+=skip, y+=scaley) {
+    u16 *pRow = pData + (i*width);
+    for(int j = 0,xx=x; j < width; j+=skip, xx+=scalex) {
+      u16 noise_base = inoise16(xx,y,time);
+      noise_base = (0x8000 & noise_base) ? noise_base - (32767) : 32767 - noise_base;
+      noise_base = scale16(noise_base<<1, amplitude);
+      if(skip==1) {
+        pRow[j] = scale16(pRow[j],invamp) + noise_base;
+      } else {
+        for(int ii = i; ii<(i+skip) && ii<height; ++ii) {
+          u16 *pRow = pData + (ii*width);
+          for(int jj=j; jj<(j+skip) && jj<width; ++jj) {
+            pRow[jj] = scale16(pRow[jj],invamp) + noise_base;
+          }
+        }
+      }
+    }
+  }
+}
+
+} // namespace
+
+FL_TEST_CASE("inoise16_row matches inoise16") {
+    u32 state = 1;
+    u16 out[77];
+    const i32 steps[] = {0, 1, 37, 300, 4096, 65535, 65536, 200000, -1, -5000, -70000};
+    for (i32 dx : steps) {
+        for (int trial = 0; trial < 20; ++trial) {
+            const u32 x = lcg(state);
+            const u32 y = lcg(state);
+            const u32 z = lcg(state);
+            const int count = 1 + static_cast<int>(lcg(state) % 77);
+            inoise16_row(out, count, x, dx, y, z);
+            for (int i = 0; i < count; ++i) {
+                const u32 xi = x + static_cast<u32>(i) * static_cast<u32>(dx);
+                FL_REQUIRE_EQ(out[i], inoise16(xi, y, z));
+            }
+        }
+    }
+}
+
+FL_TEST_CASE("inoise8_row matches inoise8") {
+    u32 state = 7;
+    u8 out[77];
+    const i16 steps[] = {0, 1, 3, 17, 128, 255, 256, 1000, -1, -300, 32767};
+    for (i16 dx : steps) {
+        for (int trial = 0; trial < 20; ++trial) {
+            const u16 x = static_cast<u16>(lcg(state));
+            const u16 y = static_cast<u16>(lcg(state));
+            const u16 z = static_cast<u16>(lcg(state));
+            const int count = 1 + static_cast<int>(lcg(state) % 77);
+            inoise8_row(out, count, x, dx, y, z);
+            for (int i = 0; i < count; ++i) {
+                const u16 xi = static_cast<u16>(x + i * dx);
+                FL_REQUIRE_EQ(out[i], inoise8(xi, y, z));
+            }
+        }
+    }
+}
+
+FL_TEST_CASE("2D noise fills are unchanged by the row kernels") {
+    const int sizes[][2] = {{1, 1}, {7, 3}, {16, 16}, {33, 5}, {70, 9}};
+    for (const auto& size : sizes) {
+        const int w = size[0];
+        const int h = size[1];
+        const int n = w * h;
+        for (u8 octaves = 1; octaves <= 3; ++octaves) {
+            fl::vector<u8> a8(n, 0x33), b8(n, 0x33);
+            fill_raw_2dnoise8(a8.data(), w, h, octaves, q44(2, 0), 128, 1, 1234, 411, 999, -377, 4321);
+            ref_fill_raw_2dnoise8(b8.data(), w, h, octaves, q44(2, 0), 128, 1, 1234, 411, 999, -377, 4321);
+            FL_CHECK(fl::memcmp(a8.data(), b8.data(), n) == 0);
+
+            fl::vector<u8> c8(n, 0x44), d8(n, 0x44);
+            fill_raw_2dnoise16into8(c8.data(), w, h, octaves, q44(2, 0), 171, 1, 0x12345678u, 5000, 0x9ABC0000u, 7000, 0x1000u);
+            ref_fill_raw_2dnoise16into8(d8.data(), w, h, octaves, q44(2, 0), 171, 1, 0x12345678u, 5000, 0x9ABC0000u, 7000, 0x1000u);
+            FL_CHECK(fl::memcmp(c8.data(), d8.data(), n) == 0);
+
+            fl::vector<u16> a16(n, 0x1111), b16(n, 0x1111);
+            fill_raw_2dnoise16(a16.data(), w, h, octaves, q88(2, 0), 40000, 2, 0x00FF0000u, -9000, 0x12340000u, 3000, 0x77777u);
+            ref_fill_raw_2dnoise16(b16.data(), w, h, octaves, q88(2, 0), 40000, 2, 0x00FF0000u, -9000, 0x12340000u, 3000, 0x77777u);
+            FL_CHECK(fl::memcmp(a16.data(), b16.data(), n * sizeof(u16)) == 0);
+        }
+    }
+}
+
+} // FL_TEST_FILE
@@ -0,0 +1,67 @@
+/// @file frame_telemetry.cpp
+/// Tests for fl/remote/frame_telemetry.h: telemetry.* RPC methods
+
+#include "fl/remote/frame_telemetry.h"
+#include "fl/remote/remote.h"
+#include "fl/system/frame_telemetry.h"
+#include "fl/stl/optional.h"
+#include "test.h"
+
+FL_TEST_FILE(FL_FILEPATH) {
+
+namespace {
+
+fl::json makeRequest(const char* method, fl::json params = fl::json::array()) {
+    fl::json req = fl::json::object();
+    req.set("method", method);
+    req.set("params", params);
+    req.set("id", 1);
+    return req;
+}
+
+} // namespace
+
+FL_TEST_CASE("Remote telemetry: get, enable and reset") {
+    fl::FrameTelemetry& t = fl::FrameTelemetry::instance();
+    t.setEnabled(true);
+    t.reset();
+    t.beginFrame(0);
+    t.addStage(fl::FrameStage::ENCODE, 300);
+    t.addStage(fl::FrameStage::ENQUEUE, 20);
+    t.endFrame(1000);
+
+    fl::Remote remote(
+        []() -> fl::optional<fl::json> { return fl::nullopt; },
+        [](const fl::json&) {}
+    );
+    fl::bindFrameTelemetry(remote);
+
+    fl::json response = remote.processRpc(makeRequest("telemetry.get"));
+    FL_REQUIRE(response.contains("result"));
+    fl::json result = response["result"];
+    FL_CHECK(result["enabled"].as_bool().value_or(false));
+    FL_CHECK_EQ(result["frames"].as_int().value_or(-1), 1);
+    FL_CHECK_EQ(result["bucketLimitsUs"].size(), fl::size(fl::TimeHistogram::kBuckets));
+
+    fl::json encode = result["stages"]["encode"];
+    FL_CHECK_EQ(encode["count"].as_int().value_or(-1), 1);
+    FL_CHECK_EQ(encode["maxUs"].as_int().value_or(-1), 300);
+    FL_CHECK_EQ(encode["buckets"][9].as_int().value_or(-1), 1);  // [256, 512)
+    FL_CHECK_EQ(result["stages"]["frame"]["maxUs"].as_int().value_or(-1), 1000);
+
+    FL_REQUIRE_EQ(result["recent"].size(), 1u);
+    FL_CHECK_EQ(result["recent"][0]["channels"].as_int().value_or(-1), 1);
+    FL_CHECK_EQ(result["recent"][0]["encode"].as_int().value_or(-1), 300);
+
+    fl::json params = fl::json::array();
+    params.push_back(fl::json(false));
+    response = remote.processRpc(makeRequest("telemetry.enable", params));
+    FL_CHECK_FALSE(response["result"].as_bool().value_or(true));
+    FL_CHECK_FALSE(t.isEnabled());
+    t.setEnabled(true);
+
+    remote.processRpc(makeRequest("telemetry.reset"));
+    FL_CHECK_EQ(t.frames(), 0u);
+}
+
+} // FL_TEST_FILE
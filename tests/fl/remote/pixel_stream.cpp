@@ -0,0 +1,171 @@
+/// @file pixel_stream.cpp
+/// Tests for fl/remote/pixel_stream.h: raw pixel frames into CRGB targets
+
+#include "fl/remote/pixel_stream.h"
+#include "fl/remote/remote.h"
+#include "fl/remote/transport/serial.h"
+#include "fl/stl/optional.h"
+#include "test.h"
+
+FL_TEST_FILE(FL_FILEPATH) {
+
+namespace {
+
+fl::vector<fl::u8> pixelFrame(fl::u8 channel, fl::u8 flags, fl::u32 seq, fl::u32 first,
+                              fl::size pixels, fl::u8 base) {
+    fl::vector<fl::u8> out;
+    out.push_back(channel);
+    out.push_back(flags);
+    for (int i = 0; i < 4; ++i) out.push_back(static_cast<fl::u8>(seq >> (8 * i)));
+    for (int i = 0; i < 4; ++i) out.push_back(static_cast<fl::u8>(first >> (8 * i)));
+    for (fl::size i = 0; i < pixels * 3; ++i) {
+        out.push_back(static_cast<fl::u8>(base + i));
+    }
+    return out;
+}
+
+struct FrameLog {
+    fl::vector<fl::u32> seqs;
+};
+
+struct ScriptedBytes {
+    fl::vector<fl::u8> data;
+    fl::size pos = 0;
+    int next() { return pos < data.size() ? data[pos++] : -1; }
+};
+
+struct ByteCollector {
+    fl::vector<fl::u8> bytes;
+    void write(const char* data, fl::size len) {
+        const fl::u8* p = reinterpret_cast<const fl::u8*>(data);  // ok reinterpret cast
+        bytes.insert(bytes.end(), p, p + len);
+    }
+};
+
+} // namespace
+
+FL_TEST_CASE("PixelStream: ingest writes RGB into the target") {
+    CRGB leds[4];
+    fl::PixelStream pixels;
+    FL_CHECK_EQ(pixels.add("strip", leds), 0);
+    FrameLog log;
+    FrameLog* logp = &log;
+    pixels.onFrame([logp](fl::u8, fl::u32 seq) { logp->seqs.push_back(seq); });
+
+    FL_CHECK(pixels.ingest(pixelFrame(0, 0, 1, 0, 4, 10)));
+    FL_CHECK_EQ(leds[0].r, 10);
+    FL_CHECK_EQ(leds[0].g, 11);
+    FL_CHECK_EQ(leds[0].b, 12);
+    FL_CHECK_EQ(leds[3].b, 21);
+    FL_REQUIRE_EQ(log.seqs.size(), 1u);
+    FL_CHECK_EQ(log.seqs[0], 1u);
+
+    // Offset writes, clipped to the end of the strip.
+    FL_CHECK(pixels.ingest(pixelFrame(0, 0, 2, 2, 5, 100)));
+    FL_CHECK_EQ(leds[1].b, 15);
+    FL_CHECK_EQ(leds[2].r, 100);
+    FL_CHECK_EQ(leds[3].b, 105);
+    FL_CHECK_EQ(pixels.stats().applied, 2u);
+}
+
+FL_TEST_CASE("PixelStream: late, duplicate and bad frames are dropped") {
+    CRGB leds[2];
+    fl::PixelStream pixels;
+    pixels.add("strip", leds);
+
+    FL_CHECK(pixels.ingest(pixelFrame(0, 0, 10, 0, 2, 50)));
+    FL_CHECK_FALSE(pixels.ingest(pixelFrame(0, 0, 9, 0, 2, 0)));   // older
+    FL_CHECK_FALSE(pixels.ingest(pixelFrame(0, 0, 10, 0, 2, 0)));  // repeat
+    FL_CHECK_EQ(leds[0].r, 50);
+    FL_CHECK_EQ(pixels.stats().late, 2u);
+
+    FL_CHECK_FALSE(pixels.ingest(pixelFrame(1, 0, 11, 0, 2, 0)));  // no channel 1
+    FL_CHECK_FALSE(pixels.ingest(pixelFrame(0, 0, 11, 2, 1, 0)));  // past the end
+    const fl::u8 shortPayload[] = {0, 0, 1};
+    FL_CHECK_FALSE(pixels.ingest(shortPayload));
+    FL_CHECK_EQ(pixels.stats().rejected, 3u);
+
+    // Sequence numbers wrap, and a restart flag rewinds.
+    FL_CHECK(pixels.ingest(pixelFrame(0, fl::kPixelFrameRestart, 0xfffffffeu, 0, 2, 1)));
+    FL_CHECK(pixels.ingest(pixelFrame(0, 0, 3, 0, 2, 2)));
+    FL_CHECK_EQ(leds[0].r, 2);
+    pixels.resetSequence();
+    FL_CHECK(pixels.ingest(pixelFrame(0, 0, 1, 0, 2, 3)));
+}
+
+FL_TEST_CASE("PixelStream: partial chunks complete one frame") {
+    fl::shared_ptr<fl::Frame> frame = fl::make_shared<fl::Frame>(6);
+    fl::PixelStream pixels;
+    FL_CHECK_EQ(pixels.add("frame", frame), 0);
+    FrameLog log;
+    FrameLog* logp = &log;
+    pixels.onFrame([logp](fl::u8, fl::u32 seq) { logp->seqs.push_back(seq); });
+
+    FL_CHECK(pixels.ingest(pixelFrame(0, fl::kPixelFramePartial, 5, 0, 3, 0)));
+    FL_CHECK(log.seqs.empty());
+    FL_CHECK(pixels.ingest(pixelFrame(0, 0, 5, 3, 3, 9)));
+    FL_REQUIRE_EQ(log.seqs.size(), 1u);
+    FL_CHECK_EQ(frame->rgb()[2].b, 8);
+    FL_CHECK_EQ(frame->rgb()[3].r, 9);
+    FL_CHECK_FALSE(pixels.ingest(pixelFrame(0, 0, 5, 0, 3, 0)));  // frame closed
+}
+
+FL_TEST_CASE("PixelStream: serial frames land in the target without queueing") {
+    CRGB leds[300];
+    fl::PixelStream pixels;
+    pixels.add("strip", leds);
+
+    ScriptedBytes script;
+    ByteCollector wire;
+    // Larger than FL_SERIAL_FRAME_MAX on small targets; never buffered.
+    fl::vector<fl::u8> big = pixelFrame(0, 0, 1, 0, 300, 7);
+    fl::writeSerialFrame(wire, fl::SerialFrameType::kPixels, big);
+    const char* line = "{\"method\":\"pixels.info\",\"params\":[],\"id\":3}\n";
+    for (const char* p = line; *p; ++p) {
+        wire.bytes.push_back(static_cast<fl::u8>(*p));
+    }
+    fl::writeSerialFrame(wire, fl::SerialFrameType::kPixels, pixelFrame(0, 0, 0, 0, 1, 0));  // late
+    script.data = wire.bytes;
+
+    ScriptedBytes* src = &script;
+    fl::SerialFrameReader reader([src]() { return src->next(); }, 64);
+    reader.setPixelStream(&pixels);
+    reader.poll();
+
+    FL_CHECK_EQ(leds[0].r, 7);
+    FL_CHECK_EQ(leds[299].b, static_cast<fl::u8>(7 + 899));
+    FL_CHECK_EQ(pixels.stats().applied, 1u);
+    FL_CHECK_EQ(pixels.stats().late, 1u);
+    FL_CHECK_FALSE(reader.popFrame(fl::SerialFrameType::kPixels).has_value());
+    FL_CHECK(reader.popLine().has_value());
+}
+
+FL_TEST_CASE("PixelStream: pixels.info lists channels") {
+    CRGB a[3];
+    CRGB b[5];
+    fl::PixelStream pixels;
+    pixels.add("a", a);
+    pixels.add("b", b);
+    pixels.ingest(pixelFrame(1, 0, 42, 0, 1, 0));
+
+    fl::Remote remote(
+        []() -> fl::optional<fl::json> { return fl::nullopt; },
+        [](const fl::json&) {}
+    );
+    fl::bindPixelStream(remote, pixels);
+    fl::json request = fl::json::object();
+    request.set("method", "pixels.info");
+    request.set("params", fl::json::array());
+    request.set("id", 1);
+    fl::json response = remote.processRpc(request);
+    FL_REQUIRE(response.contains("result"));
+    fl::json channels = response["result"]["channels"];
+    FL_REQUIRE_EQ(channels.size(), 2u);
+    FL_CHECK((channels[1]["name"] | fl::string()) == "b");
+    FL_CHECK_EQ(channels[1]["pixels"] | 0, 5);
+    FL_CHECK_EQ(channels[1]["seq"] | 0, 42);
+    FL_CHECK(channels[0]["seq"].is_null());
+    FL_CHECK_EQ(response["result"]["applied"] | 0, 1);
+}
+
+} // FL_TEST_FILE
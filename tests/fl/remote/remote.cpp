@@ -1,6 +1,7 @@
 
 
 #include "fl/remote/remote.h"
+#include "fl/remote/rpc/response_send.h"
 #include "fl/stl/cctype.h"
 #include "fl/stl/stdint.h"
 #include "fl/stl/cstring.h"
@@ -1713,4 +1714,115 @@ FL_TEST_CASE("Remote: Async RPC - Sync vs Async behavior difference") {
         FL_REQUIRE(ackResult["acknowledged"].as_bool().value() == true);
     }
 }
+// =============================================================================
+// Batch and Pipelining Tests
+// =============================================================================
+
+FL_TEST_CASE("Remote: JSON-RPC batch returns one response array") {
+    TestIO io;
+    fl::Remote remote(
+        [&io]() { return io.pullRequest(); },
+        [&io](const fl::json& r) { io.pushResponse(r); }
+    );
+    remote.bind("add", [](int a, int b) { return a + b; });
+
+    fl::json batch = fl::json::array();
+    fl::json p1 = fl::json::array();
+    p1.push_back(1);
+    p1.push_back(2);
+    batch.push_back(makeRequest("add", p1, 1));
+    fl::json note = fl::json::object();  // notification: no id, no response
+    note.set("method", "add");
+    note.set("params", p1);
+    batch.push_back(note);
+    fl::json p2 = fl::json::array();
+    p2.push_back(10);
+    p2.push_back(20);
+    batch.push_back(makeRequest("add", p2, 2));
+    batch.push_back(makeRequest("missing", fl::json::array(), 3));
+    io.requests.push_back(batch);
+    io.requests.push_back(fl::json::array());  // empty batch is invalid
+
+    FL_CHECK_EQ(remote.update(0), 4u);
+    FL_REQUIRE_EQ(io.responses.size(), 2u);
+    fl::json responses = io.responses[0];
+    FL_REQUIRE(responses.is_array());
+    FL_REQUIRE_EQ(responses.size(), 3u);
+    FL_CHECK_EQ(responses[0]["id"] | 0, 1);
+    FL_CHECK_EQ(responses[0]["result"] | 0, 3);
+    FL_CHECK_EQ(responses[1]["id"] | 0, 2);
+    FL_CHECK_EQ(responses[1]["result"] | 0, 30);
+    FL_CHECK_EQ(responses[2]["id"] | 0, 3);
+    FL_CHECK_EQ(responses[2]["error"]["code"] | 0, -32601);
+    FL_CHECK_EQ(io.responses[1]["error"]["code"] | 0, -32600);
+    FL_CHECK(io.responses[1]["id"].is_null());
+}
+
+FL_TEST_CASE("Remote: pipelined async calls complete out of order with backpressure") {
+    TestIO io;
+    fl::Remote remote(
+        [&io]() { return io.pullRequest(); },
+        [&io](const fl::json& r) { io.pushResponse(r); }
+    );
+    remote.setMaxInFlight(2);
+
+    // Handlers park their ResponseSend and finish later, in any order.
+    fl::vector<fl::ResponseSend> parked;
+    fl::vector<fl::ResponseSend>* parkedp = &parked;
+    remote.bindAsync("work", [parkedp](fl::ResponseSend& send, const fl::json&) {
+        parkedp->push_back(fl::move(send));
+    });
+    for (int id = 1; id <= 4; ++id) {
+        io.requests.push_back(makeRequest("work", fl::json::array(), id));
+    }
+
+    // Only two requests are taken; the rest wait in the source.
+    remote.update(0);
+    FL_CHECK_EQ(io.requestIndex, 2u);
+    FL_CHECK_EQ(remote.inFlightCount(), 2u);
+    FL_REQUIRE_EQ(parked.size(), 2u);
+    FL_REQUIRE_EQ(io.responses.size(), 2u);  // ACKs
+    remote.update(0);
+    FL_CHECK_EQ(io.requestIndex, 2u);
+
+    // Completing the second call first frees one slot.
+    parked[1].send(fl::json("second"));
+    FL_CHECK_EQ(io.responses.back()["id"] | 0, 2);
+    FL_CHECK_EQ(remote.inFlightCount(), 1u);
+    remote.update(0);
+    FL_CHECK_EQ(io.requestIndex, 3u);
+
+    // Stream updates keep a call in flight; the final value ends it.
+    parked[0].sendUpdate(fl::json(50));
+    FL_CHECK_EQ(remote.inFlightCount(), 2u);
+    parked[0].sendFinal(fl::json("first"));
+    parked[2].send(fl::json("third"));
+    FL_CHECK_EQ(remote.inFlightCount(), 0u);
+    remote.update(0);
+    FL_CHECK_EQ(io.requestIndex, 4u);
+}
+
+FL_TEST_CASE("Remote: sendAsyncResponse completes pipelined calls oldest first") {
+    TestIO io;
+    fl::Remote remote(
+        [&io]() { return io.pullRequest(); },
+        [&io](const fl::json& r) { io.pushResponse(r); }
+    );
+    remote.bind("task", [](int n) -> int { return n; }, fl::RpcMode::ASYNC);
+    fl::json params = fl::json::array();
+    params.push_back(1);
+    io.requests.push_back(makeRequest("task", params, 7));
+    fl::json stringId = makeRequest("task", params, 0);
+    stringId.set("id", "eight");
+    io.requests.push_back(stringId);
+    remote.update(0);
+    io.responses.clear();
+
+    remote.sendAsyncResponse("task", fl::json(1));
+    remote.sendAsyncResponse("task", fl::json(2));
+    remote.sendAsyncResponse("task", fl::json(3));  // nothing pending: ignored
+    FL_REQUIRE_EQ(io.responses.size(), 2u);
+    FL_CHECK_EQ(io.responses[0]["id"] | 0, 7);
+    FL_CHECK((io.responses[1]["id"] | fl::string()) == "eight");
+}
 } // FL_TEST_FILE
@@ -1,6 +1,7 @@
 // Combined RPC tests — one test binary for all RPC tests
 // ok cpp include
 #include "tests/fl/remote/rpc/base64.hpp"
+#include "tests/fl/remote/rpc/msgpack.hpp"
 #include "tests/fl/remote/rpc/response_send.hpp"
 #include "tests/fl/remote/rpc/rpc.hpp"
 #include "tests/fl/remote/rpc/runtime_rpc_binding.hpp"
@@ -0,0 +1,369 @@
+#include "fl/remote/remote.h"
+#include "fl/remote/rpc/base64.h"
+#include "fl/remote/rpc/msgpack.h"
+#include "fl/remote/rpc/rpc.h"
+#include "fl/stl/json.h"
+#include "fl/stl/string.h"
+#include "fl/stl/vector.h"
+#include "test.h"
+
+namespace {
+
+// Encodes {"method": m, "params": <written by fn>, "id": id}.
+template <typename ParamsFn>
+fl::vector<fl::u8> msgpackRequest(const char* method, int id, ParamsFn params) {
+    fl::vector<fl::u8> out;
+    fl::MsgpackWriter w(out);
+    w.writeMap(id >= 0 ? 3 : 2);
+    w.writeStr("method");
+    w.writeStr(method);
+    w.writeStr("params");
+    params(w);
+    if (id >= 0) {
+        w.writeStr("id");
+        w.writeInt(id);
+    }
+    return out;
+}
+
+fl::json decodeMsgpack(const fl::vector<fl::u8>& bytes) {
+    fl::MsgpackReader r(fl::span<const fl::u8>(bytes.data(), bytes.size()));
+    fl::json out;
+    FL_REQUIRE(r.readJson(out));
+    FL_CHECK(r.atEnd());
+    return out;
+}
+
+} // namespace
+
+FL_TEST_CASE("msgpack: writer emits the smallest encodings") {
+    fl::vector<fl::u8> out;
+    fl::MsgpackWriter w(out);
+    w.writeInt(1);
+    w.writeInt(-1);
+    w.writeInt(200);
+    w.writeInt(-200);
+    w.writeInt(70000);
+    w.writeStr("abc");
+    w.writeBool(true);
+    w.writeNil();
+    const fl::u8 expected[] = {0x01, 0xff, 0xcc, 0xc8, 0xd1, 0xff, 0x38,
+                               0xce, 0x00, 0x01, 0x11, 0x70, 0xa3, 'a',
+                               'b',  'c',  0xc3, 0xc0};
+    FL_REQUIRE_EQ(out.size(), sizeof(expected));
+    for (fl::size i = 0; i < sizeof(expected); ++i) {
+        FL_CHECK_EQ(out[i], expected[i]);
+    }
+}
+
+FL_TEST_CASE("msgpack: scalar and container round trip") {
+    fl::vector<fl::u8> out;
+    fl::MsgpackWriter w(out);
+    const fl::i64 ints[] = {0, 127, 128, 255, 256, 65535, 65536, -32, -33, -129,
+                            -32769, 4294967296LL, -4294967296LL};
+    w.writeArray(sizeof(ints) / sizeof(ints[0]));
+    for (fl::i64 v : ints) {
+        w.writeInt(v);
+    }
+    w.writeFloat(2.5f);
+    fl::vector<fl::u8> blob(300, 0xab);
+    w.writeBin(blob);
+    fl::string longStr(40, 'x');
+    w.writeStr(longStr.c_str());
+
+    fl::MsgpackReader r(out);
+    fl::u32 n = 0;
+    FL_REQUIRE(r.readArray(n));
+    FL_REQUIRE_EQ(n, sizeof(ints) / sizeof(ints[0]));
+    for (fl::i64 v : ints) {
+        fl::i64 got = 0;
+        FL_REQUIRE(r.readInt(got));
+        FL_CHECK_EQ(got, v);
+    }
+    fl::i64 notInt = 0;
+    FL_CHECK_FALSE(r.readInt(notInt));  // type mismatch leaves the cursor
+    float f = 0;
+    FL_REQUIRE(r.readFloat(f));
+    FL_CHECK_EQ(f, 2.5f);
+    fl::span<const fl::u8> bin;
+    FL_REQUIRE(r.readBin(bin));
+    FL_CHECK_EQ(bin.size(), 300u);
+    FL_CHECK_EQ(bin[299], 0xab);
+    fl::string_view s;
+    FL_REQUIRE(r.readStr(s));
+    FL_CHECK(s == longStr.c_str());
+    FL_CHECK(r.atEnd());
+    FL_CHECK(r.ok());
+}
+
+FL_TEST_CASE("msgpack: skip handles nesting, ext and malformed input") {
+    // [{"a": [1, ext8(len 2)]}, float64 1.0] then 7
+    const fl::u8 doc[] = {0x92, 0x81, 0xa1, 'a', 0x92, 0x01, 0xc7, 0x02, 0x05, 0xaa, 0xbb,
+                          0xcb, 0x3f, 0xf0, 0, 0, 0, 0, 0, 0, 0x07};
+    fl::MsgpackReader r(fl::span<const fl::u8>(doc, sizeof(doc)));
+    fl::span<const fl::u8> raw;
+    FL_REQUIRE(r.skip(raw));
+    FL_CHECK_EQ(raw.size(), sizeof(doc) - 1);
+    fl::i64 v = 0;
+    FL_REQUIRE(r.readInt(v));
+    FL_CHECK_EQ(v, 7);
+
+    const fl::u8 truncated[] = {0x93, 0x01, 0x02};
+    fl::MsgpackReader t(fl::span<const fl::u8>(truncated, sizeof(truncated)));
+    FL_CHECK_FALSE(t.skip());
+    FL_CHECK_FALSE(t.ok());
+
+    const fl::u8 hugeCount[] = {0xdd, 0xff, 0xff, 0xff, 0xff, 0x00};
+    fl::MsgpackReader h(fl::span<const fl::u8>(hugeCount, sizeof(hugeCount)));
+    FL_CHECK_FALSE(h.skip());
+
+    const fl::u8 reserved[] = {0xc1};
+    fl::MsgpackReader c(fl::span<const fl::u8>(reserved, sizeof(reserved)));
+    FL_CHECK(c.peek() == fl::MsgpackType::kInvalid);
+    FL_CHECK_FALSE(c.skip());
+}
+
+FL_TEST_CASE("msgpack: json round trip") {
+    fl::json doc = fl::json::parse(
+        R"({"name": "strip", "n": 42, "neg": -5, "f": 0.25, "on": true, "none": null,
+            "bytes": [1, 2, 3], "big": [1000, -1000], "mixed": [1, "a", {"k": []}]})");
+    fl::vector<fl::u8> out;
+    fl::MsgpackWriter(out).writeJson(doc);
+    fl::json back = decodeMsgpack(out);
+    FL_CHECK_EQ(back.to_string(), doc.to_string());
+    FL_CHECK(out.size() < doc.to_string().size());
+}
+
+FL_TEST_CASE("Rpc: handleMsgpack decodes typed params in place") {
+    fl::Rpc rpc;
+    rpc.bind("add", [](int a, int b) { return a + b; });
+    rpc.bind("scale", [](float v, float k) { return v * k; });
+    rpc.bind("greet", [](const fl::string& name) { return fl::string("hi ") + name; });
+    rpc.bind("checksum", [](const fl::vector<fl::u8>& data) {
+        int sum = 0;
+        for (fl::size i = 0; i < data.size(); ++i) {
+            sum += data[i];
+        }
+        return sum;
+    });
+    rpc.bind("echoBytes", [](fl::vector<fl::u8> data) { return data; });
+    int lastSet = 0;
+    rpc.bind("set", [&lastSet](int v) { lastSet = v; });
+
+    fl::vector<fl::u8> response;
+    FL_REQUIRE(rpc.handleMsgpack(msgpackRequest("add", 1, [](fl::MsgpackWriter& w) {
+        w.writeArray(2);
+        w.writeInt(6);
+        w.writeInt(7);
+    }), response));
+    fl::json r = decodeMsgpack(response);
+    FL_CHECK_EQ(r["id"] | 0, 1);
+    FL_CHECK_EQ(r["result"] | 0, 13);
+    FL_CHECK_FALSE(r.contains("error"));
+
+    response.clear();
+    FL_REQUIRE(rpc.handleMsgpack(msgpackRequest("scale", 2, [](fl::MsgpackWriter& w) {
+        w.writeArray(2);
+        w.writeFloat(1.5f);
+        w.writeInt(4);  // ints widen to float silently
+    }), response));
+    r = decodeMsgpack(response);
+    FL_CHECK_EQ(r["result"] | 0.0f, 6.0f);
+    FL_CHECK_FALSE(r.contains("warnings"));
+
+    response.clear();
+    FL_REQUIRE(rpc.handleMsgpack(msgpackRequest("greet", 3, [](fl::MsgpackWriter& w) {
+        w.writeArray(1);
+        w.writeStr("bob");
+    }), response));
+    FL_CHECK_EQ((decodeMsgpack(response)["result"] | fl::string()), fl::string("hi bob"));
+
+    // Byte arrays travel as bin: no base64 on either side.
+    fl::vector<fl::u8> pixels(300);
+    for (fl::size i = 0; i < pixels.size(); ++i) {
+        pixels[i] = static_cast<fl::u8>(i);
+    }
+    response.clear();
+    fl::vector<fl::u8> request = msgpackRequest("checksum", 4, [&pixels](fl::MsgpackWriter& w) {
+        w.writeArray(1);
+        w.writeBin(pixels);
+    });
+    FL_REQUIRE(rpc.handleMsgpack(request, response));
+    int expected = 0;
+    for (fl::size i = 0; i < pixels.size(); ++i) {
+        expected += pixels[i];
+    }
+    FL_CHECK_EQ(decodeMsgpack(response)["result"] | 0, expected);
+    fl::string jsonRequest = fl::string(R"({"method":"checksum","params":[")") +
+                             fl::base64_encode(pixels) + R"("],"id":4})";
+    FL_CHECK(request.size() * 5 < jsonRequest.size() * 4);  // base64 alone is +33%
+
+    response.clear();
+    FL_REQUIRE(rpc.handleMsgpack(msgpackRequest("echoBytes", 5, [&pixels](fl::MsgpackWriter& w) {
+        w.writeArray(1);
+        w.writeBin(pixels);
+    }), response));
+    fl::MsgpackReader rr(response);
+    fl::u32 fields = 0;
+    FL_REQUIRE(rr.readMap(fields));
+    FL_CHECK_EQ(fields, 2u);
+    fl::span<const fl::u8> echoed;
+    for (fl::u32 i = 0; i < fields; ++i) {
+        fl::string_view key;
+        FL_REQUIRE(rr.readStr(key));
+        if (key == "result") {
+            FL_REQUIRE(rr.readBin(echoed));
+        } else {
+            FL_REQUIRE(rr.skip());
+        }
+    }
+    FL_REQUIRE_EQ(echoed.size(), pixels.size());
+    FL_CHECK_EQ(echoed[123], pixels[123]);
+
+    // Notifications (no id) run but produce no response.
+    response.clear();
+    FL_CHECK_FALSE(rpc.handleMsgpack(msgpackRequest("set", -1, [](fl::MsgpackWriter& w) {
+        w.writeArray(1);
+        w.writeInt(99);
+    }), response));
+    FL_CHECK(response.empty());
+    FL_CHECK_EQ(lastSet, 99);
+}
+
+FL_TEST_CASE("Rpc: handleMsgpack errors and warnings") {
+    fl::Rpc rpc;
+    rpc.bind("add", [](int a, int b) { return a + b; });
+    rpc.bind("small", [](fl::u8 v) { return static_cast<int>(v); });
+    rpc.bind("anything", [](const fl::json& j) { return static_cast<int>(j.size()); });
+    rpc.bindAsync("later", [](fl::ResponseSend&, const fl::json&) {});
+
+    fl::vector<fl::u8> response;
+    FL_REQUIRE(rpc.handleMsgpack(msgpackRequest("nope", 1, [](fl::MsgpackWriter& w) {
+        w.writeArray(0);
+    }), response));
+    fl::json r = decodeMsgpack(response);
+    FL_CHECK_EQ(r["error"]["code"] | 0, -32601);
+    FL_CHECK_EQ(r["id"] | 0, 1);
+
+    response.clear();
+    FL_REQUIRE(rpc.handleMsgpack(msgpackRequest("add", 2, [](fl::MsgpackWriter& w) {
+        w.writeArray(1);
+        w.writeInt(1);
+    }), response));
+    r = decodeMsgpack(response);
+    FL_CHECK_EQ(r["error"]["code"] | 0, -32602);
+    FL_CHECK(r["error"]["message"].as_string().value_or("").find("count") != fl::string::npos);
+    FL_CHECK_FALSE(r.contains("result"));
+
+    response.clear();
+    FL_REQUIRE(rpc.handleMsgpack(msgpackRequest("add", 3, [](fl::MsgpackWriter& w) {
+        w.writeArray(2);
+        w.writeStr("1");
+        w.writeInt(2);
+    }), response));
+    FL_CHECK_EQ(decodeMsgpack(response)["error"]["code"] | 0, -32602);
+
+    response.clear();
+    FL_REQUIRE(rpc.handleMsgpack(msgpackRequest("small", 4, [](fl::MsgpackWriter& w) {
+        w.writeArray(1);
+        w.writeInt(300);
+    }), response));
+    r = decodeMsgpack(response);
+    FL_CHECK_EQ(r["result"] | 0, 44);
+    FL_CHECK_EQ(r["warnings"].size(), 1u);
+    FL_CHECK_EQ(r.size(), 3u);
+
+    // json parameters still work (decoded into a small tree).
+    response.clear();
+    FL_REQUIRE(rpc.handleMsgpack(msgpackRequest("anything", 5, [](fl::MsgpackWriter& w) {
+        w.writeArray(1);
+        w.writeArray(3);
+        w.writeInt(1);
+        w.writeNil();
+        w.writeStr("x");
+    }), response));
+    FL_CHECK_EQ(decodeMsgpack(response)["result"] | 0, 3);
+
+    response.clear();
+    FL_REQUIRE(rpc.handleMsgpack(msgpackRequest("later", 6, [](fl::MsgpackWriter& w) {
+        w.writeArray(0);
+    }), response));
+    FL_CHECK_EQ(decodeMsgpack(response)["error"]["code"] | 0, -32602);
+
+    // Garbage gets an Invalid Request reply with a nil id.
+    const fl::u8 junk[] = {0x01, 0x02};
+    response.clear();
+    FL_REQUIRE(rpc.handleMsgpack(fl::span<const fl::u8>(junk, sizeof(junk)), response));
+    r = decodeMsgpack(response);
+    FL_CHECK_EQ(r["error"]["code"] | 0, -32600);
+    FL_CHECK(r["id"].is_null());
+    FL_CHECK(r["error"]["message"].as_string().value_or("").find("missing") == fl::string::npos);
+
+    // A well-formed envelope without "method" says so.
+    fl::vector<fl::u8> noMethod;
+    fl::MsgpackWriter w(noMethod);
+    w.writeMap(1);
+    w.writeStr("id");
+    w.writeInt(7);
+    response.clear();
+    FL_REQUIRE(rpc.handleMsgpack(noMethod, response));
+    r = decodeMsgpack(response);
+    FL_CHECK_EQ(r["error"]["code"] | 0, -32600);
+    FL_CHECK_EQ(r["error"]["message"].as_string().value_or(""),
+                fl::string("Invalid Request: missing 'method'"));
+
+    // A method followed by a truncated field is not a missing method.
+    fl::vector<fl::u8> truncated = msgpackRequest("add", -1, [](fl::MsgpackWriter& pw) {
+        pw.writeArray(2);
+        pw.writeInt(1);
+    });
+    response.clear();
+    FL_REQUIRE(rpc.handleMsgpack(truncated, response));
+    r = decodeMsgpack(response);
+    FL_CHECK_EQ(r["error"]["code"] | 0, -32600);
+    FL_CHECK_EQ(r["error"]["message"].as_string().value_or(""),
+                fl::string("Invalid Request"));
+}
+
+FL_TEST_CASE("Remote: binary frames are answered on the binary channel") {
+    fl::vector<fl::vector<fl::u8>> inbox;
+    fl::vector<fl::vector<fl::u8>> outbox;
+    fl::vector<fl::json> jsonOut;
+    fl::vector<fl::vector<fl::u8>>* inboxPtr = &inbox;
+    fl::vector<fl::vector<fl::u8>>* outboxPtr = &outbox;
+
+    fl::Remote remote(
+        []() { return fl::optional<fl::json>(); },
+        [&jsonOut](const fl::json& response) { jsonOut.push_back(response); });
+    remote.setBinaryRequestSource([inboxPtr]() -> fl::optional<fl::vector<fl::u8>> {
+        if (inboxPtr->empty()) {
+            return fl::nullopt;
+        }
+        fl::vector<fl::u8> frame = (*inboxPtr)[0];
+        inboxPtr->erase(inboxPtr->begin());
+        return frame;
+    });
+    remote.setBinaryResponseSink([outboxPtr](fl::span<const fl::u8> frame) {
+        outboxPtr->push_back(fl::vector<fl::u8>(frame.data(), frame.data() + frame.size()));
+    });
+    remote.bind("mul", [](int a, int b) { return a * b; });
+
+    inbox.push_back(msgpackRequest("mul", 8, [](fl::MsgpackWriter& w) {
+        w.writeArray(2);
+        w.writeInt(6);
+        w.writeInt(7);
+    }));
+    inbox.push_back(msgpackRequest("mul", -1, [](fl::MsgpackWriter& w) {
+        w.writeArray(2);
+        w.writeInt(1);
+        w.writeInt(1);
+    }));
+    remote.update(0);
+
+    FL_CHECK(inbox.empty());
+    FL_CHECK(jsonOut.empty());
+    FL_REQUIRE_EQ(outbox.size(), 1u);
+    fl::json r = decodeMsgpack(outbox[0]);
+    FL_CHECK_EQ(r["id"] | 0, 8);
+    FL_CHECK_EQ(r["result"] | 0, 42);
+}
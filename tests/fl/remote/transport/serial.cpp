@@ -2,6 +2,8 @@
 // Tests for serial transport layer optimizations
 
 #include "fl/remote/transport/serial.h"
+#include "fl/remote/remote.h"
+#include "fl/remote/rpc/response_send.h"
 #include "test.h"
 
 FL_TEST_FILE(FL_FILEPATH) {
@@ -219,6 +221,277 @@ FL_TEST_CASE("Serial: createSerialResponseStreamSink - streams framed JSON") {
     FL_CHECK_EQ(parsed["result"].size(), 64);
 }
 
+// =============================================================================
+// Binary Frame Tests
+// =============================================================================
+
+namespace {
+
+struct ScriptedBytes {
+    fl::vector<fl::u8> data;
+    fl::size pos = 0;
+    fl::size limit = 0;  // bytes released so far (simulates arrival)
+    int next() {
+        if (pos >= limit || pos >= data.size()) {
+            return -1;
+        }
+        return data[pos++];
+    }
+};
+
+struct FrameCollector {
+    fl::vector<fl::u8> bytes;
+    void write(const char* data, fl::size len) {
+        bytes.insert(bytes.end(), reinterpret_cast<const fl::u8*>(data),  // ok reinterpret cast
+                     reinterpret_cast<const fl::u8*>(data) + len);  // ok reinterpret cast
+    }
+};
+
+void appendText(fl::vector<fl::u8>& out, const char* text) {
+    for (const char* p = text; *p; ++p) {
+        out.push_back(static_cast<fl::u8>(*p));
+    }
+}
+
+} // namespace
+
+FL_TEST_CASE("Serial: writeSerialFrame header layout") {
+    FrameCollector out;
+    const fl::u8 payload[] = {0x81, 0xa1, 'x', 0x01};
+    fl::writeSerialFrame(out, fl::SerialFrameType::kMsgpackRpc,
+                         fl::span<const fl::u8>(payload, sizeof(payload)));
+    const fl::u8 expected[] = {0xC1, 'M', 4, 0, 0, 0, 0x81, 0xa1, 'x', 0x01};
+    FL_REQUIRE_EQ(out.bytes.size(), sizeof(expected));
+    for (fl::size i = 0; i < sizeof(expected); ++i) {
+        FL_CHECK_EQ(out.bytes[i], expected[i]);
+    }
+}
+
+FL_TEST_CASE("Serial: SerialFrameReader demultiplexes lines and frames") {
+    ScriptedBytes script;
+    appendText(script.data, "{\"method\":\"a\"}\r\n");
+    FrameCollector frame;
+    fl::vector<fl::u8> payload(1000);
+    for (fl::size i = 0; i < payload.size(); ++i) {
+        payload[i] = static_cast<fl::u8>(i * 7);  // includes '\n' and 0xC1 bytes
+    }
+    fl::writeSerialFrame(frame, fl::SerialFrameType::kMsgpackRpc, payload);
+    script.data.insert(script.data.end(), frame.bytes.begin(), frame.bytes.end());
+    appendText(script.data, "{\"method\":\"b\"}\n");
+
+    ScriptedBytes* src = &script;
+    fl::SerialFrameReader reader([src]() { return src->next(); }, 4096);
+
+    // Bytes trickle in; partial messages survive across polls.
+    for (script.limit = 0; script.limit <= script.data.size(); script.limit += 37) {
+        reader.poll();
+    }
+    script.limit = script.data.size();
+    reader.poll();
+
+    auto first = reader.popLine();
+    FL_REQUIRE(first.has_value());
+    FL_CHECK_EQ(*first, fl::string("{\"method\":\"a\"}"));
+    auto got = reader.popFrame(fl::SerialFrameType::kMsgpackRpc);
+    FL_REQUIRE(got.has_value());
+    FL_REQUIRE_EQ(got->size(), payload.size());
+    for (fl::size i = 0; i < payload.size(); ++i) {
+        FL_CHECK_EQ((*got)[i], payload[i]);
+    }
+    auto second = reader.popLine();
+    FL_REQUIRE(second.has_value());
+    FL_CHECK_EQ(*second, fl::string("{\"method\":\"b\"}"));
+    FL_CHECK_FALSE(reader.popLine().has_value());
+    FL_CHECK_FALSE(reader.popFrame(fl::SerialFrameType::kMsgpackRpc).has_value());
+}
+
+FL_TEST_CASE("Serial: SerialFrameReader drops oversized frames") {
+    ScriptedBytes script;
+    FrameCollector big;
+    fl::vector<fl::u8> payload(200, 0x0a);
+    fl::writeSerialFrame(big, fl::SerialFrameType::kMsgpackRpc, payload);
+    script.data = big.bytes;
+    appendText(script.data, "{\"ok\":1}\n");
+    script.limit = script.data.size();
+
+    ScriptedBytes* src = &script;
+    fl::SerialFrameReader reader([src]() { return src->next(); }, 64);
+    reader.poll();
+    FL_CHECK_FALSE(reader.popFrame(fl::SerialFrameType::kMsgpackRpc).has_value());
+    auto line = reader.popLine();
+    FL_REQUIRE(line.has_value());
+    FL_CHECK_EQ(*line, fl::string("{\"ok\":1}"));
+}
+
+FL_TEST_CASE("Serial: createSerialMuxTransport splits JSON and binary requests") {
+    ScriptedBytes script;
+    appendText(script.data, "PFX: {\"method\":\"ping\",\"id\":1}\n");
+    FrameCollector frame;
+    const fl::u8 payload[] = {0x80};
+    fl::writeSerialFrame(frame, fl::SerialFrameType::kMsgpackRpc,
+                         fl::span<const fl::u8>(payload, sizeof(payload)));
+    script.data.insert(script.data.end(), frame.bytes.begin(), frame.bytes.end());
+    script.limit = script.data.size();
+
+    ScriptedBytes* src = &script;
+    fl::SerialMuxTransport t = fl::createSerialMuxTransport(
+        "REMOTE: ", "PFX: ", [src]() { return src->next(); });
+    auto binary = t.binarySource();
+    FL_REQUIRE(binary.has_value());
+    FL_CHECK_EQ(binary->size(), 1u);
+    auto request = t.source();
+    FL_REQUIRE(request.has_value());
+    FL_CHECK_EQ((*request)["method"].as_string().value_or(""), fl::string("ping"));
+    FL_CHECK_FALSE(t.source().has_value());
+    FL_CHECK_FALSE(t.binarySource().has_value());
+}
+
+FL_TEST_CASE("Serial: SerialFrameReader holds input instead of dropping lines") {
+    ScriptedBytes script;
+    for (int i = 0; i < 20; ++i) {
+        fl::string line = "{\"n\":" + fl::to_string(i) + "}\n";
+        appendText(script.data, line.c_str());
+    }
+    script.limit = script.data.size();
+
+    ScriptedBytes* src = &script;
+    fl::SerialFrameReader reader([src]() { return src->next(); }, 64, 8);
+    reader.poll();
+    FL_CHECK(reader.full());
+    FL_CHECK(script.pos < script.data.size());  // the rest is still unread
+
+    int expected = 0;
+    for (int round = 0; round < 4 && expected < 20; ++round) {
+        while (auto line = reader.popLine()) {
+            fl::string want = "{\"n\":" + fl::to_string(expected) + "}";
+            FL_CHECK_EQ(*line, want);
+            ++expected;
+        }
+        reader.poll();
+    }
+    FL_CHECK_EQ(expected, 20);
+}
+
+FL_TEST_CASE("Serial: SerialFrameReader skips frame types nobody pops") {
+    ScriptedBytes script;
+    FrameCollector frames;
+    const fl::u8 payload[] = {1, 2, 3};
+    for (int i = 0; i < 12; ++i) {
+        fl::writeSerialFrame(frames, fl::SerialFrameType::kPixels,
+                             fl::span<const fl::u8>(payload, sizeof(payload)));
+    }
+    script.data = frames.bytes;
+    appendText(script.data, "{\"ok\":1}\n");
+    script.limit = script.data.size();
+
+    ScriptedBytes* src = &script;
+    fl::SerialFrameReader reader([src]() { return src->next(); }, 64, 4);
+    reader.poll();
+    FL_CHECK_FALSE(reader.full());
+    FL_CHECK(reader.popLine().has_value());
+}
+
+FL_TEST_CASE("Serial: pipelined burst through the mux reaches fl::Remote intact") {
+    ScriptedBytes script;
+    for (int id = 1; id <= 20; ++id) {
+        fl::string line = "{\"method\":\"inc\",\"params\":[],\"id\":" + fl::to_string(id) + "}\n";
+        appendText(script.data, line.c_str());
+    }
+    script.limit = script.data.size();  // the whole burst is already buffered
+
+    ScriptedBytes* src = &script;
+    fl::SerialMuxTransport t = fl::createSerialMuxTransport(
+        "REMOTE: ", "", [src]() { return src->next(); });
+    fl::vector<fl::json> responses;
+    fl::vector<fl::json>* out = &responses;
+    fl::Remote remote(t.source, [out](const fl::json& r) { out->push_back(r); });
+    int count = 0;
+    remote.bind("inc", [&count]() { return ++count; });
+
+    for (int i = 0; i < 5 && responses.size() < 20; ++i) {
+        remote.update(static_cast<fl::u32>(i));
+    }
+
+    FL_CHECK_EQ(count, 20);
+    FL_REQUIRE_EQ(responses.size(), 20u);
+    for (int i = 0; i < 20; ++i) {
+        FL_CHECK_EQ(responses[i]["id"] | 0, i + 1);
+        FL_CHECK_EQ(responses[i]["result"] | 0, i + 1);
+    }
+}
+
+FL_TEST_CASE("Serial: batch elements count against maxInFlight over the mux") {
+    ScriptedBytes script;
+    fl::string batch = "[";
+    for (int id = 1; id <= 6; ++id) {
+        if (id > 1) {
+            batch += ",";
+        }
+        batch += "{\"method\":\"inc\",\"params\":[],\"id\":" + fl::to_string(id) + "}";
+    }
+    batch += "]\n";
+    appendText(script.data, batch.c_str());
+    appendText(script.data, "{\"method\":\"inc\",\"params\":[],\"id\":7}\n");
+    script.limit = script.data.size();
+
+    ScriptedBytes* src = &script;
+    fl::SerialMuxTransport t = fl::createSerialMuxTransport(
+        "REMOTE: ", "", [src]() { return src->next(); });
+    fl::vector<fl::json> responses;
+    fl::vector<fl::json>* out = &responses;
+    fl::Remote remote(t.source, [out](const fl::json& r) { out->push_back(r); });
+    remote.setMaxInFlight(4);
+    int count = 0;
+    remote.bind("inc", [&count]() { return ++count; });
+
+    // The six-element batch fills the bound on its own.
+    FL_CHECK_EQ(remote.pull(), 1u);
+    FL_CHECK_EQ(count, 6);
+    FL_CHECK_EQ(remote.inFlightCount(), 6u);
+    FL_CHECK_EQ(remote.pull(), 0u);
+    remote.push();
+    FL_CHECK_EQ(remote.inFlightCount(), 0u);
+
+    remote.update(0);
+    FL_CHECK_EQ(count, 7);
+    FL_REQUIRE_EQ(responses.size(), 2u);
+    FL_CHECK_EQ(responses[0].size(), 6u);
+    FL_CHECK_EQ(responses[1]["id"] | 0, 7);
+}
+
+FL_TEST_CASE("Serial: async calls that never complete expire from maxInFlight") {
+    ScriptedBytes script;
+    appendText(script.data, "{\"method\":\"hang\",\"params\":[],\"id\":1}\n");
+    appendText(script.data, "{\"method\":\"inc\",\"params\":[],\"id\":2}\n");
+    script.limit = script.data.size();
+
+    ScriptedBytes* src = &script;
+    fl::SerialMuxTransport t = fl::createSerialMuxTransport(
+        "REMOTE: ", "", [src]() { return src->next(); });
+    fl::vector<fl::json> responses;
+    fl::vector<fl::json>* out = &responses;
+    fl::Remote remote(t.source, [out](const fl::json& r) { out->push_back(r); });
+    remote.setMaxInFlight(1, 100);
+    fl::vector<fl::ResponseSend> parked;
+    fl::vector<fl::ResponseSend>* parkedp = &parked;
+    remote.bindAsync("hang", [parkedp](fl::ResponseSend& send, const fl::json&) {
+        parkedp->push_back(fl::move(send));  // never answered
+    });
+    int count = 0;
+    remote.bind("inc", [&count]() { return ++count; });
+
+    remote.update(1000);
+    FL_REQUIRE_EQ(parked.size(), 1u);
+    FL_CHECK_EQ(remote.inFlightCount(), 1u);
+    remote.update(1050);
+    FL_CHECK_EQ(count, 0);  // still held back behind the open call
+
+    remote.update(1100);
+    FL_CHECK_EQ(count, 1);
+    FL_CHECK_EQ(remote.inFlightCount(), 0u);
+    FL_CHECK_EQ(responses.back()["id"] | 0, 2);
+}
+
 // =============================================================================
 // String Optimization Comparison Tests
 // =============================================================================
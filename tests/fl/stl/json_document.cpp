@@ -0,0 +1,239 @@
+// Unit tests for json_document / json_ref / json_arena.
+
+#include "test.h"
+#include "fl/stl/json.h"
+#include "fl/stl/json_document.h"
+#include "fl/stl/string.h"
+#include "fl/stl/vector.h"
+
+FL_TEST_FILE(FL_FILEPATH) {
+
+using namespace fl;
+
+namespace {
+
+const char *kSample = R"({
+    "name": "strip \"A\"\n",
+    "count": 42,
+    "scale": 0.5,
+    "enabled": true,
+    "nothing": null,
+    "pins": [1, 2, 3],
+    "mixed": [1, 2.5, "x", false, null, {"k": -7}],
+    "nested": {"b": {"c": [10, 20]}, "a": "z"},
+    "empty_obj": {},
+    "empty_arr": []
+})";
+
+} // namespace
+
+FL_TEST_CASE("json_document - scalars match fl::json") {
+    json_document doc = json_document::parse(kSample);
+    json ref = json::parse(kSample);
+    FL_REQUIRE(doc.ok());
+    FL_REQUIRE(doc.is_object());
+
+    FL_CHECK_EQ(doc["count"] | 0, ref["count"] | 0);
+    FL_CHECK_EQ(doc["count"] | 0.0f, ref["count"] | 0.0f);
+    FL_CHECK_EQ(doc["scale"] | 0.0f, ref["scale"] | 0.0f);
+    FL_CHECK_EQ(doc["scale"] | 0, ref["scale"] | 0);
+    FL_CHECK_EQ(doc["enabled"] | false, ref["enabled"] | false);
+    FL_CHECK((doc["name"] | fl::string("?")) == (ref["name"] | fl::string("?")));
+    FL_CHECK_EQ(doc["name"] | 5, ref["name"] | 5);
+    FL_CHECK_EQ(doc["missing"] | 9, ref["missing"] | 9);
+    FL_CHECK_EQ(doc["nothing"] | 3, ref["nothing"] | 3);
+
+    FL_CHECK(doc["nothing"].is_null());
+    FL_CHECK(doc["missing"].is_null());
+    FL_CHECK(doc["count"].is_int());
+    FL_CHECK(doc["scale"].is_float());
+    FL_CHECK(doc["enabled"].is_bool());
+    FL_CHECK(doc["name"].is_string());
+
+    FL_CHECK_EQ(*doc["count"].as_int<u8>(), 42);
+    FL_CHECK_EQ(*doc["enabled"].as_bool(), true);
+    FL_CHECK(*doc["name"].as_string() == "strip \"A\"\n");
+    FL_CHECK(doc["name"].as_string_view() == fl::string_view("strip \"A\"\n"));
+    FL_CHECK_FALSE(doc["pins"].as_int().has_value());
+    FL_CHECK_EQ(doc["count"].as_or(0), 42);
+}
+
+FL_TEST_CASE("json_document - containers and navigation") {
+    json_document doc = json_document::parse(kSample);
+    FL_REQUIRE(doc.ok());
+
+    FL_CHECK_EQ(doc.size(), 10u);
+    FL_CHECK(doc["pins"].is_array());
+    FL_CHECK_EQ(doc["pins"].size(), 3u);
+    FL_CHECK_EQ(doc["pins"][2] | 0, 3);
+    FL_CHECK(doc["pins"][3].is_null());
+    FL_CHECK(doc["pins"][-1].is_null());
+    FL_CHECK(doc["pins"]["x"].is_null());
+    FL_CHECK(doc["count"][0].is_null());
+
+    FL_CHECK_EQ(doc["mixed"][5]["k"] | 0, -7);
+    FL_CHECK_EQ(doc["nested"]["b"]["c"][1] | 0, 20);
+    FL_CHECK(doc["nested"].contains("a"));
+    FL_CHECK_FALSE(doc["nested"].contains("q"));
+    FL_CHECK(doc["pins"].contains(2));
+    FL_CHECK_FALSE(doc["pins"].contains(3));
+    FL_CHECK(doc["empty_obj"].is_object());
+    FL_CHECK_EQ(doc["empty_obj"].size(), 0u);
+    FL_CHECK(doc["empty_arr"].is_array());
+    FL_CHECK(doc["empty_arr"].begin() == doc["empty_arr"].end());
+
+    fl::string key("count");
+    FL_CHECK_EQ(doc[key] | 0, 42);
+
+    float pins[4] = {0, 0, 0, 0};
+    FL_CHECK_EQ(doc["pins"].copy_to(fl::span<float>(pins, 4)), 3u);
+    FL_CHECK_EQ(pins[1], 2.0f);
+    FL_CHECK_EQ(doc["mixed"].copy_to(fl::span<float>(pins, 4)), 2u);
+    FL_CHECK_EQ(pins[1], 2.5f);
+
+    fl::optional<fl::vector<int>> v = doc["pins"].try_as<fl::vector<int>>();
+    FL_REQUIRE(v.has_value());
+    FL_CHECK_EQ(v->size(), 3u);
+    FL_CHECK_EQ((*v)[0], 1);
+}
+
+FL_TEST_CASE("json_document - member iteration matches fl::json order") {
+    json_document doc = json_document::parse(kSample);
+    json ref = json::parse(kSample);
+    fl::vector<fl::string> keys = ref.keys();
+
+    fl::size i = 0;
+    for (json_ref_member m : doc.root()) {
+        FL_REQUIRE(i < keys.size());
+        FL_CHECK(fl::string(m.key.data(), m.key.size()) == keys[i]);
+        ++i;
+    }
+    FL_CHECK_EQ(i, keys.size());
+
+    int sum = 0;
+    for (json_ref_member m : doc["pins"]) {
+        FL_CHECK(m.key.empty());
+        sum += m.value | 0;
+    }
+    FL_CHECK_EQ(sum, 6);
+}
+
+FL_TEST_CASE("json_document - numeric arrays pack like fl::json") {
+    const char *text = R"({"u8": [0, 255], "i16": [-5, 300], "f": [1, 2.5],
+                          "big": [70000, 1], "huge": [1, 99999999], "s": [1, "a"]})";
+    json_document doc = json_document::parse(text);
+    json ref = json::parse(text);
+    FL_REQUIRE(doc.ok());
+    const char *keys[] = {"u8", "i16", "f", "big", "huge", "s"};
+    for (const char *k : keys) {
+        FL_CHECK(doc[k].is_array());
+        FL_CHECK_EQ(doc[k].size(), ref[k].size());
+        for (fl::size i = 0; i < doc[k].size(); ++i) {
+            FL_CHECK_EQ(doc[k][i].is_int(), ref[k][i].is_int());
+            FL_CHECK_EQ(doc[k][i].is_float(), ref[k][i].is_float());
+            FL_CHECK_EQ(doc[k][i] | 0, ref[k][i] | 0);
+            FL_CHECK_EQ(doc[k][i] | 0.0f, ref[k][i] | 0.0f);
+        }
+    }
+    FL_CHECK(doc.to_json().to_string() == ref.to_string());
+
+    int sum = 0;
+    for (json_ref_member m : doc["i16"]) {
+        sum += m.value | 0;
+    }
+    FL_CHECK_EQ(sum, 295);
+    i16 out[2];
+    FL_CHECK_EQ(doc["i16"].copy_to(fl::span<i16>(out, 2)), 2u);
+    FL_CHECK_EQ(out[1], 300);
+}
+
+FL_TEST_CASE("json_document - duplicate keys keep the last value") {
+    json_document doc = json_document::parse(R"({"a": 1, "b": 2, "a": 3})");
+    FL_REQUIRE(doc.ok());
+    FL_CHECK_EQ(doc.size(), 2u);
+    FL_CHECK_EQ(doc["a"] | 0, 3);
+    FL_CHECK_EQ(doc["a"] | 0, json::parse(R"({"a": 1, "b": 2, "a": 3})")["a"] | 0);
+}
+
+FL_TEST_CASE("json_document - to_json round-trips") {
+    json_document doc = json_document::parse(kSample);
+    json ref = json::parse(kSample);
+    FL_CHECK(doc.to_json().to_string() == ref.to_string());
+    FL_CHECK(doc["nested"].to_string() == ref["nested"].to_string());
+}
+
+FL_TEST_CASE("json_document - invalid input and scalar roots") {
+    FL_CHECK_FALSE(json_document::parse("").ok());
+    FL_CHECK_FALSE(json_document::parse("{\"a\": 1").ok());
+    FL_CHECK_FALSE(json_document::parse("[1, 2").ok());
+    FL_CHECK(json_document::parse("{\"a\": 1}").ok());
+    FL_CHECK(json_document().is_null());
+    FL_CHECK_EQ(json_document().arena().block_count(), 0u);
+
+    json_document n = json_document::parse("17");
+    FL_REQUIRE(n.ok());
+    FL_CHECK_EQ(n | 0, 17);
+}
+
+FL_TEST_CASE("json_document - parse_owned outlives the source") {
+    json_document doc;
+    {
+        fl::string text("{\"key\": \"value\", \"k\\\"2\": [1]}");
+        doc = json_document::parse_owned(text);
+        text = "{\"overwritten\": true, \"filler\": \"xxxxxxxx\"}";
+    }
+    FL_REQUIRE(doc.ok());
+    FL_CHECK((doc["key"] | fl::string()) == "value");
+    FL_CHECK_EQ(doc["k\"2"][0] | 0, 1);
+
+    json_document moved(fl::move(doc));
+    FL_CHECK_FALSE(doc.ok());
+    FL_CHECK(moved["key"].as_string_view() == "value");
+}
+
+FL_TEST_CASE("json_document - large document uses few arena blocks") {
+    fl::string text("[");
+    for (int i = 0; i < 2000; ++i) {
+        if (i) {
+            text += ",";
+        }
+        text += "{\"id\":";
+        text += i;
+        text += ",\"v\":[1,2,3]}";
+    }
+    text += "]";
+
+    json_document doc = json_document::parse(text);
+    FL_REQUIRE(doc.ok());
+    FL_CHECK_EQ(doc.size(), 2000u);
+    FL_CHECK_EQ(doc[1999]["id"] | 0, 1999);
+    FL_CHECK_EQ(doc[7]["v"][2] | 0, 3);
+    FL_CHECK(doc.arena().block_count() < 16u);
+    FL_CHECK(doc.arena().bytes_used() <= doc.arena().bytes_reserved());
+}
+
+FL_TEST_CASE("json_arena - alignment, oversize blocks and release") {
+    json_arena arena(256);
+    void *a = arena.allocate(3);
+    void *b = arena.allocate(5);
+    FL_REQUIRE(a != nullptr);
+    FL_REQUIRE(b != nullptr);
+    FL_CHECK_EQ(reinterpret_cast<fl::uptr>(a) % 8, 0u);
+    FL_CHECK_EQ(reinterpret_cast<fl::uptr>(b) % 8, 0u);
+    FL_CHECK_EQ(arena.block_count(), 1u);
+    FL_CHECK(arena.allocate(0) == nullptr);
+
+    // A request larger than a block gets its own; the current block stays
+    // in use for the next small allocation.
+    void *big = arena.allocate(4096);
+    FL_REQUIRE(big != nullptr);
+    FL_CHECK_EQ(arena.block_count(), 2u);
+    char *c = static_cast<char *>(arena.allocate(8));
+    FL_CHECK(c == static_cast<char *>(b) + 8);
+
+    arena.release();
+    FL_CHECK_EQ(arena.block_count(), 0u);
+    FL_CHECK_EQ(arena.bytes_reserved(), 0u);
+}
+
+} // FL_TEST_FILE
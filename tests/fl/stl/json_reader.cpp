@@ -0,0 +1,250 @@
+// Unit tests for json_reader (pull JSON reader).
+
+#include "test.h"
+#include "fl/stl/json.h"
+#include "fl/stl/json_reader.h"
+#include "fl/stl/string.h"
+#include "fl/stl/vector.h"
+
+FL_TEST_FILE(FL_FILEPATH) {
+
+using namespace fl;
+
+namespace {
+
+const char *kScreenMap = R"({
+  "map": {
+    "strip0": {"x": [0, 1, 2], "y": [5, 5, 5], "diameter": 0.25},
+    "blob": "\"quoted\" \\ and a long-ish value that must be skipped cleanly",
+    "strip1": {"x": [1.5, -2, 3e2, 40000], "y": [0, 0, 0, 0], "diameter": 0.5}
+  },
+  "name": "tab\there",
+  "fps": 60,
+  "enabled": true,
+  "odd/key~": [null, {"deep": [[1], [2, [3]]]}]
+})";
+
+// Source that hands out at most `chunk` bytes per call.
+struct ChunkedSource {
+    fl::string_view text;
+    fl::size pos;
+    fl::size chunk;
+    fl::size operator()(char *dst, fl::size max) {
+        fl::size n = text.size() - pos;
+        n = n < chunk ? n : chunk;
+        n = n < max ? n : max;
+        for (fl::size i = 0; i < n; ++i) {
+            dst[i] = text[pos + i];
+        }
+        pos += n;
+        return n;
+    }
+};
+
+void checkScreenMap(json_reader &r) {
+    fl::vector<float> x;
+    FL_REQUIRE(r.find("/map/strip0/x"));
+    FL_CHECK(r.pointer() == "/map/strip0/x");
+    FL_REQUIRE(r.read(x));
+    FL_REQUIRE_EQ(x.size(), 3u);
+    FL_CHECK_EQ(x[2], 2.0f);
+
+    FL_REQUIRE(r.find("/map/strip1/x"));
+    FL_REQUIRE(r.read(x));
+    FL_REQUIRE_EQ(x.size(), 4u);
+    FL_CHECK_EQ(x[0], 1.5f);
+    FL_CHECK_EQ(x[1], -2.0f);
+    FL_CHECK_EQ(x[2], 300.0f);
+    FL_CHECK_EQ(x[3], 40000.0f);
+
+    float diameter = 0;
+    FL_REQUIRE(r.find("/map/strip1/diameter"));
+    FL_CHECK(r.read(diameter));
+    FL_CHECK_EQ(diameter, 0.5f);
+
+    fl::string name;
+    FL_REQUIRE(r.find("/name"));
+    FL_CHECK(r.read(name));
+    FL_CHECK(name == "tab\there");
+
+    int fps = 0;
+    FL_REQUIRE(r.find("/fps"));
+    FL_CHECK(r.read(fps));
+    FL_CHECK_EQ(fps, 60);
+
+    bool enabled = false;
+    FL_REQUIRE(r.find("/enabled"));
+    FL_CHECK(r.read(enabled));
+    FL_CHECK(enabled);
+
+    int deep[4] = {0, 0, 0, 0};
+    FL_REQUIRE(r.find("/odd~1key~0/1/deep/1/1"));
+    FL_CHECK_EQ(r.read_array(fl::span<int>(deep, 4)), 1u);
+    FL_CHECK_EQ(deep[0], 3);
+
+    FL_CHECK_FALSE(r.find("/missing"));
+    FL_CHECK(r.event() == json_event::kEnd);
+}
+
+} // namespace
+
+FL_TEST_CASE("json_reader - event stream and pointers") {
+    json_reader r(fl::string_view(R"({"a": [1, 2.5, "s", true, null], "b": {}})"));
+    FL_CHECK(r.next() == json_event::kBeginObject);
+    FL_CHECK(r.pointer() == "");
+    FL_CHECK(r.next() == json_event::kKey);
+    FL_CHECK(r.text() == "a");
+    FL_CHECK(r.pointer() == "/a");
+    FL_CHECK(r.next() == json_event::kBeginArray);
+    FL_CHECK_EQ(r.depth(), 2);
+    FL_CHECK(r.next() == json_event::kNumber);
+    FL_CHECK(r.pointer() == "/a/0");
+    FL_CHECK_FALSE(r.is_float());
+    FL_CHECK_EQ(r.int_value(), 1);
+    FL_CHECK(r.next() == json_event::kNumber);
+    FL_CHECK(r.is_float());
+    FL_CHECK_EQ(r.float_value(), 2.5f);
+    FL_CHECK_EQ(r.int_value(), 2);
+    FL_CHECK(r.next() == json_event::kString);
+    FL_CHECK(r.text() == "s");
+    FL_CHECK(r.next() == json_event::kBool);
+    FL_CHECK(r.bool_value());
+    FL_CHECK(r.next() == json_event::kNull);
+    FL_CHECK(r.pointer() == "/a/4");
+    FL_CHECK(r.next() == json_event::kEndArray);
+    FL_CHECK(r.pointer() == "/a");
+    FL_CHECK(r.next() == json_event::kKey);
+    FL_CHECK(r.next() == json_event::kBeginObject);
+    FL_CHECK(r.next() == json_event::kEndObject);
+    FL_CHECK(r.next() == json_event::kEndObject);
+    FL_CHECK_EQ(r.depth(), 0);
+    FL_CHECK(r.next() == json_event::kEnd);
+    FL_CHECK(r.next() == json_event::kEnd);
+}
+
+FL_TEST_CASE("json_reader - find and typed reads") {
+    json_reader r{fl::string_view(kScreenMap)};
+    checkScreenMap(r);
+}
+
+FL_TEST_CASE("json_reader - tiny buffer and byte-sized chunks") {
+    for (fl::size chunk = 1; chunk <= 7; ++chunk) {
+        char storage[32];
+        json_reader r{fl::span<char>(storage, sizeof(storage))};
+        ChunkedSource src = {fl::string_view(kScreenMap), 0, chunk};
+        ChunkedSource *srcp = &src;  // fl::function copies functors per call
+        r.set_source([srcp](char *dst, fl::size max) { return (*srcp)(dst, max); });
+        checkScreenMap(r);
+    }
+}
+
+FL_TEST_CASE("json_reader - long strings are truncated, not fatal") {
+    fl::string text("{\"blob\": \"");
+    for (int i = 0; i < 500; ++i) {
+        text += (i % 50 == 0) ? "\\\"" : "x";
+    }
+    text += "\", \"v\": 7}";
+
+    json_reader r(fl::string_view(text.c_str(), text.size()), 64);
+    FL_CHECK(r.next() == json_event::kBeginObject);
+    FL_CHECK(r.next() == json_event::kKey);
+    FL_CHECK(r.next() == json_event::kString);
+    FL_CHECK(r.truncated());
+    FL_CHECK(r.text().size() < 64u);
+    FL_CHECK(r.text()[0] == '"');
+    fl::string blob;
+    FL_CHECK(r.next() == json_event::kKey);
+    FL_CHECK(r.text() == "v");
+
+    json_reader r2(fl::string_view(text.c_str(), text.size()), 64);
+    int v = 0;
+    FL_REQUIRE(r2.find("/v"));
+    FL_CHECK(r2.read(v));
+    FL_CHECK_EQ(v, 7);
+
+    json_reader r3(fl::string_view(text.c_str(), text.size()), 64);
+    FL_REQUIRE(r3.find("/blob"));
+    FL_CHECK_FALSE(r3.read(blob));  // truncated
+}
+
+FL_TEST_CASE("json_reader - skip consumes whole containers") {
+    json_reader r(fl::string_view(R"([{"a": "]}", "b": [[{}]]}, 5])"));
+    FL_CHECK(r.next() == json_event::kBeginArray);
+    FL_CHECK(r.next() == json_event::kBeginObject);
+    FL_CHECK(r.skip());
+    FL_CHECK(r.event() == json_event::kEndObject);
+    FL_CHECK_EQ(r.depth(), 1);
+    FL_CHECK(r.next() == json_event::kNumber);
+    FL_CHECK(r.pointer() == "/1");
+    FL_CHECK(r.next() == json_event::kEndArray);
+    FL_CHECK(r.next() == json_event::kEnd);
+}
+
+FL_TEST_CASE("json_reader - typed reads agree with json::parse") {
+    json doc = json::parse(kScreenMap);
+    json_reader r{fl::string_view(kScreenMap)};
+    fl::vector<int> y;
+    FL_REQUIRE(r.find("/map/strip0/y"));
+    FL_REQUIRE(r.read(y));
+    for (fl::size i = 0; i < y.size(); ++i) {
+        FL_CHECK_EQ(y[i], doc["map"]["strip0"]["y"][i] | -1);
+    }
+    fl::vector<int> x;
+    FL_REQUIRE(r.find("/map/strip1/x"));
+    FL_REQUIRE(r.read(x));
+    for (fl::size i = 0; i < x.size(); ++i) {
+        FL_CHECK_EQ(x[i], doc["map"]["strip1"]["x"][i] | -1);
+    }
+
+    // Type mismatches fail and leave the reader past the value.
+    json_reader r2{fl::string_view(kScreenMap)};
+    fl::vector<float> notArray;
+    FL_REQUIRE(r2.find("/map/strip0"));
+    FL_CHECK_FALSE(r2.read(notArray));
+    FL_CHECK(r2.event() == json_event::kEndObject);
+    int notNumber = 0;
+    FL_REQUIRE(r2.find("/name"));
+    FL_CHECK_FALSE(r2.read(notNumber));
+    fl::vector<float> mixed;
+    FL_REQUIRE(r2.find("/odd~1key~0"));
+    FL_CHECK_FALSE(r2.read(mixed));
+    FL_CHECK(r2.next() == json_event::kEndObject);
+}
+
+FL_TEST_CASE("json_reader - malformed input") {
+    const char *bad[] = {
+        "", "{", "[1,]", "{\"a\" 1}", "{\"a\": 1,}", "[1 2]", "{\"a\": tru}",
+        "[\"unterminated", "{]", "1 2", "[1]]",
+    };
+    for (const char *text : bad) {
+        json_reader r{fl::string_view(text)};
+        json_event e = json_event::kNone;
+        for (int i = 0; i < 20; ++i) {
+            e = r.next();
+            if (e == json_event::kError || e == json_event::kEnd) {
+                break;
+            }
+        }
+        FL_CHECK_MESSAGE(e == json_event::kError, text);
+        FL_CHECK(r.error() != nullptr);
+    }
+
+    fl::string deep;
+    for (int i = 0; i < FL_JSON_READER_MAX_DEPTH + 1; ++i) {
+        deep += "[";
+    }
+    json_reader r(fl::string_view(deep.c_str(), deep.size()));
+    FL_CHECK_FALSE(r.find("/0/0/0/0/0/0/0/0/0/0/0/0/0/0/0/0/0/0/0/0/0/0/0/0/0/0/0/0/0/0/0/0/0"));
+    FL_CHECK(r.event() == json_event::kError);
+}
+
+FL_TEST_CASE("json_reader - scalar root and number forms") {
+    json_reader r(fl::string_view("  -12.5e1 "));
+    FL_REQUIRE(r.find(""));
+    float f = 0;
+    FL_CHECK(r.read(f));
+    FL_CHECK_EQ(f, -125.0f);
+    FL_CHECK(r.next() == json_event::kEnd);
+}
+
+} // FL_TEST_FILE
@@ -129,6 +129,37 @@ FL_TEST_CASE("FileSystem test with real hard drive") {
     // TestDirGuard destructor handles cleanup
 }
 
+FL_TEST_CASE("FileSystem host file handle maps file contents") {
+    fl::string test_dir = "test_filesystem_map_temp";
+    fl::string test_content = "mapped bytes";
+    TestDirGuard guard(test_dir);
+    fl::string full_path = test_dir;
+    full_path.append("/map.bin");
+    FL_REQUIRE(fl::StubFileSystem::createTextFile(full_path.c_str(), test_content.c_str()));
+    fl::setTestFileSystemRoot(test_dir.c_str());
+
+    fl::FileSystem fs;
+    FL_REQUIRE(fs.beginSd(5));
+    fl::ifstream handle = fs.openRead("map.bin");
+    FL_REQUIRE(handle.is_open());
+
+    fl::span<const fl::u8> view = handle.rdbuf()->map();
+#ifndef FL_IS_WIN
+    FL_REQUIRE_EQ(view.size(), test_content.length());
+    fl::string mapped;
+    mapped.assign(reinterpret_cast<const char*>(view.data()), view.size()); // ok reinterpret cast
+    FL_CHECK_EQ(mapped, test_content);
+    // Reads are unaffected by the mapping.
+    fl::vector<uint8_t> buffer(6);
+    FL_CHECK_EQ(handle.read(buffer.data(), buffer.size()), 6u);
+    FL_CHECK_EQ(buffer[0], 'm');
+#else
+    FL_CHECK(view.empty());
+#endif
+    handle.close();
+    fs.end();
+}
+
 FL_TEST_CASE("FileSystem test with subdirectories") {
     // Create a nested directory structure
     fl::string test_dir = "test_fs_nested";
@@ -0,0 +1,168 @@
+/// @file frame_telemetry.cpp
+/// Unit tests for fl/system/frame_telemetry.h: histogram buckets and
+/// percentiles, frame accounting, history ring and FastLED.show() hooks
+
+#include "fl/system/frame_telemetry.h"
+#include "FastLED.h"
+#include "fl/channels/channel.h"
+#include "fl/channels/config.h"
+#include "fl/channels/manager.h"
+#include "fl/chipsets/chipset_timing_config.h"
+#include "fl/stl/shared_ptr.h"
+#include "fl/stl/span.h"
+#include "platforms/stub/virtual_bus_driver.h"
+#include "test.h"
+
+FL_TEST_FILE(FL_FILEPATH) {
+
+using fl::FrameStage;
+using fl::FrameTelemetry;
+using fl::TimeHistogram;
+
+// ============================================================================
+// TimeHistogram
+// ============================================================================
+
+FL_TEST_CASE("TimeHistogram: log2 buckets") {
+    FL_CHECK_EQ(TimeHistogram::bucketFor(0), 0);
+    FL_CHECK_EQ(TimeHistogram::bucketFor(1), 1);
+    FL_CHECK_EQ(TimeHistogram::bucketFor(2), 2);
+    FL_CHECK_EQ(TimeHistogram::bucketFor(3), 2);
+    FL_CHECK_EQ(TimeHistogram::bucketFor(1000), 10);
+    FL_CHECK_EQ(TimeHistogram::bucketFor(0xFFFFFFFFu), TimeHistogram::kBuckets - 1);
+    FL_CHECK_EQ(TimeHistogram::bucketLimitUs(0), 1u);
+    FL_CHECK_EQ(TimeHistogram::bucketLimitUs(10), 1024u);
+    FL_CHECK_EQ(TimeHistogram::bucketLimitUs(TimeHistogram::kBuckets - 1), 0u);
+}
+
+FL_TEST_CASE("TimeHistogram: stats and percentiles") {
+    TimeHistogram hist;
+    FL_CHECK_EQ(hist.percentileUs(50), 0u);
+    for (int i = 0; i < 90; ++i) {
+        hist.record(100);   // bucket [64, 128)
+    }
+    for (int i = 0; i < 10; ++i) {
+        hist.record(5000);  // bucket [4096, 8192)
+    }
+    FL_CHECK_EQ(hist.count(), 100u);
+    FL_CHECK_EQ(hist.minUs(), 100u);
+    FL_CHECK_EQ(hist.maxUs(), 5000u);
+    FL_CHECK_EQ(hist.meanUs(), 590u);
+    FL_CHECK_EQ(hist.bucket(7), 90u);
+    FL_CHECK_EQ(hist.bucket(13), 10u);
+    FL_CHECK_EQ(hist.percentileUs(50), 127u);
+    FL_CHECK_EQ(hist.percentileUs(90), 127u);
+    FL_CHECK_EQ(hist.percentileUs(95), 5000u);  // capped at max
+    hist.reset();
+    FL_CHECK_EQ(hist.count(), 0u);
+    FL_CHECK_EQ(hist.maxUs(), 0u);
+}
+
+// ============================================================================
+// FrameTelemetry
+// ============================================================================
+
+FL_TEST_CASE("FrameTelemetry: per-frame and per-channel stages") {
+    FrameTelemetry t;
+    t.beginFrame(1000);
+    t.addStage(FrameStage::POWER, 10);
+    t.addStage(FrameStage::WAIT, 20);
+    t.addStage(FrameStage::WAIT, 30);
+    t.addStage(FrameStage::ENCODE, 40);
+    t.addStage(FrameStage::ENCODE, 60);
+    t.addStage(FrameStage::ENQUEUE, 5);
+    t.addStage(FrameStage::ENQUEUE, 7);
+    t.endFrame(1500);
+
+    FL_CHECK_EQ(t.frames(), 1u);
+    FL_CHECK_EQ(t.histogram(FrameStage::FRAME).count(), 1u);
+    FL_CHECK_EQ(t.histogram(FrameStage::FRAME).maxUs(), 500u);
+    FL_CHECK_EQ(t.histogram(FrameStage::DRAW).count(), 0u);  // no previous frame
+    FL_CHECK_EQ(t.histogram(FrameStage::WAIT).count(), 1u);
+    FL_CHECK_EQ(t.histogram(FrameStage::WAIT).maxUs(), 50u);
+    FL_CHECK_EQ(t.histogram(FrameStage::ENCODE).count(), 2u);
+    FL_CHECK_EQ(t.histogram(FrameStage::ENQUEUE).count(), 2u);
+
+    FrameTelemetry::FrameRecord rec[4];
+    FL_REQUIRE_EQ(t.history(fl::span<FrameTelemetry::FrameRecord>(rec)), 1u);
+    FL_CHECK_EQ(rec[0].frame, 1u);
+    FL_CHECK_EQ(rec[0].channels, 2);
+    FL_CHECK_EQ(rec[0].stageUs[static_cast<int>(FrameStage::ENCODE)], 100u);
+    FL_CHECK_EQ(rec[0].stageUs[static_cast<int>(FrameStage::FRAME)], 500u);
+
+    // Second frame measures DRAW from the previous endFrame().
+    t.beginFrame(2500);
+    t.endFrame(2600);
+    FL_CHECK_EQ(t.histogram(FrameStage::DRAW).count(), 1u);
+    FL_CHECK_EQ(t.histogram(FrameStage::DRAW).maxUs(), 1000u);
+}
+
+FL_TEST_CASE("FrameTelemetry: history ring keeps the newest frames") {
+    FrameTelemetry t;
+    const fl::u32 total = FrameTelemetry::kHistory + 5;
+    for (fl::u32 i = 0; i < total; ++i) {
+        t.beginFrame(i * 100);
+        t.endFrame(i * 100 + i);
+    }
+    FrameTelemetry::FrameRecord rec[FrameTelemetry::kHistory];
+    FL_REQUIRE_EQ(t.history(fl::span<FrameTelemetry::FrameRecord>(rec)),
+                  FrameTelemetry::kHistory);
+    FL_CHECK_EQ(rec[0].frame, 6u);
+    FL_CHECK_EQ(rec[FrameTelemetry::kHistory - 1].frame, total);
+    FL_CHECK_EQ(rec[FrameTelemetry::kHistory - 1].stageUs[0], total - 1);
+
+    FrameTelemetry::FrameRecord last[2];
+    FL_REQUIRE_EQ(t.history(fl::span<FrameTelemetry::FrameRecord>(last)), 2u);
+    FL_CHECK_EQ(last[0].frame, total - 1);
+    FL_CHECK_EQ(last[1].frame, total);
+}
+
+FL_TEST_CASE("FrameTelemetry: disabled records nothing") {
+    FrameTelemetry t;
+    t.setEnabled(false);
+    t.beginFrame(0);
+    t.addStage(FrameStage::ENCODE, 10);
+    t.endFrame(100);
+    FL_CHECK_EQ(t.frames(), 0u);
+    FL_CHECK_EQ(t.histogram(FrameStage::ENCODE).count(), 0u);
+}
+
+FL_TEST_CASE("FrameTelemetry: FastLED.show() feeds the singleton") {
+    fl::ChannelManager& mgr = fl::ChannelManager::instance();
+    auto bus = fl::make_shared<fl::stub::VirtualBusDriver>(fl::stub::VirtualBusConfig(4));
+    bus->setRealTime(false);
+    mgr.addDriver(1000, bus);
+
+    CRGB leds[2][16];
+    fl::ChannelPtr channels[2];
+    for (int i = 0; i < 2; ++i) {
+        fl::ChannelConfig config(i, fl::makeTimingConfig<fl::TIMING_WS2812_800KHZ>(),
+                                 fl::span<CRGB>(leds[i], 16), GRB);
+        channels[i] = fl::Channel::create(config);
+        FastLED.add(channels[i]);
+    }
+
+    FrameTelemetry& t = FrameTelemetry::instance();
+    t.setEnabled(true);
+    t.reset();
+    FastLED.show();
+    FastLED.show();
+
+    FL_CHECK_EQ(t.frames(), 2u);
+    FL_CHECK_EQ(t.histogram(FrameStage::FRAME).count(), 2u);
+    FL_CHECK_EQ(t.histogram(FrameStage::DRAW).count(), 1u);
+    FL_CHECK_EQ(t.histogram(FrameStage::ENCODE).count(), 4u);
+    FL_CHECK_EQ(t.histogram(FrameStage::ENQUEUE).count(), 4u);
+    FrameTelemetry::FrameRecord rec[1];
+    FL_REQUIRE_EQ(t.history(fl::span<FrameTelemetry::FrameRecord>(rec)), 1u);
+    FL_CHECK_EQ(rec[0].frame, 2u);
+    FL_CHECK_EQ(rec[0].channels, 2);
+
+    for (int i = 0; i < 2; ++i) {
+        FastLED.remove(channels[i]);
+    }
+    mgr.removeDriver(bus);
+    t.reset();
+}
+
+} // FL_TEST_FILE
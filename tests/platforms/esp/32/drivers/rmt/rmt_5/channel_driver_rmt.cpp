@@ -383,6 +383,46 @@ FL_TEST_CASE("RMT5 driver - rapid show() calls") {
     }
 }
 
+//=============================================================================
+// Test Suite: Driver-Provided Encode Buffers
+//=============================================================================
+
+FL_TEST_CASE("RMT5 driver - encodes into a leased pool buffer") {
+    resetMock();
+    auto& mock = Rmt5PeripheralMock::instance();
+    auto driver = ChannelEngineRMT::create();
+
+    auto ch = ChannelData::create(18, createWS2812Timing(), fl::vector_psram<uint8_t>());
+    fl::span<uint8_t> lease = driver->acquireEncodeBuffer(*ch, 6);
+    FL_REQUIRE(lease.size() >= 6u);
+    // Asking again before the frame is sent hands back the same buffer.
+    FL_CHECK(driver->acquireEncodeBuffer(*ch, 6).data() == lease.data());
+
+    const uint8_t frame[] = {0x10, 0x20, 0x30, 0x40, 0x50, 0x60};
+    for (size_t i = 0; i < 6; i++) {
+        lease[i] = frame[i];
+    }
+    ch->setExternalEncoded(lease.slice(0, 6));
+    FL_CHECK(ch->getData().empty());
+
+    driver->enqueue(ch);
+    driver->show();
+
+    const auto& history = mock.getTransmissionHistory();
+    FL_REQUIRE_EQ(history.size(), 1u);
+    FL_CHECK_EQ(history[0].buffer_size, 6u);
+    FL_CHECK(verifyPixelData(history[0], fl::span<const uint8_t>(frame, 6)));
+
+    mock.simulateTransmitDone(reinterpret_cast<void*>(1));
+    for (int i = 0; i < 10 && ch->isInUse(); i++) {
+        driver->poll();
+    }
+    FL_CHECK(ch->isInUse() == false);
+
+    // The transmission returned the buffer; the next frame gets a fresh lease.
+    FL_CHECK(driver->acquireEncodeBuffer(*ch, 6).size() >= 6u);
+}
+
 #endif // FASTLED_STUB_IMPL
 
 } // FL_TEST_FILE
@@ -0,0 +1,127 @@
+// ok standalone
+/// @file tests/platforms/stub/virtual_bus_driver.cpp
+/// @brief Unit tests for VirtualBusDriver
+///
+/// Tests cover:
+/// - Wire-time model for clockless and SPI channels
+/// - Lane scheduling, submit time and utilization
+/// - max_total_channels cap and published capabilities
+/// - Real-time poll() BUSY -> DRAINING -> READY and isInUse lifecycle
+
+#include "test.h"
+#include "platforms/stub/virtual_bus_driver.h"
+#include "fl/channels/config.h"
+#include "fl/channels/data.h"
+#include "fl/stl/chrono.h"
+
+using namespace fl;
+using fl::stub::VirtualBusConfig;
+using fl::stub::VirtualBusDriver;
+
+namespace {
+
+// WS2812-like: 1250 ns per bit, 280 us latch.
+ChannelDataPtr makeClockless(int pin, size_t bytes) {
+    ChipsetTimingConfig timing(250, 625, 375, 280);
+    fl::vector_psram<u8> data(bytes, 0x5A);
+    return ChannelData::create(pin, timing, fl::move(data));
+}
+
+ChannelDataPtr makeSpi(int dataPin, size_t bytes, u32 clockHz) {
+    SpiChipsetConfig spiCfg(dataPin, dataPin + 1, SpiEncoder::apa102(clockHz));
+    fl::vector_psram<u8> data(bytes, 0xA5);
+    ChipsetVariant chipset = spiCfg;
+    return ChannelData::create(chipset, fl::move(data));
+}
+
+} // namespace
+
+FL_TEST_SUITE("VirtualBusDriver") {
+
+FL_TEST_CASE("wire time follows chipset timing") {
+    // 30 bytes * 8 bits * 1.25 us + 280 us latch.
+    FL_CHECK_EQ(VirtualBusDriver::channelWireUs(*makeClockless(1, 30)), 580u);
+    // 600 bytes * 8 bits at 6 MHz.
+    FL_CHECK_EQ(VirtualBusDriver::channelWireUs(*makeSpi(2, 600, 6000000)), 800u);
+}
+
+FL_TEST_CASE("channels beyond the lane count wait for a free lane") {
+    VirtualBusDriver bus(VirtualBusConfig(2));
+    bus.setRealTime(false);
+    for (int i = 0; i < 5; ++i) {
+        bus.enqueue(makeClockless(i, 30));
+    }
+    bus.show();
+    FL_CHECK(bus.poll() == IChannelDriver::DriverState::READY);
+
+    const auto& s = bus.getStats();
+    FL_CHECK_EQ(s.frames, 1u);
+    FL_CHECK_EQ(s.channels, 5u);
+    FL_CHECK_EQ(s.lastWireUs, 3u * 580u);    // three waves
+    FL_CHECK_EQ(s.lastSubmitUs, 2u * 580u);  // fifth channel starts in wave three
+    FL_CHECK_EQ(s.laneBusyUs, 5u * 580u);
+    FL_CHECK(s.utilization() > 0.83);
+    FL_CHECK(s.utilization() < 0.84);
+    FL_CHECK(s.achievableFps() > 574.0);
+    FL_CHECK(s.achievableFps() < 575.0);
+}
+
+FL_TEST_CASE("mixed lengths pack onto the earliest free lane") {
+    VirtualBusDriver bus(VirtualBusConfig(2));
+    bus.setRealTime(false);
+    bus.enqueue(makeClockless(0, 300));        // 3280 us
+    bus.enqueue(makeClockless(1, 30));         // 580 us
+    bus.enqueue(makeSpi(2, 600, 6000000));     // 800 us, lane 1 after 580
+    bus.show();
+    FL_CHECK_EQ(bus.getStats().lastWireUs, 3280u);
+    FL_CHECK_EQ(bus.getStats().lastSubmitUs, 580u);
+}
+
+FL_TEST_CASE("max_total_channels drops the overflow") {
+    VirtualBusDriver bus(VirtualBusConfig(8, 3));
+    bus.setRealTime(false);
+    for (int i = 0; i < 5; ++i) {
+        bus.enqueue(makeClockless(i, 30));
+    }
+    bus.show();
+    FL_CHECK_EQ(bus.getStats().channels, 3u);
+    FL_CHECK_EQ(bus.getStats().channelsDropped, 2u);
+}
+
+FL_TEST_CASE("capabilities publish lanes and channel cap") {
+    VirtualBusConfig cfg(16, 32);
+    cfg.spi = false;
+    VirtualBusDriver bus(cfg);
+    FL_CHECK(bus.getName() == fl::string::from_literal("VIRTUAL"));
+    FL_CHECK(bus.getCapabilities().supportsClockless);
+    FL_CHECK_FALSE(bus.getCapabilities().supportsSpi);
+    FL_CHECK_EQ(bus.getDriverCapabilities().max_total_channels, 32);
+    FL_REQUIRE_EQ(bus.getPinGroups().size(), 1u);
+    FL_CHECK_EQ(bus.getPinGroups()[0].max_concurrent, 16);
+    FL_CHECK(bus.canHandle(makeClockless(0, 3)));
+    FL_CHECK_FALSE(bus.canHandle(makeSpi(0, 3, 6000000)));
+}
+
+FL_TEST_CASE("real time: BUSY until submitted, DRAINING until latched") {
+    VirtualBusDriver bus(VirtualBusConfig(1));
+    ChannelDataPtr a = makeClockless(0, 30);
+    ChannelDataPtr b = makeClockless(1, 30);
+    bus.enqueue(a);
+    bus.enqueue(b);
+    bus.show();
+    FL_CHECK(a->isInUse());
+    FL_CHECK(bus.poll() == IChannelDriver::DriverState::BUSY);
+
+    bool sawDraining = false;
+    const u32 t0 = fl::micros();
+    while (bus.poll() != IChannelDriver::DriverState::READY) {
+        sawDraining = sawDraining || bus.poll() == IChannelDriver::DriverState::DRAINING;
+        FL_REQUIRE(fl::micros() - t0 < 1000000u);
+    }
+    FL_CHECK(sawDraining);
+    FL_CHECK(fl::micros() - t0 >= 1100u);
+    FL_CHECK_FALSE(a->isInUse());
+    FL_CHECK_FALSE(b->isInUse());
+}
+
+}
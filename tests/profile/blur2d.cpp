@@ -0,0 +1,100 @@
+// ok standalone
+// blur2d profile: the per-pixel XYMap path (user XY function) against the
+// row-major line-buffer fast paths used for rectangular and serpentine
+// XYMaps and for Canvas.
+//
+// Usage:
+//   ./blur2d              # human-readable table
+//   ./blur2d baseline     # JSON: 64x64 serpentine blur2d, amount 64
+//   bash profile blur2d --iterations 5
+
+#include "FastLED.h"
+#include "fl/gfx/blur.h"
+#include "fl/math/xymap.h"
+#include "fl/stl/chrono.h"
+#include "fl/stl/int.h"
+#include "fl/stl/span.h"
+#include "fl/stl/stdio.h"
+#include "profile_result.h"
+
+namespace {
+
+constexpr int kMaxSide = 128;
+constexpr int kIterations = 500;
+
+CRGB gLeds[kMaxSide * kMaxSide];
+
+fl::u16 xySerpentineFn(fl::u16 x, fl::u16 y, fl::u16 w, fl::u16 h) {
+    return fl::xy_serpentine(x, y, w, h);
+}
+
+void refill(int n, int frame) {
+    for (int i = 0; i < n; ++i) {
+        gLeds[i] = CRGB(static_cast<fl::u8>(i * 7 + frame), static_cast<fl::u8>(i * 13),
+                        static_cast<fl::u8>(255 - i - frame));
+    }
+}
+
+// ns per pixel for one blur call. Repeated blurs fade towards black, which
+// does not change the work done per pixel.
+template <typename Fn>
+double nsPerPixel(int side, Fn fn) {
+    const int n = side * side;
+    refill(n, 0);
+    for (int i = 0; i < 20; ++i) {
+        fn();
+    }
+    const fl::u32 t0 = fl::micros();
+    for (int i = 0; i < kIterations; ++i) {
+        fn();
+    }
+    const fl::u32 elapsed = fl::micros() - t0;
+    return 1000.0 * static_cast<double>(elapsed) / (static_cast<double>(kIterations) * n);
+}
+
+void runSide(int side) {
+    const fl::u8 s = static_cast<fl::u8>(side);
+    const int n = side * side;
+    fl::span<CRGB> leds(gLeds, n);
+    const fl::XYMap fnMap = fl::XYMap::constructWithUserFunction(s, s, xySerpentineFn);
+    const fl::XYMap serpMap = fl::XYMap::constructSerpentine(s, s);
+    const fl::XYMap rectMap = fl::XYMap::constructRectangularGrid(s, s);
+    fl::gfx::Canvas<CRGB> canvas(leds, side, side);
+
+    const double generic = nsPerPixel(side, [&]() { fl::gfx::blur2d(leds, s, s, 64, fnMap); });
+    const double serp = nsPerPixel(side, [&]() { fl::gfx::blur2d(leds, s, s, 64, serpMap); });
+    const double rect = nsPerPixel(side, [&]() { fl::gfx::blur2d(leds, s, s, 64, rectMap); });
+    const double canv = nsPerPixel(side, [&]() { fl::gfx::blur2d(canvas, fl::alpha8(64)); });
+    const double gauss = nsPerPixel(side, [&]() { fl::gfx::blurGaussian<1, 1>(canvas); });
+
+    fl::printf("%4dx%-4d %9.2f %9.2f %9.2f %9.2f %9.2f   (serpentine %.1fx)\n", side, side,
+               generic, serp, rect, canv, gauss, generic / serp);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc > 1) {
+        const fl::XYMap serpMap = fl::XYMap::constructSerpentine(64, 64);
+        fl::span<CRGB> leds(gLeds, 64 * 64);
+        refill(64 * 64, 0);
+        const fl::u32 t0 = fl::micros();
+        for (int i = 0; i < kIterations; ++i) {
+            fl::gfx::blur2d(leds, 64, 64, 64, serpMap);
+        }
+        const fl::u32 elapsed = fl::micros() - t0;
+        ProfileResultBuilder result(argv[1], "blur2d");
+        result.add_timing(kIterations, elapsed);
+        result.print();
+        return 0;
+    }
+
+    fl::printf("blur2d, amount 64, ns per pixel\n");
+    fl::printf("%-9s %9s %9s %9s %9s %9s\n", "size", "xy fn", "serp", "rect", "canvas",
+               "gauss R1");
+    const int sides[] = {16, 32, 64, 128};
+    for (int side : sides) {
+        runSide(side);
+    }
+    return 0;
+}
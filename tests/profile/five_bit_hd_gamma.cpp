@@ -1,6 +1,7 @@
 // Performance comparison: five_bit_hd_gamma_bitshift baseline vs optimized
 // Benchmarks the span-based CRGBA5 output variant which is the hot path
-// for APA102/DOTSTAR LED strips.
+// for APA102/DOTSTAR LED strips, and compares CRGBA5 + frame formatting
+// against the fused five_bit_hd_gamma_apa102_frames() encoder.
 // ok standalone
 
 #include "FastLED.h"
@@ -20,9 +21,16 @@ static const int PROFILE_ITERATIONS = 10000;
 // Volatile to prevent dead-code elimination
 volatile u8 g_sink = 0;
 
+// Wall-sized strip for the two-pass vs fused comparison
+static const int WALL_LEDS = 20000;
+static const int WALL_ITERATIONS = 200;
+
 // Test data buffers
 static CRGB g_input[NUM_LEDS];
 static CRGBA5 g_output[NUM_LEDS];
+static CRGB g_wall[WALL_LEDS];
+static CRGBA5 g_wall_gamma[WALL_LEDS];
+static u8 g_wire[WALL_LEDS * 4];
 
 static void init_test_data() {
     // Fill with realistic LED color data - mix of patterns
@@ -61,6 +69,41 @@ __attribute__((noinline)) void benchmark_baseline(int iterations) {
     g_sink = local_sink;
 }
 
+// Two-pass: full-frame CRGBA5 intermediate, then a formatting pass (BGR).
+__attribute__((noinline)) void encode_two_pass(int n) {
+    five_bit_hd_gamma_bitshift(fl::span<const CRGB>(g_wall, n), CRGB(255, 200, 180),
+                               128, fl::span<CRGBA5>(g_wall_gamma, n));
+    u8 *out = g_wire;
+    for (int i = 0; i < n; i++, out += 4) {
+        out[0] = static_cast<u8>(0xE0 | g_wall_gamma[i].brightness_5bit);
+        out[1] = g_wall_gamma[i].color.b;
+        out[2] = g_wall_gamma[i].color.g;
+        out[3] = g_wall_gamma[i].color.r;
+    }
+}
+
+// Fused: gamma, 5-bit brightness and frame bytes in one chunked pass.
+__attribute__((noinline)) void encode_fused(int n) {
+    five_bit_hd_gamma_apa102_frames(fl::span<const CRGB>(g_wall, n), CRGB(255, 200, 180),
+                                    128, EOrder::BGR, fl::span<u8>(g_wire, n * 4));
+}
+
+template <typename Fn>
+static double encode_ns_per_pixel(Fn fn, int n) {
+    const int iterations = static_cast<int>(
+        static_cast<i64>(WALL_ITERATIONS) * WALL_LEDS / n);
+    for (int i = 0; i < 5; i++) {
+        fn(n);
+    }
+    u32 t0 = ::micros();
+    for (int i = 0; i < iterations; i++) {
+        fn(n);
+        asm volatile("" : : : "memory");
+    }
+    u32 elapsed = ::micros() - t0;
+    return 1000.0 * elapsed / (static_cast<double>(iterations) * n);
+}
+
 int main(int argc, char *argv[]) {
     bool json_output = (argc > 1 && fl::strcmp(argv[1], "baseline") == 0);
 
@@ -95,6 +138,20 @@ int main(int argc, char *argv[]) {
         fl::printf("Throughput:  %.2f Mpixels/sec\n",
                    total_pixel_ops / static_cast<double>(elapsed_us));
         fl::printf("=====================================\n");
+
+        for (int i = 0; i < WALL_LEDS; i++) {
+            g_wall[i] = g_input[i % NUM_LEDS];
+        }
+        fl::printf("\nAPA102 frame encode, ns per pixel (two-pass = CRGBA5 + format)\n");
+        const int sizes[] = {NUM_LEDS, 2048, WALL_LEDS};
+        for (int n : sizes) {
+            const double two = encode_ns_per_pixel(encode_two_pass, n);
+            const double fused = encode_ns_per_pixel(encode_fused, n);
+            fl::printf("  %6d LEDs   two-pass %6.2f   fused %6.2f   (%.2fx)\n", n, two,
+                       fused, two / fused);
+        }
+        fl::printf("  two-pass intermediate: %d bytes for %d LEDs; fused: none\n",
+                   static_cast<int>(sizeof(g_wall_gamma)), WALL_LEDS);
     }
 
     return 0;
@@ -1,11 +1,14 @@
 // ok standalone
 // Memory profiling test for JSON parsers
-// Compares parse() (Legacy) vs parse2() (custom parser)
+// Compares parse() (Legacy) vs parse2() (custom parser) vs the arena-backed
+// json_document
 // Uses global allocation overrides to track ALL memory usage
 
 #include "fl/system/file_system.h"  // for filebuf, FileSystem, make_sdcard_filesystem
 #include "fl/stl/int.h"          // for size, u32, u8
 #include "fl/stl/json.h"         // for json
+#include "fl/stl/json_document.h"  // for json_document
+#include "fl/stl/chrono.h"       // for micros
 #include "fl/stl/atomic.h"   // for atomic
 #include "fl/stl/stdint.h"  // for size_t
 #include "fl/stl/map.h"      // for unsorted_map_fixed
@@ -361,8 +364,9 @@ void profile_json_memory(const char* test_name, const fl::string& json_data) {
 
     size_t parse2_peak = 0;
     size_t parse2_allocs = 0;
+    size_t parse2_retained = 0;
     {
-        json result2 = json::parse2(json_data);
+        json result2(json_value::parse2(json_data));
         if (result2.is_null()) {
             printf("❌ ERROR: Custom parse2() failed\n");
             g_tracking_enabled = false;
@@ -371,11 +375,38 @@ void profile_json_memory(const char* test_name, const fl::string& json_data) {
 
         parse2_peak = g_stats.peak_bytes.load();
         parse2_allocs = g_stats.alloc_count.load();
+        parse2_retained = g_stats.current_bytes.load();
     }
 
     g_tracking_enabled = false;
     g_stats.print_stats("Custom parse2()");
 
+    // Test 3: arena-backed json_document (borrows json_data)
+    g_stats.reset();
+    g_tracking_enabled = true;
+
+    size_t arena_peak = 0;
+    size_t arena_allocs = 0;
+    size_t arena_blocks = 0;
+    size_t arena_retained = 0;
+    {
+        json_document doc = json_document::parse(json_data);
+        if (!doc.ok()) {
+            printf("❌ ERROR: json_document::parse() failed\n");
+            g_tracking_enabled = false;
+            return;
+        }
+
+        arena_peak = g_stats.peak_bytes.load();
+        arena_allocs = g_stats.alloc_count.load();
+        arena_blocks = doc.arena().block_count();
+        arena_retained = g_stats.current_bytes.load();
+    }
+
+    g_tracking_enabled = false;
+    g_stats.print_stats("Arena json_document::parse()");
+    printf("  Arena blocks:     %zu\n", arena_blocks);
+
     // Comparison
     printf("\n");
     printf("================================================================================\n");
@@ -410,6 +441,31 @@ void profile_json_memory(const char* test_name, const fl::string& json_data) {
                extra, (alloc_ratio - 1.0) * 100.0);
     }
 
+    double arena_memory_ratio = (double)arena_peak / (double)parse2_peak;
+    printf("Peak memory:   json_document = %.1f%% of parse2()  (%zu vs %zu bytes)\n",
+           arena_memory_ratio * 100.0, arena_peak, parse2_peak);
+    printf("Retained:      json_document = %zu vs parse2() %zu bytes (live after parse)\n",
+           arena_retained, parse2_retained);
+    printf("Allocations:   json_document = %zu vs parse2() %zu allocs\n",
+           arena_allocs, parse2_allocs);
+
+    // Parse + destroy time (tracking disabled)
+    const int iterations = json_data.size() > 100000 ? 5 : 200;
+    fl::u32 t0 = fl::micros();
+    for (int i = 0; i < iterations; ++i) {
+        json r(json_value::parse2(json_data));
+        (void)r;
+    }
+    const double parse2_us = (double)(fl::micros() - t0) / iterations;
+    t0 = fl::micros();
+    for (int i = 0; i < iterations; ++i) {
+        json_document d = json_document::parse(json_data);
+        (void)d;
+    }
+    const double arena_us = (double)(fl::micros() - t0) / iterations;
+    printf("Parse time:    parse2() %.1f us, json_document %.1f us (%.1fx)\n",
+           parse2_us, arena_us, parse2_us / arena_us);
+
     printf("================================================================================\n");
     printf("\n");
 }
@@ -438,7 +494,7 @@ int test_phase1_validation() {
 
     // Phase 1 validation only - this MUST allocate ZERO heap memory
     // Use zero-copy string_view to avoid fl::string allocation
-    bool valid = json::parse2_validate_only(fl::string_view(test_json, ::strlen(test_json)));
+    bool valid = json_value::parse2_validate_only(fl::string_view(test_json, ::strlen(test_json)));
 
     g_tracking_enabled = false;
 
@@ -524,7 +580,7 @@ int main(int argc, char** argv) {
     printf("JSON MEMORY PROFILER\n");
     printf("================================================================================\n");
     printf("This profiler tracks ALL heap allocations using global malloc/free overrides.\n");
-    printf("Compares Legacy parse() vs custom parse2() memory usage.\n");
+    printf("Compares Legacy parse() vs custom parse2() vs json_document memory usage.\n");
     printf("================================================================================\n\n");
 
     int failures = 0;
@@ -0,0 +1,98 @@
+// ok standalone
+// Noise fill profile: per-pixel scalar inoise16()/inoise8() against the
+// batched row kernels (inoise16_row / inoise8_row) that the 2D fills use.
+//
+// Usage:
+//   ./noise_fill              # human-readable table
+//   ./noise_fill baseline     # JSON: 32x32 fill_raw_2dnoise16into8, 3 octaves
+//   bash profile noise_fill --iterations 5
+
+#include "FastLED.h"
+#include "noise.h"
+#include "fl/stl/chrono.h"
+#include "fl/stl/int.h"
+#include "fl/stl/stdio.h"
+#include "profile_result.h"
+
+namespace {
+
+constexpr int kWidth = 32;
+constexpr int kHeight = 32;
+constexpr int kIterations = 2000;
+
+fl::u16 gRow16[kWidth * kHeight];
+fl::u8 gRow8[kWidth * kHeight];
+fl::u8 gFill[kWidth * kHeight];
+
+__attribute__((noinline)) void scalar16(fl::u32 t) {
+    for (int y = 0; y < kHeight; ++y) {
+        for (int x = 0; x < kWidth; ++x) {
+            gRow16[y * kWidth + x] = inoise16(x * 3000u, y * 3000u, t);
+        }
+    }
+}
+
+__attribute__((noinline)) void batched16(fl::u32 t) {
+    for (int y = 0; y < kHeight; ++y) {
+        inoise16_row(gRow16 + y * kWidth, kWidth, 0, 3000, y * 3000u, t);
+    }
+}
+
+__attribute__((noinline)) void scalar8(fl::u16 t) {
+    for (int y = 0; y < kHeight; ++y) {
+        for (int x = 0; x < kWidth; ++x) {
+            gRow8[y * kWidth + x] = inoise8(static_cast<fl::u16>(x * 40), static_cast<fl::u16>(y * 40), t);
+        }
+    }
+}
+
+__attribute__((noinline)) void batched8(fl::u16 t) {
+    for (int y = 0; y < kHeight; ++y) {
+        inoise8_row(gRow8 + y * kWidth, kWidth, 0, 40, static_cast<fl::u16>(y * 40), t);
+    }
+}
+
+__attribute__((noinline)) void fill16into8(fl::u32 t) {
+    fill_raw_2dnoise16into8(gFill, kWidth, kHeight, 3, 0, 3000, 0, 3000, t);
+}
+
+template <typename Fn>
+double nsPerPixel(Fn fn) {
+    for (int i = 0; i < 50; ++i) {
+        fn(static_cast<fl::u32>(i) * 97);
+    }
+    const fl::u32 t0 = fl::micros();
+    for (int i = 0; i < kIterations; ++i) {
+        fn(static_cast<fl::u32>(i) * 97);
+    }
+    const fl::u32 elapsed = fl::micros() - t0;
+    return 1000.0 * elapsed / (static_cast<double>(kIterations) * kWidth * kHeight);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc > 1) {
+        const fl::u32 t0 = fl::micros();
+        for (int i = 0; i < kIterations; ++i) {
+            fill16into8(static_cast<fl::u32>(i) * 97);
+        }
+        const fl::u32 elapsed = fl::micros() - t0;
+        ProfileResultBuilder result(argv[1], "noise_fill");
+        result.add_timing(kIterations, elapsed);
+        result.print();
+        return 0;
+    }
+
+    const double s16 = nsPerPixel([](fl::u32 t) { scalar16(t); });
+    const double b16 = nsPerPixel([](fl::u32 t) { batched16(t); });
+    const double s8 = nsPerPixel([](fl::u32 t) { scalar8(static_cast<fl::u16>(t)); });
+    const double b8 = nsPerPixel([](fl::u32 t) { batched8(static_cast<fl::u16>(t)); });
+    const double f = nsPerPixel([](fl::u32 t) { fill16into8(t); });
+
+    fl::printf("Noise fill, %dx%d, ns per pixel\n", kWidth, kHeight);
+    fl::printf("  inoise16  scalar %6.2f  row %6.2f  (%.2fx)\n", s16, b16, s16 / b16);
+    fl::printf("  inoise8   scalar %6.2f  row %6.2f  (%.2fx)\n", s8, b8, s8 / b8);
+    fl::printf("  fill_raw_2dnoise16into8, 3 octaves: %6.2f\n", f);
+    return 0;
+}
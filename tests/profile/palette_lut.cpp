@@ -0,0 +1,101 @@
+// ok standalone
+// Palette mapping profile: per-pixel ColorFromPalette() against a compiled
+// PaletteLUT, with fixed and per-pixel brightness.
+//
+// Usage:
+//   ./palette_lut              # human-readable table
+//   ./palette_lut baseline     # JSON: 64x64 LUT map with per-pixel brightness
+//   bash profile palette_lut --iterations 5
+
+#include "FastLED.h"
+#include "fl/gfx/colorutils.h"
+#include "fl/gfx/palette_lut.h"
+#include "fl/stl/chrono.h"
+#include "fl/stl/int.h"
+#include "fl/stl/span.h"
+#include "fl/stl/stdio.h"
+#include "profile_result.h"
+
+namespace {
+
+constexpr int kPixels = 64 * 64;
+constexpr int kIterations = 2000;
+
+fl::u8 gIndex[kPixels];
+fl::u8 gBright[kPixels];
+CRGB gLeds[kPixels];
+const CRGBPalette16 gPalette = PartyColors_p;
+fl::PaletteLUT gLut;
+
+__attribute__((noinline)) void perPixel() {
+    for (int i = 0; i < kPixels; ++i) {
+        gLeds[i] = ColorFromPalette(gPalette, gIndex[i]);
+    }
+}
+
+__attribute__((noinline)) void perPixelBright() {
+    for (int i = 0; i < kPixels; ++i) {
+        gLeds[i] = ColorFromPalette(gPalette, gIndex[i], gBright[i]);
+    }
+}
+
+__attribute__((noinline)) void lutMap() {
+    gLut.map(gIndex, gLeds);
+}
+
+__attribute__((noinline)) void lutMapBright() {
+    gLut.map(gIndex, gBright, gLeds);
+}
+
+template <typename Fn>
+double nsPerPixel(Fn fn) {
+    for (int i = 0; i < 20; ++i) {
+        fn();
+    }
+    const fl::u32 t0 = fl::micros();
+    for (int i = 0; i < kIterations; ++i) {
+        fn();
+    }
+    const fl::u32 elapsed = fl::micros() - t0;
+    return 1000.0 * elapsed / (static_cast<double>(kIterations) * kPixels);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    for (int i = 0; i < kPixels; ++i) {
+        gIndex[i] = static_cast<fl::u8>(i * 7 + (i >> 6));
+        gBright[i] = static_cast<fl::u8>(i * 13);
+    }
+    gLut.compile(gPalette);
+
+    if (argc > 1) {
+        const fl::u32 t0 = fl::micros();
+        for (int i = 0; i < kIterations; ++i) {
+            lutMapBright();
+        }
+        const fl::u32 elapsed = fl::micros() - t0;
+        ProfileResultBuilder result(argv[1], "palette_lut");
+        result.add_timing(kIterations, elapsed);
+        result.print();
+        return 0;
+    }
+
+    const fl::u32 c0 = fl::micros();
+    for (int i = 0; i < kIterations; ++i) {
+        gLut.compile(i & 1 ? PartyColors_p : RainbowColors_p);
+    }
+    const double compileUs = static_cast<double>(fl::micros() - c0) / kIterations;
+    gLut.compile(gPalette);
+
+    const double p = nsPerPixel(perPixel);
+    const double l = nsPerPixel(lutMap);
+    const double pb = nsPerPixel(perPixelBright);
+    const double lb = nsPerPixel(lutMapBright);
+
+    fl::printf("Palette mapping, %d pixels, ns per pixel\n", kPixels);
+    fl::printf("  brightness 255     ColorFromPalette %6.2f  LUT %6.2f  (%.1fx)\n", p, l, p / l);
+    fl::printf("  per-pixel bright   ColorFromPalette %6.2f  LUT %6.2f  (%.1fx)\n", pb, lb, pb / lb);
+    fl::printf("  compile: %.2f us\n", compileUs);
+    return 0;
+}
@@ -0,0 +1,107 @@
+// ok standalone
+// Parallel channel-encode profile: FastLED.show() cost with many Channel-API
+// strips, serial vs. ChannelManager::setEncodeWorkers(N).
+//
+// Drives kChannels WS2812 strips through the stub clockless engine with its
+// per-bit wire simulation disabled, so the measured time is the encode stage
+// (color adjustment, dithering, wire ordering) plus dispatch -- exactly what
+// the worker pool parallelizes on host simulators.
+//
+// Usage:
+//   ./parallel_encode                 # human-readable table
+//   ./parallel_encode baseline        # JSON: serial encode
+//   ./parallel_encode parallel        # JSON: 4 encode workers
+//   bash profile parallel_encode --iterations 20
+
+#include "FastLED.h"
+#include "fl/channels/channel.h"
+#include "fl/channels/config.h"
+#include "fl/task/parallel_for.h"
+#include "fl/channels/manager.h"
+#include "fl/chipsets/chipset_timing_config.h"
+#include "fl/stl/chrono.h"
+#include "fl/stl/cstring.h"
+#include "fl/stl/int.h"
+#include "fl/stl/shared_ptr.h"
+#include "fl/stl/stdio.h"
+#include "fl/stl/vector.h"
+#include "platforms/stub/clockless_channel_engine_stub.h"
+#include "profile_result.h"
+
+namespace {
+
+constexpr int kChannels = 64;
+constexpr int kLedsPerChannel = 300;
+constexpr int kFrames = 64;
+
+CRGB gLeds[kChannels][kLedsPerChannel];
+
+/// Total microseconds for `frames` FastLED.show() calls.
+fl::u32 timeShow(int frames) {
+    const fl::u32 t0 = fl::micros();
+    for (int i = 0; i < frames; ++i) {
+        FastLED.show();
+    }
+    return fl::micros() - t0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const bool json_mode = (argc > 1);
+    const char* variant = json_mode ? argv[1] : "baseline";
+
+    fl::ChannelManager& mgr = fl::ChannelManager::instance();
+    mgr.clearAllDrivers();
+    auto engine = fl::make_shared<fl::stub::ClocklessChannelEngineStub>();
+    engine->setSimulateEdges(false);
+    mgr.addDriver(1000, engine);
+
+    fl::vector<fl::ChannelPtr> channels;
+    for (int c = 0; c < kChannels; ++c) {
+        for (int i = 0; i < kLedsPerChannel; ++i) {
+            gLeds[c][i] = CRGB(static_cast<fl::u8>(c * 3 + i),
+                               static_cast<fl::u8>(i * 7),
+                               static_cast<fl::u8>(255 - c));
+        }
+        auto timing = fl::makeTimingConfig<fl::TIMING_WS2812_800KHZ>();
+        fl::ChannelConfig config(c, timing, fl::span<CRGB>(gLeds[c], kLedsPerChannel), GRB);
+        channels.push_back(fl::Channel::create(config));
+        FastLED.add(channels.back());
+    }
+    FastLED.setMaxRefreshRate(0);
+    FastLED.setBrightness(200);  // Non-trivial scaling keeps the encoder honest.
+
+    if (json_mode) {
+        const bool parallel = fl::strcmp(variant, "parallel") == 0;
+        mgr.setEncodeWorkers(parallel ? 4 : 1);
+        timeShow(4);  // Warm-up: driver binding, buffer growth.
+        const fl::u32 elapsed = timeShow(kFrames);
+        ProfileResultBuilder::print_result(variant, "parallel_encode", kFrames, elapsed);
+        return 0;
+    }
+
+    fl::printf("Parallel encode: %d WS2812 channels x %d LEDs (stub engine, no wire sim)\n",
+               kChannels, kLedsPerChannel);
+    if (!fl::task::parallelForSupported()) {
+        fl::printf("  NOTE: FASTLED_PARALLEL_FOR=0 on this build; all rows run serially\n");
+    }
+    const fl::u8 workerCounts[] = {1, 2, 4, 8};
+    fl::u32 serialUs = 0;
+    for (fl::u8 workers : workerCounts) {
+        mgr.setEncodeWorkers(workers);
+        timeShow(4);
+        engine->resetCounters();
+        const fl::u32 elapsed = timeShow(kFrames);
+        if (workers == 1) {
+            serialUs = elapsed;
+        }
+        const fl::u32 perFrame = elapsed / kFrames;
+        fl::printf("  workers=%u  %6u us/frame  speedup %.2fx  (%u channels enqueued)\n",
+                   static_cast<unsigned>(mgr.getEncodeWorkers()),
+                   static_cast<unsigned>(perFrame),
+                   elapsed ? static_cast<double>(serialUs) / elapsed : 0.0,
+                   static_cast<unsigned>(engine->channelCount()));
+    }
+    return 0;
+}
@@ -0,0 +1,138 @@
+// ok standalone
+// Multi-lane SPI transpose profile: transpose_{8,16}lane_simd() (fl::simd
+// u8x16 movemask kernels) vs transpose_{8,16}lane_inline() (scalar reference).
+//
+// Transposes one frame of 1000 RGB LEDs per lane (3000 bytes per lane) into
+// the bit-interleaved stream that octal/hex SPI hardware clocks out, the
+// per-frame cost SPITransposer pays before every parallel SPI transmit.
+//
+// Usage:
+//   ./spi_transpose                # human-readable table (MB/s per variant)
+//   ./spi_transpose baseline       # JSON: scalar 16-lane transpose
+//   ./spi_transpose simd           # JSON: SIMD 16-lane transpose
+//   bash profile spi_transpose --iterations 20
+
+#include "FastLED.h"
+#include "fl/math/transposition.h"
+#include "fl/stl/cstring.h"
+#include "fl/stl/int.h"
+#include "fl/stl/stdio.h"
+#include "profile_result.h"
+
+using namespace fl;
+
+static const int WARMUP_FRAMES = 20;
+static const int LANE_BYTES = 1000 * 3;
+static const int PROFILE_FRAMES = 500;
+
+volatile u8 g_sink = 0;
+
+static u8 g_lanes[16][LANE_BYTES];
+static u8 g_output[16 * LANE_BYTES];
+static const u8* g_lane_ptrs[16];
+
+static void init_test_data() {
+    for (int lane = 0; lane < 16; lane++) {
+        for (int i = 0; i < LANE_BYTES; i++) {
+            g_lanes[lane][i] = static_cast<u8>((i * 37 + lane * 11 + 5) & 0xFF);
+        }
+        g_lane_ptrs[lane] = g_lanes[lane];
+    }
+}
+
+template <typename TransposeFn>
+__attribute__((noinline)) u32 run_frames(int frames, TransposeFn transpose) {
+    u8 local_sink = 0;
+    const u32 t0 = ::micros();
+    for (int f = 0; f < frames; f++) {
+        // Perturb one byte per frame so the loop body can't be hoisted.
+        g_lanes[f & 15][f % LANE_BYTES] ^= static_cast<u8>(f);
+        asm volatile("" : : : "memory");
+        transpose(g_lane_ptrs, g_output, LANE_BYTES);
+        local_sink ^= g_output[f % (16 * LANE_BYTES)];
+        asm volatile("" : "+r"(local_sink) : : "memory");
+    }
+    const u32 elapsed = ::micros() - t0;
+    g_sink = local_sink;
+    return elapsed;
+}
+
+static u32 run_scalar8(int frames) {
+    return run_frames(frames, [](const u8* const* lanes, u8* out, size_t n) {
+        transpose_8lane_inline(lanes, out, n);
+    });
+}
+
+static u32 run_simd8(int frames) {
+    return run_frames(frames, [](const u8* const* lanes, u8* out, size_t n) {
+        transpose_8lane_simd(lanes, out, n);
+    });
+}
+
+static u32 run_scalar16(int frames) {
+    return run_frames(frames, [](const u8* const* lanes, u8* out, size_t n) {
+        transpose_16lane_inline(lanes, out, n);
+    });
+}
+
+static u32 run_simd16(int frames) {
+    return run_frames(frames, [](const u8* const* lanes, u8* out, size_t n) {
+        transpose_16lane_simd(lanes, out, n);
+    });
+}
+
+/// Output megabytes per second for `lanes` x LANE_BYTES x PROFILE_FRAMES.
+static double mb_per_sec(int lanes, u32 elapsed_us) {
+    if (elapsed_us == 0) {
+        return 0.0;
+    }
+    const double bytes = static_cast<double>(lanes) * LANE_BYTES * PROFILE_FRAMES;
+    return bytes / static_cast<double>(elapsed_us);
+}
+
+static void print_row(const char* name, int lanes, u32 elapsed_us) {
+    fl::printf("%-10s %10lu %12.2f %10.1f\n", name,
+               static_cast<unsigned long>(elapsed_us),
+               static_cast<double>(elapsed_us) / PROFILE_FRAMES,
+               mb_per_sec(lanes, elapsed_us));
+}
+
+int main(int argc, char* argv[]) {
+    const bool json_output = (argc > 1);
+    const bool simd_variant = json_output && fl::strcmp(argv[1], "simd") == 0;
+
+    init_test_data();
+    run_scalar8(WARMUP_FRAMES);
+    run_simd8(WARMUP_FRAMES);
+    run_scalar16(WARMUP_FRAMES);
+    run_simd16(WARMUP_FRAMES);
+
+    if (json_output) {
+        const u32 elapsed_us =
+            simd_variant ? run_simd16(PROFILE_FRAMES) : run_scalar16(PROFILE_FRAMES);
+        ProfileResultBuilder::print_result(simd_variant ? "simd" : "baseline",
+                                           "spi_transpose", 16 * LANE_BYTES * PROFILE_FRAMES,
+                                           elapsed_us);
+        return 0;
+    }
+
+    const u32 scalar8_us = run_scalar8(PROFILE_FRAMES);
+    const u32 simd8_us = run_simd8(PROFILE_FRAMES);
+    const u32 scalar16_us = run_scalar16(PROFILE_FRAMES);
+    const u32 simd16_us = run_simd16(PROFILE_FRAMES);
+
+    fl::printf("\n=== SPI multi-lane transpose ===\n\n");
+    fl::printf("Config: %d bytes/lane x %d frames\n", LANE_BYTES, PROFILE_FRAMES);
+    fl::printf("%-10s %10s %12s %10s\n", "variant", "total us", "us/frame", "MB/s");
+    print_row("scalar8", 8, scalar8_us);
+    print_row("simd8", 8, simd8_us);
+    print_row("scalar16", 16, scalar16_us);
+    print_row("simd16", 16, simd16_us);
+    if (simd8_us > 0 && simd16_us > 0) {
+        fl::printf("Speedup: 8-lane %.2fx, 16-lane %.2fx\n",
+                   static_cast<double>(scalar8_us) / simd8_us,
+                   static_cast<double>(scalar16_us) / simd16_us);
+    }
+    fl::printf("================================\n");
+    return 0;
+}
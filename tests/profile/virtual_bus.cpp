@@ -0,0 +1,148 @@
+// ok standalone
+// Virtual LED bus capacity profile: FastLED.show() through VirtualBusDriver,
+// which holds each frame on a modelled wire for as long as real hardware would.
+//
+// Sweeps strip count x strip length for a few lane counts (4 = ESP32-S3 RMT,
+// 8 = ESP32 RMT / octal SPI, 16 = PARLIO / hex SPI class hardware) and reports
+// per configuration:
+//   - measured FPS and mean FastLED.show() time (encode + waiting on the bus)
+//   - wire-limited FPS (zero CPU cost)
+//   - modelled show() blocking: time until the last strip gets a lane
+//   - bus utilization: fraction of lane-time spent transmitting
+//
+// Usage:
+//   ./virtual_bus                 # human-readable sweep (WS2812, all lane counts)
+//   ./virtual_bus 8               # sweep one lane count
+//   ./virtual_bus baseline        # JSON: 16 x 300 LEDs on 8 lanes
+//   bash profile virtual_bus --iterations 5
+
+#include "FastLED.h"
+#include "fl/channels/channel.h"
+#include "fl/channels/config.h"
+#include "fl/channels/manager.h"
+#include "fl/chipsets/chipset_timing_config.h"
+#include "fl/stl/chrono.h"
+#include "fl/stl/cstdlib.h"
+#include "fl/stl/cstring.h"
+#include "fl/stl/int.h"
+#include "fl/stl/shared_ptr.h"
+#include "fl/stl/stdio.h"
+#include "fl/stl/vector.h"
+#include "platforms/stub/virtual_bus_driver.h"
+#include "profile_result.h"
+
+namespace {
+
+constexpr int kWarmupFrames = 2;
+constexpr int kFrames = 8;
+constexpr int kMaxStrips = 32;
+constexpr int kMaxLeds = 1000;
+
+const int kStripCounts[] = {1, 4, 8, 16, 32};
+const int kStripLengths[] = {100, 300, 1000};
+const fl::u8 kLaneCounts[] = {4, 8, 16};
+
+CRGB gLeds[kMaxStrips][kMaxLeds];
+
+struct RunResult {
+    double fps;
+    double showUs;
+    fl::stub::VirtualBusStats stats;
+};
+
+/// Registers `strips` WS2812 strips of `leds` LEDs on a fresh `lanes`-lane
+/// virtual bus, runs kFrames shows and tears everything down again.
+RunResult runConfig(int strips, int leds, fl::u8 lanes) {
+    fl::ChannelManager& mgr = fl::ChannelManager::instance();
+    mgr.clearAllDrivers();
+    auto bus = fl::make_shared<fl::stub::VirtualBusDriver>(fl::stub::VirtualBusConfig(lanes));
+    mgr.addDriver(1000, bus);
+
+    fl::vector<fl::ChannelPtr> channels;
+    for (int s = 0; s < strips; ++s) {
+        for (int i = 0; i < leds; ++i) {
+            gLeds[s][i] = CRGB(static_cast<fl::u8>(s * 5 + i), static_cast<fl::u8>(i * 3),
+                               static_cast<fl::u8>(255 - s));
+        }
+        auto timing = fl::makeTimingConfig<fl::TIMING_WS2812_800KHZ>();
+        fl::ChannelConfig config(s, timing, fl::span<CRGB>(gLeds[s], leds), GRB);
+        channels.push_back(fl::Channel::create(config));
+        FastLED.add(channels.back());
+    }
+
+    for (int f = 0; f < kWarmupFrames; ++f) {
+        FastLED.show();
+    }
+    mgr.waitForReady();
+    bus->resetStats();
+
+    fl::u64 showUs = 0;
+    const fl::u32 t0 = fl::micros();
+    for (int f = 0; f < kFrames; ++f) {
+        const fl::u32 s0 = fl::micros();
+        FastLED.show();
+        showUs += fl::micros() - s0;
+    }
+    mgr.waitForReady();
+    const fl::u32 elapsed = fl::micros() - t0;
+
+    RunResult result;
+    result.fps = elapsed ? 1e6 * kFrames / elapsed : 0.0;
+    result.showUs = static_cast<double>(showUs) / kFrames;
+    result.stats = bus->getStats();
+
+    for (auto& channel : channels) {
+        FastLED.remove(channel);
+    }
+    return result;
+}
+
+void printSweep(fl::u8 lanes) {
+    fl::printf("\n--- %u lanes (WS2812 800 kHz) ---\n", static_cast<unsigned>(lanes));
+    fl::printf("%7s %6s %9s %10s %9s %11s %6s\n", "strips", "leds", "fps", "show us",
+               "wire fps", "block us", "util");
+    for (int strips : kStripCounts) {
+        for (int leds : kStripLengths) {
+            const RunResult r = runConfig(strips, leds, lanes);
+            fl::printf("%7d %6d %9.1f %10.0f %9.1f %11.0f %5.0f%%\n", strips, leds, r.fps,
+                       r.showUs, r.stats.achievableFps(), r.stats.avgSubmitUs(),
+                       100.0 * r.stats.utilization());
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    FastLED.setMaxRefreshRate(0);
+
+    const int lanesArg = argc > 1 ? fl::atoi(argv[1]) : 0;
+    const bool json_mode = argc > 1 && lanesArg == 0;
+    if (json_mode) {
+        const RunResult r = runConfig(16, 300, 8);
+        ProfileResultBuilder result(argv[1], "virtual_bus");
+        result.add_timing(kFrames, static_cast<fl::u32>(1e6 * kFrames / (r.fps > 0 ? r.fps : 1)));
+        result.set("fps", r.fps);
+        result.set("show_us", r.showUs);
+        result.set("wire_fps", r.stats.achievableFps());
+        result.set("block_us", r.stats.avgSubmitUs());
+        result.set("utilization", r.stats.utilization());
+        result.print();
+        return 0;
+    }
+
+    fl::printf("Virtual bus capacity sweep: %d frames per configuration\n", kFrames);
+    fl::printf("  fps      = measured FastLED.show() rate, wire time included\n");
+    fl::printf("  show us  = mean FastLED.show() call time (encode + bus wait)\n");
+    fl::printf("  wire fps = frame rate the wire allows with zero CPU cost\n");
+    fl::printf("  block us = modelled time until the last strip gets a lane\n");
+    fl::printf("  util     = share of lane-time spent transmitting\n");
+    if (lanesArg > 0) {
+        printSweep(static_cast<fl::u8>(lanesArg));
+    } else {
+        for (fl::u8 lanes : kLaneCounts) {
+            printSweep(lanes);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,124 @@
+// ok standalone
+// Wave8 bulk expansion profile: wave8ExpandSpan() (fl::simd u8x16 select
+// kernel on SSE2 hosts) vs wave8ExpandSpan_scalar() (byte-LUT reference).
+//
+// Expands a 1000-LED RGB frame (3000 bytes -> 24 000 pulse-symbol bytes)
+// through the WS2812 LUT, the per-frame cost every clockless wave8 driver
+// pays before transposition.
+//
+// Usage:
+//   ./wave8_expand                # human-readable comparison
+//   ./wave8_expand baseline       # JSON: scalar byte loop
+//   ./wave8_expand simd           # JSON: wave8ExpandSpan()
+//   bash profile wave8_expand --iterations 20
+
+#include "FastLED.h"
+#include "fl/channels/detail/wave8.h"
+#include "fl/channels/wave8.h"
+#include "fl/chipsets/led_timing.h"
+#include "fl/stl/cstring.h"
+#include "fl/stl/int.h"
+#include "fl/stl/span.h"
+#include "fl/stl/stdio.h"
+#include "profile_result.h"
+
+using namespace fl;
+
+static const int WARMUP_FRAMES = 50;
+static const int NUM_BYTES = 1000 * 3;
+static const int PROFILE_FRAMES = 2000;
+
+volatile u8 g_sink = 0;
+
+static u8 g_input[NUM_BYTES];
+static Wave8Byte g_output[NUM_BYTES];
+static Wave8ByteExpansionLut g_lut;
+
+static void init_test_data() {
+    ChipsetTiming timing;
+    timing.T1 = TIMING_WS2812_800KHZ::T1;
+    timing.T2 = TIMING_WS2812_800KHZ::T2;
+    timing.T3 = TIMING_WS2812_800KHZ::T3;
+    buildWave8ByteExpansionLUT(buildWave8ExpansionLUT(timing), g_lut);
+    for (int i = 0; i < NUM_BYTES; i++) {
+        g_input[i] = static_cast<u8>((i * 37 + 11) & 0xFF);
+    }
+}
+
+template <typename ExpandFn>
+__attribute__((noinline)) u32 run_frames(int frames, ExpandFn expand) {
+    fl::span<const u8> input(g_input, NUM_BYTES);
+    fl::span<Wave8Byte> output(g_output, NUM_BYTES);
+    u8 local_sink = 0;
+    const u32 t0 = ::micros();
+    for (int f = 0; f < frames; f++) {
+        // Perturb one byte per frame so the loop body can't be hoisted.
+        g_input[f % NUM_BYTES] ^= static_cast<u8>(f);
+        asm volatile("" : : : "memory");
+        expand(input, g_lut, output);
+        local_sink ^= output[f % NUM_BYTES].symbols[f & 7].data;
+        asm volatile("" : "+r"(local_sink) : : "memory");
+    }
+    const u32 elapsed = ::micros() - t0;
+    g_sink = local_sink;
+    return elapsed;
+}
+
+static u32 run_scalar(int frames) {
+    return run_frames(frames, [](fl::span<const u8> in,
+                                 const Wave8ByteExpansionLut& lut,
+                                 fl::span<Wave8Byte> out) {
+        wave8ExpandSpan_scalar(in, lut, out);
+    });
+}
+
+static u32 run_simd(int frames) {
+    return run_frames(frames, [](fl::span<const u8> in,
+                                 const Wave8ByteExpansionLut& lut,
+                                 fl::span<Wave8Byte> out) {
+        wave8ExpandSpan(in, lut, out);
+    });
+}
+
+int main(int argc, char* argv[]) {
+    const bool json_output = (argc > 1);
+    const bool simd_variant = json_output && fl::strcmp(argv[1], "simd") == 0;
+
+    init_test_data();
+    run_scalar(WARMUP_FRAMES);
+    run_simd(WARMUP_FRAMES);
+
+    const int total_bytes = PROFILE_FRAMES * NUM_BYTES;
+
+    if (json_output) {
+        const u32 elapsed_us =
+            simd_variant ? run_simd(PROFILE_FRAMES) : run_scalar(PROFILE_FRAMES);
+        ProfileResultBuilder::print_result(simd_variant ? "simd" : "baseline",
+                                           "wave8_expand", total_bytes,
+                                           elapsed_us);
+        return 0;
+    }
+
+    const u32 scalar_us = run_scalar(PROFILE_FRAMES);
+    const u32 simd_us = run_simd(PROFILE_FRAMES);
+
+    fl::printf("\n=== wave8 bulk expansion ===\n\n");
+    fl::printf("Config: %d bytes x %d frames (SIMD kernel %s)\n", NUM_BYTES,
+               PROFILE_FRAMES, FL_WAVE8_EXPAND_SIMD ? "enabled" : "disabled");
+    fl::printf("%-10s %10s %12s %10s\n", "variant", "total us", "us/frame",
+               "ns/byte");
+    fl::printf("%-10s %10lu %12.2f %10.3f\n", "scalar",
+               static_cast<unsigned long>(scalar_us),
+               static_cast<double>(scalar_us) / PROFILE_FRAMES,
+               static_cast<double>(scalar_us) * 1000.0 / total_bytes);
+    fl::printf("%-10s %10lu %12.2f %10.3f\n", "simd",
+               static_cast<unsigned long>(simd_us),
+               static_cast<double>(simd_us) / PROFILE_FRAMES,
+               static_cast<double>(simd_us) * 1000.0 / total_bytes);
+    if (simd_us > 0) {
+        fl::printf("Speedup: %.2fx\n",
+                   static_cast<double>(scalar_us) / simd_us);
+    }
+    fl::printf("============================\n");
+    return 0;
+}